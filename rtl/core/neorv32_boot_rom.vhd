@@ -45,11 +45,17 @@ entity neorv32_boot_rom is
     BOOTROM_BASE : std_ulogic_vector(31 downto 0) -- boot ROM base address
   );
   port (
-    clk_i  : in  std_ulogic; -- global clock line
-    rden_i : in  std_ulogic; -- read enable
-    addr_i : in  std_ulogic_vector(31 downto 0); -- address
-    data_o : out std_ulogic_vector(31 downto 0); -- data out
-    ack_o  : out std_ulogic -- transfer acknowledge
+    clk_i       : in  std_ulogic; -- global clock line
+    -- processor bus --
+    rden_i      : in  std_ulogic; -- read enable
+    addr_i      : in  std_ulogic_vector(31 downto 0); -- address
+    data_o      : out std_ulogic_vector(31 downto 0); -- data out
+    ack_o       : out std_ulogic; -- transfer acknowledge
+    -- crossbar port (instruction fetch) --
+    xbar_rden_i : in  std_ulogic := '0'; -- read enable
+    xbar_addr_i : in  std_ulogic_vector(31 downto 0) := (others => '0'); -- address
+    xbar_data_o : out std_ulogic_vector(31 downto 0); -- data out
+    xbar_ack_o  : out std_ulogic -- transfer acknowledge
   );
 end neorv32_boot_rom;
 
@@ -69,6 +75,12 @@ architecture neorv32_boot_rom_rtl of neorv32_boot_rom is
   signal rdata  : std_ulogic_vector(31 downto 0);
   signal addr   : std_ulogic_vector(boot_rom_size_index_c-1 downto 0);
 
+  -- crossbar port --
+  signal xbar_acc_en : std_ulogic;
+  signal xbar_rden   : std_ulogic;
+  signal xbar_rdata  : std_ulogic_vector(31 downto 0);
+  signal xbar_addr   : std_ulogic_vector(boot_rom_size_index_c-1 downto 0);
+
   -- ROM - initialized with executable code --
   constant mem_rom : mem32_t(0 to boot_rom_size_c/4-1) := mem32_init_f(bootloader_init_image, boot_rom_size_c/4);
 
@@ -85,6 +97,9 @@ begin
   acc_en <= '1' when (addr_i(hi_abb_c downto lo_abb_c) = BOOTROM_BASE(hi_abb_c downto lo_abb_c)) else '0';
   addr   <= addr_i(boot_rom_size_index_c+1 downto 2); -- word aligned
 
+  xbar_acc_en <= '1' when (xbar_addr_i(hi_abb_c downto lo_abb_c) = BOOTROM_BASE(hi_abb_c downto lo_abb_c)) else '0';
+  xbar_addr   <= xbar_addr_i(boot_rom_size_index_c+1 downto 2); -- word aligned
+
 
   -- Memory Access --------------------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
@@ -103,4 +118,22 @@ begin
   ack_o  <= rden;
 
 
+  -- Crossbar Port Access -------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  -- second read port for instruction fetches via the bus switch's crossbar path --
+  xbar_file_access: process(clk_i)
+  begin
+    if rising_edge(clk_i) then
+      xbar_rden <= xbar_rden_i and xbar_acc_en;
+      if (xbar_acc_en = '1') and (xbar_rden_i = '1') then
+        xbar_rdata <= mem_rom(to_integer(unsigned(xbar_addr)));
+      end if;
+    end if;
+  end process xbar_file_access;
+
+  -- output gate --
+  xbar_data_o <= xbar_rdata when (xbar_rden = '1') else (others => '0');
+  xbar_ack_o  <= xbar_rden;
+
+
 end neorv32_boot_rom_rtl;
@@ -1,6 +1,6 @@
 -- The NEORV32 RISC-V Processor, https://github.com/stnolting/neorv32
 -- Auto-generated memory init file (for BOOTLOADER) from source file <bootloader/main.bin>
--- Size: 4068 bytes
+-- Size: 7456 bytes
 
 library ieee;
 use ieee.std_logic_1164.all;
@@ -17,7 +17,7 @@ package neorv32_bootloader_image is
     00000003 => x"80010197",
     00000004 => x"7f418193",
     00000005 => x"00000517",
-    00000006 => x"0d450513",
+    00000006 => x"0d850513",
     00000007 => x"30551073",
     00000008 => x"34151073",
     00000009 => x"30001073",
@@ -45,989 +45,1836 @@ package neorv32_bootloader_image is
     00000031 => x"fe941ce3",
     00000032 => x"80010597",
     00000033 => x"f8058593",
-    00000034 => x"80818613",
-    00000035 => x"00c5d863",
-    00000036 => x"00058023",
-    00000037 => x"00158593",
-    00000038 => x"ff5ff06f",
-    00000039 => x"00001597",
-    00000040 => x"f4858593",
-    00000041 => x"80010617",
-    00000042 => x"f5c60613",
-    00000043 => x"80010697",
-    00000044 => x"f5468693",
-    00000045 => x"00d65c63",
-    00000046 => x"00058703",
-    00000047 => x"00e60023",
-    00000048 => x"00158593",
-    00000049 => x"00160613",
-    00000050 => x"fedff06f",
-    00000051 => x"00000513",
-    00000052 => x"00000593",
-    00000053 => x"060000ef",
-    00000054 => x"34051073",
-    00000055 => x"30047073",
-    00000056 => x"10500073",
-    00000057 => x"ffdff06f",
-    00000058 => x"ff810113",
-    00000059 => x"00812023",
-    00000060 => x"00912223",
-    00000061 => x"34202473",
-    00000062 => x"02044663",
-    00000063 => x"34102473",
-    00000064 => x"00041483",
-    00000065 => x"0034f493",
-    00000066 => x"00240413",
-    00000067 => x"34141073",
-    00000068 => x"00300413",
-    00000069 => x"00941863",
-    00000070 => x"34102473",
-    00000071 => x"00240413",
-    00000072 => x"34141073",
-    00000073 => x"00012403",
-    00000074 => x"00412483",
-    00000075 => x"00810113",
-    00000076 => x"30200073",
-    00000077 => x"fd010113",
-    00000078 => x"02912223",
-    00000079 => x"800004b7",
-    00000080 => x"00048793",
-    00000081 => x"02112623",
-    00000082 => x"02812423",
-    00000083 => x"03212023",
-    00000084 => x"01312e23",
-    00000085 => x"01412c23",
-    00000086 => x"01512a23",
-    00000087 => x"01612823",
-    00000088 => x"01712623",
-    00000089 => x"01812423",
-    00000090 => x"01912223",
-    00000091 => x"0007a023",
-    00000092 => x"8001a223",
-    00000093 => x"ffff07b7",
-    00000094 => x"4b878793",
-    00000095 => x"30579073",
-    00000096 => x"00000613",
-    00000097 => x"00000593",
-    00000098 => x"00200513",
-    00000099 => x"399000ef",
-    00000100 => x"421000ef",
-    00000101 => x"00048493",
-    00000102 => x"00050863",
-    00000103 => x"00100513",
-    00000104 => x"00000593",
-    00000105 => x"44d000ef",
-    00000106 => x"00005537",
-    00000107 => x"00000613",
+    00000034 => x"80010617",
+    00000035 => x"ff060613",
+    00000036 => x"00c5d863",
+    00000037 => x"00058023",
+    00000038 => x"00158593",
+    00000039 => x"ff5ff06f",
+    00000040 => x"00002597",
+    00000041 => x"c8058593",
+    00000042 => x"80010617",
+    00000043 => x"f5860613",
+    00000044 => x"80010697",
+    00000045 => x"f5068693",
+    00000046 => x"00d65c63",
+    00000047 => x"00058703",
+    00000048 => x"00e60023",
+    00000049 => x"00158593",
+    00000050 => x"00160613",
+    00000051 => x"fedff06f",
+    00000052 => x"00000513",
+    00000053 => x"00000593",
+    00000054 => x"060000ef",
+    00000055 => x"34051073",
+    00000056 => x"30047073",
+    00000057 => x"10500073",
+    00000058 => x"ffdff06f",
+    00000059 => x"ff810113",
+    00000060 => x"00812023",
+    00000061 => x"00912223",
+    00000062 => x"34202473",
+    00000063 => x"02044663",
+    00000064 => x"34102473",
+    00000065 => x"00041483",
+    00000066 => x"0034f493",
+    00000067 => x"00240413",
+    00000068 => x"34141073",
+    00000069 => x"00300413",
+    00000070 => x"00941863",
+    00000071 => x"34102473",
+    00000072 => x"00240413",
+    00000073 => x"34141073",
+    00000074 => x"00012403",
+    00000075 => x"00412483",
+    00000076 => x"00810113",
+    00000077 => x"30200073",
+    00000078 => x"fc010113",
+    00000079 => x"02112e23",
+    00000080 => x"02812c23",
+    00000081 => x"02912a23",
+    00000082 => x"03212823",
+    00000083 => x"03312623",
+    00000084 => x"03412423",
+    00000085 => x"03512223",
+    00000086 => x"03612023",
+    00000087 => x"01712e23",
+    00000088 => x"01812c23",
+    00000089 => x"01912a23",
+    00000090 => x"01a12823",
+    00000091 => x"01b12623",
+    00000092 => x"80000537",
+    00000093 => x"00052023",
+    00000094 => x"80000537",
+    00000095 => x"00052223",
+    00000096 => x"ffff0537",
+    00000097 => x"4f050513",
+    00000098 => x"30551073",
+    00000099 => x"00200513",
+    00000100 => x"00000593",
+    00000101 => x"00000613",
+    00000102 => x"00001097",
+    00000103 => x"630080e7",
+    00000104 => x"00001097",
+    00000105 => x"590080e7",
+    00000106 => x"00050a63",
+    00000107 => x"00100513",
     00000108 => x"00000593",
-    00000109 => x"b0050513",
-    00000110 => x"23d000ef",
-    00000111 => x"1bd000ef",
-    00000112 => x"02050a63",
-    00000113 => x"1c5000ef",
-    00000114 => x"fe002783",
-    00000115 => x"0027d793",
-    00000116 => x"00a78533",
-    00000117 => x"00f537b3",
-    00000118 => x"00b785b3",
-    00000119 => x"1d9000ef",
-    00000120 => x"08000793",
-    00000121 => x"30479073",
-    00000122 => x"30046073",
-    00000123 => x"00000013",
-    00000124 => x"00000013",
-    00000125 => x"ffff1537",
-    00000126 => x"f1450513",
-    00000127 => x"2c1000ef",
-    00000128 => x"f1302573",
-    00000129 => x"244000ef",
-    00000130 => x"ffff1537",
-    00000131 => x"f4c50513",
-    00000132 => x"2ad000ef",
-    00000133 => x"fe002503",
-    00000134 => x"230000ef",
-    00000135 => x"ffff1537",
-    00000136 => x"f5450513",
-    00000137 => x"299000ef",
-    00000138 => x"30102573",
-    00000139 => x"21c000ef",
-    00000140 => x"ffff1537",
-    00000141 => x"f5c50513",
-    00000142 => x"285000ef",
-    00000143 => x"fc002573",
-    00000144 => x"208000ef",
-    00000145 => x"ffff1537",
-    00000146 => x"f6450513",
-    00000147 => x"271000ef",
-    00000148 => x"fe802503",
-    00000149 => x"ffff1437",
-    00000150 => x"1f0000ef",
-    00000151 => x"ffff1537",
-    00000152 => x"f6c50513",
-    00000153 => x"259000ef",
-    00000154 => x"ff802503",
-    00000155 => x"1dc000ef",
-    00000156 => x"f7440513",
-    00000157 => x"249000ef",
-    00000158 => x"ff002503",
-    00000159 => x"1cc000ef",
-    00000160 => x"ffff1537",
-    00000161 => x"f8050513",
-    00000162 => x"235000ef",
-    00000163 => x"ffc02503",
-    00000164 => x"1b8000ef",
-    00000165 => x"f7440513",
-    00000166 => x"225000ef",
-    00000167 => x"ff402503",
-    00000168 => x"1a8000ef",
-    00000169 => x"0d5000ef",
-    00000170 => x"06050663",
-    00000171 => x"ffff1537",
-    00000172 => x"f8850513",
-    00000173 => x"209000ef",
-    00000174 => x"0d1000ef",
-    00000175 => x"fe002403",
-    00000176 => x"00341413",
-    00000177 => x"00a40933",
-    00000178 => x"00893433",
-    00000179 => x"00b40433",
-    00000180 => x"115000ef",
-    00000181 => x"02051663",
-    00000182 => x"0b1000ef",
-    00000183 => x"fe85eae3",
-    00000184 => x"00b41463",
-    00000185 => x"ff2566e3",
-    00000186 => x"00100513",
-    00000187 => x"4d4000ef",
-    00000188 => x"ffff1537",
-    00000189 => x"fb050513",
-    00000190 => x"1c5000ef",
-    00000191 => x"0cc000ef",
-    00000192 => x"1b1000ef",
-    00000193 => x"fc050ae3",
-    00000194 => x"ffff1537",
-    00000195 => x"fb450513",
-    00000196 => x"1ad000ef",
-    00000197 => x"0a8000ef",
-    00000198 => x"ffff19b7",
-    00000199 => x"ffff1a37",
-    00000200 => x"07200a93",
-    00000201 => x"06800b13",
-    00000202 => x"07500b93",
-    00000203 => x"07300c13",
-    00000204 => x"ffff1937",
-    00000205 => x"ffff1cb7",
-    00000206 => x"fc098513",
-    00000207 => x"181000ef",
-    00000208 => x"161000ef",
-    00000209 => x"00050413",
-    00000210 => x"13d000ef",
-    00000211 => x"fb0a0513",
-    00000212 => x"16d000ef",
-    00000213 => x"01541863",
-    00000214 => x"ffff02b7",
-    00000215 => x"00028067",
-    00000216 => x"fd9ff06f",
-    00000217 => x"01641663",
-    00000218 => x"054000ef",
-    00000219 => x"fcdff06f",
-    00000220 => x"00000513",
-    00000221 => x"01740e63",
-    00000222 => x"01841663",
-    00000223 => x"680000ef",
-    00000224 => x"fb9ff06f",
-    00000225 => x"06c00793",
-    00000226 => x"00f41863",
-    00000227 => x"00100513",
-    00000228 => x"430000ef",
-    00000229 => x"fa5ff06f",
-    00000230 => x"06500793",
-    00000231 => x"00f41c63",
-    00000232 => x"0004a783",
-    00000233 => x"f4079ce3",
-    00000234 => x"ebcc8513",
-    00000235 => x"111000ef",
-    00000236 => x"f89ff06f",
-    00000237 => x"fc890513",
-    00000238 => x"ff5ff06f",
-    00000239 => x"ffff1537",
-    00000240 => x"dfc50513",
-    00000241 => x"0f90006f",
-    00000242 => x"ff010113",
-    00000243 => x"00112623",
-    00000244 => x"30047073",
-    00000245 => x"00000013",
-    00000246 => x"00000013",
-    00000247 => x"ffff1537",
-    00000248 => x"e6050513",
-    00000249 => x"0d9000ef",
-    00000250 => x"0ad000ef",
-    00000251 => x"fe051ee3",
-    00000252 => x"ff002783",
-    00000253 => x"00078067",
-    00000254 => x"0000006f",
-    00000255 => x"ff010113",
-    00000256 => x"00812423",
-    00000257 => x"00050413",
-    00000258 => x"ffff1537",
-    00000259 => x"e7050513",
-    00000260 => x"00112623",
-    00000261 => x"0a9000ef",
-    00000262 => x"03040513",
-    00000263 => x"0ff57513",
-    00000264 => x"065000ef",
-    00000265 => x"30047073",
-    00000266 => x"00000013",
-    00000267 => x"00000013",
-    00000268 => x"181000ef",
-    00000269 => x"00050863",
-    00000270 => x"00100513",
-    00000271 => x"00000593",
-    00000272 => x"1b1000ef",
-    00000273 => x"0000006f",
-    00000274 => x"fe010113",
-    00000275 => x"01212823",
-    00000276 => x"00050913",
-    00000277 => x"ffff1537",
-    00000278 => x"00912a23",
-    00000279 => x"e7c50513",
-    00000280 => x"ffff14b7",
-    00000281 => x"00812c23",
-    00000282 => x"01312623",
-    00000283 => x"00112e23",
-    00000284 => x"01c00413",
-    00000285 => x"049000ef",
-    00000286 => x"fd448493",
-    00000287 => x"ffc00993",
-    00000288 => x"008957b3",
-    00000289 => x"00f7f793",
-    00000290 => x"00f487b3",
-    00000291 => x"0007c503",
-    00000292 => x"ffc40413",
-    00000293 => x"7f0000ef",
-    00000294 => x"ff3414e3",
-    00000295 => x"01c12083",
-    00000296 => x"01812403",
-    00000297 => x"01412483",
-    00000298 => x"01012903",
-    00000299 => x"00c12983",
-    00000300 => x"02010113",
-    00000301 => x"00008067",
-    00000302 => x"fb010113",
-    00000303 => x"04112623",
-    00000304 => x"04512423",
-    00000305 => x"04612223",
-    00000306 => x"04712023",
-    00000307 => x"02812e23",
-    00000308 => x"02912c23",
-    00000309 => x"02a12a23",
-    00000310 => x"02b12823",
-    00000311 => x"02c12623",
-    00000312 => x"02d12423",
-    00000313 => x"02e12223",
-    00000314 => x"02f12023",
-    00000315 => x"01012e23",
-    00000316 => x"01112c23",
-    00000317 => x"01c12a23",
-    00000318 => x"01d12823",
-    00000319 => x"01e12623",
-    00000320 => x"01f12423",
-    00000321 => x"342024f3",
-    00000322 => x"800007b7",
-    00000323 => x"00778793",
-    00000324 => x"08f49463",
-    00000325 => x"09d000ef",
-    00000326 => x"00050663",
-    00000327 => x"00000513",
-    00000328 => x"0a1000ef",
-    00000329 => x"654000ef",
-    00000330 => x"02050063",
-    00000331 => x"65c000ef",
-    00000332 => x"fe002783",
-    00000333 => x"0027d793",
-    00000334 => x"00a78533",
-    00000335 => x"00f537b3",
-    00000336 => x"00b785b3",
-    00000337 => x"670000ef",
-    00000338 => x"03c12403",
-    00000339 => x"04c12083",
-    00000340 => x"04812283",
-    00000341 => x"04412303",
-    00000342 => x"04012383",
-    00000343 => x"03812483",
-    00000344 => x"03412503",
-    00000345 => x"03012583",
-    00000346 => x"02c12603",
-    00000347 => x"02812683",
-    00000348 => x"02412703",
-    00000349 => x"02012783",
-    00000350 => x"01c12803",
-    00000351 => x"01812883",
-    00000352 => x"01412e03",
-    00000353 => x"01012e83",
-    00000354 => x"00c12f03",
-    00000355 => x"00812f83",
-    00000356 => x"05010113",
-    00000357 => x"30200073",
-    00000358 => x"00700793",
-    00000359 => x"00f49a63",
-    00000360 => x"8041a783",
-    00000361 => x"00078663",
-    00000362 => x"00100513",
-    00000363 => x"e51ff0ef",
+    00000109 => x"00001097",
+    00000110 => x"5c0080e7",
+    00000111 => x"00005537",
+    00000112 => x"b0050513",
+    00000113 => x"00000593",
+    00000114 => x"00000613",
+    00000115 => x"00001097",
+    00000116 => x"6b8080e7",
+    00000117 => x"00001097",
+    00000118 => x"5ac080e7",
+    00000119 => x"04050063",
+    00000120 => x"00001097",
+    00000121 => x"5b0080e7",
+    00000122 => x"fe002603",
+    00000123 => x"00265613",
+    00000124 => x"00c50633",
+    00000125 => x"00a63533",
+    00000126 => x"00a585b3",
+    00000127 => x"00060513",
+    00000128 => x"00001097",
+    00000129 => x"5a4080e7",
+    00000130 => x"08000513",
+    00000131 => x"30451073",
+    00000132 => x"30046073",
+    00000133 => x"00000013",
+    00000134 => x"00000013",
+    00000135 => x"ffff2537",
+    00000136 => x"c5c50513",
+    00000137 => x"00001097",
+    00000138 => x"71c080e7",
+    00000139 => x"f1302573",
+    00000140 => x"00000097",
+    00000141 => x"450080e7",
+    00000142 => x"ffff2537",
+    00000143 => x"c0b50513",
+    00000144 => x"00001097",
+    00000145 => x"700080e7",
+    00000146 => x"fe002503",
+    00000147 => x"00000097",
+    00000148 => x"434080e7",
+    00000149 => x"ffff2537",
+    00000150 => x"b4450513",
+    00000151 => x"00001097",
+    00000152 => x"6e4080e7",
+    00000153 => x"30102573",
+    00000154 => x"00000097",
+    00000155 => x"418080e7",
+    00000156 => x"ffff2537",
+    00000157 => x"c9a50513",
+    00000158 => x"00001097",
+    00000159 => x"6c8080e7",
+    00000160 => x"fc002573",
+    00000161 => x"00000097",
+    00000162 => x"3fc080e7",
+    00000163 => x"ffff2537",
+    00000164 => x"c9250513",
+    00000165 => x"00001097",
+    00000166 => x"6ac080e7",
+    00000167 => x"fe802503",
+    00000168 => x"00000097",
+    00000169 => x"3e0080e7",
+    00000170 => x"ffff2537",
+    00000171 => x"c1350513",
+    00000172 => x"00001097",
+    00000173 => x"690080e7",
+    00000174 => x"ff802503",
+    00000175 => x"00000097",
+    00000176 => x"3c4080e7",
+    00000177 => x"ffff2537",
+    00000178 => x"b2150413",
+    00000179 => x"00040513",
+    00000180 => x"00001097",
+    00000181 => x"670080e7",
+    00000182 => x"ff002503",
+    00000183 => x"00000097",
+    00000184 => x"3a4080e7",
+    00000185 => x"ffff2537",
+    00000186 => x"c3750513",
+    00000187 => x"00001097",
+    00000188 => x"654080e7",
+    00000189 => x"ffc02503",
+    00000190 => x"00000097",
+    00000191 => x"388080e7",
+    00000192 => x"00040513",
+    00000193 => x"00001097",
+    00000194 => x"63c080e7",
+    00000195 => x"ff402503",
+    00000196 => x"00000097",
+    00000197 => x"370080e7",
+    00000198 => x"00001097",
+    00000199 => x"468080e7",
+    00000200 => x"08050e63",
+    00000201 => x"ffff2537",
+    00000202 => x"ae050513",
+    00000203 => x"00001097",
+    00000204 => x"614080e7",
+    00000205 => x"00001097",
+    00000206 => x"45c080e7",
+    00000207 => x"fe002603",
+    00000208 => x"00361613",
+    00000209 => x"00c50433",
+    00000210 => x"00a43533",
+    00000211 => x"00a584b3",
+    00000212 => x"00001097",
+    00000213 => x"524080e7",
+    00000214 => x"00050863",
+    00000215 => x"00001097",
+    00000216 => x"5b8080e7",
+    00000217 => x"04051463",
+    00000218 => x"00001097",
+    00000219 => x"428080e7",
+    00000220 => x"00958863",
+    00000221 => x"0095b533",
+    00000222 => x"fc051ce3",
+    00000223 => x"00c0006f",
+    00000224 => x"00853533",
+    00000225 => x"fc0516e3",
+    00000226 => x"00100513",
+    00000227 => x"00000097",
+    00000228 => x"36c080e7",
+    00000229 => x"ffff2537",
+    00000230 => x"c3550513",
+    00000231 => x"00001097",
+    00000232 => x"5a4080e7",
+    00000233 => x"00000097",
+    00000234 => x"5b0080e7",
+    00000235 => x"ffff2537",
+    00000236 => x"c3f50513",
+    00000237 => x"00001097",
+    00000238 => x"58c080e7",
+    00000239 => x"ffff2537",
+    00000240 => x"b8c50413",
+    00000241 => x"00040513",
+    00000242 => x"00001097",
+    00000243 => x"578080e7",
+    00000244 => x"ffff2537",
+    00000245 => x"b8450493",
+    00000246 => x"ffff2537",
+    00000247 => x"c3550913",
+    00000248 => x"07100b13",
+    00000249 => x"06500b93",
+    00000250 => x"ffff2537",
+    00000251 => x"b5950993",
+    00000252 => x"06800c93",
+    00000253 => x"ffff2537",
+    00000254 => x"b1550a13",
+    00000255 => x"07400d93",
+    00000256 => x"07200c13",
+    00000257 => x"07500d13",
+    00000258 => x"00048513",
+    00000259 => x"00001097",
+    00000260 => x"534080e7",
+    00000261 => x"00001097",
+    00000262 => x"4f0080e7",
+    00000263 => x"00050a93",
+    00000264 => x"00001097",
+    00000265 => x"4c0080e7",
+    00000266 => x"00090513",
+    00000267 => x"00001097",
+    00000268 => x"514080e7",
+    00000269 => x"035b5063",
+    00000270 => x"035dce63",
+    00000271 => x"058a8a63",
+    00000272 => x"07300513",
+    00000273 => x"08aa9a63",
+    00000274 => x"00000097",
+    00000275 => x"548080e7",
+    00000276 => x"fb9ff06f",
+    00000277 => x"057a8463",
+    00000278 => x"079a8063",
+    00000279 => x"06c00513",
+    00000280 => x"06aa9c63",
+    00000281 => x"00100513",
+    00000282 => x"00000097",
+    00000283 => x"290080e7",
+    00000284 => x"f99ff06f",
+    00000285 => x"05aa8a63",
+    00000286 => x"07800513",
+    00000287 => x"04aa9e63",
+    00000288 => x"00200513",
+    00000289 => x"00000097",
+    00000290 => x"274080e7",
+    00000291 => x"f7dff06f",
+    00000292 => x"ffff02b7",
+    00000293 => x"00028067",
+    00000294 => x"f71ff06f",
+    00000295 => x"80000537",
+    00000296 => x"00052503",
+    00000297 => x"04051263",
+    00000298 => x"00098513",
+    00000299 => x"00001097",
+    00000300 => x"494080e7",
+    00000301 => x"f55ff06f",
+    00000302 => x"00040513",
+    00000303 => x"00001097",
+    00000304 => x"484080e7",
+    00000305 => x"f45ff06f",
+    00000306 => x"00000513",
+    00000307 => x"00000097",
+    00000308 => x"22c080e7",
+    00000309 => x"f35ff06f",
+    00000310 => x"000a0513",
+    00000311 => x"00001097",
+    00000312 => x"464080e7",
+    00000313 => x"f25ff06f",
+    00000314 => x"00000097",
+    00000315 => x"46c080e7",
+    00000316 => x"fb010113",
+    00000317 => x"04112623",
+    00000318 => x"04512423",
+    00000319 => x"04612223",
+    00000320 => x"04712023",
+    00000321 => x"02812e23",
+    00000322 => x"02912c23",
+    00000323 => x"02a12a23",
+    00000324 => x"02b12823",
+    00000325 => x"02c12623",
+    00000326 => x"02d12423",
+    00000327 => x"02e12223",
+    00000328 => x"02f12023",
+    00000329 => x"01012e23",
+    00000330 => x"01112c23",
+    00000331 => x"01c12a23",
+    00000332 => x"01d12823",
+    00000333 => x"01e12623",
+    00000334 => x"01f12423",
+    00000335 => x"342024f3",
+    00000336 => x"00700513",
+    00000337 => x"06a48063",
+    00000338 => x"80000537",
+    00000339 => x"00750513",
+    00000340 => x"06a49063",
+    00000341 => x"00001097",
+    00000342 => x"1dc080e7",
+    00000343 => x"00050863",
+    00000344 => x"00000513",
+    00000345 => x"00001097",
+    00000346 => x"1dc080e7",
+    00000347 => x"00001097",
+    00000348 => x"214080e7",
+    00000349 => x"0a050863",
+    00000350 => x"00001097",
+    00000351 => x"218080e7",
+    00000352 => x"fe002603",
+    00000353 => x"00265613",
+    00000354 => x"00c50633",
+    00000355 => x"00a63533",
+    00000356 => x"00a585b3",
+    00000357 => x"00060513",
+    00000358 => x"00001097",
+    00000359 => x"20c080e7",
+    00000360 => x"0840006f",
+    00000361 => x"80000537",
+    00000362 => x"00452503",
+    00000363 => x"0c051463",
     00000364 => x"34102473",
-    00000365 => x"630000ef",
-    00000366 => x"04050263",
-    00000367 => x"ffff1537",
-    00000368 => x"e8050513",
-    00000369 => x"6f8000ef",
-    00000370 => x"00048513",
-    00000371 => x"e7dff0ef",
-    00000372 => x"02000513",
-    00000373 => x"6b0000ef",
-    00000374 => x"00040513",
-    00000375 => x"e6dff0ef",
-    00000376 => x"02000513",
-    00000377 => x"6a0000ef",
-    00000378 => x"34302573",
-    00000379 => x"e5dff0ef",
-    00000380 => x"ffff1537",
-    00000381 => x"e8850513",
-    00000382 => x"6c4000ef",
-    00000383 => x"00440413",
-    00000384 => x"34141073",
-    00000385 => x"f45ff06f",
-    00000386 => x"ff010113",
-    00000387 => x"00000513",
-    00000388 => x"00112623",
-    00000389 => x"00812423",
-    00000390 => x"740000ef",
-    00000391 => x"09e00513",
-    00000392 => x"77c000ef",
-    00000393 => x"00000513",
-    00000394 => x"774000ef",
-    00000395 => x"00050413",
-    00000396 => x"00000513",
-    00000397 => x"744000ef",
-    00000398 => x"00c12083",
-    00000399 => x"0ff47513",
-    00000400 => x"00812403",
-    00000401 => x"01010113",
-    00000402 => x"00008067",
-    00000403 => x"ff010113",
-    00000404 => x"00112623",
-    00000405 => x"00812423",
-    00000406 => x"00000513",
-    00000407 => x"6fc000ef",
-    00000408 => x"00500513",
-    00000409 => x"738000ef",
-    00000410 => x"00000513",
-    00000411 => x"730000ef",
-    00000412 => x"00050413",
-    00000413 => x"00147413",
-    00000414 => x"00000513",
-    00000415 => x"6fc000ef",
-    00000416 => x"fc041ce3",
-    00000417 => x"00c12083",
-    00000418 => x"00812403",
-    00000419 => x"01010113",
-    00000420 => x"00008067",
-    00000421 => x"ff010113",
-    00000422 => x"00000513",
-    00000423 => x"00112623",
-    00000424 => x"6b8000ef",
-    00000425 => x"00600513",
-    00000426 => x"6f4000ef",
-    00000427 => x"00c12083",
-    00000428 => x"00000513",
-    00000429 => x"01010113",
-    00000430 => x"6c00006f",
-    00000431 => x"ff010113",
-    00000432 => x"00812423",
-    00000433 => x"00050413",
-    00000434 => x"01055513",
-    00000435 => x"0ff57513",
-    00000436 => x"00112623",
-    00000437 => x"6c8000ef",
-    00000438 => x"00845513",
-    00000439 => x"0ff57513",
-    00000440 => x"6bc000ef",
-    00000441 => x"0ff47513",
-    00000442 => x"00812403",
-    00000443 => x"00c12083",
-    00000444 => x"01010113",
-    00000445 => x"6a80006f",
-    00000446 => x"ff010113",
-    00000447 => x"00812423",
-    00000448 => x"00050413",
-    00000449 => x"00000513",
-    00000450 => x"00112623",
-    00000451 => x"64c000ef",
-    00000452 => x"00300513",
-    00000453 => x"688000ef",
-    00000454 => x"00040513",
-    00000455 => x"fa1ff0ef",
-    00000456 => x"00000513",
-    00000457 => x"678000ef",
-    00000458 => x"00050413",
-    00000459 => x"00000513",
-    00000460 => x"648000ef",
-    00000461 => x"00c12083",
-    00000462 => x"0ff47513",
-    00000463 => x"00812403",
-    00000464 => x"01010113",
-    00000465 => x"00008067",
-    00000466 => x"fd010113",
-    00000467 => x"02812423",
-    00000468 => x"02912223",
-    00000469 => x"03212023",
-    00000470 => x"01312e23",
-    00000471 => x"01412c23",
-    00000472 => x"02112623",
-    00000473 => x"00050913",
-    00000474 => x"00058993",
-    00000475 => x"00c10493",
-    00000476 => x"00000413",
-    00000477 => x"00400a13",
-    00000478 => x"02091e63",
-    00000479 => x"524000ef",
-    00000480 => x"00a48023",
-    00000481 => x"00140413",
-    00000482 => x"00148493",
-    00000483 => x"ff4416e3",
-    00000484 => x"02c12083",
-    00000485 => x"02812403",
-    00000486 => x"00c12503",
-    00000487 => x"02412483",
-    00000488 => x"02012903",
-    00000489 => x"01c12983",
-    00000490 => x"01812a03",
-    00000491 => x"03010113",
-    00000492 => x"00008067",
-    00000493 => x"00898533",
-    00000494 => x"f41ff0ef",
-    00000495 => x"fc5ff06f",
-    00000496 => x"fd010113",
-    00000497 => x"01412c23",
-    00000498 => x"02812423",
-    00000499 => x"80418793",
-    00000500 => x"02112623",
-    00000501 => x"02912223",
-    00000502 => x"03212023",
-    00000503 => x"01312e23",
-    00000504 => x"01512a23",
-    00000505 => x"01612823",
-    00000506 => x"01712623",
-    00000507 => x"01812423",
-    00000508 => x"00100713",
-    00000509 => x"00e7a023",
-    00000510 => x"00050413",
-    00000511 => x"80418a13",
-    00000512 => x"02051863",
-    00000513 => x"ffff1537",
-    00000514 => x"e8c50513",
-    00000515 => x"4b0000ef",
-    00000516 => x"080005b7",
-    00000517 => x"00040513",
-    00000518 => x"f31ff0ef",
-    00000519 => x"4788d7b7",
-    00000520 => x"afe78793",
-    00000521 => x"02f50a63",
-    00000522 => x"00000513",
-    00000523 => x"01c0006f",
-    00000524 => x"ffff1537",
-    00000525 => x"eac50513",
-    00000526 => x"484000ef",
-    00000527 => x"4d8000ef",
-    00000528 => x"00051663",
-    00000529 => x"00300513",
-    00000530 => x"bb5ff0ef",
-    00000531 => x"dbdff0ef",
-    00000532 => x"fc0510e3",
-    00000533 => x"ff1ff06f",
-    00000534 => x"080009b7",
-    00000535 => x"00498593",
-    00000536 => x"00040513",
-    00000537 => x"ee5ff0ef",
-    00000538 => x"00050a93",
-    00000539 => x"00898593",
-    00000540 => x"00040513",
-    00000541 => x"ed5ff0ef",
-    00000542 => x"ff002c03",
-    00000543 => x"00050b13",
-    00000544 => x"ffcafb93",
-    00000545 => x"00000913",
-    00000546 => x"00000493",
-    00000547 => x"00c98993",
-    00000548 => x"013905b3",
-    00000549 => x"052b9c63",
-    00000550 => x"016484b3",
+    00000365 => x"00001097",
+    00000366 => x"2c0080e7",
+    00000367 => x"06050063",
+    00000368 => x"ffff2537",
+    00000369 => x"b0750513",
+    00000370 => x"00001097",
+    00000371 => x"378080e7",
+    00000372 => x"00048513",
+    00000373 => x"00000097",
+    00000374 => x"0ac080e7",
+    00000375 => x"02000513",
+    00000376 => x"00001097",
+    00000377 => x"300080e7",
+    00000378 => x"00040513",
+    00000379 => x"00000097",
+    00000380 => x"094080e7",
+    00000381 => x"02000513",
+    00000382 => x"00001097",
+    00000383 => x"2e8080e7",
+    00000384 => x"34302573",
+    00000385 => x"00000097",
+    00000386 => x"07c080e7",
+    00000387 => x"ffff2537",
+    00000388 => x"b8150513",
+    00000389 => x"00001097",
+    00000390 => x"32c080e7",
+    00000391 => x"00440513",
+    00000392 => x"34151073",
+    00000393 => x"04c12083",
+    00000394 => x"04812283",
+    00000395 => x"04412303",
+    00000396 => x"04012383",
+    00000397 => x"03c12403",
+    00000398 => x"03812483",
+    00000399 => x"03412503",
+    00000400 => x"03012583",
+    00000401 => x"02c12603",
+    00000402 => x"02812683",
+    00000403 => x"02412703",
+    00000404 => x"02012783",
+    00000405 => x"01c12803",
+    00000406 => x"01812883",
+    00000407 => x"01412e03",
+    00000408 => x"01012e83",
+    00000409 => x"00c12f03",
+    00000410 => x"00812f83",
+    00000411 => x"05010113",
+    00000412 => x"30200073",
+    00000413 => x"00100513",
+    00000414 => x"00000097",
+    00000415 => x"58c080e7",
+    00000416 => x"fe010113",
+    00000417 => x"00112e23",
+    00000418 => x"00812c23",
+    00000419 => x"00912a23",
+    00000420 => x"01212823",
+    00000421 => x"01312623",
+    00000422 => x"00050413",
+    00000423 => x"ffff2537",
+    00000424 => x"b7250513",
+    00000425 => x"00001097",
+    00000426 => x"29c080e7",
+    00000427 => x"01c00493",
+    00000428 => x"ffff2537",
+    00000429 => x"ccd50913",
+    00000430 => x"ffc00993",
+    00000431 => x"00945533",
+    00000432 => x"00f57513",
+    00000433 => x"01250533",
+    00000434 => x"00054503",
+    00000435 => x"00001097",
+    00000436 => x"214080e7",
+    00000437 => x"ffc48493",
+    00000438 => x"ff3492e3",
+    00000439 => x"01c12083",
+    00000440 => x"01812403",
+    00000441 => x"01412483",
+    00000442 => x"01012903",
+    00000443 => x"00c12983",
+    00000444 => x"02010113",
+    00000445 => x"00008067",
+    00000446 => x"fe010113",
+    00000447 => x"00112e23",
+    00000448 => x"00812c23",
+    00000449 => x"00912a23",
+    00000450 => x"01212823",
+    00000451 => x"01312623",
+    00000452 => x"01412423",
+    00000453 => x"01512223",
+    00000454 => x"00050413",
+    00000455 => x"80000537",
+    00000456 => x"00100593",
+    00000457 => x"00200613",
+    00000458 => x"00b52223",
+    00000459 => x"00c40e63",
+    00000460 => x"04041063",
+    00000461 => x"ffff2537",
+    00000462 => x"cb050513",
+    00000463 => x"00001097",
+    00000464 => x"204080e7",
+    00000465 => x"0740006f",
+    00000466 => x"ffff2537",
+    00000467 => x"c1b50513",
+    00000468 => x"00001097",
+    00000469 => x"1f0080e7",
+    00000470 => x"80000537",
+    00000471 => x"02c50513",
+    00000472 => x"04052023",
+    00000473 => x"04052223",
+    00000474 => x"04051423",
+    00000475 => x"04c0006f",
+    00000476 => x"ffff2537",
+    00000477 => x"b7550513",
+    00000478 => x"00001097",
+    00000479 => x"1c8080e7",
+    00000480 => x"00001097",
+    00000481 => x"038080e7",
+    00000482 => x"1c050063",
+    00000483 => x"00200513",
+    00000484 => x"00000593",
+    00000485 => x"00000613",
+    00000486 => x"00001097",
+    00000487 => x"030080e7",
+    00000488 => x"00000097",
+    00000489 => x"4c0080e7",
+    00000490 => x"1a050063",
+    00000491 => x"08000537",
+    00000492 => x"00000097",
+    00000493 => x"504080e7",
+    00000494 => x"00040513",
+    00000495 => x"00000097",
+    00000496 => x"578080e7",
+    00000497 => x"00050993",
+    00000498 => x"00155513",
+    00000499 => x"23c465b7",
+    00000500 => x"57f58593",
+    00000501 => x"14b51e63",
+    00000502 => x"00040513",
+    00000503 => x"00000097",
+    00000504 => x"558080e7",
+    00000505 => x"00050493",
+    00000506 => x"00040513",
+    00000507 => x"00000097",
+    00000508 => x"548080e7",
+    00000509 => x"ff002a03",
+    00000510 => x"4788d5b7",
+    00000511 => x"aff58593",
+    00000512 => x"00050913",
+    00000513 => x"04b99063",
+    00000514 => x"00040513",
+    00000515 => x"000a0593",
+    00000516 => x"00048613",
+    00000517 => x"00000097",
+    00000518 => x"5ec080e7",
+    00000519 => x"00400513",
+    00000520 => x"04a4e663",
+    00000521 => x"00000993",
+    00000522 => x"0024d513",
+    00000523 => x"000a2583",
+    00000524 => x"013589b3",
+    00000525 => x"fff50513",
+    00000526 => x"004a0a13",
+    00000527 => x"fe0518e3",
+    00000528 => x"05c0006f",
+    00000529 => x"00100513",
+    00000530 => x"00a41e63",
+    00000531 => x"0024d593",
+    00000532 => x"000a0513",
+    00000533 => x"00000097",
+    00000534 => x"788080e7",
+    00000535 => x"00050993",
+    00000536 => x"04c0006f",
+    00000537 => x"00400513",
+    00000538 => x"00a4f663",
+    00000539 => x"00000993",
+    00000540 => x"02c0006f",
+    00000541 => x"00000993",
+    00000542 => x"0024da93",
+    00000543 => x"00040513",
+    00000544 => x"00000097",
+    00000545 => x"4b4080e7",
+    00000546 => x"013509b3",
+    00000547 => x"00aa2023",
+    00000548 => x"fffa8a93",
+    00000549 => x"004a0a13",
+    00000550 => x"fe0a92e3",
     00000551 => x"00200513",
-    00000552 => x"fa0494e3",
-    00000553 => x"ffff1537",
-    00000554 => x"eb850513",
-    00000555 => x"410000ef",
-    00000556 => x"02c12083",
-    00000557 => x"02812403",
-    00000558 => x"800007b7",
-    00000559 => x"0157a023",
-    00000560 => x"000a2023",
-    00000561 => x"02412483",
-    00000562 => x"02012903",
-    00000563 => x"01c12983",
-    00000564 => x"01812a03",
-    00000565 => x"01412a83",
-    00000566 => x"01012b03",
-    00000567 => x"00c12b83",
-    00000568 => x"00812c03",
-    00000569 => x"03010113",
-    00000570 => x"00008067",
-    00000571 => x"00040513",
-    00000572 => x"e59ff0ef",
-    00000573 => x"012c07b3",
-    00000574 => x"00a484b3",
-    00000575 => x"00a7a023",
-    00000576 => x"00490913",
-    00000577 => x"f8dff06f",
-    00000578 => x"ff010113",
-    00000579 => x"00112623",
-    00000580 => x"00812423",
-    00000581 => x"00912223",
-    00000582 => x"00058413",
-    00000583 => x"00050493",
-    00000584 => x"d75ff0ef",
-    00000585 => x"00000513",
-    00000586 => x"430000ef",
-    00000587 => x"00200513",
-    00000588 => x"46c000ef",
-    00000589 => x"00048513",
-    00000590 => x"d85ff0ef",
-    00000591 => x"00040513",
-    00000592 => x"45c000ef",
-    00000593 => x"00000513",
-    00000594 => x"430000ef",
-    00000595 => x"00812403",
-    00000596 => x"00c12083",
-    00000597 => x"00412483",
-    00000598 => x"01010113",
-    00000599 => x"cf1ff06f",
-    00000600 => x"fe010113",
-    00000601 => x"00812c23",
-    00000602 => x"00912a23",
-    00000603 => x"01212823",
-    00000604 => x"00112e23",
-    00000605 => x"00050493",
-    00000606 => x"00b12623",
-    00000607 => x"00000413",
-    00000608 => x"00400913",
-    00000609 => x"00c10793",
-    00000610 => x"008787b3",
-    00000611 => x"0007c583",
-    00000612 => x"00848533",
-    00000613 => x"00140413",
-    00000614 => x"f71ff0ef",
-    00000615 => x"ff2414e3",
-    00000616 => x"01c12083",
-    00000617 => x"01812403",
-    00000618 => x"01412483",
-    00000619 => x"01012903",
-    00000620 => x"02010113",
-    00000621 => x"00008067",
-    00000622 => x"ff010113",
-    00000623 => x"00112623",
-    00000624 => x"00812423",
-    00000625 => x"00050413",
-    00000626 => x"ccdff0ef",
-    00000627 => x"00000513",
-    00000628 => x"388000ef",
-    00000629 => x"0d800513",
-    00000630 => x"3c4000ef",
+    00000552 => x"02a40863",
+    00000553 => x"00100513",
+    00000554 => x"02a41e63",
+    00000555 => x"00000513",
+    00000556 => x"00001097",
+    00000557 => x"f64080e7",
+    00000558 => x"fa802503",
+    00000559 => x"ffffa5b7",
+    00000560 => x"fff58593",
+    00000561 => x"00b57533",
+    00000562 => x"faa02423",
+    00000563 => x"0180006f",
+    00000564 => x"41200533",
+    00000565 => x"00a9c533",
+    00000566 => x"00153513",
+    00000567 => x"00000097",
+    00000568 => x"7e4080e7",
+    00000569 => x"41200533",
+    00000570 => x"04a99a63",
+    00000571 => x"ffff2537",
+    00000572 => x"b4150513",
+    00000573 => x"00001097",
+    00000574 => x"04c080e7",
+    00000575 => x"80000537",
+    00000576 => x"00952023",
+    00000577 => x"80000537",
+    00000578 => x"00052223",
+    00000579 => x"01c12083",
+    00000580 => x"01812403",
+    00000581 => x"01412483",
+    00000582 => x"01012903",
+    00000583 => x"00c12983",
+    00000584 => x"00812a03",
+    00000585 => x"00412a83",
+    00000586 => x"02010113",
+    00000587 => x"00008067",
+    00000588 => x"00000513",
+    00000589 => x"00000097",
+    00000590 => x"2d0080e7",
+    00000591 => x"00200513",
+    00000592 => x"00000097",
+    00000593 => x"2c4080e7",
+    00000594 => x"00300513",
+    00000595 => x"00000097",
+    00000596 => x"2b8080e7",
+    00000597 => x"ff010113",
+    00000598 => x"00112623",
+    00000599 => x"30047073",
+    00000600 => x"00000013",
+    00000601 => x"00000013",
+    00000602 => x"ffff2537",
+    00000603 => x"b4c50513",
+    00000604 => x"00001097",
+    00000605 => x"fd0080e7",
+    00000606 => x"00001097",
+    00000607 => x"f80080e7",
+    00000608 => x"fe051ce3",
+    00000609 => x"ff002503",
+    00000610 => x"00050067",
+    00000611 => x"0000006f",
+    00000612 => x"fd010113",
+    00000613 => x"02112623",
+    00000614 => x"02812423",
+    00000615 => x"02912223",
+    00000616 => x"03212023",
+    00000617 => x"01312e23",
+    00000618 => x"01412c23",
+    00000619 => x"01512a23",
+    00000620 => x"01612823",
+    00000621 => x"01712623",
+    00000622 => x"01812423",
+    00000623 => x"01912223",
+    00000624 => x"80000537",
+    00000625 => x"00052403",
+    00000626 => x"12040663",
+    00000627 => x"ffff2537",
+    00000628 => x"b0e50513",
+    00000629 => x"00001097",
+    00000630 => x"f6c080e7",
     00000631 => x"00040513",
-    00000632 => x"cddff0ef",
-    00000633 => x"00000513",
-    00000634 => x"390000ef",
-    00000635 => x"00812403",
-    00000636 => x"00c12083",
-    00000637 => x"01010113",
-    00000638 => x"c55ff06f",
-    00000639 => x"fe010113",
-    00000640 => x"800007b7",
-    00000641 => x"00812c23",
-    00000642 => x"0007a403",
-    00000643 => x"00112e23",
-    00000644 => x"00912a23",
-    00000645 => x"01212823",
-    00000646 => x"01312623",
-    00000647 => x"01412423",
-    00000648 => x"01512223",
-    00000649 => x"02041863",
-    00000650 => x"ffff1537",
-    00000651 => x"ebc50513",
-    00000652 => x"01812403",
-    00000653 => x"01c12083",
-    00000654 => x"01412483",
-    00000655 => x"01012903",
-    00000656 => x"00c12983",
-    00000657 => x"00812a03",
-    00000658 => x"00412a83",
-    00000659 => x"02010113",
-    00000660 => x"26c0006f",
-    00000661 => x"ffff1537",
-    00000662 => x"ed850513",
-    00000663 => x"260000ef",
-    00000664 => x"00040513",
-    00000665 => x"9e5ff0ef",
-    00000666 => x"ffff1537",
-    00000667 => x"ee050513",
-    00000668 => x"24c000ef",
-    00000669 => x"08000537",
-    00000670 => x"9d1ff0ef",
-    00000671 => x"ffff1537",
-    00000672 => x"ef850513",
-    00000673 => x"238000ef",
-    00000674 => x"218000ef",
-    00000675 => x"00050493",
-    00000676 => x"1f4000ef",
-    00000677 => x"07900793",
-    00000678 => x"0af49e63",
-    00000679 => x"b6dff0ef",
-    00000680 => x"00051663",
-    00000681 => x"00300513",
-    00000682 => x"955ff0ef",
-    00000683 => x"ffff1537",
-    00000684 => x"f0450513",
-    00000685 => x"01045493",
-    00000686 => x"204000ef",
-    00000687 => x"00148493",
-    00000688 => x"08000937",
-    00000689 => x"fff00993",
-    00000690 => x"00010a37",
-    00000691 => x"fff48493",
-    00000692 => x"07349063",
-    00000693 => x"4788d5b7",
-    00000694 => x"afe58593",
-    00000695 => x"08000537",
-    00000696 => x"e81ff0ef",
-    00000697 => x"08000537",
-    00000698 => x"00040593",
-    00000699 => x"00450513",
-    00000700 => x"e71ff0ef",
-    00000701 => x"ff002a03",
-    00000702 => x"080009b7",
-    00000703 => x"ffc47413",
-    00000704 => x"00000493",
-    00000705 => x"00000913",
-    00000706 => x"00c98a93",
-    00000707 => x"01548533",
-    00000708 => x"009a07b3",
-    00000709 => x"02849663",
-    00000710 => x"00898513",
-    00000711 => x"412005b3",
-    00000712 => x"e41ff0ef",
-    00000713 => x"ffff1537",
-    00000714 => x"eb850513",
-    00000715 => x"f05ff06f",
-    00000716 => x"00090513",
-    00000717 => x"e85ff0ef",
-    00000718 => x"01490933",
-    00000719 => x"f91ff06f",
-    00000720 => x"0007a583",
-    00000721 => x"00448493",
-    00000722 => x"00b90933",
-    00000723 => x"e15ff0ef",
-    00000724 => x"fbdff06f",
-    00000725 => x"01c12083",
-    00000726 => x"01812403",
-    00000727 => x"01412483",
-    00000728 => x"01012903",
-    00000729 => x"00c12983",
-    00000730 => x"00812a03",
-    00000731 => x"00412a83",
-    00000732 => x"02010113",
-    00000733 => x"00008067",
-    00000734 => x"fe802503",
-    00000735 => x"01155513",
-    00000736 => x"00157513",
-    00000737 => x"00008067",
-    00000738 => x"ff010113",
-    00000739 => x"f9402783",
-    00000740 => x"f9002703",
-    00000741 => x"f9402683",
-    00000742 => x"fed79ae3",
-    00000743 => x"00e12023",
-    00000744 => x"00f12223",
-    00000745 => x"00012503",
-    00000746 => x"00412583",
-    00000747 => x"01010113",
-    00000748 => x"00008067",
-    00000749 => x"ff010113",
-    00000750 => x"00a12023",
-    00000751 => x"00b12223",
-    00000752 => x"f9800793",
-    00000753 => x"fff00713",
-    00000754 => x"00e7a023",
-    00000755 => x"00412703",
-    00000756 => x"f8e02e23",
-    00000757 => x"00012703",
-    00000758 => x"00e7a023",
-    00000759 => x"01010113",
-    00000760 => x"00008067",
-    00000761 => x"fe802503",
-    00000762 => x"01255513",
-    00000763 => x"00157513",
-    00000764 => x"00008067",
-    00000765 => x"fa002023",
-    00000766 => x"fe002703",
-    00000767 => x"00151513",
-    00000768 => x"00000793",
-    00000769 => x"04a77463",
-    00000770 => x"000016b7",
-    00000771 => x"00000713",
-    00000772 => x"ffe68693",
-    00000773 => x"04f6e663",
-    00000774 => x"00367613",
-    00000775 => x"0035f593",
-    00000776 => x"fff78793",
-    00000777 => x"01461613",
-    00000778 => x"00c7e7b3",
-    00000779 => x"01659593",
-    00000780 => x"01871713",
-    00000781 => x"00b7e7b3",
-    00000782 => x"00e7e7b3",
-    00000783 => x"10000737",
-    00000784 => x"00e7e7b3",
-    00000785 => x"faf02023",
-    00000786 => x"00008067",
-    00000787 => x"00178793",
-    00000788 => x"01079793",
-    00000789 => x"40a70733",
-    00000790 => x"0107d793",
-    00000791 => x"fa9ff06f",
-    00000792 => x"ffe70513",
-    00000793 => x"0fd57513",
-    00000794 => x"00051a63",
-    00000795 => x"0037d793",
-    00000796 => x"00170713",
-    00000797 => x"0ff77713",
-    00000798 => x"f9dff06f",
-    00000799 => x"0017d793",
-    00000800 => x"ff1ff06f",
-    00000801 => x"fa002783",
-    00000802 => x"fe07cee3",
-    00000803 => x"faa02223",
-    00000804 => x"00008067",
-    00000805 => x"fa002503",
-    00000806 => x"01f55513",
-    00000807 => x"00008067",
-    00000808 => x"fa402503",
-    00000809 => x"fe055ee3",
-    00000810 => x"0ff57513",
-    00000811 => x"00008067",
-    00000812 => x"fa402503",
-    00000813 => x"01f55513",
-    00000814 => x"00008067",
-    00000815 => x"ff010113",
-    00000816 => x"00812423",
-    00000817 => x"01212023",
-    00000818 => x"00112623",
-    00000819 => x"00912223",
-    00000820 => x"00050413",
-    00000821 => x"00a00913",
-    00000822 => x"00044483",
-    00000823 => x"00140413",
-    00000824 => x"00049e63",
-    00000825 => x"00c12083",
-    00000826 => x"00812403",
-    00000827 => x"00412483",
-    00000828 => x"00012903",
-    00000829 => x"01010113",
-    00000830 => x"00008067",
-    00000831 => x"01249663",
-    00000832 => x"00d00513",
-    00000833 => x"f81ff0ef",
-    00000834 => x"00048513",
-    00000835 => x"f79ff0ef",
-    00000836 => x"fc9ff06f",
-    00000837 => x"fe802503",
-    00000838 => x"01355513",
-    00000839 => x"00157513",
-    00000840 => x"00008067",
-    00000841 => x"00757513",
-    00000842 => x"00367613",
-    00000843 => x"0015f593",
-    00000844 => x"00a51513",
-    00000845 => x"00d61613",
-    00000846 => x"00c56533",
-    00000847 => x"00959593",
-    00000848 => x"fa800793",
-    00000849 => x"00b56533",
-    00000850 => x"0007a023",
-    00000851 => x"10056513",
-    00000852 => x"00a7a023",
-    00000853 => x"00008067",
-    00000854 => x"fa800713",
-    00000855 => x"00072683",
-    00000856 => x"00757793",
-    00000857 => x"00100513",
-    00000858 => x"00f51533",
-    00000859 => x"00d56533",
-    00000860 => x"00a72023",
-    00000861 => x"00008067",
-    00000862 => x"fa800713",
-    00000863 => x"00072683",
-    00000864 => x"00757513",
-    00000865 => x"00100793",
-    00000866 => x"00a797b3",
-    00000867 => x"fff7c793",
-    00000868 => x"00d7f7b3",
-    00000869 => x"00f72023",
-    00000870 => x"00008067",
-    00000871 => x"faa02623",
-    00000872 => x"fa802783",
-    00000873 => x"fe07cee3",
-    00000874 => x"fac02503",
-    00000875 => x"00008067",
-    00000876 => x"fe802503",
-    00000877 => x"01055513",
-    00000878 => x"00157513",
-    00000879 => x"00008067",
-    00000880 => x"00100793",
-    00000881 => x"01f00713",
-    00000882 => x"00a797b3",
-    00000883 => x"00a74a63",
-    00000884 => x"fc802703",
-    00000885 => x"00f747b3",
-    00000886 => x"fcf02423",
-    00000887 => x"00008067",
-    00000888 => x"fcc02703",
-    00000889 => x"00f747b3",
-    00000890 => x"fcf02623",
-    00000891 => x"00008067",
-    00000892 => x"fca02423",
-    00000893 => x"fcb02623",
-    00000894 => x"00008067",
-    00000895 => x"69617641",
-    00000896 => x"6c62616c",
-    00000897 => x"4d432065",
-    00000898 => x"0a3a7344",
-    00000899 => x"203a6820",
-    00000900 => x"706c6548",
-    00000901 => x"3a72200a",
-    00000902 => x"73655220",
-    00000903 => x"74726174",
-    00000904 => x"3a75200a",
-    00000905 => x"6c705520",
-    00000906 => x"0a64616f",
-    00000907 => x"203a7320",
-    00000908 => x"726f7453",
-    00000909 => x"6f742065",
-    00000910 => x"616c6620",
-    00000911 => x"200a6873",
-    00000912 => x"4c203a6c",
-    00000913 => x"2064616f",
-    00000914 => x"6d6f7266",
-    00000915 => x"616c6620",
-    00000916 => x"200a6873",
-    00000917 => x"45203a65",
-    00000918 => x"75636578",
-    00000919 => x"00006574",
-    00000920 => x"746f6f42",
-    00000921 => x"2e676e69",
-    00000922 => x"0a0a2e2e",
-    00000923 => x"00000000",
-    00000924 => x"52450a07",
-    00000925 => x"5f524f52",
-    00000926 => x"00000000",
-    00000927 => x"00007830",
-    00000928 => x"58455b0a",
-    00000929 => x"00002043",
-    00000930 => x"00000a5d",
-    00000931 => x"69617741",
-    00000932 => x"676e6974",
-    00000933 => x"6f656e20",
-    00000934 => x"32337672",
-    00000935 => x"6578655f",
-    00000936 => x"6e69622e",
-    00000937 => x"202e2e2e",
-    00000938 => x"00000000",
-    00000939 => x"64616f4c",
-    00000940 => x"2e676e69",
-    00000941 => x"00202e2e",
-    00000942 => x"00004b4f",
-    00000943 => x"65206f4e",
-    00000944 => x"75636578",
-    00000945 => x"6c626174",
-    00000946 => x"76612065",
-    00000947 => x"616c6961",
-    00000948 => x"2e656c62",
-    00000949 => x"00000000",
-    00000950 => x"74697257",
-    00000951 => x"00002065",
-    00000952 => x"74796220",
-    00000953 => x"74207365",
-    00000954 => x"5053206f",
-    00000955 => x"6c662049",
-    00000956 => x"20687361",
-    00000957 => x"00002040",
-    00000958 => x"7928203f",
-    00000959 => x"20296e2f",
-    00000960 => x"00000000",
-    00000961 => x"616c460a",
-    00000962 => x"6e696873",
-    00000963 => x"2e2e2e67",
-    00000964 => x"00000020",
-    00000965 => x"3c0a0a0a",
-    00000966 => x"454e203c",
-    00000967 => x"3356524f",
-    00000968 => x"6f422032",
-    00000969 => x"6f6c746f",
-    00000970 => x"72656461",
-    00000971 => x"0a3e3e20",
-    00000972 => x"444c420a",
-    00000973 => x"41203a56",
-    00000974 => x"20206775",
-    00000975 => x"30322038",
-    00000976 => x"480a3132",
-    00000977 => x"203a5657",
-    00000978 => x"00000020",
-    00000979 => x"4b4c430a",
-    00000980 => x"0020203a",
-    00000981 => x"53494d0a",
-    00000982 => x"00203a41",
-    00000983 => x"58455a0a",
-    00000984 => x"00203a54",
-    00000985 => x"4f52500a",
-    00000986 => x"00203a43",
-    00000987 => x"454d490a",
-    00000988 => x"00203a4d",
-    00000989 => x"74796220",
-    00000990 => x"40207365",
-    00000991 => x"00000000",
-    00000992 => x"454d440a",
-    00000993 => x"00203a4d",
-    00000994 => x"75410a0a",
-    00000995 => x"6f626f74",
-    00000996 => x"6920746f",
-    00000997 => x"7338206e",
-    00000998 => x"7250202e",
-    00000999 => x"20737365",
-    00001000 => x"2079656b",
-    00001001 => x"61206f74",
-    00001002 => x"74726f62",
-    00001003 => x"00000a2e",
-    00001004 => x"0000000a",
-    00001005 => x"726f6241",
-    00001006 => x"2e646574",
-    00001007 => x"00000a0a",
-    00001008 => x"444d430a",
-    00001009 => x"00203e3a",
-    00001010 => x"61766e49",
-    00001011 => x"2064696c",
-    00001012 => x"00444d43",
-    00001013 => x"33323130",
-    00001014 => x"37363534",
-    00001015 => x"62613938",
-    00001016 => x"66656463"
+    00000632 => x"00000097",
+    00000633 => x"ca0080e7",
+    00000634 => x"ffff2537",
+    00000635 => x"b2a50513",
+    00000636 => x"00001097",
+    00000637 => x"f50080e7",
+    00000638 => x"08000537",
+    00000639 => x"00000097",
+    00000640 => x"c84080e7",
+    00000641 => x"ffff2537",
+    00000642 => x"c5350513",
+    00000643 => x"00001097",
+    00000644 => x"f34080e7",
+    00000645 => x"00001097",
+    00000646 => x"ef0080e7",
+    00000647 => x"00050493",
+    00000648 => x"00001097",
+    00000649 => x"ec0080e7",
+    00000650 => x"07900513",
+    00000651 => x"0ca49a63",
+    00000652 => x"00000097",
+    00000653 => x"230080e7",
+    00000654 => x"1c050063",
+    00000655 => x"ffff2537",
+    00000656 => x"ca250513",
+    00000657 => x"00001097",
+    00000658 => x"efc080e7",
+    00000659 => x"01045513",
+    00000660 => x"00150913",
+    00000661 => x"080004b7",
+    00000662 => x"000109b7",
+    00000663 => x"fff90913",
+    00000664 => x"00048513",
+    00000665 => x"00000097",
+    00000666 => x"70c080e7",
+    00000667 => x"013484b3",
+    00000668 => x"fe0916e3",
+    00000669 => x"00000493",
+    00000670 => x"4788d537",
+    00000671 => x"afe50513",
+    00000672 => x"00a12023",
+    00000673 => x"08000937",
+    00000674 => x"00010993",
+    00000675 => x"00400a13",
+    00000676 => x"00998533",
+    00000677 => x"00054583",
+    00000678 => x"01248533",
+    00000679 => x"00001097",
+    00000680 => x"b68080e7",
+    00000681 => x"00148493",
+    00000682 => x"ff4494e3",
+    00000683 => x"00000913",
+    00000684 => x"08000537",
+    00000685 => x"00450493",
+    00000686 => x"00812023",
+    00000687 => x"00010993",
+    00000688 => x"00400a13",
+    00000689 => x"01298533",
+    00000690 => x"00054583",
+    00000691 => x"00990533",
+    00000692 => x"00001097",
+    00000693 => x"b34080e7",
+    00000694 => x"00190913",
+    00000695 => x"ff4914e3",
+    00000696 => x"ff002983",
+    00000697 => x"00400913",
+    00000698 => x"05247663",
+    00000699 => x"00000a13",
+    00000700 => x"0980006f",
+    00000701 => x"ffff2537",
+    00000702 => x"b5950513",
+    00000703 => x"0c40006f",
+    00000704 => x"02c12083",
+    00000705 => x"02812403",
+    00000706 => x"02412483",
+    00000707 => x"02012903",
+    00000708 => x"01c12983",
+    00000709 => x"01812a03",
+    00000710 => x"01412a83",
+    00000711 => x"01012b03",
+    00000712 => x"00c12b83",
+    00000713 => x"00812c03",
+    00000714 => x"00412c83",
+    00000715 => x"03010113",
+    00000716 => x"00008067",
+    00000717 => x"00000a93",
+    00000718 => x"00000a13",
+    00000719 => x"00245413",
+    00000720 => x"08000537",
+    00000721 => x"00c50b13",
+    00000722 => x"00010b93",
+    00000723 => x"0009ac03",
+    00000724 => x"00000c93",
+    00000725 => x"01812023",
+    00000726 => x"019b8533",
+    00000727 => x"00054583",
+    00000728 => x"019b0533",
+    00000729 => x"00001097",
+    00000730 => x"aa0080e7",
+    00000731 => x"001c8c93",
+    00000732 => x"ff2c94e3",
+    00000733 => x"00498993",
+    00000734 => x"014c0a33",
+    00000735 => x"001a8a93",
+    00000736 => x"004b0b13",
+    00000737 => x"fc8a94e3",
+    00000738 => x"00000413",
+    00000739 => x"41400533",
+    00000740 => x"00a12023",
+    00000741 => x"00010993",
+    00000742 => x"00898533",
+    00000743 => x"00054583",
+    00000744 => x"00848533",
+    00000745 => x"00450513",
+    00000746 => x"00001097",
+    00000747 => x"a5c080e7",
+    00000748 => x"00140413",
+    00000749 => x"ff2412e3",
+    00000750 => x"ffff2537",
+    00000751 => x"b4150513",
+    00000752 => x"02c12083",
+    00000753 => x"02812403",
+    00000754 => x"02412483",
+    00000755 => x"02012903",
+    00000756 => x"01c12983",
+    00000757 => x"01812a03",
+    00000758 => x"01412a83",
+    00000759 => x"01012b03",
+    00000760 => x"00c12b83",
+    00000761 => x"00812c03",
+    00000762 => x"00412c83",
+    00000763 => x"03010113",
+    00000764 => x"00001317",
+    00000765 => x"d5030067",
+    00000766 => x"00300513",
+    00000767 => x"00000097",
+    00000768 => x"008080e7",
+    00000769 => x"ff010113",
+    00000770 => x"00112623",
+    00000771 => x"00812423",
+    00000772 => x"00050413",
+    00000773 => x"ffff2537",
+    00000774 => x"c4a50513",
+    00000775 => x"00001097",
+    00000776 => x"d24080e7",
+    00000777 => x"03040513",
+    00000778 => x"0ff57513",
+    00000779 => x"00001097",
+    00000780 => x"cb4080e7",
+    00000781 => x"30047073",
+    00000782 => x"00000013",
+    00000783 => x"00000013",
+    00000784 => x"00001097",
+    00000785 => x"af0080e7",
+    00000786 => x"00050a63",
+    00000787 => x"00100513",
+    00000788 => x"00000593",
+    00000789 => x"00001097",
+    00000790 => x"b20080e7",
+    00000791 => x"0000006f",
+    00000792 => x"ff010113",
+    00000793 => x"00112623",
+    00000794 => x"00812423",
+    00000795 => x"00000513",
+    00000796 => x"00001097",
+    00000797 => x"b88080e7",
+    00000798 => x"09e00513",
+    00000799 => x"00001097",
+    00000800 => x"bb8080e7",
+    00000801 => x"00000513",
+    00000802 => x"00001097",
+    00000803 => x"bac080e7",
+    00000804 => x"00050413",
+    00000805 => x"00000513",
+    00000806 => x"00001097",
+    00000807 => x"b7c080e7",
+    00000808 => x"0ff47513",
+    00000809 => x"00c12083",
+    00000810 => x"00812403",
+    00000811 => x"01010113",
+    00000812 => x"00008067",
+    00000813 => x"fe010113",
+    00000814 => x"00112e23",
+    00000815 => x"00812c23",
+    00000816 => x"00912a23",
+    00000817 => x"01212823",
+    00000818 => x"00050413",
+    00000819 => x"00000513",
+    00000820 => x"00001097",
+    00000821 => x"b28080e7",
+    00000822 => x"00300513",
+    00000823 => x"00001097",
+    00000824 => x"b58080e7",
+    00000825 => x"00812423",
+    00000826 => x"00200413",
+    00000827 => x"00810493",
+    00000828 => x"fff00913",
+    00000829 => x"00848533",
+    00000830 => x"00054503",
+    00000831 => x"00001097",
+    00000832 => x"b38080e7",
+    00000833 => x"fff40413",
+    00000834 => x"ff2416e3",
+    00000835 => x"fa802503",
+    00000836 => x"000065b7",
+    00000837 => x"00b56533",
+    00000838 => x"faa02423",
+    00000839 => x"01c12083",
+    00000840 => x"01812403",
+    00000841 => x"01412483",
+    00000842 => x"01012903",
+    00000843 => x"02010113",
+    00000844 => x"00008067",
+    00000845 => x"fe010113",
+    00000846 => x"00112e23",
+    00000847 => x"00812c23",
+    00000848 => x"00912a23",
+    00000849 => x"01212823",
+    00000850 => x"02050a63",
+    00000851 => x"00200593",
+    00000852 => x"04b51a63",
+    00000853 => x"00000413",
+    00000854 => x"00810493",
+    00000855 => x"00400913",
+    00000856 => x"00000097",
+    00000857 => x"498080e7",
+    00000858 => x"008485b3",
+    00000859 => x"00140413",
+    00000860 => x"00a58023",
+    00000861 => x"ff2416e3",
+    00000862 => x"06c0006f",
+    00000863 => x"00000413",
+    00000864 => x"00810493",
+    00000865 => x"00400913",
+    00000866 => x"00001097",
+    00000867 => x"b7c080e7",
+    00000868 => x"008485b3",
+    00000869 => x"00140413",
+    00000870 => x"00a58023",
+    00000871 => x"ff2416e3",
+    00000872 => x"0440006f",
+    00000873 => x"00000513",
+    00000874 => x"00001097",
+    00000875 => x"a8c080e7",
+    00000876 => x"00855593",
+    00000877 => x"00010637",
+    00000878 => x"f0060613",
+    00000879 => x"00c5f5b3",
+    00000880 => x"01855613",
+    00000881 => x"00c5e5b3",
+    00000882 => x"00851613",
+    00000883 => x"00ff06b7",
+    00000884 => x"00d67633",
+    00000885 => x"01851513",
+    00000886 => x"00c56533",
+    00000887 => x"00b56533",
+    00000888 => x"00a12423",
+    00000889 => x"00812503",
+    00000890 => x"01c12083",
+    00000891 => x"01812403",
+    00000892 => x"01412483",
+    00000893 => x"01012903",
+    00000894 => x"02010113",
+    00000895 => x"00008067",
+    00000896 => x"fd010113",
+    00000897 => x"02112623",
+    00000898 => x"02812423",
+    00000899 => x"02912223",
+    00000900 => x"03212023",
+    00000901 => x"01312e23",
+    00000902 => x"01412c23",
+    00000903 => x"01512a23",
+    00000904 => x"01612823",
+    00000905 => x"01712623",
+    00000906 => x"01812423",
+    00000907 => x"01912223",
+    00000908 => x"16060663",
+    00000909 => x"00060413",
+    00000910 => x"00058493",
+    00000911 => x"00050913",
+    00000912 => x"00000a93",
+    00000913 => x"00000593",
+    00000914 => x"00000993",
+    00000915 => x"00100b13",
+    00000916 => x"00001537",
+    00000917 => x"f0050b93",
+    00000918 => x"01200c13",
+    00000919 => x"00100c93",
+    00000920 => x"036c9663",
+    00000921 => x"00059c63",
+    00000922 => x"00090513",
+    00000923 => x"00000097",
+    00000924 => x"ec8080e7",
+    00000925 => x"00050993",
+    00000926 => x"00400593",
+    00000927 => x"0ff9f513",
+    00000928 => x"0089d993",
+    00000929 => x"fff58593",
+    00000930 => x"10056c93",
+    00000931 => x"001cf513",
+    00000932 => x"00051c63",
+    00000933 => x"04058263",
+    00000934 => x"fff58593",
+    00000935 => x"04058c63",
+    00000936 => x"0089da13",
+    00000937 => x"0640006f",
+    00000938 => x"00059c63",
+    00000939 => x"00090513",
+    00000940 => x"00000097",
+    00000941 => x"e84080e7",
+    00000942 => x"00050993",
+    00000943 => x"00400593",
+    00000944 => x"0089d513",
+    00000945 => x"fff58593",
+    00000946 => x"01548633",
+    00000947 => x"001a8a93",
+    00000948 => x"01360023",
+    00000949 => x"0bc0006f",
+    00000950 => x"00090513",
+    00000951 => x"00000097",
+    00000952 => x"e58080e7",
+    00000953 => x"00050993",
+    00000954 => x"00855a13",
+    00000955 => x"00300593",
+    00000956 => x"0180006f",
+    00000957 => x"00090513",
+    00000958 => x"00000097",
+    00000959 => x"e3c080e7",
+    00000960 => x"00050a13",
+    00000961 => x"00400593",
+    00000962 => x"008a5513",
+    00000963 => x"00fa7613",
+    00000964 => x"00360613",
+    00000965 => x"fff58593",
+    00000966 => x"03861463",
+    00000967 => x"00059a63",
+    00000968 => x"00090513",
+    00000969 => x"00000097",
+    00000970 => x"e10080e7",
+    00000971 => x"00400593",
+    00000972 => x"0ff57613",
+    00000973 => x"00855513",
+    00000974 => x"fff58593",
+    00000975 => x"01260613",
+    00000976 => x"0ff9f693",
+    00000977 => x"004a1713",
+    00000978 => x"01777733",
+    00000979 => x"00d766b3",
+    00000980 => x"0956f063",
+    00000981 => x"028afe63",
+    00000982 => x"fff6c693",
+    00000983 => x"fff60613",
+    00000984 => x"009686b3",
+    00000985 => x"00168693",
+    00000986 => x"01568733",
+    00000987 => x"fff70703",
+    00000988 => x"015487b3",
+    00000989 => x"00e78023",
+    00000990 => x"001a8a93",
+    00000991 => x"00c03733",
+    00000992 => x"008ab7b3",
+    00000993 => x"00f77733",
+    00000994 => x"fff60613",
+    00000995 => x"fc071ee3",
+    00000996 => x"001cdc93",
+    00000997 => x"00050993",
+    00000998 => x"ec8ae4e3",
+    00000999 => x"02c12083",
+    00001000 => x"02812403",
+    00001001 => x"02412483",
+    00001002 => x"02012903",
+    00001003 => x"01c12983",
+    00001004 => x"01812a03",
+    00001005 => x"01412a83",
+    00001006 => x"01012b03",
+    00001007 => x"00c12b83",
+    00001008 => x"00812c03",
+    00001009 => x"00412c83",
+    00001010 => x"03010113",
+    00001011 => x"00008067",
+    00001012 => x"00400513",
+    00001013 => x"00000097",
+    00001014 => x"c30080e7",
+    00001015 => x"ff010113",
+    00001016 => x"00112623",
+    00001017 => x"00812423",
+    00001018 => x"00912223",
+    00001019 => x"00058413",
+    00001020 => x"00050493",
+    00001021 => x"00001097",
+    00001022 => x"868080e7",
+    00001023 => x"008035b3",
+    00001024 => x"00a03633",
+    00001025 => x"00c5f5b3",
+    00001026 => x"02058263",
+    00001027 => x"00000593",
+    00001028 => x"00158593",
+    00001029 => x"0085b633",
+    00001030 => x"00a5b6b3",
+    00001031 => x"00d67633",
+    00001032 => x"fa002623",
+    00001033 => x"fe0616e3",
+    00001034 => x"0100006f",
+    00001035 => x"00000593",
+    00001036 => x"00000513",
+    00001037 => x"06040c63",
+    00001038 => x"00000513",
+    00001039 => x"00000793",
+    00001040 => x"00020637",
+    00001041 => x"000106b7",
+    00001042 => x"f0068693",
+    00001043 => x"00ff0737",
+    00001044 => x"fa802803",
+    00001045 => x"00c87833",
+    00001046 => x"fe080ce3",
+    00001047 => x"fac02803",
+    00001048 => x"0085f663",
+    00001049 => x"fa002623",
+    00001050 => x"00158593",
+    00001051 => x"00885893",
+    00001052 => x"00d8f8b3",
+    00001053 => x"01885293",
+    00001054 => x"0058e8b3",
+    00001055 => x"00881293",
+    00001056 => x"00e2f2b3",
+    00001057 => x"01881813",
+    00001058 => x"00586833",
+    00001059 => x"01186833",
+    00001060 => x"00a80533",
+    00001061 => x"00178893",
+    00001062 => x"00279793",
+    00001063 => x"00f487b3",
+    00001064 => x"0107a023",
+    00001065 => x"00088793",
+    00001066 => x"fa8894e3",
+    00001067 => x"00c12083",
+    00001068 => x"00812403",
+    00001069 => x"00412483",
+    00001070 => x"01010113",
+    00001071 => x"00008067",
+    00001072 => x"ff010113",
+    00001073 => x"00112623",
+    00001074 => x"00812423",
+    00001075 => x"00912223",
+    00001076 => x"01212023",
+    00001077 => x"800005b7",
+    00001078 => x"02c58493",
+    00001079 => x"0494c583",
+    00001080 => x"00050413",
+    00001081 => x"00058a63",
+    00001082 => x"00600513",
+    00001083 => x"00000097",
+    00001084 => x"7f4080e7",
+    00001085 => x"040484a3",
+    00001086 => x"01600493",
+    00001087 => x"00400913",
+    00001088 => x"00001097",
+    00001089 => x"804080e7",
+    00001090 => x"00950663",
+    00001091 => x"ff251ae3",
+    00001092 => x"0140006f",
+    00001093 => x"00600513",
+    00001094 => x"00000097",
+    00001095 => x"7c8080e7",
+    00001096 => x"fe1ff06f",
+    00001097 => x"01500513",
+    00001098 => x"00040463",
+    00001099 => x"00600513",
+    00001100 => x"00000097",
+    00001101 => x"7b0080e7",
+    00001102 => x"00000097",
+    00001103 => x"7c0080e7",
+    00001104 => x"fe051ce3",
+    00001105 => x"00005537",
+    00001106 => x"b0050513",
+    00001107 => x"00000593",
+    00001108 => x"00000613",
+    00001109 => x"00c12083",
+    00001110 => x"00812403",
+    00001111 => x"00412483",
+    00001112 => x"00012903",
+    00001113 => x"01010113",
+    00001114 => x"00000317",
+    00001115 => x"71c30067",
+    00001116 => x"fe010113",
+    00001117 => x"00112e23",
+    00001118 => x"00812c23",
+    00001119 => x"00912a23",
+    00001120 => x"01212823",
+    00001121 => x"00050413",
+    00001122 => x"00000097",
+    00001123 => x"51c080e7",
+    00001124 => x"00000513",
+    00001125 => x"00000097",
+    00001126 => x"664080e7",
+    00001127 => x"0d800513",
+    00001128 => x"00000097",
+    00001129 => x"694080e7",
+    00001130 => x"00812423",
+    00001131 => x"00200413",
+    00001132 => x"00810493",
+    00001133 => x"fff00913",
+    00001134 => x"00848533",
+    00001135 => x"00054503",
+    00001136 => x"00000097",
+    00001137 => x"674080e7",
+    00001138 => x"fff40413",
+    00001139 => x"ff2416e3",
+    00001140 => x"00000513",
+    00001141 => x"00000097",
+    00001142 => x"640080e7",
+    00001143 => x"01c12083",
+    00001144 => x"01812403",
+    00001145 => x"01412483",
+    00001146 => x"01012903",
+    00001147 => x"02010113",
+    00001148 => x"00000317",
+    00001149 => x"4e830067",
+    00001150 => x"ff010113",
+    00001151 => x"00112623",
+    00001152 => x"00812423",
+    00001153 => x"80000537",
+    00001154 => x"02c50413",
+    00001155 => x"04442503",
+    00001156 => x"04042583",
+    00001157 => x"02b56463",
+    00001158 => x"04944503",
+    00001159 => x"00050a63",
+    00001160 => x"00600513",
+    00001161 => x"00000097",
+    00001162 => x"6bc080e7",
+    00001163 => x"040404a3",
+    00001164 => x"00000097",
+    00001165 => x"02c080e7",
+    00001166 => x"fd5ff06f",
+    00001167 => x"00150593",
+    00001168 => x"04b42223",
+    00001169 => x"00850533",
+    00001170 => x"00054503",
+    00001171 => x"00c12083",
+    00001172 => x"00812403",
+    00001173 => x"01010113",
+    00001174 => x"00008067",
+    00001175 => x"fc010113",
+    00001176 => x"02112e23",
+    00001177 => x"02812c23",
+    00001178 => x"02912a23",
+    00001179 => x"03212823",
+    00001180 => x"03312623",
+    00001181 => x"03412423",
+    00001182 => x"03512223",
+    00001183 => x"03612023",
+    00001184 => x"01712e23",
+    00001185 => x"01812c23",
+    00001186 => x"01912a23",
+    00001187 => x"01a12823",
+    00001188 => x"01b12623",
+    00001189 => x"00000493",
+    00001190 => x"00000913",
+    00001191 => x"00300993",
+    00001192 => x"00100a13",
+    00001193 => x"ffff2537",
+    00001194 => x"ce050a93",
+    00001195 => x"fc000d93",
+    00001196 => x"80000537",
+    00001197 => x"02c50b93",
+    00001198 => x"02000c93",
+    00001199 => x"00400c13",
+    00001200 => x"00000097",
+    00001201 => x"644080e7",
+    00001202 => x"00a105a3",
+    00001203 => x"00a9ca63",
+    00001204 => x"03450663",
+    00001205 => x"00200593",
+    00001206 => x"0ab50a63",
+    00001207 => x"fe5ff06f",
+    00001208 => x"09850e63",
+    00001209 => x"01600593",
+    00001210 => x"fcb51ce3",
+    00001211 => x"00600513",
+    00001212 => x"00000097",
+    00001213 => x"5f0080e7",
+    00001214 => x"fc9ff06f",
+    00001215 => x"00000b13",
+    00001216 => x"fff00413",
+    00001217 => x"00b10513",
+    00001218 => x"00000097",
+    00001219 => x"298080e7",
+    00001220 => x"06051663",
+    00001221 => x"00b14503",
+    00001222 => x"000b0863",
+    00001223 => x"014b1a63",
+    00001224 => x"00050913",
+    00001225 => x"0140006f",
+    00001226 => x"00050493",
+    00001227 => x"00c0006f",
+    00001228 => x"00851593",
+    00001229 => x"0125e933",
+    00001230 => x"00a44533",
+    00001231 => x"00f57593",
+    00001232 => x"00259593",
+    00001233 => x"015585b3",
+    00001234 => x"0005a583",
+    00001235 => x"00455513",
+    00001236 => x"00b54533",
+    00001237 => x"00f57593",
+    00001238 => x"00259593",
+    00001239 => x"015585b3",
+    00001240 => x"0005a583",
+    00001241 => x"00455513",
+    00001242 => x"001b0b13",
+    00001243 => x"00b54433",
+    00001244 => x"f93b1ae3",
+    00001245 => x"fbf90513",
+    00001246 => x"0fb57663",
+    00001247 => x"01500513",
+    00001248 => x"00000097",
+    00001249 => x"560080e7",
+    00001250 => x"f39ff06f",
+    00001251 => x"00000c13",
+    00001252 => x"00000413",
+    00001253 => x"fff00b13",
+    00001254 => x"00b10513",
+    00001255 => x"00000097",
+    00001256 => x"204080e7",
+    00001257 => x"04051663",
+    00001258 => x"00b14503",
+    00001259 => x"00ab45b3",
+    00001260 => x"00f5f613",
+    00001261 => x"00261613",
+    00001262 => x"01560633",
+    00001263 => x"00062603",
+    00001264 => x"0045d593",
+    00001265 => x"00c5c5b3",
+    00001266 => x"00f5f613",
+    00001267 => x"00261613",
+    00001268 => x"01560633",
+    00001269 => x"00062603",
+    00001270 => x"0045d593",
+    00001271 => x"00c5cb33",
+    00001272 => x"01851533",
+    00001273 => x"008c0c13",
+    00001274 => x"00856433",
+    00001275 => x"fb9c16e3",
+    00001276 => x"00000d13",
+    00001277 => x"00000c13",
+    00001278 => x"00b10513",
+    00001279 => x"00000097",
+    00001280 => x"1a4080e7",
+    00001281 => x"10051e63",
+    00001282 => x"00b14503",
+    00001283 => x"01a51533",
+    00001284 => x"008d0d13",
+    00001285 => x"01856c33",
+    00001286 => x"ff9d10e3",
+    00001287 => x"fffb4513",
+    00001288 => x"00ac4533",
+    00001289 => x"00153513",
+    00001290 => x"008035b3",
+    00001291 => x"00b57533",
+    00001292 => x"0e050863",
+    00001293 => x"00600513",
+    00001294 => x"00000097",
+    00001295 => x"4a8080e7",
+    00001296 => x"00000097",
+    00001297 => x"4b8080e7",
+    00001298 => x"fe051ce3",
+    00001299 => x"00040513",
+    00001300 => x"00000593",
+    00001301 => x"00000613",
+    00001302 => x"00000097",
+    00001303 => x"42c080e7",
+    00001304 => x"e5dff06f",
+    00001305 => x"00000b13",
+    00001306 => x"00000c13",
+    00001307 => x"00490d93",
+    00001308 => x"00391513",
+    00001309 => x"40a00d33",
+    00001310 => x"00b10513",
+    00001311 => x"00000097",
+    00001312 => x"124080e7",
+    00001313 => x"06051263",
+    00001314 => x"00b14503",
+    00001315 => x"052c7263",
+    00001316 => x"00a445b3",
+    00001317 => x"00f5f613",
+    00001318 => x"00261613",
+    00001319 => x"01560633",
+    00001320 => x"00062603",
+    00001321 => x"0045d593",
+    00001322 => x"00c5c5b3",
+    00001323 => x"00f5f613",
+    00001324 => x"00261613",
+    00001325 => x"01560633",
+    00001326 => x"00062603",
+    00001327 => x"017c06b3",
+    00001328 => x"00a68023",
+    00001329 => x"0045d513",
+    00001330 => x"00c54433",
+    00001331 => x"00c0006f",
+    00001332 => x"01a51533",
+    00001333 => x"01656b33",
+    00001334 => x"001c0c13",
+    00001335 => x"008d0d13",
+    00001336 => x"f98d9ce3",
+    00001337 => x"000d8c13",
+    00001338 => x"01bc4533",
+    00001339 => x"016445b3",
+    00001340 => x"fff5c593",
+    00001341 => x"00b56533",
+    00001342 => x"02051c63",
+    00001343 => x"048bc583",
+    00001344 => x"0ff4f513",
+    00001345 => x"04b50063",
+    00001346 => x"fff58593",
+    00001347 => x"0ff5f593",
+    00001348 => x"fc000d93",
+    00001349 => x"00b51663",
+    00001350 => x"00600513",
+    00001351 => x"0080006f",
+    00001352 => x"01500513",
+    00001353 => x"00000097",
+    00001354 => x"3bc080e7",
+    00001355 => x"d91ff06f",
+    00001356 => x"01500513",
+    00001357 => x"00000097",
+    00001358 => x"3ac080e7",
+    00001359 => x"fc000d93",
+    00001360 => x"d7dff06f",
+    00001361 => x"80000537",
+    00001362 => x"02c50513",
+    00001363 => x"05252023",
+    00001364 => x"04052223",
+    00001365 => x"00148593",
+    00001366 => x"04b50423",
+    00001367 => x"00100593",
+    00001368 => x"04b504a3",
+    00001369 => x"03c12083",
+    00001370 => x"03812403",
+    00001371 => x"03412483",
+    00001372 => x"03012903",
+    00001373 => x"02c12983",
+    00001374 => x"02812a03",
+    00001375 => x"02412a83",
+    00001376 => x"02012b03",
+    00001377 => x"01c12b83",
+    00001378 => x"01812c03",
+    00001379 => x"01412c83",
+    00001380 => x"01012d03",
+    00001381 => x"00c12d83",
+    00001382 => x"04010113",
+    00001383 => x"00008067",
+    00001384 => x"ff010113",
+    00001385 => x"00112623",
+    00001386 => x"00812423",
+    00001387 => x"00912223",
+    00001388 => x"fe002583",
+    00001389 => x"00050413",
+    00001390 => x"0045d513",
+    00001391 => x"00150493",
+    00001392 => x"fff48493",
+    00001393 => x"02048463",
+    00001394 => x"00000097",
+    00001395 => x"34c080e7",
+    00001396 => x"fe0508e3",
+    00001397 => x"00000097",
+    00001398 => x"360080e7",
+    00001399 => x"00050593",
+    00001400 => x"00000513",
+    00001401 => x"00b40023",
+    00001402 => x"0080006f",
+    00001403 => x"00100513",
+    00001404 => x"00c12083",
+    00001405 => x"00812403",
+    00001406 => x"00412483",
+    00001407 => x"01010113",
+    00001408 => x"00008067",
+    00001409 => x"fe010113",
+    00001410 => x"00112e23",
+    00001411 => x"00812c23",
+    00001412 => x"00912a23",
+    00001413 => x"01212823",
+    00001414 => x"01312623",
+    00001415 => x"00058413",
+    00001416 => x"00050493",
+    00001417 => x"00000097",
+    00001418 => x"080080e7",
+    00001419 => x"00000513",
+    00001420 => x"00000097",
+    00001421 => x"1c8080e7",
+    00001422 => x"00200513",
+    00001423 => x"00200913",
+    00001424 => x"00000097",
+    00001425 => x"1f4080e7",
+    00001426 => x"00912423",
+    00001427 => x"00810493",
+    00001428 => x"fff00993",
+    00001429 => x"01248533",
+    00001430 => x"00054503",
+    00001431 => x"00000097",
+    00001432 => x"1d8080e7",
+    00001433 => x"fff90913",
+    00001434 => x"ff3916e3",
+    00001435 => x"00040513",
+    00001436 => x"00000097",
+    00001437 => x"1c4080e7",
+    00001438 => x"00000513",
+    00001439 => x"00000097",
+    00001440 => x"198080e7",
+    00001441 => x"01c12083",
+    00001442 => x"01812403",
+    00001443 => x"01412483",
+    00001444 => x"01012903",
+    00001445 => x"00c12983",
+    00001446 => x"02010113",
+    00001447 => x"00000317",
+    00001448 => x"03c30067",
+    00001449 => x"ff010113",
+    00001450 => x"00112623",
+    00001451 => x"00000513",
+    00001452 => x"00000097",
+    00001453 => x"148080e7",
+    00001454 => x"00600513",
+    00001455 => x"00000097",
+    00001456 => x"178080e7",
+    00001457 => x"00000513",
+    00001458 => x"00c12083",
+    00001459 => x"01010113",
+    00001460 => x"00000317",
+    00001461 => x"14430067",
+    00001462 => x"ff010113",
+    00001463 => x"00112623",
+    00001464 => x"00812423",
+    00001465 => x"00000513",
+    00001466 => x"00000097",
+    00001467 => x"110080e7",
+    00001468 => x"00500513",
+    00001469 => x"00000097",
+    00001470 => x"140080e7",
+    00001471 => x"00000513",
+    00001472 => x"00000097",
+    00001473 => x"134080e7",
+    00001474 => x"00050413",
+    00001475 => x"00000513",
+    00001476 => x"00000097",
+    00001477 => x"104080e7",
+    00001478 => x"00147513",
+    00001479 => x"fc0514e3",
+    00001480 => x"00c12083",
+    00001481 => x"00812403",
+    00001482 => x"01010113",
+    00001483 => x"00008067",
+    00001484 => x"fe802503",
+    00001485 => x"01055513",
+    00001486 => x"00157513",
+    00001487 => x"00008067",
+    00001488 => x"00100593",
+    00001489 => x"01f00613",
+    00001490 => x"00a595b3",
+    00001491 => x"00a64a63",
+    00001492 => x"fc802503",
+    00001493 => x"00b54533",
+    00001494 => x"fca02423",
+    00001495 => x"00008067",
+    00001496 => x"fcc02503",
+    00001497 => x"00b54533",
+    00001498 => x"fcc00593",
+    00001499 => x"00a5a023",
+    00001500 => x"00008067",
+    00001501 => x"fcb02623",
+    00001502 => x"fca02423",
+    00001503 => x"00008067",
+    00001504 => x"fe802503",
+    00001505 => x"01155513",
+    00001506 => x"00157513",
+    00001507 => x"00008067",
+    00001508 => x"f9402583",
+    00001509 => x"f9002503",
+    00001510 => x"f9402603",
+    00001511 => x"fec59ae3",
+    00001512 => x"00008067",
+    00001513 => x"fff00613",
+    00001514 => x"f8c02c23",
+    00001515 => x"f8b02e23",
+    00001516 => x"f8a02c23",
+    00001517 => x"00008067",
+    00001518 => x"fe802503",
+    00001519 => x"01355513",
+    00001520 => x"00157513",
+    00001521 => x"00008067",
+    00001522 => x"fa002423",
+    00001523 => x"00757513",
+    00001524 => x"00a51513",
+    00001525 => x"0015f593",
+    00001526 => x"00959593",
+    00001527 => x"00367613",
+    00001528 => x"00d61613",
+    00001529 => x"00a5e533",
+    00001530 => x"00c56533",
+    00001531 => x"10056513",
+    00001532 => x"faa02423",
+    00001533 => x"00008067",
+    00001534 => x"fa802583",
+    00001535 => x"00757513",
+    00001536 => x"00100613",
+    00001537 => x"00a61533",
+    00001538 => x"00a5e533",
+    00001539 => x"faa02423",
+    00001540 => x"00008067",
+    00001541 => x"00757513",
+    00001542 => x"fa802583",
+    00001543 => x"00100613",
+    00001544 => x"00a61533",
+    00001545 => x"fff54513",
+    00001546 => x"00a5f533",
+    00001547 => x"faa02423",
+    00001548 => x"00008067",
+    00001549 => x"fac00593",
+    00001550 => x"00a5a023",
+    00001551 => x"fa802503",
+    00001552 => x"fe054ee3",
+    00001553 => x"000205b7",
+    00001554 => x"fac02503",
+    00001555 => x"fa802603",
+    00001556 => x"00b67633",
+    00001557 => x"fe061ae3",
+    00001558 => x"00008067",
+    00001559 => x"fa802503",
+    00001560 => x"01755513",
+    00001561 => x"00f57513",
+    00001562 => x"00100593",
+    00001563 => x"00a59533",
+    00001564 => x"00008067",
+    00001565 => x"fe802503",
+    00001566 => x"01255513",
+    00001567 => x"00157513",
+    00001568 => x"00008067",
+    00001569 => x"ff010113",
+    00001570 => x"00112623",
+    00001571 => x"00812423",
+    00001572 => x"00912223",
+    00001573 => x"00060413",
+    00001574 => x"00058493",
+    00001575 => x"fa002023",
+    00001576 => x"00000097",
+    00001577 => x"0ec080e7",
+    00001578 => x"0034f593",
+    00001579 => x"01659593",
+    00001580 => x"00347613",
+    00001581 => x"01461613",
+    00001582 => x"00c5e5b3",
+    00001583 => x"00a5e533",
+    00001584 => x"100005b7",
+    00001585 => x"00b56533",
+    00001586 => x"faa02023",
+    00001587 => x"00c12083",
+    00001588 => x"00812403",
+    00001589 => x"00412483",
+    00001590 => x"01010113",
+    00001591 => x"00008067",
+    00001592 => x"000405b7",
+    00001593 => x"fa002603",
+    00001594 => x"00b67633",
+    00001595 => x"fe061ce3",
+    00001596 => x"faa02223",
+    00001597 => x"00008067",
+    00001598 => x"fa002503",
+    00001599 => x"01f55513",
+    00001600 => x"00008067",
+    00001601 => x"fa402503",
+    00001602 => x"fe055ee3",
+    00001603 => x"0ff57513",
+    00001604 => x"00008067",
+    00001605 => x"fa402583",
+    00001606 => x"00000513",
+    00001607 => x"0005c463",
+    00001608 => x"00008067",
+    00001609 => x"80000537",
+    00001610 => x"00b50423",
+    00001611 => x"00100513",
+    00001612 => x"00008067",
+    00001613 => x"80000537",
+    00001614 => x"00854503",
+    00001615 => x"00008067",
+    00001616 => x"00a00593",
+    00001617 => x"00040637",
+    00001618 => x"fa400693",
+    00001619 => x"00d00713",
+    00001620 => x"00054783",
+    00001621 => x"00b78663",
+    00001622 => x"00079c63",
+    00001623 => x"02c0006f",
+    00001624 => x"fa002803",
+    00001625 => x"00c87833",
+    00001626 => x"fe081ce3",
+    00001627 => x"00e6a023",
+    00001628 => x"00150513",
+    00001629 => x"fa002803",
+    00001630 => x"00c87833",
+    00001631 => x"fe081ce3",
+    00001632 => x"faf02223",
+    00001633 => x"fcdff06f",
+    00001634 => x"00008067",
+    00001635 => x"fe002583",
+    00001636 => x"00000893",
+    00001637 => x"00000693",
+    00001638 => x"00155613",
+    00001639 => x"00c58733",
+    00001640 => x"01f00793",
+    00001641 => x"00100813",
+    00001642 => x"fff00293",
+    00001643 => x"00189893",
+    00001644 => x"00f75333",
+    00001645 => x"00137313",
+    00001646 => x"011368b3",
+    00001647 => x"00a8e863",
+    00001648 => x"00f81333",
+    00001649 => x"0066e6b3",
+    00001650 => x"40a888b3",
+    00001651 => x"fff78793",
+    00001652 => x"fc579ee3",
+    00001653 => x"ff068713",
+    00001654 => x"00475713",
+    00001655 => x"0fe00793",
+    00001656 => x"00e7e663",
+    00001657 => x"00080537",
+    00001658 => x"0600006f",
+    00001659 => x"00f00713",
+    00001660 => x"06d76063",
+    00001661 => x"00000793",
+    00001662 => x"00000693",
+    00001663 => x"00159593",
+    00001664 => x"00c585b3",
+    00001665 => x"01f00613",
+    00001666 => x"00100713",
+    00001667 => x"fff00813",
+    00001668 => x"00179793",
+    00001669 => x"00c5d8b3",
+    00001670 => x"0018f893",
+    00001671 => x"00f8e7b3",
+    00001672 => x"00a7e863",
+    00001673 => x"00c718b3",
+    00001674 => x"0116e6b3",
+    00001675 => x"40a787b3",
+    00001676 => x"fff60613",
+    00001677 => x"fd061ee3",
+    00001678 => x"01000513",
+    00001679 => x"00d56463",
+    00001680 => x"01000693",
+    00001681 => x"01080537",
+    00001682 => x"00a6e533",
+    00001683 => x"00008067",
+    00001684 => x"00000813",
+    00001685 => x"00000613",
+    00001686 => x"00151513",
+    00001687 => x"01f00693",
+    00001688 => x"00100713",
+    00001689 => x"fff00793",
+    00001690 => x"00181813",
+    00001691 => x"00d5d8b3",
+    00001692 => x"0018f893",
+    00001693 => x"0108e833",
+    00001694 => x"00a86863",
+    00001695 => x"00d718b3",
+    00001696 => x"01166633",
+    00001697 => x"40a80833",
+    00001698 => x"fff68693",
+    00001699 => x"fcf69ee3",
+    00001700 => x"00001737",
+    00001701 => x"fff70513",
+    00001702 => x"02a66c63",
+    00001703 => x"00000513",
+    00001704 => x"00400593",
+    00001705 => x"010006b7",
+    00001706 => x"ffe70713",
+    00001707 => x"ffd5f813",
+    00001708 => x"00300793",
+    00001709 => x"00080463",
+    00001710 => x"00100793",
+    00001711 => x"00f65633",
+    00001712 => x"fff58593",
+    00001713 => x"00d50533",
+    00001714 => x"fec762e3",
+    00001715 => x"0080006f",
+    00001716 => x"00000513",
+    00001717 => x"fff60593",
+    00001718 => x"00b56533",
+    00001719 => x"00008067",
+    00001720 => x"75410a0a",
+    00001721 => x"6f626f74",
+    00001722 => x"6920746f",
+    00001723 => x"7338206e",
+    00001724 => x"7250202e",
+    00001725 => x"20737365",
+    00001726 => x"2079656b",
+    00001727 => x"61206f74",
+    00001728 => x"74726f62",
+    00001729 => x"0a000a2e",
+    00001730 => x"4358455b",
+    00001731 => x"72570020",
+    00001732 => x"20657469",
+    00001733 => x"766e4900",
+    00001734 => x"64696c61",
+    00001735 => x"444d4320",
+    00001736 => x"79622000",
+    00001737 => x"20736574",
+    00001738 => x"62200040",
+    00001739 => x"73657479",
+    00001740 => x"206f7420",
+    00001741 => x"20495053",
+    00001742 => x"73616c66",
+    00001743 => x"20402068",
+    00001744 => x"004b4f00",
+    00001745 => x"53494d0a",
+    00001746 => x"00203a41",
+    00001747 => x"746f6f42",
+    00001748 => x"2e676e69",
+    00001749 => x"0a0a2e2e",
+    00001750 => x"206f4e00",
+    00001751 => x"63657865",
+    00001752 => x"62617475",
+    00001753 => x"6120656c",
+    00001754 => x"6c696176",
+    00001755 => x"656c6261",
+    00001756 => x"7830002e",
+    00001757 => x"616f4c00",
+    00001758 => x"676e6964",
+    00001759 => x"202e2e2e",
+    00001760 => x"000a5d00",
+    00001761 => x"444d430a",
+    00001762 => x"00203e3a",
+    00001763 => x"69617641",
+    00001764 => x"6c62616c",
+    00001765 => x"4d432065",
+    00001766 => x"0a3a7344",
+    00001767 => x"203a6820",
+    00001768 => x"706c6548",
+    00001769 => x"3a72200a",
+    00001770 => x"73655220",
+    00001771 => x"74726174",
+    00001772 => x"3a75200a",
+    00001773 => x"6c705520",
+    00001774 => x"0a64616f",
+    00001775 => x"203a7820",
+    00001776 => x"6f6c7055",
+    00001777 => x"28206461",
+    00001778 => x"636f6c62",
+    00001779 => x"7270206b",
+    00001780 => x"636f746f",
+    00001781 => x"0a296c6f",
+    00001782 => x"203a7320",
+    00001783 => x"726f7453",
+    00001784 => x"6f742065",
+    00001785 => x"616c6620",
+    00001786 => x"200a6873",
+    00001787 => x"4c203a6c",
+    00001788 => x"2064616f",
+    00001789 => x"6d6f7266",
+    00001790 => x"616c6620",
+    00001791 => x"200a6873",
+    00001792 => x"45203a65",
+    00001793 => x"75636578",
+    00001794 => x"0a006574",
+    00001795 => x"3a4b4c43",
+    00001796 => x"0a002020",
+    00001797 => x"4d454d49",
+    00001798 => x"4100203a",
+    00001799 => x"74696177",
+    00001800 => x"20676e69",
+    00001801 => x"636f6c62",
+    00001802 => x"7075206b",
+    00001803 => x"64616f6c",
+    00001804 => x"202e2e2e",
+    00001805 => x"0a000a00",
+    00001806 => x"4d454d44",
+    00001807 => x"4100203a",
+    00001808 => x"74726f62",
+    00001809 => x"0a2e6465",
+    00001810 => x"0a07000a",
+    00001811 => x"4f525245",
+    00001812 => x"3f005f52",
+    00001813 => x"2f792820",
+    00001814 => x"0020296e",
+    00001815 => x"3c0a0a0a",
+    00001816 => x"454e203c",
+    00001817 => x"3356524f",
+    00001818 => x"6f422032",
+    00001819 => x"6f6c746f",
+    00001820 => x"72656461",
+    00001821 => x"0a3e3e20",
+    00001822 => x"444c420a",
+    00001823 => x"4f203a56",
+    00001824 => x"31207463",
+    00001825 => x"30322038",
+    00001826 => x"480a3632",
+    00001827 => x"203a5657",
+    00001828 => x"500a0020",
+    00001829 => x"3a434f52",
+    00001830 => x"5a0a0020",
+    00001831 => x"3a545845",
+    00001832 => x"460a0020",
+    00001833 => x"6873616c",
+    00001834 => x"2e676e69",
+    00001835 => x"00202e2e",
+    00001836 => x"69617741",
+    00001837 => x"676e6974",
+    00001838 => x"6f656e20",
+    00001839 => x"32337672",
+    00001840 => x"6578655f",
+    00001841 => x"6e69622e",
+    00001842 => x"202e2e2e",
+    00001843 => x"32313000",
+    00001844 => x"36353433",
+    00001845 => x"61393837",
+    00001846 => x"65646362",
+    00001847 => x"00000066",
+    00001848 => x"00000000",
+    00001849 => x"1db71064",
+    00001850 => x"3b6e20c8",
+    00001851 => x"26d930ac",
+    00001852 => x"76dc4190",
+    00001853 => x"6b6b51f4",
+    00001854 => x"4db26158",
+    00001855 => x"5005713c",
+    00001856 => x"edb88320",
+    00001857 => x"f00f9344",
+    00001858 => x"d6d6a3e8",
+    00001859 => x"cb61b38c",
+    00001860 => x"9b64c2b0",
+    00001861 => x"86d3d2d4",
+    00001862 => x"a00ae278",
+    00001863 => x"bdbdf21c"
   );
 
 end neorv32_bootloader_image;
@@ -0,0 +1,276 @@
+-- #################################################################################################
+-- # << NEORV32 - Multi-Port Bus Arbiter >>                                                        #
+-- # ********************************************************************************************* #
+-- # Allows to access a single peripheral bus ("p_bus") by NUM_PORTS controller busses ("m_bus").  #
+-- # The controller ports are packed into flat vectors (port i occupies slice i). Access requests  #
+-- # are served in round-robin order. If the current bus owner asserts its "lock" signal (atomic   #
+-- # LR/SC sequence) the arbiter does not grant the bus to any other port until the lock is        #
+-- # released. This makes the reservation of a hart visible to all other bus controllers.          #
+-- # ********************************************************************************************* #
+-- # BSD 3-Clause License                                                                          #
+-- #                                                                                               #
+-- # Copyright (c) 2021, Stephan Nolting. All rights reserved.                                     #
+-- #                                                                                               #
+-- # Redistribution and use in source and binary forms, with or without modification, are          #
+-- # permitted provided that the following conditions are met:                                     #
+-- #                                                                                               #
+-- # 1. Redistributions of source code must retain the above copyright notice, this list of        #
+-- #    conditions and the following disclaimer.                                                   #
+-- #                                                                                               #
+-- # 2. Redistributions in binary form must reproduce the above copyright notice, this list of     #
+-- #    conditions and the following disclaimer in the documentation and/or other materials        #
+-- #    provided with the distribution.                                                            #
+-- #                                                                                               #
+-- # 3. Neither the name of the copyright holder nor the names of its contributors may be used to  #
+-- #    endorse or promote products derived from this software without specific prior written      #
+-- #    permission.                                                                                #
+-- #                                                                                               #
+-- # THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS   #
+-- # OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF               #
+-- # MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE    #
+-- # COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,     #
+-- # EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE #
+-- # GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED    #
+-- # AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING     #
+-- # NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED  #
+-- # OF THE POSSIBILITY OF SUCH DAMAGE.                                                            #
+-- # ********************************************************************************************* #
+-- # The NEORV32 Processor - https://github.com/stnolting/neorv32              (c) Stephan Nolting #
+-- #################################################################################################
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library neorv32;
+use neorv32.neorv32_package.all;
+
+entity neorv32_bus_arbiter is
+  generic (
+    NUM_PORTS : natural -- number of controller ports (1..8)
+  );
+  port (
+    -- global control --
+    clk_i         : in  std_ulogic; -- global clock, rising edge
+    rstn_i        : in  std_ulogic; -- global reset, low-active, async
+    -- controller interfaces (packed) --
+    m_bus_addr_i  : in  std_ulogic_vector(NUM_PORTS*data_width_c-1 downto 0); -- bus access address
+    m_bus_rdata_o : out std_ulogic_vector(data_width_c-1 downto 0); -- bus read data (shared by all ports)
+    m_bus_wdata_i : in  std_ulogic_vector(NUM_PORTS*data_width_c-1 downto 0); -- bus write data
+    m_bus_ben_i   : in  std_ulogic_vector(NUM_PORTS*4-1 downto 0); -- byte enable
+    m_bus_we_i    : in  std_ulogic_vector(NUM_PORTS-1 downto 0); -- write enable
+    m_bus_re_i    : in  std_ulogic_vector(NUM_PORTS-1 downto 0); -- read enable
+    m_bus_lock_i  : in  std_ulogic_vector(NUM_PORTS-1 downto 0); -- exclusive access request
+    m_bus_src_i   : in  std_ulogic_vector(NUM_PORTS-1 downto 0); -- access source (1=instruction fetch, 0=data access)
+    m_bus_priv_i  : in  std_ulogic_vector(NUM_PORTS*2-1 downto 0); -- current privilege level
+    m_bus_ack_o   : out std_ulogic_vector(NUM_PORTS-1 downto 0); -- bus transfer acknowledge
+    m_bus_err_o   : out std_ulogic_vector(NUM_PORTS-1 downto 0); -- bus transfer error
+    -- peripheral bus --
+    p_bus_sel_o   : out std_ulogic_vector(NUM_PORTS-1 downto 0); -- one-hot: currently selected controller port
+    p_bus_src_o   : out std_ulogic; -- access source of selected port
+    p_bus_priv_o  : out std_ulogic_vector(1 downto 0); -- privilege level of selected port
+    p_bus_addr_o  : out std_ulogic_vector(data_width_c-1 downto 0); -- bus access address
+    p_bus_rdata_i : in  std_ulogic_vector(data_width_c-1 downto 0); -- bus read data
+    p_bus_wdata_o : out std_ulogic_vector(data_width_c-1 downto 0); -- bus write data
+    p_bus_ben_o   : out std_ulogic_vector(03 downto 0); -- byte enable
+    p_bus_we_o    : out std_ulogic; -- write enable
+    p_bus_re_o    : out std_ulogic; -- read enable
+    p_bus_lock_o  : out std_ulogic; -- exclusive access request
+    p_bus_ack_i   : in  std_ulogic; -- bus transfer acknowledge
+    p_bus_err_i   : in  std_ulogic  -- bus transfer error
+  );
+end neorv32_bus_arbiter;
+
+architecture neorv32_bus_arbiter_rtl of neorv32_bus_arbiter is
+
+  -- access requests --
+  signal rd_req_buf, wr_req_buf : std_ulogic_vector(NUM_PORTS-1 downto 0);
+  signal req_current            : std_ulogic_vector(NUM_PORTS-1 downto 0);
+  signal req_buffered           : std_ulogic_vector(NUM_PORTS-1 downto 0);
+
+  -- internal bus lines --
+  signal m_bus_ack, m_bus_err : std_ulogic_vector(NUM_PORTS-1 downto 0);
+
+  -- access arbiter --
+  type arbiter_state_t is (IDLE, BUSY, RETIRE);
+  type arbiter_t is record
+    state     : arbiter_state_t;
+    state_nxt : arbiter_state_t;
+    owner     : natural range 0 to NUM_PORTS-1; -- last/current bus owner
+    owner_nxt : natural range 0 to NUM_PORTS-1;
+    bus_sel   : natural range 0 to NUM_PORTS-1; -- port that is currently connected to the peripheral bus
+    re_trig   : std_ulogic;
+    we_trig   : std_ulogic;
+  end record;
+  signal arbiter : arbiter_t;
+
+  -- selected port --
+  signal sel : std_ulogic_vector(NUM_PORTS-1 downto 0); -- one-hot
+
+begin
+
+  -- Sanity Checks --------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  assert not ((NUM_PORTS < 1) or (NUM_PORTS > 8)) report "NEORV32 PROCESSOR CONFIG ERROR! Bus arbiter <NUM_PORTS> has to be 1..8." severity error;
+
+
+  -- Access Buffer --------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  access_buffer: process(rstn_i, clk_i)
+  begin
+    if (rstn_i = '0') then
+      rd_req_buf <= (others => '0');
+      wr_req_buf <= (others => '0');
+    elsif rising_edge(clk_i) then
+      for i in 0 to NUM_PORTS-1 loop
+        if (rd_req_buf(i) = '0') and (wr_req_buf(i) = '0') then -- idle
+          rd_req_buf(i) <= m_bus_re_i(i);
+          wr_req_buf(i) <= m_bus_we_i(i);
+        elsif (m_bus_err(i) = '1') or -- error termination
+              (m_bus_ack(i) = '1') then -- normal termination
+          rd_req_buf(i) <= '0';
+          wr_req_buf(i) <= '0';
+        end if;
+      end loop; -- i
+    end if;
+  end process access_buffer;
+
+  -- any current/buffered requests? --
+  req_current  <= m_bus_re_i or m_bus_we_i;
+  req_buffered <= rd_req_buf or wr_req_buf;
+
+
+  -- Access Arbiter Sync --------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  -- for registers that require a specific reset state --
+  arbiter_sync: process(rstn_i, clk_i)
+  begin
+    if (rstn_i = '0') then
+      arbiter.state <= IDLE;
+      arbiter.owner <= 0;
+    elsif rising_edge(clk_i) then
+      arbiter.state <= arbiter.state_nxt;
+      arbiter.owner <= arbiter.owner_nxt;
+    end if;
+  end process arbiter_sync;
+
+
+  -- Peripheral Bus Arbiter -----------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  arbiter_comb: process(arbiter, req_current, req_buffered, rd_req_buf, wr_req_buf, m_bus_lock_i, p_bus_ack_i, p_bus_err_i)
+    variable port_v  : natural range 0 to NUM_PORTS-1;
+    variable found_v : boolean;
+  begin
+    -- arbiter defaults --
+    arbiter.state_nxt <= arbiter.state;
+    arbiter.owner_nxt <= arbiter.owner;
+    arbiter.bus_sel   <= arbiter.owner;
+    arbiter.we_trig   <= '0';
+    arbiter.re_trig   <= '0';
+
+    -- state machine --
+    case arbiter.state is
+
+      when IDLE => -- wait for (next) request
+      -- ------------------------------------------------------------
+        found_v := false;
+        port_v  := arbiter.owner;
+        if (m_bus_lock_i(arbiter.owner) = '1') then -- current owner holds an exclusive lock -> only owner is allowed to continue
+          found_v := (req_current(arbiter.owner) = '1') or (req_buffered(arbiter.owner) = '1');
+        else -- round-robin: start searching at the port following the last owner
+          for i in 1 to NUM_PORTS loop
+            if (found_v = false) and ((req_current((arbiter.owner + i) mod NUM_PORTS) = '1') or (req_buffered((arbiter.owner + i) mod NUM_PORTS) = '1')) then
+              port_v  := (arbiter.owner + i) mod NUM_PORTS;
+              found_v := true;
+            end if;
+          end loop; -- i
+        end if;
+        --
+        if found_v then
+          arbiter.bus_sel   <= port_v;
+          arbiter.owner_nxt <= port_v;
+          if (req_current(port_v) = '1') then -- current request?
+            arbiter.state_nxt <= BUSY;
+          else -- buffered request
+            arbiter.state_nxt <= RETIRE;
+          end if;
+        end if;
+
+      when RETIRE => -- retire pending (buffered) access
+      -- ------------------------------------------------------------
+        arbiter.we_trig   <= wr_req_buf(arbiter.owner);
+        arbiter.re_trig   <= rd_req_buf(arbiter.owner);
+        arbiter.state_nxt <= BUSY;
+
+      when BUSY => -- transaction in progress
+      -- ------------------------------------------------------------
+        if (p_bus_err_i = '1') or -- error termination
+           (p_bus_ack_i = '1') then -- normal termination
+          arbiter.state_nxt <= IDLE;
+        end if;
+
+      when others => -- undefined
+      -- ------------------------------------------------------------
+        arbiter.state_nxt <= IDLE;
+
+    end case;
+  end process arbiter_comb;
+
+  -- one-hot port select --
+  port_select: process(arbiter.bus_sel)
+  begin
+    sel <= (others => '0');
+    sel(arbiter.bus_sel) <= '1';
+  end process port_select;
+
+  p_bus_sel_o <= sel;
+
+
+  -- Peripheral Bus Switch ------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  bus_switch: process(sel, arbiter, m_bus_addr_i, m_bus_wdata_i, m_bus_ben_i, m_bus_we_i, m_bus_re_i, m_bus_lock_i, m_bus_src_i, m_bus_priv_i)
+    variable addr_v, wdata_v : std_ulogic_vector(data_width_c-1 downto 0);
+    variable ben_v           : std_ulogic_vector(03 downto 0);
+    variable priv_v          : std_ulogic_vector(01 downto 0);
+    variable we_v, re_v      : std_ulogic;
+    variable lock_v, src_v   : std_ulogic;
+  begin
+    addr_v  := (others => '0');
+    wdata_v := (others => '0');
+    ben_v   := (others => '0');
+    priv_v  := (others => '0');
+    we_v    := '0';
+    re_v    := '0';
+    lock_v  := '0';
+    src_v   := '0';
+    for i in 0 to NUM_PORTS-1 loop -- AND-OR multiplexer
+      if (sel(i) = '1') then
+        addr_v  := addr_v  or m_bus_addr_i(i*data_width_c+data_width_c-1 downto i*data_width_c);
+        wdata_v := wdata_v or m_bus_wdata_i(i*data_width_c+data_width_c-1 downto i*data_width_c);
+        ben_v   := ben_v   or m_bus_ben_i(i*4+3 downto i*4);
+        priv_v  := priv_v  or m_bus_priv_i(i*2+1 downto i*2);
+        we_v    := we_v    or m_bus_we_i(i);
+        re_v    := re_v    or m_bus_re_i(i);
+        lock_v  := lock_v  or m_bus_lock_i(i);
+        src_v   := src_v   or m_bus_src_i(i);
+      end if;
+    end loop; -- i
+    p_bus_addr_o  <= addr_v;
+    p_bus_wdata_o <= wdata_v;
+    p_bus_ben_o   <= ben_v;
+    p_bus_priv_o  <= priv_v;
+    p_bus_we_o    <= we_v or arbiter.we_trig;
+    p_bus_re_o    <= re_v or arbiter.re_trig;
+    p_bus_lock_o  <= lock_v;
+    p_bus_src_o   <= src_v;
+  end process bus_switch;
+
+  m_bus_rdata_o <= p_bus_rdata_i;
+
+  m_bus_ack     <= sel when (p_bus_ack_i = '1') else (others => '0');
+  m_bus_err     <= sel when (p_bus_err_i = '1') else (others => '0');
+  m_bus_ack_o   <= m_bus_ack;
+  m_bus_err_o   <= m_bus_err;
+
+
+end neorv32_bus_arbiter_rtl;
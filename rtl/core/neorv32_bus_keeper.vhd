@@ -56,9 +56,18 @@ entity neorv32_bus_keeper is
     -- Internal instruction memory --
     MEM_INT_IMEM_EN   : boolean; -- implement processor-internal instruction memory
     MEM_INT_IMEM_SIZE : natural; -- size of processor-internal instruction memory in bytes
+    MEM_INT_IMEM_BASE : std_ulogic_vector(31 downto 0); -- base address of processor-internal instruction memory
     -- Internal data memory --
     MEM_INT_DMEM_EN   : boolean; -- implement processor-internal data memory
-    MEM_INT_DMEM_SIZE : natural  -- size of processor-internal data memory in bytes
+    MEM_INT_DMEM_SIZE : natural; -- size of processor-internal data memory in bytes
+    MEM_INT_DMEM_BASE : std_ulogic_vector(31 downto 0); -- base address of processor-internal data memory
+    -- Additional internal memory banks --
+    MEM_INT_XMEM_BASE : xmem_base_t; -- base addresses of additional internal memory banks
+    MEM_INT_XMEM_SIZE : xmem_size_t; -- sizes of additional internal memory banks in bytes (0 = not implemented)
+    -- Execute in place flash window --
+    XIP_EN            : boolean; -- implement execute-in-place flash controller
+    XIP_BASE          : std_ulogic_vector(31 downto 0); -- base address of the memory-mapped flash window
+    XIP_SIZE          : natural   -- size of the memory-mapped flash window in bytes
   );
   port (
     -- host access --
@@ -79,7 +88,9 @@ architecture neorv32_bus_keeper_rtl of neorv32_bus_keeper is
   type access_check_t is record
     int_imem       : std_ulogic;
     int_dmem       : std_ulogic;
+    int_xmem       : std_ulogic;
     int_bootrom_io : std_ulogic;
+    xip            : std_ulogic;
     valid          : std_ulogic;
   end record;
   signal access_check : access_check_t;
@@ -101,13 +112,16 @@ begin
 
   -- Access Control -------------------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
-  -- access to processor-internal IMEM or DMEM? --
-  access_check.int_imem <= '1' when (addr_i(31 downto index_size_f(MEM_INT_IMEM_SIZE)) = imem_base_c(31 downto index_size_f(MEM_INT_IMEM_SIZE))) and (MEM_INT_IMEM_EN = true) else '0';
-  access_check.int_dmem <= '1' when (addr_i(31 downto index_size_f(MEM_INT_DMEM_SIZE)) = dmem_base_c(31 downto index_size_f(MEM_INT_DMEM_SIZE))) and (MEM_INT_DMEM_EN = true) else '0';
+  -- access to processor-internal IMEM, DMEM or additional memory banks? --
+  access_check.int_imem <= '1' when (addr_i(31 downto index_size_f(MEM_INT_IMEM_SIZE)) = MEM_INT_IMEM_BASE(31 downto index_size_f(MEM_INT_IMEM_SIZE))) and (MEM_INT_IMEM_EN = true) else '0';
+  access_check.int_dmem <= '1' when (addr_i(31 downto index_size_f(MEM_INT_DMEM_SIZE)) = MEM_INT_DMEM_BASE(31 downto index_size_f(MEM_INT_DMEM_SIZE))) and (MEM_INT_DMEM_EN = true) else '0';
+  access_check.int_xmem <= xmem_access_f(addr_i, MEM_INT_XMEM_BASE, MEM_INT_XMEM_SIZE);
   -- access to processor-internal BOOTROM or IO devices? --
   access_check.int_bootrom_io <= '1' when (addr_i(31 downto 16) = boot_rom_base_c(31 downto 16)) else '0'; -- hacky!
+  -- access to the XIP flash window? (not monitored: XIP module terminates its own accesses) --
+  access_check.xip <= '1' when (addr_i(31 downto index_size_f(XIP_SIZE)) = XIP_BASE(31 downto index_size_f(XIP_SIZE))) and (XIP_EN = true) else '0';
   -- actual internal bus access? --
-  access_check.valid <= access_check.int_imem or access_check.int_dmem or access_check.int_bootrom_io;
+  access_check.valid <= access_check.int_imem or access_check.int_dmem or access_check.int_xmem or access_check.int_bootrom_io;
 
 
   -- Keeper ---------------------------------------------------------------------------------
@@ -123,7 +137,7 @@ begin
       -- pending access? --
       control.bus_err <= '0';
       if (control.pending = '0') then -- idle
-        if ((rden_i or wren_i) = '1') and ((access_check.valid = '1') or (MEM_EXT_EN = false)) then -- valid INTERNAL access
+        if ((rden_i or wren_i) = '1') and ((access_check.valid = '1') or (MEM_EXT_EN = false)) and (access_check.xip = '0') then -- valid INTERNAL access
           control.pending <= '1';
         end if;
       else -- pending
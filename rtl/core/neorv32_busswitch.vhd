@@ -2,7 +2,9 @@
 -- # << NEORV32 - Bus Switch >>                                                                    #
 -- # ********************************************************************************************* #
 -- # Allows to access a single peripheral bus ("p_bus") by two controller busses. Controller port  #
--- # A ("ca_bus") has priority over controller port B ("cb_bus").                                  #
+-- # A ("ca_bus") has priority over controller port B ("cb_bus"). Optionally, accesses of          #
+-- # controller port B can be routed to a dedicated read-only crossbar bus ("x_bus") so they can   #
+-- # be processed in parallel to accesses of controller port A.                                    #
 -- # ********************************************************************************************* #
 -- # BSD 3-Clause License                                                                          #
 -- #                                                                                               #
@@ -45,7 +47,8 @@ use neorv32.neorv32_package.all;
 entity neorv32_busswitch is
   generic (
     PORT_CA_READ_ONLY : boolean; -- set if controller port A is read-only
-    PORT_CB_READ_ONLY : boolean  -- set if controller port B is read-only
+    PORT_CB_READ_ONLY : boolean; -- set if controller port B is read-only
+    PORT_CB_XBAR      : boolean  -- implement dedicated (crossbar) read path for controller port B
   );
   port (
     -- global control --
@@ -71,6 +74,7 @@ entity neorv32_busswitch is
     cb_bus_lock_i   : in  std_ulogic; -- exclusive access request
     cb_bus_ack_o    : out std_ulogic; -- bus transfer acknowledge
     cb_bus_err_o    : out std_ulogic; -- bus transfer error
+    cb_bus_xsel_i   : in  std_ulogic := '0'; -- route access to crossbar port
     -- peripheral bus --
     p_bus_src_o     : out std_ulogic; -- access source: 0 = A, 1 = B
     p_bus_addr_o    : out std_ulogic_vector(data_width_c-1 downto 0); -- bus access address
@@ -81,7 +85,13 @@ entity neorv32_busswitch is
     p_bus_re_o      : out std_ulogic; -- read enable
     p_bus_lock_o    : out std_ulogic; -- exclusive access request
     p_bus_ack_i     : in  std_ulogic; -- bus transfer acknowledge
-    p_bus_err_i     : in  std_ulogic  -- bus transfer error
+    p_bus_err_i     : in  std_ulogic; -- bus transfer error
+    -- crossbar bus (controller B only, read-only) --
+    x_bus_addr_o    : out std_ulogic_vector(data_width_c-1 downto 0); -- bus access address
+    x_bus_rdata_i   : in  std_ulogic_vector(data_width_c-1 downto 0) := (others => '0'); -- bus read data
+    x_bus_re_o      : out std_ulogic; -- read enable
+    x_bus_ack_i     : in  std_ulogic := '0'; -- bus transfer acknowledge
+    x_bus_err_i     : in  std_ulogic := '0'  -- bus transfer error
   );
 end neorv32_busswitch;
 
@@ -93,6 +103,10 @@ architecture neorv32_busswitch_rtl of neorv32_busswitch is
   signal ca_req_current, ca_req_buffered : std_ulogic;
   signal cb_req_current, cb_req_buffered : std_ulogic;
 
+  -- crossbar --
+  signal cb_xsel,   cb_xbar   : std_ulogic; -- crossbar access request / crossbar access in progress
+  signal cb_bus_re, cb_bus_we : std_ulogic; -- controller B requests to the peripheral bus
+
   -- internal bus lines --
   signal ca_bus_ack, cb_bus_ack : std_ulogic;
   signal ca_bus_err, cb_bus_err : std_ulogic;
@@ -134,8 +148,8 @@ begin
 
       -- controller B requests --
       if (cb_rd_req_buf = '0') and (cb_wr_req_buf = '0') then
-        cb_rd_req_buf <= cb_bus_re_i;
-        cb_wr_req_buf <= cb_bus_we_i;
+        cb_rd_req_buf <= cb_bus_re;
+        cb_wr_req_buf <= cb_bus_we;
       elsif (cb_bus_err = '1') or -- error termination
             (cb_bus_ack = '1') then -- normal termination
         cb_rd_req_buf <= '0';
@@ -147,7 +161,7 @@ begin
 
   -- any current requests? --
   ca_req_current <= (ca_bus_re_i or ca_bus_we_i) when (PORT_CA_READ_ONLY = false) else ca_bus_re_i;
-  cb_req_current <= (cb_bus_re_i or cb_bus_we_i) when (PORT_CB_READ_ONLY = false) else cb_bus_re_i;
+  cb_req_current <= (cb_bus_re or cb_bus_we) when (PORT_CB_READ_ONLY = false) else cb_bus_re;
 
   -- any buffered requests? --
   ca_req_buffered <= (ca_rd_req_buf or ca_wr_req_buf) when (PORT_CA_READ_ONLY = false) else ca_rd_req_buf;
@@ -253,24 +267,48 @@ begin
                     ca_bus_wdata_i  when (arbiter.bus_sel = '0')    else cb_bus_wdata_i;
   p_bus_ben_o    <= cb_bus_ben_i    when (PORT_CA_READ_ONLY = true) else ca_bus_ben_i   when (PORT_CB_READ_ONLY = true) else
                     ca_bus_ben_i    when (arbiter.bus_sel = '0')    else cb_bus_ben_i;
-  p_bus_we       <= ca_bus_we_i     when (arbiter.bus_sel = '0')    else cb_bus_we_i;
-  p_bus_re       <= ca_bus_re_i     when (arbiter.bus_sel = '0')    else cb_bus_re_i;
+  p_bus_we       <= ca_bus_we_i     when (arbiter.bus_sel = '0')    else cb_bus_we;
+  p_bus_re       <= ca_bus_re_i     when (arbiter.bus_sel = '0')    else cb_bus_re;
   p_bus_we_o     <= (p_bus_we or arbiter.we_trig);
   p_bus_re_o     <= (p_bus_re or arbiter.re_trig);
   p_bus_lock_o   <= ca_bus_lock_i or cb_bus_lock_i;
 
   ca_bus_rdata_o <= p_bus_rdata_i;
-  cb_bus_rdata_o <= p_bus_rdata_i;
+  cb_bus_rdata_o <= x_bus_rdata_i when (cb_xbar = '1') else p_bus_rdata_i;
 
   ca_bus_ack     <= p_bus_ack_i and (not arbiter.bus_sel);
   cb_bus_ack     <= p_bus_ack_i and (    arbiter.bus_sel);
   ca_bus_ack_o   <= ca_bus_ack;
-  cb_bus_ack_o   <= cb_bus_ack;
+  cb_bus_ack_o   <= cb_bus_ack or (x_bus_ack_i and cb_xbar);
 
   ca_bus_err     <= p_bus_err_i and (not arbiter.bus_sel);
   cb_bus_err     <= p_bus_err_i and (    arbiter.bus_sel);
   ca_bus_err_o   <= ca_bus_err;
-  cb_bus_err_o   <= cb_bus_err;
+  cb_bus_err_o   <= cb_bus_err or (x_bus_err_i and cb_xbar);
+
+
+  -- Crossbar Bus ---------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  -- controller B accesses that are routed to the crossbar bus bypass the arbiter --
+  cb_xsel   <= cb_bus_xsel_i when (PORT_CB_XBAR = true) else '0';
+  cb_bus_re <= cb_bus_re_i and (not cb_xsel);
+  cb_bus_we <= cb_bus_we_i and (not cb_xsel);
+
+  crossbar_access: process(rstn_i, clk_i)
+  begin
+    if (rstn_i = '0') then
+      cb_xbar <= '0';
+    elsif rising_edge(clk_i) then
+      if (cb_xbar = '0') then -- idle
+        cb_xbar <= cb_bus_re_i and cb_xsel;
+      elsif (x_bus_ack_i = '1') or (x_bus_err_i = '1') then -- normal or error termination
+        cb_xbar <= '0';
+      end if;
+    end if;
+  end process crossbar_access;
+
+  x_bus_addr_o <= cb_bus_addr_i;
+  x_bus_re_o   <= cb_bus_re_i and cb_xsel;
 
 
 end neorv32_busswitch_rtl;
@@ -0,0 +1,179 @@
+-- #################################################################################################
+-- # << NEORV32 - Core-Local Interruptor (CLINT) >>                                                #
+-- # ********************************************************************************************* #
+-- # Per-hart machine software interrupt ("msip") and machine timer compare ("mtimecmp[h]")        #
+-- # registers for multi-hart (SMP) configurations. The system time is provided by the MTIME unit  #
+-- # (or the external time input). Only required/implemented if there is more than one hart.       #
+-- # Note: The 64-bit comparators are de-coupled into two 32-bit systems (like in MTIME).          #
+-- # ********************************************************************************************* #
+-- # BSD 3-Clause License                                                                          #
+-- #                                                                                               #
+-- # Copyright (c) 2021, Stephan Nolting. All rights reserved.                                     #
+-- #                                                                                               #
+-- # Redistribution and use in source and binary forms, with or without modification, are          #
+-- # permitted provided that the following conditions are met:                                     #
+-- #                                                                                               #
+-- # 1. Redistributions of source code must retain the above copyright notice, this list of        #
+-- #    conditions and the following disclaimer.                                                   #
+-- #                                                                                               #
+-- # 2. Redistributions in binary form must reproduce the above copyright notice, this list of     #
+-- #    conditions and the following disclaimer in the documentation and/or other materials        #
+-- #    provided with the distribution.                                                            #
+-- #                                                                                               #
+-- # 3. Neither the name of the copyright holder nor the names of its contributors may be used to  #
+-- #    endorse or promote products derived from this software without specific prior written      #
+-- #    permission.                                                                                #
+-- #                                                                                               #
+-- # THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS   #
+-- # OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF               #
+-- # MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE    #
+-- # COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,     #
+-- # EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE #
+-- # GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED    #
+-- # AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING     #
+-- # NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED  #
+-- # OF THE POSSIBILITY OF SUCH DAMAGE.                                                            #
+-- # ********************************************************************************************* #
+-- # The NEORV32 Processor - https://github.com/stnolting/neorv32              (c) Stephan Nolting #
+-- #################################################################################################
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library neorv32;
+use neorv32.neorv32_package.all;
+
+entity neorv32_clint is
+  generic (
+    NUM_HARTS : natural -- number of harts (1..4)
+  );
+  port (
+    -- host access --
+    clk_i       : in  std_ulogic; -- global clock line
+    addr_i      : in  std_ulogic_vector(31 downto 0); -- address
+    rden_i      : in  std_ulogic; -- read enable
+    wren_i      : in  std_ulogic; -- write enable
+    data_i      : in  std_ulogic_vector(31 downto 0); -- data in
+    data_o      : out std_ulogic_vector(31 downto 0); -- data out
+    ack_o       : out std_ulogic; -- transfer acknowledge
+    -- system time --
+    time_i      : in  std_ulogic_vector(63 downto 0); -- current system time
+    -- interrupts (one per hart) --
+    msw_irq_o   : out std_ulogic_vector(NUM_HARTS-1 downto 0); -- machine software interrupt
+    mtime_irq_o : out std_ulogic_vector(NUM_HARTS-1 downto 0)  -- machine timer interrupt
+  );
+end neorv32_clint;
+
+architecture neorv32_clint_rtl of neorv32_clint is
+
+  -- IO space: module base address --
+  constant hi_abb_c : natural := index_size_f(io_size_c)-1; -- high address boundary bit
+  constant lo_abb_c : natural := index_size_f(clint_size_c); -- low address boundary bit
+
+  -- access control --
+  signal acc_en : std_ulogic; -- module access enable
+  signal rden   : std_ulogic;
+  signal wren   : std_ulogic;
+  signal widx   : std_ulogic_vector(3 downto 0); -- word index
+
+  -- accessible regs --
+  type cmp_t is array (0 to NUM_HARTS-1) of std_ulogic_vector(31 downto 0);
+  signal msip        : std_ulogic_vector(NUM_HARTS-1 downto 0);
+  signal msip_ff     : std_ulogic_vector(NUM_HARTS-1 downto 0);
+  signal mtimecmp_lo : cmp_t;
+  signal mtimecmp_hi : cmp_t;
+
+  -- comparators and IRQ trigger --
+  signal cmp_lo       : std_ulogic_vector(NUM_HARTS-1 downto 0);
+  signal cmp_lo_ff    : std_ulogic_vector(NUM_HARTS-1 downto 0);
+  signal cmp_hi       : std_ulogic_vector(NUM_HARTS-1 downto 0);
+  signal cmp_match_ff : std_ulogic_vector(NUM_HARTS-1 downto 0);
+
+begin
+
+  -- Sanity Checks --------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  assert not ((NUM_HARTS < 1) or (NUM_HARTS > 4)) report "NEORV32 PROCESSOR CONFIG ERROR! CLINT <NUM_HARTS> has to be 1..4." severity error;
+
+
+  -- Access Control -------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  acc_en <= '1' when (addr_i(hi_abb_c downto lo_abb_c) = clint_base_c(hi_abb_c downto lo_abb_c)) else '0';
+  widx   <= addr_i(lo_abb_c-1 downto 2); -- word index: 0..3 = msip, 8..15 = mtimecmp (lo/hi)
+  rden   <= acc_en and rden_i;
+  wren   <= acc_en and wren_i;
+
+
+  -- Write Access ---------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  wr_access: process(clk_i)
+  begin
+    if rising_edge(clk_i) then
+      if (wren = '1') then
+        for i in 0 to NUM_HARTS-1 loop
+          -- msip --
+          if (widx = ("00" & std_ulogic_vector(to_unsigned(i, 2)))) then
+            msip(i) <= data_i(0);
+          end if;
+          -- mtimecmp --
+          if (widx = ('1' & std_ulogic_vector(to_unsigned(i, 2)) & '0')) then
+            mtimecmp_lo(i) <= data_i;
+          end if;
+          if (widx = ('1' & std_ulogic_vector(to_unsigned(i, 2)) & '1')) then
+            mtimecmp_hi(i) <= data_i;
+          end if;
+        end loop; -- i
+      end if;
+    end if;
+  end process wr_access;
+
+
+  -- Read Access ----------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  rd_access: process(clk_i)
+  begin
+    if rising_edge(clk_i) then
+      ack_o  <= rden or wren;
+      data_o <= (others => '0'); -- default
+      if (rden = '1') then
+        for i in 0 to NUM_HARTS-1 loop
+          if (widx = ("00" & std_ulogic_vector(to_unsigned(i, 2)))) then
+            data_o(0) <= msip(i);
+          end if;
+          if (widx = ('1' & std_ulogic_vector(to_unsigned(i, 2)) & '0')) then
+            data_o <= mtimecmp_lo(i);
+          end if;
+          if (widx = ('1' & std_ulogic_vector(to_unsigned(i, 2)) & '1')) then
+            data_o <= mtimecmp_hi(i);
+          end if;
+        end loop; -- i
+      end if;
+    end if;
+  end process rd_access;
+
+
+  -- Interrupt Generators -------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  irq_sync: process(clk_i)
+  begin
+    if rising_edge(clk_i) then
+      -- software interrupt: rising edge of msip --
+      msip_ff   <= msip;
+      msw_irq_o <= msip and (not msip_ff);
+      -- timer interrupt: rising edge of comparator match --
+      cmp_lo_ff    <= cmp_lo;
+      cmp_match_ff <= cmp_lo_ff and cmp_hi;
+      mtime_irq_o  <= cmp_lo_ff and cmp_hi and (not cmp_match_ff);
+    end if;
+  end process irq_sync;
+
+  -- test words --
+  comparators:
+  for i in 0 to NUM_HARTS-1 generate
+    cmp_lo(i) <= '1' when (unsigned(time_i(31 downto 00)) >= unsigned(mtimecmp_lo(i))) else '0';
+    cmp_hi(i) <= '1' when (unsigned(time_i(63 downto 32)) >= unsigned(mtimecmp_hi(i))) else '0';
+  end generate;
+
+
+end neorv32_clint_rtl;
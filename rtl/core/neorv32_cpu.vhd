@@ -75,12 +75,18 @@ entity neorv32_cpu is
     FAST_SHIFT_EN                : boolean; -- use barrel shifter for shift operations
     CPU_CNT_WIDTH                : natural; -- total width of CPU cycle and instret counters (0..64)
     CPU_IPB_ENTRIES              : natural; -- entries is instruction prefetch buffer, has to be a power of 2
+    CPU_NUM_TRIGGERS             : natural; -- number of hardware trigger module triggers (0..16)
     -- Physical Memory Protection (PMP) --
     PMP_NUM_REGIONS              : natural; -- number of regions (0..64)
-    PMP_MIN_GRANULARITY          : natural; -- minimal region granularity in bytes, has to be a power of 2, min 8 bytes
+    PMP_MIN_GRANULARITY          : natural; -- minimal region granularity in bytes, has to be a power of 2, min 4 bytes
     -- Hardware Performance Monitors (HPM) --
     HPM_NUM_CNTS                 : natural; -- number of implemented HPM counters (0..29)
-    HPM_CNT_WIDTH                : natural  -- total size of HPM counters (0..64)
+    HPM_CNT_WIDTH                : natural; -- total size of HPM counters (0..64)
+    -- Tightly-Coupled Memories (TCM) --
+    TCM_IMEM_BASE                : std_ulogic_vector(31 downto 0); -- instruction TCM base address
+    TCM_IMEM_SIZE                : natural; -- instruction TCM size in bytes (0 = no instruction TCM)
+    TCM_DMEM_BASE                : std_ulogic_vector(31 downto 0); -- data TCM base address
+    TCM_DMEM_SIZE                : natural  -- data TCM size in bytes (0 = no data TCM)
   );
   port (
     -- global control --
@@ -111,6 +117,17 @@ entity neorv32_cpu is
     d_bus_err_i    : in  std_ulogic; -- bus transfer error
     d_bus_fence_o  : out std_ulogic; -- executed FENCE operation
     d_bus_priv_o   : out std_ulogic_vector(1 downto 0); -- privilege level
+    -- instruction tightly-coupled memory (TCM) interface --
+    i_tcm_addr_o   : out std_ulogic_vector(data_width_c-1 downto 0); -- access address
+    i_tcm_re_o     : out std_ulogic; -- read enable
+    i_tcm_rdata_i  : in  std_ulogic_vector(data_width_c-1 downto 0); -- read data
+    -- data tightly-coupled memory (TCM) interface --
+    d_tcm_addr_o   : out std_ulogic_vector(data_width_c-1 downto 0); -- access address
+    d_tcm_wdata_o  : out std_ulogic_vector(data_width_c-1 downto 0); -- write data
+    d_tcm_ben_o    : out std_ulogic_vector(03 downto 0); -- byte enable
+    d_tcm_we_o     : out std_ulogic; -- write enable
+    d_tcm_re_o     : out std_ulogic; -- read enable
+    d_tcm_rdata_i  : in  std_ulogic_vector(data_width_c-1 downto 0); -- read data
     -- system time input from MTIME --
     time_i         : in  std_ulogic_vector(63 downto 0); -- current system time
     -- non-maskable interrupt --
@@ -122,7 +139,15 @@ entity neorv32_cpu is
     -- fast interrupts (custom) --
     firq_i         : in  std_ulogic_vector(15 downto 0);
     -- debug mode (halt) request --
-    db_halt_req_i  : in  std_ulogic
+    db_halt_req_i  : in  std_ulogic;
+    -- external HPM events --
+    icache_ev_i    : in  std_ulogic_vector(03 downto 0); -- i-cache events: 0 = useful prefetch, 1 = useless prefetch, 2 = access, 3 = miss
+    -- i-cache locking (custom CSRs) --
+    icache_ctrl_o  : out std_ulogic_vector(02 downto 0); -- i-cache control: 0 = lock preloaded blocks, 1 = unlock all blocks, 2 = preload request
+    icache_addr_o  : out std_ulogic_vector(data_width_c-1 downto 0); -- i-cache preload address
+    icache_stat_i  : in  std_ulogic_vector(01 downto 0); -- i-cache status: 0 = preload in progress, 1 = preload failed
+    -- instruction trace port --
+    trace_o        : out cpu_trace_if_t -- program flow discontinuity events
   );
 end neorv32_cpu;
 
@@ -139,7 +164,10 @@ architecture neorv32_cpu_rtl of neorv32_cpu is
   signal mem_rdata  : std_ulogic_vector(data_width_c-1 downto 0); -- memory read data
   signal alu_idone  : std_ulogic; -- iterative alu operation done
   signal bus_i_wait : std_ulogic; -- wait for current bus instruction fetch
+  signal bus_i_pipe : std_ulogic; -- fetch address is located in the pipelined instruction TCM
   signal bus_d_wait : std_ulogic; -- wait for current bus data access
+  signal bus_d_tcm  : std_ulogic; -- data access address is located in data TCM
+  signal tcm_req    : std_ulogic_vector(1 downto 0); -- data TCM access request
   signal csr_rdata  : std_ulogic_vector(data_width_c-1 downto 0); -- csr read data
   signal mar        : std_ulogic_vector(data_width_c-1 downto 0); -- current memory address register
   signal ma_instr   : std_ulogic; -- misaligned instruction address
@@ -197,6 +225,10 @@ begin
   -- Instruction prefetch buffer size --
   assert not (is_power_of_two_f(CPU_IPB_ENTRIES) = false) report "NEORV32 CPU CONFIG ERROR! Number of entries in instruction prefetch buffer <CPU_IPB_ENTRIES> has to be a power of two." severity error;
 
+  -- Hardware trigger module --
+  assert not (CPU_NUM_TRIGGERS > 16) report "NEORV32 CPU CONFIG ERROR! Number of hardware triggers <CPU_NUM_TRIGGERS> out of valid range (0..16)." severity error;
+  assert not ((CPU_EXTENSION_RISCV_Zicsr = false) and (CPU_NUM_TRIGGERS > 0)) report "NEORV32 CPU CONFIG ERROR! Hardware trigger module requires <CPU_EXTENSION_RISCV_Zicsr> extension to be enabled." severity error;
+
   -- Co-processor timeout counter (for debugging only) --
   assert not (cp_timeout_en_c = true) report "NEORV32 CPU CONFIG WARNING! Co-processor timeout counter enabled. This should be used for debugging/simulation only." severity warning;
 
@@ -204,7 +236,7 @@ begin
   assert not (PMP_NUM_REGIONS > 64) report "NEORV32 CPU CONFIG ERROR! Number of PMP regions <PMP_NUM_REGIONS> out xf valid range (0..64)." severity error;
   -- PMP granularity --
   assert not ((is_power_of_two_f(PMP_MIN_GRANULARITY) = false) and (PMP_NUM_REGIONS > 0)) report "NEORV32 CPU CONFIG ERROR! <PMP_MIN_GRANULARITY> has to be a power of two." severity error;
-  assert not ((PMP_MIN_GRANULARITY < 8) and (PMP_NUM_REGIONS > 0)) report "NEORV32 CPU CONFIG ERROR! <PMP_MIN_GRANULARITY> has to be >= 8 bytes." severity error;
+  assert not ((PMP_MIN_GRANULARITY < 4) and (PMP_NUM_REGIONS > 0)) report "NEORV32 CPU CONFIG ERROR! <PMP_MIN_GRANULARITY> has to be >= 4 bytes." severity error;
   -- PMP requires Zicsr extension --
   assert not ((CPU_EXTENSION_RISCV_Zicsr = false) and (PMP_NUM_REGIONS > 0)) report "NEORV32 CPU CONFIG ERROR! Physical memory protection (PMP) requires <CPU_EXTENSION_RISCV_Zicsr> extension to be enabled." severity error;
 
@@ -243,9 +275,10 @@ begin
     -- Extension Options --
     CPU_CNT_WIDTH                => CPU_CNT_WIDTH,                -- total width of CPU cycle and instret counters (0..64)
     CPU_IPB_ENTRIES              => CPU_IPB_ENTRIES,              -- entries is instruction prefetch buffer, has to be a power of 2
+    CPU_NUM_TRIGGERS             => CPU_NUM_TRIGGERS,             -- number of hardware trigger module triggers (0..16)
     -- Physical memory protection (PMP) --
     PMP_NUM_REGIONS              => PMP_NUM_REGIONS,              -- number of regions (0..64)
-    PMP_MIN_GRANULARITY          => PMP_MIN_GRANULARITY,          -- minimal region granularity in bytes, has to be a power of 2, min 8 bytes
+    PMP_MIN_GRANULARITY          => PMP_MIN_GRANULARITY,          -- minimal region granularity in bytes, has to be a power of 2, min 4 bytes
     -- Hardware Performance Monitors (HPM) --
     HPM_NUM_CNTS                 => HPM_NUM_CNTS,                 -- number of implemented HPM counters (0..29)
     HPM_CNT_WIDTH                => HPM_CNT_WIDTH                 -- total size of HPM counters
@@ -258,7 +291,9 @@ begin
     -- status input --
     alu_idone_i   => alu_idone,   -- ALU iterative operation done
     bus_i_wait_i  => bus_i_wait,  -- wait for bus
+    bus_i_pipe_i  => bus_i_pipe,  -- fetch address is located in the pipelined instruction TCM
     bus_d_wait_i  => bus_d_wait,  -- wait for bus
+    bus_d_tcm_i   => bus_d_tcm,   -- data access address is located in data TCM
     excl_state_i  => excl_state,  -- atomic/exclusive access lock status
     -- data input --
     instr_i       => instr,       -- instruction
@@ -270,6 +305,7 @@ begin
     fetch_pc_o    => fetch_pc,    -- PC for instruction fetch
     curr_pc_o     => curr_pc,     -- current PC (corresponding to current instruction)
     csr_rdata_o   => csr_rdata,   -- CSR read data
+    bus_d_tcm_o   => tcm_req,     -- data TCM access request
     -- FPU interface --
     fpu_flags_i   => fpu_flags,   -- exception flags
     -- debug mode (halt) request --
@@ -294,7 +330,15 @@ begin
     ma_store_i    => ma_store,    -- misaligned store data address
     be_instr_i    => be_instr,    -- bus error on instruction access
     be_load_i     => be_load,     -- bus error on load data access
-    be_store_i    => be_store     -- bus error on store data access
+    be_store_i    => be_store,    -- bus error on store data access
+    -- external HPM events --
+    icache_ev_i   => icache_ev_i, -- i-cache events
+    -- i-cache locking (custom CSRs) --
+    icache_ctrl_o => icache_ctrl_o, -- i-cache control
+    icache_addr_o => icache_addr_o, -- i-cache preload address
+    icache_stat_i => icache_stat_i, -- i-cache status
+    -- instruction trace port --
+    trace_o       => trace_o      -- program flow discontinuity events
   );
 
   -- CPU is sleeping? --
@@ -362,7 +406,12 @@ begin
     CPU_EXTENSION_RISCV_C => CPU_EXTENSION_RISCV_C, -- implement compressed extension?
     -- Physical memory protection (PMP) --
     PMP_NUM_REGIONS       => PMP_NUM_REGIONS,       -- number of regions (0..64)
-    PMP_MIN_GRANULARITY   => PMP_MIN_GRANULARITY    -- minimal region granularity in bytes, has to be a power of 2, min 8 bytes
+    PMP_MIN_GRANULARITY   => PMP_MIN_GRANULARITY,   -- minimal region granularity in bytes, has to be a power of 2, min 4 bytes
+    -- Tightly-coupled memories (TCM) --
+    TCM_IMEM_BASE         => TCM_IMEM_BASE,         -- instruction TCM base address
+    TCM_IMEM_SIZE         => TCM_IMEM_SIZE,         -- instruction TCM size in bytes (0 = no instruction TCM)
+    TCM_DMEM_BASE         => TCM_DMEM_BASE,         -- data TCM base address
+    TCM_DMEM_SIZE         => TCM_DMEM_SIZE          -- data TCM size in bytes (0 = no data TCM)
   )
   port map (
     -- global control --
@@ -373,6 +422,7 @@ begin
     fetch_pc_i     => fetch_pc,       -- PC for instruction fetch
     instr_o        => instr,          -- instruction
     i_wait_o       => bus_i_wait,     -- wait for fetch to complete
+    i_pipe_o       => bus_i_pipe,     -- fetch address is located in the pipelined instruction TCM
     --
     ma_instr_o     => ma_instr,       -- misaligned instruction address
     be_instr_o     => be_instr,       -- bus error on instruction access
@@ -382,6 +432,8 @@ begin
     rdata_o        => mem_rdata,      -- read data
     mar_o          => mar,            -- current memory address register
     d_wait_o       => bus_d_wait,     -- wait for access to complete
+    d_tcm_o        => bus_d_tcm,      -- data access address is located in data TCM
+    tcm_req_i      => tcm_req,        -- data TCM access request
     --
     excl_state_o   => excl_state,     -- atomic/exclusive access status
     ma_load_o      => ma_load,        -- misaligned load data address
@@ -412,7 +464,18 @@ begin
     d_bus_lock_o   => d_bus_lock_o,   -- exclusive access request
     d_bus_ack_i    => d_bus_ack_i,    -- bus transfer acknowledge
     d_bus_err_i    => d_bus_err_i,    -- bus transfer error
-    d_bus_fence_o  => d_bus_fence_o   -- fence operation
+    d_bus_fence_o  => d_bus_fence_o,  -- fence operation
+    -- instruction TCM --
+    i_tcm_addr_o   => i_tcm_addr_o,   -- access address
+    i_tcm_re_o     => i_tcm_re_o,     -- read enable
+    i_tcm_rdata_i  => i_tcm_rdata_i,  -- read data
+    -- data TCM --
+    d_tcm_addr_o   => d_tcm_addr_o,   -- access address
+    d_tcm_wdata_o  => d_tcm_wdata_o,  -- write data
+    d_tcm_ben_o    => d_tcm_ben_o,    -- byte enable
+    d_tcm_we_o     => d_tcm_we_o,     -- write enable
+    d_tcm_re_o     => d_tcm_re_o,     -- read enable
+    d_tcm_rdata_i  => d_tcm_rdata_i   -- read data
   );
 
   -- current privilege level --
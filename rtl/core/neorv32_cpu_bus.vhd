@@ -1,7 +1,8 @@
 -- #################################################################################################
 -- # << NEORV32 - Bus Interface Unit >>                                                            #
 -- # ********************************************************************************************* #
--- # Instruction and data bus interfaces and physical memory protection (PMP).                     #
+-- # Instruction and data bus interfaces, tightly-coupled memory (TCM) ports and physical memory   #
+-- # protection (PMP).                                                                             #
 -- # ********************************************************************************************* #
 -- # BSD 3-Clause License                                                                          #
 -- #                                                                                               #
@@ -47,7 +48,12 @@ entity neorv32_cpu_bus is
     CPU_EXTENSION_RISCV_C : boolean; -- implement compressed extension?
     -- Physical memory protection (PMP) --
     PMP_NUM_REGIONS       : natural; -- number of regions (0..64)
-    PMP_MIN_GRANULARITY   : natural  -- minimal region granularity in bytes, has to be a power of 2, min 8 bytes
+    PMP_MIN_GRANULARITY   : natural; -- minimal region granularity in bytes, has to be a power of 2, min 4 bytes
+    -- Tightly-coupled memories (TCM) --
+    TCM_IMEM_BASE         : std_ulogic_vector(31 downto 0); -- instruction TCM base address
+    TCM_IMEM_SIZE         : natural; -- instruction TCM size in bytes (0 = no instruction TCM)
+    TCM_DMEM_BASE         : std_ulogic_vector(31 downto 0); -- data TCM base address
+    TCM_DMEM_SIZE         : natural  -- data TCM size in bytes (0 = no data TCM)
   );
   port (
     -- global control --
@@ -58,6 +64,7 @@ entity neorv32_cpu_bus is
     fetch_pc_i     : in  std_ulogic_vector(data_width_c-1 downto 0); -- PC for instruction fetch
     instr_o        : out std_ulogic_vector(data_width_c-1 downto 0); -- instruction
     i_wait_o       : out std_ulogic; -- wait for fetch to complete
+    i_pipe_o       : out std_ulogic; -- fetch address is located in the pipelined instruction TCM
     --
     ma_instr_o     : out std_ulogic; -- misaligned instruction address
     be_instr_o     : out std_ulogic; -- bus error on instruction access
@@ -67,6 +74,8 @@ entity neorv32_cpu_bus is
     rdata_o        : out std_ulogic_vector(data_width_c-1 downto 0); -- read data
     mar_o          : out std_ulogic_vector(data_width_c-1 downto 0); -- current memory address register
     d_wait_o       : out std_ulogic; -- wait for access to complete
+    d_tcm_o        : out std_ulogic; -- data access address (MAR) is located in data TCM
+    tcm_req_i      : in  std_ulogic_vector(1 downto 0); -- data TCM access request (0 = read, 1 = write)
     --
     excl_state_o   : out std_ulogic; -- atomic/exclusive access status
     ma_load_o      : out std_ulogic; -- misaligned load data address
@@ -97,7 +106,18 @@ entity neorv32_cpu_bus is
     d_bus_lock_o   : out std_ulogic; -- exclusive access request
     d_bus_ack_i    : in  std_ulogic; -- bus transfer acknowledge
     d_bus_err_i    : in  std_ulogic; -- bus transfer error
-    d_bus_fence_o  : out std_ulogic  -- fence operation
+    d_bus_fence_o  : out std_ulogic; -- fence operation
+    -- instruction TCM --
+    i_tcm_addr_o   : out std_ulogic_vector(data_width_c-1 downto 0); -- access address
+    i_tcm_re_o     : out std_ulogic; -- read enable
+    i_tcm_rdata_i  : in  std_ulogic_vector(data_width_c-1 downto 0); -- read data
+    -- data TCM --
+    d_tcm_addr_o   : out std_ulogic_vector(data_width_c-1 downto 0); -- access address
+    d_tcm_wdata_o  : out std_ulogic_vector(data_width_c-1 downto 0); -- write data
+    d_tcm_ben_o    : out std_ulogic_vector(03 downto 0); -- byte enable
+    d_tcm_we_o     : out std_ulogic; -- write enable
+    d_tcm_re_o     : out std_ulogic; -- read enable
+    d_tcm_rdata_i  : in  std_ulogic_vector(data_width_c-1 downto 0)  -- read data
   );
 end neorv32_cpu_bus;
 
@@ -105,8 +125,8 @@ architecture neorv32_cpu_bus_rtl of neorv32_cpu_bus is
 
   -- PMP modes --
   constant pmp_off_mode_c   : std_ulogic_vector(1 downto 0) := "00"; -- null region (disabled)
---constant pmp_tor_mode_c   : std_ulogic_vector(1 downto 0) := "01"; -- top of range
---constant pmp_na4_mode_c   : std_ulogic_vector(1 downto 0) := "10"; -- naturally aligned four-byte region
+  constant pmp_tor_mode_c   : std_ulogic_vector(1 downto 0) := "01"; -- top of range
+  constant pmp_na4_mode_c   : std_ulogic_vector(1 downto 0) := "10"; -- naturally aligned four-byte region
   constant pmp_napot_mode_c : std_ulogic_vector(1 downto 0) := "11"; -- naturally aligned power-of-two region (>= 8 bytes)
 
   -- PMP granularity --
@@ -121,17 +141,22 @@ architecture neorv32_cpu_bus_rtl of neorv32_cpu_bus is
   --
   constant pmp_cfg_l_c  : natural := 7; -- locked entry
 
+  -- tightly-coupled memories: the fast path requires a single-cycle PMP check --
+  constant i_tcm_en_c : boolean := (TCM_IMEM_SIZE > 0) and (PMP_NUM_REGIONS <= pmp_num_regions_critical_c);
+  constant d_tcm_en_c : boolean := (TCM_DMEM_SIZE > 0) and (PMP_NUM_REGIONS <= pmp_num_regions_critical_c);
+
   -- data interface registers --
   signal mar, mdo, mdi : std_ulogic_vector(data_width_c-1 downto 0);
 
   -- data access --
-  signal d_bus_wdata : std_ulogic_vector(data_width_c-1 downto 0); -- write data
+  signal d_wdata_nxt : std_ulogic_vector(data_width_c-1 downto 0); -- aligned write data (to MDO)
   signal d_bus_rdata : std_ulogic_vector(data_width_c-1 downto 0); -- read data
   signal rdata_align : std_ulogic_vector(data_width_c-1 downto 0); -- read-data alignment
-  signal d_bus_ben   : std_ulogic_vector(3 downto 0); -- write data byte enable
+  signal d_ben_nxt   : std_ulogic_vector(3 downto 0); -- byte enable (to byte enable register)
+  signal d_bus_ben   : std_ulogic_vector(3 downto 0); -- byte enable register
 
   -- misaligned access? --
-  signal d_misaligned, i_misaligned : std_ulogic;
+  signal d_misaligned_nxt, d_misaligned, i_misaligned : std_ulogic;
 
   -- bus arbiter --
   type bus_arbiter_t is record
@@ -139,6 +164,7 @@ architecture neorv32_cpu_bus_rtl of neorv32_cpu_bus is
     wr_req    : std_ulogic; -- write access in progress
     err_align : std_ulogic; -- alignment error
     err_bus   : std_ulogic; -- bus access error
+    tcm       : std_ulogic; -- access via TCM port
   end record;
   signal i_arbiter, d_arbiter : bus_arbiter_t;
 
@@ -153,11 +179,20 @@ architecture neorv32_cpu_bus_rtl of neorv32_cpu_bus is
     region_base   : pmp_addr_t; -- region config base address
     region_i_addr : pmp_addr_t; -- masked instruction access base address for comparator
     region_d_addr : pmp_addr_t; -- masked data access base address for comparator
+    i_napot       : std_ulogic_vector(PMP_NUM_REGIONS-1 downto 0); -- NAPOT region match for instruction interface
+    d_napot       : std_ulogic_vector(PMP_NUM_REGIONS-1 downto 0); -- NAPOT region match for data interface
+    i_na4         : std_ulogic_vector(PMP_NUM_REGIONS-1 downto 0); -- NA4 region match for instruction interface
+    d_na4         : std_ulogic_vector(PMP_NUM_REGIONS-1 downto 0); -- NA4 region match for data interface
+    i_below       : std_ulogic_vector(PMP_NUM_REGIONS-1 downto 0); -- instruction address < pmpaddr (TOR)
+    d_below       : std_ulogic_vector(PMP_NUM_REGIONS-1 downto 0); -- data address < pmpaddr (TOR)
     i_match       : std_ulogic_vector(PMP_NUM_REGIONS-1 downto 0); -- region match for instruction interface
     d_match       : std_ulogic_vector(PMP_NUM_REGIONS-1 downto 0); -- region match for data interface
-    if_fault      : std_ulogic_vector(PMP_NUM_REGIONS-1 downto 0); -- region access fault for fetch operation
-    ld_fault      : std_ulogic_vector(PMP_NUM_REGIONS-1 downto 0); -- region access fault for load operation
-    st_fault      : std_ulogic_vector(PMP_NUM_REGIONS-1 downto 0); -- region access fault for store operation
+    d_match_ff    : std_ulogic_vector(PMP_NUM_REGIONS-1 downto 0); -- registered region match for data interface
+    d_match_sel   : std_ulogic_vector(PMP_NUM_REGIONS-1 downto 0); -- actual region match for data interface
+    if_fault_any  : std_ulogic; -- resolved fetch fault (combinatorial)
+    ld_fault_any  : std_ulogic; -- resolved load fault (combinatorial)
+    st_fault_any  : std_ulogic; -- resolved store fault (combinatorial)
+    if_fault_ff   : std_ulogic; -- registered fetch fault
   end record;
   signal pmp : pmp_t;
 
@@ -166,6 +201,13 @@ architecture neorv32_cpu_bus_rtl of neorv32_cpu_bus is
   signal d_bus_re, d_bus_re_buf : std_ulogic;
   signal i_bus_re, i_bus_re_buf : std_ulogic;
 
+  -- tightly-coupled memories --
+  signal i_tcm_sel, d_tcm_sel : std_ulogic; -- access address is located in TCM
+  signal i_tcm_re,  i_tcm_ack : std_ulogic;
+  signal d_tcm_re,  d_tcm_we  : std_ulogic;
+  signal d_tcm_ack            : std_ulogic;
+  signal i_bus_ack, d_bus_ack : std_ulogic; -- bus or TCM access acknowledge
+
   -- pmp faults anyone? --
   signal if_pmp_fault : std_ulogic; -- pmp instruction access fault
   signal ld_pmp_fault : std_ulogic; -- pmp load access fault
@@ -176,6 +218,7 @@ begin
   -- Sanity Checks --------------------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
   assert not (PMP_NUM_REGIONS > pmp_num_regions_critical_c) report "NEORV32 CPU CONFIG WARNING! Number of implemented PMP regions (PMP_NUM_REGIONS = " & integer'image(PMP_NUM_REGIONS) & ") beyond critical limit (pmp_num_regions_critical_c = " & integer'image(pmp_num_regions_critical_c) & "). Inserting another register stage (that will increase memory latency by +1 cycle)." severity warning;
+  assert not (((TCM_IMEM_SIZE > 0) or (TCM_DMEM_SIZE > 0)) and (PMP_NUM_REGIONS > pmp_num_regions_critical_c)) report "NEORV32 CPU CONFIG NOTE! TCM ports disabled as number of PMP regions is beyond critical limit - all memory accesses use the bus interface." severity note;
 
 
   -- Data Interface: Access Address ---------------------------------------------------------
@@ -183,10 +226,12 @@ begin
   mem_adr_reg: process(rstn_i, clk_i)
   begin
     if (rstn_i = '0') then
-      mar <= (others => def_rst_val_c);
+      mar          <= (others => def_rst_val_c);
+      d_misaligned <= '0';
     elsif rising_edge(clk_i) then
       if (ctrl_i(ctrl_bus_mo_we_c) = '1') then
-        mar <= addr_i;
+        mar          <= addr_i;
+        d_misaligned <= d_misaligned_nxt;
       end if;
     end if;
   end process mem_adr_reg;
@@ -194,21 +239,21 @@ begin
   -- read-back for exception controller --
   mar_o <= mar;
 
-  -- alignment check --
-  misaligned_d_check: process(mar, ctrl_i)
+  -- alignment check (ALU address, resolved when MAR is loaded) --
+  misaligned_d_check: process(addr_i, ctrl_i)
   begin
     -- check data access --
-    d_misaligned <= '0'; -- default
+    d_misaligned_nxt <= '0'; -- default
     case ctrl_i(ctrl_bus_size_msb_c downto ctrl_bus_size_lsb_c) is -- data size
       when "00" => -- byte
-        d_misaligned <= '0';
+        d_misaligned_nxt <= '0';
       when "01" => -- half-word
-        if (mar(0) /= '0') then
-          d_misaligned <= '1';
+        if (addr_i(0) /= '0') then
+          d_misaligned_nxt <= '1';
         end if;
       when others => -- word
-        if (mar(1 downto 0) /= "00") then
-          d_misaligned <= '1';
+        if (addr_i(1 downto 0) /= "00") then
+          d_misaligned_nxt <= '1';
         end if;
     end case;
   end process misaligned_d_check;
@@ -219,40 +264,42 @@ begin
   mem_do_reg: process(rstn_i, clk_i)
   begin
     if (rstn_i = '0') then
-      mdo <= (others => def_rst_val_c);
+      mdo       <= (others => def_rst_val_c);
+      d_bus_ben <= (others => def_rst_val_c);
     elsif rising_edge(clk_i) then
       if (ctrl_i(ctrl_bus_mo_we_c) = '1') then
-        mdo <= wdata_i; -- memory data output register (MDO)
+        mdo       <= d_wdata_nxt; -- memory data output register (MDO)
+        d_bus_ben <= d_ben_nxt;
       end if;
     end if;
   end process mem_do_reg;
 
-  -- byte enable and output data alignment --
-  byte_enable: process(mar, mdo, ctrl_i)
+  -- byte enable and output data alignment (ALU address, before MDO) --
+  byte_enable: process(addr_i, wdata_i, ctrl_i)
   begin
     case ctrl_i(ctrl_bus_size_msb_c downto ctrl_bus_size_lsb_c) is -- data size
       when "00" => -- byte
-        d_bus_wdata(07 downto 00) <= mdo(07 downto 00);
-        d_bus_wdata(15 downto 08) <= mdo(07 downto 00);
-        d_bus_wdata(23 downto 16) <= mdo(07 downto 00);
-        d_bus_wdata(31 downto 24) <= mdo(07 downto 00);
-        case mar(1 downto 0) is
-          when "00"   => d_bus_ben <= "0001";
-          when "01"   => d_bus_ben <= "0010";
-          when "10"   => d_bus_ben <= "0100";
-          when others => d_bus_ben <= "1000";
+        d_wdata_nxt(07 downto 00) <= wdata_i(07 downto 00);
+        d_wdata_nxt(15 downto 08) <= wdata_i(07 downto 00);
+        d_wdata_nxt(23 downto 16) <= wdata_i(07 downto 00);
+        d_wdata_nxt(31 downto 24) <= wdata_i(07 downto 00);
+        case addr_i(1 downto 0) is
+          when "00"   => d_ben_nxt <= "0001";
+          when "01"   => d_ben_nxt <= "0010";
+          when "10"   => d_ben_nxt <= "0100";
+          when others => d_ben_nxt <= "1000";
         end case;
       when "01" => -- half-word
-        d_bus_wdata(31 downto 16) <= mdo(15 downto 00);
-        d_bus_wdata(15 downto 00) <= mdo(15 downto 00);
-        if (mar(1) = '0') then
-          d_bus_ben <= "0011"; -- low half-word
+        d_wdata_nxt(31 downto 16) <= wdata_i(15 downto 00);
+        d_wdata_nxt(15 downto 00) <= wdata_i(15 downto 00);
+        if (addr_i(1) = '0') then
+          d_ben_nxt <= "0011"; -- low half-word
         else
-          d_bus_ben <= "1100"; -- high half-word
+          d_ben_nxt <= "1100"; -- high half-word
         end if;
       when others => -- word
-        d_bus_wdata <= mdo;
-        d_bus_ben   <= "1111"; -- full word
+        d_wdata_nxt <= wdata_i;
+        d_ben_nxt   <= "1111"; -- full word
     end case;
   end process byte_enable;
 
@@ -311,15 +358,19 @@ begin
     elsif rising_edge(clk_i) then
       -- data access request --
       if (d_arbiter.wr_req = '0') and (d_arbiter.rd_req = '0') then -- idle
-        d_arbiter.wr_req    <= ctrl_i(ctrl_bus_wr_c);
-        d_arbiter.rd_req    <= ctrl_i(ctrl_bus_rd_c);
-        d_arbiter.err_align <= d_misaligned;
+        d_arbiter.wr_req    <= ctrl_i(ctrl_bus_wr_c) or tcm_req_i(1);
+        d_arbiter.rd_req    <= ctrl_i(ctrl_bus_rd_c) or tcm_req_i(0);
+        if (tcm_req_i /= "00") then -- TCM access is issued while MAR is loaded
+          d_arbiter.err_align <= d_misaligned_nxt;
+        else
+          d_arbiter.err_align <= d_misaligned;
+        end if;
         d_arbiter.err_bus   <= '0';
       else -- in progress
         d_arbiter.err_align <= (d_arbiter.err_align or d_misaligned) and (not ctrl_i(ctrl_bus_derr_ack_c));
         d_arbiter.err_bus   <= (d_arbiter.err_bus or d_bus_err_i or (st_pmp_fault and d_arbiter.wr_req) or (ld_pmp_fault and d_arbiter.rd_req)) and
                                (not ctrl_i(ctrl_bus_derr_ack_c));
-        if (d_bus_ack_i = '1') or (ctrl_i(ctrl_bus_derr_ack_c) = '1') then -- wait for normal termination / CPU abort
+        if (d_bus_ack = '1') or (ctrl_i(ctrl_bus_derr_ack_c) = '1') then -- wait for normal termination / CPU abort
           d_arbiter.wr_req <= '0';
           d_arbiter.rd_req <= '0';
         end if;
@@ -328,7 +379,7 @@ begin
   end process data_access_arbiter;
 
   -- wait for bus transaction to finish --
-  d_wait_o <= (d_arbiter.wr_req or d_arbiter.rd_req) and (not d_bus_ack_i);
+  d_wait_o <= (d_arbiter.wr_req or d_arbiter.rd_req) and (not d_bus_ack);
 
   -- output data access error to controller --
   ma_load_o  <= d_arbiter.rd_req and d_arbiter.err_align;
@@ -338,14 +389,15 @@ begin
 
   -- data bus (read/write)--
   d_bus_addr_o  <= mar;
-  d_bus_wdata_o <= d_bus_wdata;
+  d_bus_wdata_o <= mdo;
   d_bus_ben_o   <= d_bus_ben;
-  d_bus_we      <= ctrl_i(ctrl_bus_wr_c) and (not d_misaligned) and (not st_pmp_fault); -- no actual write when misaligned or PMP fault
-  d_bus_re      <= ctrl_i(ctrl_bus_rd_c) and (not d_misaligned) and (not ld_pmp_fault); -- no actual read when misaligned or PMP fault
-  d_bus_we_o    <= d_bus_we_buf when (PMP_NUM_REGIONS > pmp_num_regions_critical_c) else d_bus_we;
-  d_bus_re_o    <= d_bus_re_buf when (PMP_NUM_REGIONS > pmp_num_regions_critical_c) else d_bus_re;
+  d_bus_we      <= ctrl_i(ctrl_bus_wr_c) and (not d_misaligned); -- no actual write when misaligned
+  d_bus_re      <= ctrl_i(ctrl_bus_rd_c) and (not d_misaligned); -- no actual read when misaligned
+  d_bus_we_o    <= (d_bus_we_buf and (not st_pmp_fault)) when (PMP_NUM_REGIONS > pmp_num_regions_critical_c) else (d_bus_we and (not st_pmp_fault)); -- no actual write when PMP fault
+  d_bus_re_o    <= (d_bus_re_buf and (not ld_pmp_fault)) when (PMP_NUM_REGIONS > pmp_num_regions_critical_c) else (d_bus_re and (not ld_pmp_fault)); -- no actual read when PMP fault
   d_bus_fence_o <= ctrl_i(ctrl_bus_fence_c);
-  d_bus_rdata   <= d_bus_rdata_i;
+  d_bus_rdata   <= d_tcm_rdata_i when (d_tcm_ack = '1') else d_bus_rdata_i;
+  d_bus_ack     <= d_bus_ack_i or d_tcm_ack;
 
   -- additional register stage for control signals if using PMP_NUM_REGIONS > pmp_num_regions_critical_c --
   pmp_dbus_buffer: process(rstn_i, clk_i)
@@ -360,6 +412,34 @@ begin
   end process pmp_dbus_buffer;
 
 
+  -- Data Interface: Tightly-Coupled Memory ------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  -- The data TCM is accessed right from LOADSTORE_0 (request issued by the control unit via tcm_req_i)
+  -- bypassing the processor bus; the TCM responds with a fixed latency of one cycle.
+  -- MAR/MDO are only loaded at the end of LOADSTORE_0, so decode, alignment and PMP checks use the ALU address.
+  d_tcm_sel <= '1' when (d_tcm_en_c = true) and (addr_i(31 downto index_size_f(TCM_DMEM_SIZE)) = TCM_DMEM_BASE(31 downto index_size_f(TCM_DMEM_SIZE))) else '0';
+  d_tcm_o   <= d_tcm_sel;
+
+  d_tcm_we <= d_tcm_sel and tcm_req_i(1) and (not d_misaligned_nxt) and (not pmp.st_fault_any); -- no actual write when misaligned or PMP fault
+  d_tcm_re <= d_tcm_sel and tcm_req_i(0) and (not d_misaligned_nxt) and (not pmp.ld_fault_any); -- no actual read when misaligned or PMP fault
+
+  d_tcm_addr_o  <= addr_i;
+  d_tcm_wdata_o <= d_wdata_nxt;
+  d_tcm_ben_o   <= d_ben_nxt;
+  d_tcm_we_o    <= d_tcm_we;
+  d_tcm_re_o    <= d_tcm_re;
+
+  -- fixed-latency TCM response --
+  d_tcm_feedback: process(rstn_i, clk_i)
+  begin
+    if (rstn_i = '0') then
+      d_tcm_ack <= '0';
+    elsif rising_edge(clk_i) then
+      d_tcm_ack <= d_tcm_we or d_tcm_re;
+    end if;
+  end process d_tcm_feedback;
+
+
   -- Reservation Controller (LR/SC [A extension]) -------------------------------------------
   -- -------------------------------------------------------------------------------------------
   exclusive_access_controller: process(rstn_i, clk_i)
@@ -399,16 +479,18 @@ begin
       i_arbiter.rd_req    <= '0';
       i_arbiter.err_align <= '0';
       i_arbiter.err_bus   <= '0';
+      i_arbiter.tcm       <= '0';
     elsif rising_edge(clk_i) then
       -- instruction fetch request --
-      if (i_arbiter.rd_req = '0') then -- idle
+      if (i_arbiter.rd_req = '0') or ((i_arbiter.tcm = '1') and (i_tcm_ack = '1')) then -- idle or TCM access completing (back-to-back TCM fetches)
         i_arbiter.rd_req    <= ctrl_i(ctrl_bus_if_c);
         i_arbiter.err_align <= i_misaligned;
-        i_arbiter.err_bus   <= '0';
+        i_arbiter.err_bus   <= if_pmp_fault and i_tcm_sel and ctrl_i(ctrl_bus_if_c); -- TCM: fetch address is only valid during request
+        i_arbiter.tcm       <= i_tcm_sel;
       else -- in progres
-        i_arbiter.err_align <= (i_arbiter.err_align or i_misaligned) and (not ctrl_i(ctrl_bus_ierr_ack_c));
-        i_arbiter.err_bus   <= (i_arbiter.err_bus or i_bus_err_i or if_pmp_fault) and (not ctrl_i(ctrl_bus_ierr_ack_c));
-        if (i_bus_ack_i = '1') or (ctrl_i(ctrl_bus_ierr_ack_c) = '1') then -- wait for normal termination / CPU abort
+        i_arbiter.err_align <= (i_arbiter.err_align or (i_misaligned and (not i_arbiter.tcm))) and (not ctrl_i(ctrl_bus_ierr_ack_c));
+        i_arbiter.err_bus   <= (i_arbiter.err_bus or ((i_bus_err_i or if_pmp_fault) and (not i_arbiter.tcm))) and (not ctrl_i(ctrl_bus_ierr_ack_c));
+        if (i_bus_ack = '1') or (ctrl_i(ctrl_bus_ierr_ack_c) = '1') then -- wait for normal termination / CPU abort
           i_arbiter.rd_req <= '0';
         end if;
       end if;
@@ -418,7 +500,8 @@ begin
   i_arbiter.wr_req <= '0'; -- instruction fetch is read-only
 
   -- wait for bus transaction to finish --
-  i_wait_o <= i_arbiter.rd_req and (not i_bus_ack_i);
+  i_wait_o <= i_arbiter.rd_req and (not i_bus_ack);
+  i_pipe_o <= i_tcm_sel;
 
   -- output instruction fetch error to controller --
   ma_instr_o <= i_arbiter.err_align;
@@ -429,15 +512,33 @@ begin
   i_bus_wdata_o <= (others => '0'); -- instruction fetch is read-only
   i_bus_ben_o   <= (others => '0');
   i_bus_we_o    <= '0';
-  i_bus_re      <= ctrl_i(ctrl_bus_if_c) and (not i_misaligned) and (not if_pmp_fault); -- no actual read when misaligned or PMP fault
-  i_bus_re_o    <= i_bus_re_buf when (PMP_NUM_REGIONS > pmp_num_regions_critical_c) else i_bus_re;
+  i_bus_re      <= ctrl_i(ctrl_bus_if_c) and (not i_misaligned); -- no actual read when misaligned
+  i_bus_re_o    <= (i_bus_re_buf and (not if_pmp_fault)) when (PMP_NUM_REGIONS > pmp_num_regions_critical_c) else (i_bus_re and (not if_pmp_fault) and (not i_tcm_sel)); -- no actual read when PMP fault or TCM access
   i_bus_fence_o <= ctrl_i(ctrl_bus_fencei_c);
-  instr_o       <= i_bus_rdata_i;
+  instr_o       <= i_tcm_rdata_i when (i_tcm_ack = '1') else i_bus_rdata_i;
+  i_bus_ack     <= i_bus_ack_i or i_tcm_ack;
 
   -- check instruction access --
   i_misaligned <= '0' when (CPU_EXTENSION_RISCV_C = true) else -- no alignment exceptions possible when using C-extension
                   '1' when (fetch_pc_i(1) = '1') else '0'; -- 32-bit accesses only
 
+  -- instruction TCM: fetches from the TCM address range bypass the bus (and the i-cache) --
+  i_tcm_sel <= '1' when (i_tcm_en_c = true) and (fetch_pc_i(31 downto index_size_f(TCM_IMEM_SIZE)) = TCM_IMEM_BASE(31 downto index_size_f(TCM_IMEM_SIZE))) else '0';
+  i_tcm_re  <= i_bus_re and (not if_pmp_fault) and i_tcm_sel; -- no actual read when PMP fault
+
+  i_tcm_addr_o <= fetch_pc_i(data_width_c-1 downto 2) & "00";
+  i_tcm_re_o   <= i_tcm_re;
+
+  -- fixed-latency TCM response --
+  i_tcm_feedback: process(rstn_i, clk_i)
+  begin
+    if (rstn_i = '0') then
+      i_tcm_ack <= '0';
+    elsif rising_edge(clk_i) then
+      i_tcm_ack <= i_tcm_re;
+    end if;
+  end process i_tcm_feedback;
+
   -- additional register stage for control signals if using PMP_NUM_REGIONS > pmp_num_regions_critical_c --
   pmp_ibus_buffer: process(rstn_i, clk_i)
   begin
@@ -467,41 +568,119 @@ begin
   end process pmp_masks;
 
 
-  -- address access check --
+  -- address access check: all regions are checked in parallel --
   pmp_address_check:
   for r in 0 to PMP_NUM_REGIONS-1 generate -- iterate over all regions
+    -- NAPOT: masked compare --
     pmp.region_i_addr(r) <= fetch_pc_i                             and pmp.addr_mask(r);
-    pmp.region_d_addr(r) <= mar                                    and pmp.addr_mask(r);
+    pmp.region_d_addr(r) <= addr_i                                 and pmp.addr_mask(r);
     pmp.region_base(r)   <= pmp_addr_i(r)(data_width_c+1 downto 2) and pmp.addr_mask(r);
     --
-    pmp.i_match(r) <= '1' when (pmp.region_i_addr(r)(data_width_c-1 downto pmp_g_c) = pmp.region_base(r)(data_width_c-1 downto pmp_g_c)) else '0';
-    pmp.d_match(r) <= '1' when (pmp.region_d_addr(r)(data_width_c-1 downto pmp_g_c) = pmp.region_base(r)(data_width_c-1 downto pmp_g_c)) else '0';
+    pmp.i_napot(r) <= '1' when (pmp.region_i_addr(r)(data_width_c-1 downto pmp_g_c) = pmp.region_base(r)(data_width_c-1 downto pmp_g_c)) else '0';
+    pmp.d_napot(r) <= '1' when (pmp.region_d_addr(r)(data_width_c-1 downto pmp_g_c) = pmp.region_base(r)(data_width_c-1 downto pmp_g_c)) else '0';
+
+    -- NA4: word-address compare --
+    pmp.i_na4(r) <= '1' when ("00" & fetch_pc_i(data_width_c-1 downto 2) = pmp_addr_i(r)(data_width_c+1 downto 2)) else '0';
+    pmp.d_na4(r) <= '1' when ("00" & addr_i(data_width_c-1 downto 2)     = pmp_addr_i(r)(data_width_c+1 downto 2)) else '0';
+
+    -- TOR: one magnitude comparator per entry; shared as lower bound by the next entry --
+    pmp.i_below(r) <= '1' when (unsigned("00" & fetch_pc_i(data_width_c-1 downto 2)) < unsigned(pmp_addr_i(r)(data_width_c+1 downto 2))) else '0';
+    pmp.d_below(r) <= '1' when (unsigned("00" & addr_i(data_width_c-1 downto 2))     < unsigned(pmp_addr_i(r)(data_width_c+1 downto 2))) else '0';
   end generate; -- r
 
 
-  -- check access type and region's permissions --
+  -- region match according to address-matching mode --
+  pmp_region_match: process(pmp, pmp_ctrl_i)
+  begin
+    for r in 0 to PMP_NUM_REGIONS-1 loop -- iterate over all regions
+      case pmp_ctrl_i(r)(pmp_cfg_ah_c downto pmp_cfg_al_c) is
+        when pmp_tor_mode_c => -- pmpaddr(r-1) <= address < pmpaddr(r); lower bound of entry 0 is zero
+          if (r = 0) then
+            pmp.i_match(r) <= pmp.i_below(r);
+            pmp.d_match(r) <= pmp.d_below(r);
+          else
+            pmp.i_match(r) <= (not pmp.i_below(r-1)) and pmp.i_below(r);
+            pmp.d_match(r) <= (not pmp.d_below(r-1)) and pmp.d_below(r);
+          end if;
+        when pmp_na4_mode_c =>
+          pmp.i_match(r) <= pmp.i_na4(r);
+          pmp.d_match(r) <= pmp.d_na4(r);
+        when pmp_napot_mode_c =>
+          pmp.i_match(r) <= pmp.i_napot(r);
+          pmp.d_match(r) <= pmp.d_napot(r);
+        when others => -- pmp_off_mode_c
+          pmp.i_match(r) <= '0';
+          pmp.d_match(r) <= '0';
+      end case;
+    end loop; -- r
+  end process pmp_region_match;
+
+
+  -- the data access check uses the ALU address (addr_i) and is resolved when MAR is loaded --
+  -- additional register stage for region match if using PMP_NUM_REGIONS > pmp_num_regions_critical_c --
+  pmp_match_buffer: process(rstn_i, clk_i)
+  begin
+    if (rstn_i = '0') then
+      pmp.d_match_ff <= (others => '0');
+    elsif rising_edge(clk_i) then
+      if (ctrl_i(ctrl_bus_mo_we_c) = '1') then
+        pmp.d_match_ff <= pmp.d_match;
+      end if;
+    end if;
+  end process pmp_match_buffer;
+
+  pmp.d_match_sel <= pmp.d_match_ff when (PMP_NUM_REGIONS > pmp_num_regions_critical_c) else pmp.d_match;
+
+
+  -- check access type and permissions of the matching region --
+  -- only the lowest-numbered matching entry decides; no matching entry = no fault --
   pmp_check_permission: process(pmp, pmp_ctrl_i, ctrl_i)
+    variable i_lower_v : std_ulogic; -- a lower-numbered entry matches the fetch address
+    variable d_lower_v : std_ulogic; -- a lower-numbered entry matches the data address
+    variable if_fault_v, ld_fault_v, st_fault_v : std_ulogic; -- accumulated faults of all regions
   begin
+    i_lower_v  := '0';
+    d_lower_v  := '0';
+    if_fault_v := '0';
+    ld_fault_v := '0';
+    st_fault_v := '0';
     for r in 0 to PMP_NUM_REGIONS-1 loop -- iterate over all regions
       if ((ctrl_i(ctrl_priv_lvl_msb_c downto ctrl_priv_lvl_lsb_c) = priv_mode_u_c) or (pmp_ctrl_i(r)(pmp_cfg_l_c) = '1')) and -- user privilege level or locked pmp entry -> enforce permissions also for machine mode
-         (pmp_ctrl_i(r)(pmp_cfg_ah_c downto pmp_cfg_al_c) /= pmp_off_mode_c) and -- active entry
          (ctrl_i(ctrl_debug_running_c) = '0') then -- disable PMP checks when in debug mode
-        pmp.if_fault(r) <= pmp.i_match(r) and (not pmp_ctrl_i(r)(pmp_cfg_x_c)); -- fetch access match no execute permission
-        pmp.ld_fault(r) <= pmp.d_match(r) and (not pmp_ctrl_i(r)(pmp_cfg_r_c)); -- load access match no read permission
-        pmp.st_fault(r) <= pmp.d_match(r) and (not pmp_ctrl_i(r)(pmp_cfg_w_c)); -- store access match no write permission
-      else
-        pmp.if_fault(r) <= '0';
-        pmp.ld_fault(r) <= '0';
-        pmp.st_fault(r) <= '0';
+        if_fault_v := if_fault_v or (pmp.i_match(r)     and (not i_lower_v) and (not pmp_ctrl_i(r)(pmp_cfg_x_c))); -- first fetch access match, no execute permission
+        ld_fault_v := ld_fault_v or (pmp.d_match_sel(r) and (not d_lower_v) and (not pmp_ctrl_i(r)(pmp_cfg_r_c))); -- first load access match, no read permission
+        st_fault_v := st_fault_v or (pmp.d_match_sel(r) and (not d_lower_v) and (not pmp_ctrl_i(r)(pmp_cfg_w_c))); -- first store access match, no write permission
       end if;
+      i_lower_v := i_lower_v or pmp.i_match(r); -- only active entries can match
+      d_lower_v := d_lower_v or pmp.d_match_sel(r);
     end loop; -- r
+    pmp.if_fault_any <= if_fault_v;
+    pmp.ld_fault_any <= ld_fault_v;
+    pmp.st_fault_any <= st_fault_v;
   end process pmp_check_permission;
 
 
   -- final PMP access fault signals --
-  if_pmp_fault <= or_reduce_f(pmp.if_fault) when (PMP_NUM_REGIONS > 0) else '0';
-  ld_pmp_fault <= or_reduce_f(pmp.ld_fault) when (PMP_NUM_REGIONS > 0) else '0';
-  st_pmp_fault <= or_reduce_f(pmp.st_fault) when (PMP_NUM_REGIONS > 0) else '0';
+  pmp_fault_buffer: process(rstn_i, clk_i)
+  begin
+    if (rstn_i = '0') then
+      pmp.if_fault_ff <= '0';
+      ld_pmp_fault    <= '0';
+      st_pmp_fault    <= '0';
+    elsif rising_edge(clk_i) then
+      pmp.if_fault_ff <= pmp.if_fault_any;
+      if (PMP_NUM_REGIONS > pmp_num_regions_critical_c) then -- check registered match one cycle after MAR has been loaded
+        ld_pmp_fault <= pmp.ld_fault_any;
+        st_pmp_fault <= pmp.st_fault_any;
+      elsif (ctrl_i(ctrl_bus_mo_we_c) = '1') then -- check ALU address while MAR is loaded
+        ld_pmp_fault <= pmp.ld_fault_any;
+        st_pmp_fault <= pmp.st_fault_any;
+      end if;
+    end if;
+  end process pmp_fault_buffer;
+
+  -- data access faults are always registered; fetch access fault is registered if using PMP_NUM_REGIONS > pmp_num_regions_critical_c --
+  if_pmp_fault <= pmp.if_fault_ff when (PMP_NUM_REGIONS > pmp_num_regions_critical_c) else pmp.if_fault_any;
 
 
 end neorv32_cpu_bus_rtl;
@@ -65,9 +65,10 @@ entity neorv32_cpu_control is
     -- Extension Options --
     CPU_CNT_WIDTH                : natural; -- total width of CPU cycle and instret counters (0..64)
     CPU_IPB_ENTRIES              : natural; -- entries is instruction prefetch buffer, has to be a power of 2
+    CPU_NUM_TRIGGERS             : natural; -- number of hardware trigger module triggers (0..16)
     -- Physical memory protection (PMP) --
     PMP_NUM_REGIONS              : natural; -- number of regions (0..64)
-    PMP_MIN_GRANULARITY          : natural; -- minimal region granularity in bytes, has to be a power of 2, min 8 bytes
+    PMP_MIN_GRANULARITY          : natural; -- minimal region granularity in bytes, has to be a power of 2, min 4 bytes
     -- Hardware Performance Monitors (HPM) --
     HPM_NUM_CNTS                 : natural; -- number of implemented HPM counters (0..29)
     HPM_CNT_WIDTH                : natural  -- total size of HPM counters (0..64)
@@ -80,7 +81,9 @@ entity neorv32_cpu_control is
     -- status input --
     alu_idone_i   : in  std_ulogic; -- ALU iterative operation done
     bus_i_wait_i  : in  std_ulogic; -- wait for bus
+    bus_i_pipe_i  : in  std_ulogic; -- fetch address is located in the pipelined instruction TCM
     bus_d_wait_i  : in  std_ulogic; -- wait for bus
+    bus_d_tcm_i   : in  std_ulogic; -- data access address is located in data TCM
     excl_state_i  : in  std_ulogic; -- atomic/exclusive access lock status
     -- data input --
     instr_i       : in  std_ulogic_vector(data_width_c-1 downto 0); -- instruction
@@ -92,6 +95,7 @@ entity neorv32_cpu_control is
     fetch_pc_o    : out std_ulogic_vector(data_width_c-1 downto 0); -- PC for instruction fetch
     curr_pc_o     : out std_ulogic_vector(data_width_c-1 downto 0); -- current PC (corresponding to current instruction)
     csr_rdata_o   : out std_ulogic_vector(data_width_c-1 downto 0); -- CSR read data
+    bus_d_tcm_o   : out std_ulogic_vector(1 downto 0); -- data TCM access request (0 = read, 1 = write)
     -- FPU interface --
     fpu_flags_i   : in  std_ulogic_vector(04 downto 0); -- exception flags
     -- debug mode (halt) request --
@@ -116,7 +120,15 @@ entity neorv32_cpu_control is
     ma_store_i    : in  std_ulogic; -- misaligned store data address
     be_instr_i    : in  std_ulogic; -- bus error on instruction access
     be_load_i     : in  std_ulogic; -- bus error on load data access
-    be_store_i    : in  std_ulogic  -- bus error on store data access
+    be_store_i    : in  std_ulogic; -- bus error on store data access
+    -- external HPM events --
+    icache_ev_i   : in  std_ulogic_vector(03 downto 0); -- i-cache events: 0 = useful prefetch, 1 = useless prefetch, 2 = access, 3 = miss
+    -- i-cache locking (custom CSRs) --
+    icache_ctrl_o : out std_ulogic_vector(02 downto 0); -- i-cache control: 0 = lock preloaded blocks, 1 = unlock all blocks, 2 = preload request
+    icache_addr_o : out std_ulogic_vector(data_width_c-1 downto 0); -- i-cache preload address
+    icache_stat_i : in  std_ulogic_vector(01 downto 0); -- i-cache status: 0 = preload in progress, 1 = preload failed
+    -- instruction trace port --
+    trace_o       : out cpu_trace_if_t -- program flow discontinuity events
   );
 end neorv32_cpu_control;
 
@@ -138,6 +150,8 @@ architecture neorv32_cpu_control_rtl of neorv32_cpu_control is
     state_prev  : fetch_engine_state_t;
     restart     : std_ulogic;
     restart_nxt : std_ulogic;
+    pipe        : std_ulogic; -- current request is a pipelined TCM fetch (PC already incremented)
+    pipe_nxt    : std_ulogic;
     pc          : std_ulogic_vector(data_width_c-1 downto 0);
     pc_nxt      : std_ulogic_vector(data_width_c-1 downto 0);
     reset       : std_ulogic;
@@ -150,6 +164,7 @@ architecture neorv32_cpu_control_rtl of neorv32_cpu_control is
     wdata : std_ulogic_vector(2+31 downto 0); -- write status (bus_error, align_error) + 32-bit instruction data
     we    : std_ulogic; -- trigger write
     free  : std_ulogic; -- free entry available?
+    level : std_ulogic_vector(index_size_f(CPU_IPB_ENTRIES) downto 0); -- fill level
     clear : std_ulogic; -- clear all entries
     --
     rdata : std_ulogic_vector(2+31 downto 0); -- read data: status (bus_error, align_error) + 32-bit instruction data
@@ -222,6 +237,8 @@ architecture neorv32_cpu_control_rtl of neorv32_cpu_control is
     sleep_nxt    : std_ulogic;
     branched     : std_ulogic; -- instruction fetch was reset
     branched_nxt : std_ulogic;
+    --
+    tcm_req      : std_ulogic_vector(1 downto 0); -- data TCM access request (0 = read, 1 = write)
   end record;
   signal execute_engine : execute_engine_t;
 
@@ -261,6 +278,7 @@ architecture neorv32_cpu_control_rtl of neorv32_cpu_control is
   type pmp_ctrl_t     is array (0 to PMP_NUM_REGIONS-1) of std_ulogic_vector(7 downto 0);
   type pmp_addr_t     is array (0 to PMP_NUM_REGIONS-1) of std_ulogic_vector(data_width_c-1 downto 0);
   type pmp_ctrl_rd_t  is array (0 to 63) of std_ulogic_vector(7 downto 0);
+  type pmp_addr_rd_t  is array (0 to 63) of std_ulogic_vector(data_width_c-1 downto 0);
   type mhpmevent_t    is array (0 to HPM_NUM_CNTS-1) of std_ulogic_vector(hpmcnt_event_size_c-1 downto 0);
   type mhpmcnt_t      is array (0 to HPM_NUM_CNTS-1) of std_ulogic_vector(31 downto 0);
   type mhpmcnt_nxt_t  is array (0 to HPM_NUM_CNTS-1) of std_ulogic_vector(32 downto 0);
@@ -327,6 +345,7 @@ architecture neorv32_cpu_control_rtl of neorv32_cpu_control is
     pmpcfg            : pmp_ctrl_t; -- physical memory protection - configuration registers
     pmpcfg_rd         : pmp_ctrl_rd_t; -- physical memory protection - actual read data
     pmpaddr           : pmp_addr_t; -- physical memory protection - address registers
+    pmpaddr_rd        : pmp_addr_rd_t; -- physical memory protection - actual read data
     --
     frm               : std_ulogic_vector(02 downto 0); -- frm (R/W): FPU rounding mode
     fflags            : std_ulogic_vector(04 downto 0); -- fflags (R/W): FPU exception flags
@@ -353,6 +372,7 @@ architecture neorv32_cpu_control_rtl of neorv32_cpu_control is
     trig_break   : std_ulogic; -- ebreak instruction
     trig_halt    : std_ulogic; -- external request
     trig_step    : std_ulogic; -- single-stepping mode
+    trig_hw      : std_ulogic; -- hardware trigger
     -- leave debug mode --
     dret         : std_ulogic; -- executed DRET instruction
     -- misc --
@@ -360,6 +380,48 @@ architecture neorv32_cpu_control_rtl of neorv32_cpu_control is
   end record;
   signal debug_ctrl : debug_ctrl_t;
 
+  -- hardware trigger module --
+  type trig_ctrl_t is array (0 to CPU_NUM_TRIGGERS-1) of std_ulogic_vector(09 downto 0);
+  type trig_data_t is array (0 to CPU_NUM_TRIGGERS-1) of std_ulogic_vector(data_width_c-1 downto 0);
+  type trigger_t is record
+    tselect : std_ulogic_vector(03 downto 0); -- tselect (R/W): currently selected trigger
+    ctrl    : trig_ctrl_t; -- tdata1 (R/W): trigger configuration (compressed)
+    addr    : trig_data_t; -- tdata2 (R/W): trigger compare address
+    mask    : trig_data_t; -- don't-care mask for NAPOT address matching
+    cnt     : trig_data_t; -- tdata3 (R/W): trigger match counter (custom)
+    tdata1  : std_ulogic_vector(data_width_c-1 downto 0); -- tdata1 read-back of currently selected trigger
+    tdata2  : std_ulogic_vector(data_width_c-1 downto 0); -- tdata2 read-back of currently selected trigger
+    tdata3  : std_ulogic_vector(data_width_c-1 downto 0); -- tdata3 read-back of currently selected trigger
+    mte     : std_ulogic; -- tcontrol.MTE (R/W): M-mode breakpoint exception triggers enabled
+    mpte    : std_ulogic; -- tcontrol.MPTE (R/W): previous MTE state (saved on trap entry)
+    hit     : std_ulogic_vector(CPU_NUM_TRIGGERS-1 downto 0); -- trigger match (for current instruction)
+    fire    : std_ulogic; -- trap request: do not commit current instruction
+    break   : std_ulogic; -- trap request: raise breakpoint exception
+    halt    : std_ulogic; -- trap request: enter debug mode
+  end record;
+  signal trigger : trigger_t;
+
+  -- trigger configuration bits (trigger.ctrl) --
+  constant trig_load_c    : natural := 0; -- fire on load address match
+  constant trig_store_c   : natural := 1; -- fire on store address match
+  constant trig_exe_c     : natural := 2; -- fire on instruction address match
+  constant trig_u_c       : natural := 3; -- enabled in user mode
+  constant trig_m_c       : natural := 4; -- enabled in machine mode
+  constant trig_napot_c   : natural := 5; -- match type: 0 = equal, 1 = NAPOT
+  constant trig_act0_c    : natural := 6; -- action: 00 = breakpoint exception, 01 = enter debug mode,
+  constant trig_act1_c    : natural := 7; --         11 = count only (custom)
+  constant trig_hit_c     : natural := 8; -- trigger has fired
+  constant trig_dmode_c   : natural := 9; -- trigger is owned by debug mode
+
+  -- i-cache locking control (custom CSRs) --
+  type icache_ctrl_t is record
+    lock    : std_ulogic; -- micachectl (R/W): lock preloaded blocks
+    unlock  : std_ulogic; -- micachectl (-/W): unlock all blocks (single-shot)
+    preload : std_ulogic; -- micachepre (-/W): preload request (single-shot)
+    addr    : std_ulogic_vector(data_width_c-1 downto 0); -- micachepre (R/W): preload address
+  end record;
+  signal icache_ctrl : icache_ctrl_t;
+
   -- (hpm) counter events --
   signal cnt_event, cnt_event_nxt : std_ulogic_vector(hpmcnt_event_size_c-1 downto 0);
   signal hpmcnt_trigger           : std_ulogic_vector(HPM_NUM_CNTS-1 downto 0);
@@ -387,11 +449,13 @@ begin
       fetch_engine.state      <= IFETCH_REQUEST;
       fetch_engine.state_prev <= IFETCH_REQUEST;
       fetch_engine.restart    <= '1';
+      fetch_engine.pipe       <= '0';
       fetch_engine.pc         <= (others => def_rst_val_c);
     elsif rising_edge(clk_i) then
       fetch_engine.state      <= fetch_engine.state_nxt;
       fetch_engine.state_prev <= fetch_engine.state;
       fetch_engine.restart    <= fetch_engine.restart_nxt;
+      fetch_engine.pipe       <= fetch_engine.pipe_nxt;
       if (fetch_engine.restart = '1') then
         fetch_engine.pc <= execute_engine.pc(data_width_c-1 downto 1) & '0'; -- initialize with "real" application PC
       else
@@ -406,11 +470,12 @@ begin
 
   -- Fetch Engine FSM Comb ------------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
-  fetch_engine_fsm_comb: process(fetch_engine, execute_engine, ipb, instr_i, bus_i_wait_i, be_instr_i, ma_instr_i)
+  fetch_engine_fsm_comb: process(fetch_engine, execute_engine, ipb, instr_i, bus_i_wait_i, bus_i_pipe_i, be_instr_i, ma_instr_i)
   begin
     -- arbiter defaults --
     bus_fast_ir              <= '0';
     fetch_engine.state_nxt   <= fetch_engine.state;
+    fetch_engine.pipe_nxt    <= fetch_engine.pipe;
     fetch_engine.pc_nxt      <= fetch_engine.pc;
     fetch_engine.bus_err_ack <= '0';
     fetch_engine.restart_nxt <= fetch_engine.restart or fetch_engine.reset;
@@ -427,6 +492,10 @@ begin
       -- ------------------------------------------------------------
         if (ipb.free = '1') and (fetch_engine.restart = '0') then -- free entry in buffer AND no reset request?
           bus_fast_ir            <= '1'; -- fast instruction fetch request
+          fetch_engine.pipe_nxt  <= bus_i_pipe_i;
+          if (bus_i_pipe_i = '1') then -- TCM samples the address right away
+            fetch_engine.pc_nxt <= std_ulogic_vector(unsigned(fetch_engine.pc) + 4);
+          end if;
           fetch_engine.state_nxt <= IFETCH_ISSUE;
         end if;
         if (fetch_engine.restart = '1') then -- reset request?
@@ -437,12 +506,22 @@ begin
       -- ------------------------------------------------------------
         fetch_engine.bus_err_ack <= be_instr_i or ma_instr_i; -- ACK bus/alignment errors
         if (bus_i_wait_i = '0') or (be_instr_i = '1') or (ma_instr_i = '1') then -- wait for bus response
-          fetch_engine.pc_nxt <= std_ulogic_vector(unsigned(fetch_engine.pc) + 4);
-          ipb.we              <= not fetch_engine.restart; -- write to IPB if not being reset
+          if (fetch_engine.pipe = '0') then -- PC not incremented yet?
+            fetch_engine.pc_nxt <= std_ulogic_vector(unsigned(fetch_engine.pc) + 4);
+          end if;
+          ipb.we <= not fetch_engine.restart; -- write to IPB if not being reset
           if (fetch_engine.restart = '1') then -- reset request?
             fetch_engine.restart_nxt <= '0';
           end if;
-          fetch_engine.state_nxt <= IFETCH_REQUEST;
+          -- back-to-back TCM fetch: issue next request while the current data returns (one word per cycle) --
+          if (fetch_engine.pipe = '1') and (bus_i_pipe_i = '1') and (be_instr_i = '0') and (ma_instr_i = '0') and
+             (fetch_engine.restart = '0') and (unsigned(ipb.level) < (CPU_IPB_ENTRIES-1)) then -- room for this AND the next word?
+            bus_fast_ir         <= '1';
+            fetch_engine.pc_nxt <= std_ulogic_vector(unsigned(fetch_engine.pc) + 4);
+          else
+            fetch_engine.pipe_nxt  <= '0';
+            fetch_engine.state_nxt <= IFETCH_REQUEST;
+          end if;
         end if;
 
       when others => -- undefined
@@ -471,6 +550,7 @@ begin
     clk_i   => clk_i,     -- clock, rising edge
     rstn_i  => '1',       -- async reset, low-active
     clear_i => ipb.clear, -- sync reset, high-active
+    level_o => ipb.level, -- fill level
     -- write port --
     wdata_i => ipb.wdata, -- write data
     we_i    => ipb.we,    -- write enable
@@ -809,6 +889,76 @@ begin
   end process ctrl_output;
 
 
+  -- Instruction Trace Port -----------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  -- Only program flow discontinuities that cannot be inferred from the executable are reported:
+  -- conditional branches (taken/not taken), uninferable jumps (JALR), trap entry and trap return.
+  -- The trace port is observation-only and does not influence the CPU's timing at all.
+  trace_output: process(rstn_i, clk_i)
+  begin
+    if (rstn_i = '0') then
+      trace_o.exe    <= '0';
+      trace_o.branch <= '0';
+      trace_o.taken  <= '0';
+      trace_o.jump   <= '0';
+      trace_o.trap   <= '0';
+      trace_o.tret   <= '0';
+      trace_o.cause  <= (others => def_rst_val_c);
+      trace_o.pc     <= (others => def_rst_val_c);
+      trace_o.target <= (others => def_rst_val_c);
+      trace_o.debug  <= '0';
+    elsif rising_edge(clk_i) then
+      -- defaults --
+      trace_o.exe    <= '0';
+      trace_o.branch <= '0';
+      trace_o.jump   <= '0';
+      trace_o.trap   <= '0';
+      trace_o.tret   <= '0';
+      trace_o.taken  <= execute_engine.branch_taken;
+      trace_o.cause  <= trap_ctrl.cause;
+      trace_o.pc     <= execute_engine.pc(data_width_c-1 downto 1) & '0'; -- current instruction
+      trace_o.target <= execute_engine.next_pc(data_width_c-1 downto 1) & '0'; -- trap enter/exit address
+      if (CPU_EXTENSION_RISCV_DEBUG = true) then
+        trace_o.debug <= debug_ctrl.running;
+      else
+        trace_o.debug <= '0';
+      end if;
+
+      -- events --
+      case execute_engine.state is
+
+        when EXECUTE => -- instruction enters execution
+          trace_o.exe <= '1';
+
+        when BRANCH => -- JAL is inferable from the executable itself
+          if (execute_engine.i_reg(instr_opcode_msb_c downto instr_opcode_lsb_c) = opcode_jalr_c) then
+            trace_o.jump   <= '1';
+            trace_o.target <= alu_add_i(data_width_c-1 downto 1) & '0'; -- jump destination
+          elsif (execute_engine.i_reg(instr_opcode_msb_c downto instr_opcode_lsb_c) = opcode_branch_c) then
+            trace_o.branch <= '1';
+          end if;
+
+        when TRAP_EXECUTE =>
+          if (execute_engine.state_prev = TRAP_ENTER) then -- trap entry
+            trace_o.trap <= '1';
+            if (trap_ctrl.cause(trap_ctrl.cause'left) = '0') then -- sync. exception: PC of faulting instruction (= mepc)
+              trace_o.pc <= execute_engine.last_pc(data_width_c-1 downto 1) & '0';
+            end if;
+            if (CPU_EXTENSION_RISCV_DEBUG = true) and (trap_ctrl.cause(5) = '1') then -- entering debug mode
+              trace_o.debug <= '1';
+            end if;
+          else -- trap exit
+            trace_o.tret <= '1';
+          end if;
+
+        when others =>
+          NULL;
+
+      end case;
+    end if;
+  end process trace_output;
+
+
   -- Decoding Helper Logic ------------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
   decode_helper: process(execute_engine)
@@ -863,7 +1013,7 @@ begin
   -- Execute Engine FSM Comb ----------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
   execute_engine_fsm_comb: process(execute_engine, debug_ctrl, trap_ctrl, decode_aux, fetch_engine, cmd_issue,
-                                   csr, ctrl, csr_acc_valid, alu_idone_i, bus_d_wait_i, excl_state_i)
+                                   csr, ctrl, csr_acc_valid, alu_idone_i, bus_d_wait_i, bus_d_tcm_i, excl_state_i, trigger)
     variable opcode_v : std_ulogic_vector(6 downto 0);
   begin
     -- arbiter defaults --
@@ -875,6 +1025,7 @@ begin
     --
     execute_engine.pc_mux_sel   <= '0';
     execute_engine.pc_we        <= '0';
+    execute_engine.tcm_req      <= (others => '0');
 
     -- instruction dispatch --
     fetch_engine.reset          <= '0';
@@ -1114,6 +1265,15 @@ begin
 
         end case;
 
+        -- hardware trigger: instruction address match - do not commit the instruction, take the trap instead --
+        if (trigger.fire = '1') then
+          ctrl_nxt(ctrl_rf_wb_en_c)  <= '0'; -- no RF write-back
+          ctrl_nxt(ctrl_bus_mo_we_c) <= '0'; -- no memory access
+          ctrl_nxt(ctrl_alu_func1_c downto ctrl_alu_func0_c) <= alu_func_cmd_arith_c; -- do not start any co-processor
+          csr.re_nxt                 <= '0'; -- no CSR read side effects
+          execute_engine.state_nxt   <= SYS_WAIT;
+        end if;
+
 
       when SYS_ENV => -- system environment operation - execution
       -- ------------------------------------------------------------
@@ -1209,19 +1369,28 @@ begin
 
       when LOADSTORE_0 => -- trigger memory request
       -- ------------------------------------------------------------
-        ctrl_nxt(ctrl_bus_lock_c) <= decode_aux.is_atomic_lr; -- atomic.LR: set lock
-        if (execute_engine.i_reg(instr_opcode_msb_c-1) = '0') or (decode_aux.is_atomic_lr = '1') then -- normal load or atomic load-reservate
-          ctrl_nxt(ctrl_bus_rd_c)  <= '1'; -- read request
-        else -- store
-          if (decode_aux.is_atomic_sc = '1') then -- evaluate lock state
-            if (excl_state_i = '1') then -- lock is still ok - perform write access
-              ctrl_nxt(ctrl_bus_wr_c) <= '1'; -- write request
+        if (trigger.fire = '1') then -- hardware trigger: data address match - do not access memory, take the trap instead
+          execute_engine.state_nxt <= SYS_WAIT;
+        elsif (bus_d_tcm_i = '1') and (decode_aux.is_atomic_lr = '0') and (decode_aux.is_atomic_sc = '0') then -- plain load/store to data TCM
+          execute_engine.tcm_req(0)  <= not execute_engine.i_reg(instr_opcode_msb_c-1); -- access TCM right now
+          execute_engine.tcm_req(1)  <=     execute_engine.i_reg(instr_opcode_msb_c-1);
+          ctrl_nxt(ctrl_bus_mi_we_c) <= '1'; -- write input data to MDI (only relevant for LOADs)
+          execute_engine.state_nxt   <= LOADSTORE_2; -- skip bus latency cycle
+        else
+          ctrl_nxt(ctrl_bus_lock_c) <= decode_aux.is_atomic_lr; -- atomic.LR: set lock
+          if (execute_engine.i_reg(instr_opcode_msb_c-1) = '0') or (decode_aux.is_atomic_lr = '1') then -- normal load or atomic load-reservate
+            ctrl_nxt(ctrl_bus_rd_c)  <= '1'; -- read request
+          else -- store
+            if (decode_aux.is_atomic_sc = '1') then -- evaluate lock state
+              if (excl_state_i = '1') then -- lock is still ok - perform write access
+                ctrl_nxt(ctrl_bus_wr_c) <= '1'; -- write request
+              end if;
+            else
+              ctrl_nxt(ctrl_bus_wr_c) <= '1'; -- (normal) write request
             end if;
-          else
-            ctrl_nxt(ctrl_bus_wr_c) <= '1'; -- (normal) write request
           end if;
+          execute_engine.state_nxt <= LOADSTORE_1;
         end if;
-        execute_engine.state_nxt <= LOADSTORE_1;
 
 
       when LOADSTORE_1 => -- memory access latency
@@ -1260,6 +1429,9 @@ begin
     end case;
   end process execute_engine_fsm_comb;
 
+  -- data TCM access request (issued directly from LOADSTORE_0) --
+  bus_d_tcm_o <= execute_engine.tcm_req;
+
 
 -- ****************************************************************************************************************************
 -- Invalid Instruction / CSR access check
@@ -1361,6 +1533,24 @@ begin
       when csr_mvendorid_c | csr_marchid_c | csr_mimpid_c | csr_mhartid_c | csr_mconfigptr_c | csr_mzext_c =>
         csr_acc_valid <= (not csr_wacc_v) and csr.priv_m_mode; -- M-mode only, read-only
 
+      -- hardware trigger module CSRs --
+      when csr_tselect_c | csr_tdata1_c | csr_tdata2_c | csr_tdata3_c | csr_tcontrol_c =>
+        if (CPU_NUM_TRIGGERS > 0) then
+          csr_acc_valid <= csr.priv_m_mode; -- M-mode only
+        else
+          NULL;
+        end if;
+      when csr_tinfo_c =>
+        if (CPU_NUM_TRIGGERS > 0) then
+          csr_acc_valid <= (not csr_wacc_v) and csr.priv_m_mode; -- M-mode only, read-only
+        else
+          NULL;
+        end if;
+
+      -- custom i-cache locking CSRs --
+      when csr_micachectl_c | csr_micachepre_c =>
+        csr_acc_valid <= csr.priv_m_mode; -- M-mode only
+
       -- debug mode CSRs --
       when csr_dcsr_c | csr_dpc_c | csr_dscratch0_c =>
         if (CPU_EXTENSION_RISCV_DEBUG = true) then
@@ -1633,20 +1823,23 @@ begin
           trap_ctrl.exc_buf(exception_break_c) <= (trap_ctrl.exc_buf(exception_break_c) or 
             (
               (trap_ctrl.break_point and csr.priv_m_mode and (not csr.dcsr_ebreakm) and (not debug_ctrl.running)) or -- enable break to machine-trap-handler when in machine mode on "ebreak"
-              (trap_ctrl.break_point and csr.priv_u_mode and (not csr.dcsr_ebreaku) and (not debug_ctrl.running))    -- enable break to machine-trap-handler when in user mode on "ebreak"
+              (trap_ctrl.break_point and csr.priv_u_mode and (not csr.dcsr_ebreaku) and (not debug_ctrl.running)) or -- enable break to machine-trap-handler when in user mode on "ebreak"
+              trigger.break -- hardware trigger
             )
           ) and (not trap_ctrl.exc_ack);
         else
-          trap_ctrl.exc_buf(exception_break_c) <= (trap_ctrl.exc_buf(exception_break_c) or trap_ctrl.break_point) and (not trap_ctrl.exc_ack);
+          trap_ctrl.exc_buf(exception_break_c) <= (trap_ctrl.exc_buf(exception_break_c) or trap_ctrl.break_point or trigger.break) and (not trap_ctrl.exc_ack);
         end if;
 
         -- enter debug mode --
         if (CPU_EXTENSION_RISCV_DEBUG = true) then
           trap_ctrl.exc_buf(exception_db_break_c) <= (trap_ctrl.exc_buf(exception_db_break_c) or debug_ctrl.trig_break) and (not trap_ctrl.exc_ack);
+          trap_ctrl.exc_buf(exception_db_trig_c)  <= (trap_ctrl.exc_buf(exception_db_trig_c)  or debug_ctrl.trig_hw)    and (not trap_ctrl.exc_ack);
           trap_ctrl.irq_buf(interrupt_db_halt_c)  <= (trap_ctrl.irq_buf(interrupt_db_halt_c)  or debug_ctrl.trig_halt)  and (not trap_ctrl.irq_ack(interrupt_db_halt_c));
           trap_ctrl.irq_buf(interrupt_db_step_c)  <= (trap_ctrl.irq_buf(interrupt_db_step_c)  or debug_ctrl.trig_step)  and (not trap_ctrl.irq_ack(interrupt_db_step_c));
         else
           trap_ctrl.exc_buf(exception_db_break_c) <= '0';
+          trap_ctrl.exc_buf(exception_db_trig_c)  <= '0';
           trap_ctrl.irq_buf(interrupt_db_halt_c)  <= '0';
           trap_ctrl.irq_buf(interrupt_db_step_c)  <= '0';
         end if;
@@ -1710,6 +1903,10 @@ begin
     if (CPU_EXTENSION_RISCV_DEBUG = true) and (trap_ctrl.exc_buf(exception_db_break_c) = '1') then
       trap_ctrl.cause_nxt <= trap_db_break_c;
 
+    -- hardware trigger --
+    elsif (CPU_EXTENSION_RISCV_DEBUG = true) and (trap_ctrl.exc_buf(exception_db_trig_c) = '1') then
+      trap_ctrl.cause_nxt <= trap_db_trig_c;
+
     -- external halt request --
     elsif (CPU_EXTENSION_RISCV_DEBUG = true) and (trap_ctrl.irq_buf(interrupt_db_halt_c) = '1') then
       trap_ctrl.cause_nxt <= trap_db_halt_c;
@@ -2055,8 +2252,13 @@ begin
                     csr.pmpcfg(i)(0) <= csr.wdata((i mod 4)*8+0); -- R (rights.read)
                     csr.pmpcfg(i)(1) <= csr.wdata((i mod 4)*8+1); -- W (rights.write)
                     csr.pmpcfg(i)(2) <= csr.wdata((i mod 4)*8+2); -- X (rights.execute)
-                    csr.pmpcfg(i)(3) <= csr.wdata((i mod 4)*8+3) and csr.wdata((i mod 4)*8+4); -- A_L
-                    csr.pmpcfg(i)(4) <= csr.wdata((i mod 4)*8+3) and csr.wdata((i mod 4)*8+4); -- A_H - NAPOT/OFF only
+                    if (csr.wdata((i mod 4)*8+4 downto (i mod 4)*8+3) = "10") and (PMP_MIN_GRANULARITY > 4) then -- NA4 not available if granularity > 4 bytes
+                      csr.pmpcfg(i)(3) <= '1'; -- A_L - use NAPOT of minimal granularity instead
+                      csr.pmpcfg(i)(4) <= '1'; -- A_H
+                    else
+                      csr.pmpcfg(i)(3) <= csr.wdata((i mod 4)*8+3); -- A_L
+                      csr.pmpcfg(i)(4) <= csr.wdata((i mod 4)*8+4); -- A_H - OFF/TOR/NA4/NAPOT
+                    end if;
                     csr.pmpcfg(i)(5) <= '0'; -- reserved
                     csr.pmpcfg(i)(6) <= '0'; -- reserved
                     csr.pmpcfg(i)(7) <= csr.wdata((i mod 4)*8+7); -- L (locked / rights also enforced in m-mode)
@@ -2073,8 +2275,7 @@ begin
                (csr.addr(11 downto 4) = csr_pmpaddr32_c(11 downto 4)) or (csr.addr(11 downto 4) = csr_pmpaddr48_c(11 downto 4)) then 
               for i in 0 to PMP_NUM_REGIONS-1 loop
                 if (csr.addr(6 downto 0) = std_ulogic_vector(unsigned(csr_pmpaddr0_c(6 downto 0)) + i)) and (csr.pmpcfg(i)(7) = '0') then -- unlocked pmpaddr access
-                  csr.pmpaddr(i) <= csr.wdata;
-                  csr.pmpaddr(i)(index_size_f(PMP_MIN_GRANULARITY)-4 downto 0) <= (others => '1');
+                  csr.pmpaddr(i) <= csr.wdata; -- granularity is applied by read-back logic
                 end if;
               end loop; -- i (PMP regions)
             end if;
@@ -2293,8 +2494,7 @@ begin
     pmp_ctrl_o <= (others => (others => '0'));
     if (PMP_NUM_REGIONS /= 0) then
       for i in 0 to PMP_NUM_REGIONS-1 loop
-        pmp_addr_o(i) <= csr.pmpaddr(i) & "11";
-        pmp_addr_o(i)(index_size_f(PMP_MIN_GRANULARITY)-4 downto 0) <= (others => '1');
+        pmp_addr_o(i) <= csr.pmpaddr_rd(i) & "11"; -- effective address (incl. granularity)
         pmp_ctrl_o(i) <= csr.pmpcfg(i);
       end loop; -- i
     end if;
@@ -2304,9 +2504,17 @@ begin
   pmp_rd_dummy: process(csr)
   begin
     csr.pmpcfg_rd  <= (others => (others => '0'));
+    csr.pmpaddr_rd <= (others => (others => '0'));
     if (PMP_NUM_REGIONS /= 0) then
       for i in 0 to PMP_NUM_REGIONS-1 loop
         csr.pmpcfg_rd(i)  <= csr.pmpcfg(i);
+        csr.pmpaddr_rd(i) <= csr.pmpaddr(i);
+        -- apply granularity G (PMP_MIN_GRANULARITY = 2^(G+2)) --
+        if (csr.pmpcfg(i)(4 downto 3) = "11") then -- NAPOT: bits G-2:0 read as one
+          csr.pmpaddr_rd(i)(index_size_f(PMP_MIN_GRANULARITY)-4 downto 0) <= (others => '1');
+        elsif (csr.pmpcfg(i)(4) = '0') then -- OFF/TOR: bits G-1:0 read as zero
+          csr.pmpaddr_rd(i)(index_size_f(PMP_MIN_GRANULARITY)-3 downto 0) <= (others => '0');
+        end if;
       end loop; -- i
     end if;
   end process pmp_rd_dummy;
@@ -2473,8 +2681,8 @@ begin
   cnt_event_nxt(hpmcnt_event_wait_ii_c) <= '1' when (execute_engine.state = DISPATCH)     and (execute_engine.state_prev = DISPATCH)   else '0'; -- instruction issue wait cycle
   cnt_event_nxt(hpmcnt_event_wait_mc_c) <= '1' when (execute_engine.state = ALU_WAIT)     and (execute_engine.state_prev = ALU_WAIT)   else '0'; -- multi-cycle alu-operation wait cycle
 
-  cnt_event_nxt(hpmcnt_event_load_c)    <= '1' when (execute_engine.state = LOADSTORE_1) and (ctrl(ctrl_bus_rd_c) = '1')               else '0'; -- load operation
-  cnt_event_nxt(hpmcnt_event_store_c)   <= '1' when (execute_engine.state = LOADSTORE_1) and (ctrl(ctrl_bus_wr_c) = '1')               else '0'; -- store operation
+  cnt_event_nxt(hpmcnt_event_load_c)    <= '1' when ((execute_engine.state = LOADSTORE_1) and (ctrl(ctrl_bus_rd_c) = '1')) or (execute_engine.tcm_req(0) = '1') else '0'; -- load operation
+  cnt_event_nxt(hpmcnt_event_store_c)   <= '1' when ((execute_engine.state = LOADSTORE_1) and (ctrl(ctrl_bus_wr_c) = '1')) or (execute_engine.tcm_req(1) = '1') else '0'; -- store operation
   cnt_event_nxt(hpmcnt_event_wait_ls_c) <= '1' when (execute_engine.state = LOADSTORE_2) and (execute_engine.state_prev = LOADSTORE_2) else '0'; -- load/store memory wait cycle
 
   cnt_event_nxt(hpmcnt_event_jump_c)    <= '1' when (execute_engine.state = BRANCH) and (execute_engine.i_reg(instr_opcode_lsb_c+2) = '1') else '0'; -- jump (unconditional)
@@ -2484,6 +2692,11 @@ begin
   cnt_event_nxt(hpmcnt_event_trap_c)    <= '1' when (trap_ctrl.env_start_ack = '1')                                    else '0'; -- entered trap
   cnt_event_nxt(hpmcnt_event_illegal_c) <= '1' when (trap_ctrl.env_start_ack = '1') and (trap_ctrl.cause = trap_iil_c) else '0'; -- illegal operation
 
+  cnt_event_nxt(hpmcnt_event_pf_use_c)  <= icache_ev_i(0); -- i-cache: useful prefetch
+  cnt_event_nxt(hpmcnt_event_pf_nuse_c) <= icache_ev_i(1); -- i-cache: useless prefetch
+  cnt_event_nxt(hpmcnt_event_ic_acc_c)  <= icache_ev_i(2); -- i-cache: access
+  cnt_event_nxt(hpmcnt_event_ic_miss_c) <= icache_ev_i(3); -- i-cache: miss
+
 
   -- Control and Status Registers - Read Access ---------------------------------------------
   -- -------------------------------------------------------------------------------------------
@@ -2583,70 +2796,70 @@ begin
 
           -- physical memory protection - addresses --
           -- --------------------------------------------------------------------
-          when csr_pmpaddr0_c  => if (PMP_NUM_REGIONS > 00) then csr.rdata <= csr.pmpaddr(00); else NULL; end if; -- R/W: pmpaddr0
-          when csr_pmpaddr1_c  => if (PMP_NUM_REGIONS > 01) then csr.rdata <= csr.pmpaddr(01); else NULL; end if; -- R/W: pmpaddr1
-          when csr_pmpaddr2_c  => if (PMP_NUM_REGIONS > 02) then csr.rdata <= csr.pmpaddr(02); else NULL; end if; -- R/W: pmpaddr2
-          when csr_pmpaddr3_c  => if (PMP_NUM_REGIONS > 03) then csr.rdata <= csr.pmpaddr(03); else NULL; end if; -- R/W: pmpaddr3
-          when csr_pmpaddr4_c  => if (PMP_NUM_REGIONS > 04) then csr.rdata <= csr.pmpaddr(04); else NULL; end if; -- R/W: pmpaddr4
-          when csr_pmpaddr5_c  => if (PMP_NUM_REGIONS > 05) then csr.rdata <= csr.pmpaddr(05); else NULL; end if; -- R/W: pmpaddr5
-          when csr_pmpaddr6_c  => if (PMP_NUM_REGIONS > 06) then csr.rdata <= csr.pmpaddr(06); else NULL; end if; -- R/W: pmpaddr6
-          when csr_pmpaddr7_c  => if (PMP_NUM_REGIONS > 07) then csr.rdata <= csr.pmpaddr(07); else NULL; end if; -- R/W: pmpaddr7
-          when csr_pmpaddr8_c  => if (PMP_NUM_REGIONS > 08) then csr.rdata <= csr.pmpaddr(08); else NULL; end if; -- R/W: pmpaddr8
-          when csr_pmpaddr9_c  => if (PMP_NUM_REGIONS > 09) then csr.rdata <= csr.pmpaddr(09); else NULL; end if; -- R/W: pmpaddr9
-          when csr_pmpaddr10_c => if (PMP_NUM_REGIONS > 10) then csr.rdata <= csr.pmpaddr(10); else NULL; end if; -- R/W: pmpaddr10
-          when csr_pmpaddr11_c => if (PMP_NUM_REGIONS > 11) then csr.rdata <= csr.pmpaddr(11); else NULL; end if; -- R/W: pmpaddr11
-          when csr_pmpaddr12_c => if (PMP_NUM_REGIONS > 12) then csr.rdata <= csr.pmpaddr(12); else NULL; end if; -- R/W: pmpaddr12
-          when csr_pmpaddr13_c => if (PMP_NUM_REGIONS > 13) then csr.rdata <= csr.pmpaddr(13); else NULL; end if; -- R/W: pmpaddr13
-          when csr_pmpaddr14_c => if (PMP_NUM_REGIONS > 14) then csr.rdata <= csr.pmpaddr(14); else NULL; end if; -- R/W: pmpaddr14
-          when csr_pmpaddr15_c => if (PMP_NUM_REGIONS > 15) then csr.rdata <= csr.pmpaddr(15); else NULL; end if; -- R/W: pmpaddr15
-          when csr_pmpaddr16_c => if (PMP_NUM_REGIONS > 16) then csr.rdata <= csr.pmpaddr(16); else NULL; end if; -- R/W: pmpaddr16
-          when csr_pmpaddr17_c => if (PMP_NUM_REGIONS > 17) then csr.rdata <= csr.pmpaddr(17); else NULL; end if; -- R/W: pmpaddr17
-          when csr_pmpaddr18_c => if (PMP_NUM_REGIONS > 18) then csr.rdata <= csr.pmpaddr(18); else NULL; end if; -- R/W: pmpaddr18
-          when csr_pmpaddr19_c => if (PMP_NUM_REGIONS > 19) then csr.rdata <= csr.pmpaddr(19); else NULL; end if; -- R/W: pmpaddr19
-          when csr_pmpaddr20_c => if (PMP_NUM_REGIONS > 20) then csr.rdata <= csr.pmpaddr(20); else NULL; end if; -- R/W: pmpaddr20
-          when csr_pmpaddr21_c => if (PMP_NUM_REGIONS > 21) then csr.rdata <= csr.pmpaddr(21); else NULL; end if; -- R/W: pmpaddr21
-          when csr_pmpaddr22_c => if (PMP_NUM_REGIONS > 22) then csr.rdata <= csr.pmpaddr(22); else NULL; end if; -- R/W: pmpaddr22
-          when csr_pmpaddr23_c => if (PMP_NUM_REGIONS > 23) then csr.rdata <= csr.pmpaddr(23); else NULL; end if; -- R/W: pmpaddr23
-          when csr_pmpaddr24_c => if (PMP_NUM_REGIONS > 24) then csr.rdata <= csr.pmpaddr(24); else NULL; end if; -- R/W: pmpaddr24
-          when csr_pmpaddr25_c => if (PMP_NUM_REGIONS > 25) then csr.rdata <= csr.pmpaddr(25); else NULL; end if; -- R/W: pmpaddr25
-          when csr_pmpaddr26_c => if (PMP_NUM_REGIONS > 26) then csr.rdata <= csr.pmpaddr(26); else NULL; end if; -- R/W: pmpaddr26
-          when csr_pmpaddr27_c => if (PMP_NUM_REGIONS > 27) then csr.rdata <= csr.pmpaddr(27); else NULL; end if; -- R/W: pmpaddr27
-          when csr_pmpaddr28_c => if (PMP_NUM_REGIONS > 28) then csr.rdata <= csr.pmpaddr(28); else NULL; end if; -- R/W: pmpaddr28
-          when csr_pmpaddr29_c => if (PMP_NUM_REGIONS > 29) then csr.rdata <= csr.pmpaddr(29); else NULL; end if; -- R/W: pmpaddr29
-          when csr_pmpaddr30_c => if (PMP_NUM_REGIONS > 30) then csr.rdata <= csr.pmpaddr(30); else NULL; end if; -- R/W: pmpaddr30
-          when csr_pmpaddr31_c => if (PMP_NUM_REGIONS > 31) then csr.rdata <= csr.pmpaddr(31); else NULL; end if; -- R/W: pmpaddr31
-          when csr_pmpaddr32_c => if (PMP_NUM_REGIONS > 32) then csr.rdata <= csr.pmpaddr(32); else NULL; end if; -- R/W: pmpaddr32
-          when csr_pmpaddr33_c => if (PMP_NUM_REGIONS > 33) then csr.rdata <= csr.pmpaddr(33); else NULL; end if; -- R/W: pmpaddr33
-          when csr_pmpaddr34_c => if (PMP_NUM_REGIONS > 34) then csr.rdata <= csr.pmpaddr(34); else NULL; end if; -- R/W: pmpaddr34
-          when csr_pmpaddr35_c => if (PMP_NUM_REGIONS > 35) then csr.rdata <= csr.pmpaddr(35); else NULL; end if; -- R/W: pmpaddr35
-          when csr_pmpaddr36_c => if (PMP_NUM_REGIONS > 36) then csr.rdata <= csr.pmpaddr(36); else NULL; end if; -- R/W: pmpaddr36
-          when csr_pmpaddr37_c => if (PMP_NUM_REGIONS > 37) then csr.rdata <= csr.pmpaddr(37); else NULL; end if; -- R/W: pmpaddr37
-          when csr_pmpaddr38_c => if (PMP_NUM_REGIONS > 38) then csr.rdata <= csr.pmpaddr(38); else NULL; end if; -- R/W: pmpaddr38
-          when csr_pmpaddr39_c => if (PMP_NUM_REGIONS > 39) then csr.rdata <= csr.pmpaddr(39); else NULL; end if; -- R/W: pmpaddr39
-          when csr_pmpaddr40_c => if (PMP_NUM_REGIONS > 40) then csr.rdata <= csr.pmpaddr(40); else NULL; end if; -- R/W: pmpaddr40
-          when csr_pmpaddr41_c => if (PMP_NUM_REGIONS > 41) then csr.rdata <= csr.pmpaddr(41); else NULL; end if; -- R/W: pmpaddr41
-          when csr_pmpaddr42_c => if (PMP_NUM_REGIONS > 42) then csr.rdata <= csr.pmpaddr(42); else NULL; end if; -- R/W: pmpaddr42
-          when csr_pmpaddr43_c => if (PMP_NUM_REGIONS > 43) then csr.rdata <= csr.pmpaddr(43); else NULL; end if; -- R/W: pmpaddr43
-          when csr_pmpaddr44_c => if (PMP_NUM_REGIONS > 44) then csr.rdata <= csr.pmpaddr(44); else NULL; end if; -- R/W: pmpaddr44
-          when csr_pmpaddr45_c => if (PMP_NUM_REGIONS > 45) then csr.rdata <= csr.pmpaddr(45); else NULL; end if; -- R/W: pmpaddr45
-          when csr_pmpaddr46_c => if (PMP_NUM_REGIONS > 46) then csr.rdata <= csr.pmpaddr(46); else NULL; end if; -- R/W: pmpaddr46
-          when csr_pmpaddr47_c => if (PMP_NUM_REGIONS > 47) then csr.rdata <= csr.pmpaddr(47); else NULL; end if; -- R/W: pmpaddr47
-          when csr_pmpaddr48_c => if (PMP_NUM_REGIONS > 48) then csr.rdata <= csr.pmpaddr(48); else NULL; end if; -- R/W: pmpaddr48
-          when csr_pmpaddr49_c => if (PMP_NUM_REGIONS > 49) then csr.rdata <= csr.pmpaddr(49); else NULL; end if; -- R/W: pmpaddr49
-          when csr_pmpaddr50_c => if (PMP_NUM_REGIONS > 50) then csr.rdata <= csr.pmpaddr(50); else NULL; end if; -- R/W: pmpaddr50
-          when csr_pmpaddr51_c => if (PMP_NUM_REGIONS > 51) then csr.rdata <= csr.pmpaddr(51); else NULL; end if; -- R/W: pmpaddr51
-          when csr_pmpaddr52_c => if (PMP_NUM_REGIONS > 52) then csr.rdata <= csr.pmpaddr(52); else NULL; end if; -- R/W: pmpaddr52
-          when csr_pmpaddr53_c => if (PMP_NUM_REGIONS > 53) then csr.rdata <= csr.pmpaddr(53); else NULL; end if; -- R/W: pmpaddr53
-          when csr_pmpaddr54_c => if (PMP_NUM_REGIONS > 54) then csr.rdata <= csr.pmpaddr(54); else NULL; end if; -- R/W: pmpaddr54
-          when csr_pmpaddr55_c => if (PMP_NUM_REGIONS > 55) then csr.rdata <= csr.pmpaddr(55); else NULL; end if; -- R/W: pmpaddr55
-          when csr_pmpaddr56_c => if (PMP_NUM_REGIONS > 56) then csr.rdata <= csr.pmpaddr(56); else NULL; end if; -- R/W: pmpaddr56
-          when csr_pmpaddr57_c => if (PMP_NUM_REGIONS > 57) then csr.rdata <= csr.pmpaddr(57); else NULL; end if; -- R/W: pmpaddr57
-          when csr_pmpaddr58_c => if (PMP_NUM_REGIONS > 58) then csr.rdata <= csr.pmpaddr(58); else NULL; end if; -- R/W: pmpaddr58
-          when csr_pmpaddr59_c => if (PMP_NUM_REGIONS > 59) then csr.rdata <= csr.pmpaddr(59); else NULL; end if; -- R/W: pmpaddr59
-          when csr_pmpaddr60_c => if (PMP_NUM_REGIONS > 60) then csr.rdata <= csr.pmpaddr(60); else NULL; end if; -- R/W: pmpaddr60
-          when csr_pmpaddr61_c => if (PMP_NUM_REGIONS > 61) then csr.rdata <= csr.pmpaddr(61); else NULL; end if; -- R/W: pmpaddr61
-          when csr_pmpaddr62_c => if (PMP_NUM_REGIONS > 62) then csr.rdata <= csr.pmpaddr(62); else NULL; end if; -- R/W: pmpaddr62
-          when csr_pmpaddr63_c => if (PMP_NUM_REGIONS > 63) then csr.rdata <= csr.pmpaddr(63); else NULL; end if; -- R/W: pmpaddr63
+          when csr_pmpaddr0_c  => if (PMP_NUM_REGIONS > 00) then csr.rdata <= csr.pmpaddr_rd(00); else NULL; end if; -- R/W: pmpaddr0
+          when csr_pmpaddr1_c  => if (PMP_NUM_REGIONS > 01) then csr.rdata <= csr.pmpaddr_rd(01); else NULL; end if; -- R/W: pmpaddr1
+          when csr_pmpaddr2_c  => if (PMP_NUM_REGIONS > 02) then csr.rdata <= csr.pmpaddr_rd(02); else NULL; end if; -- R/W: pmpaddr2
+          when csr_pmpaddr3_c  => if (PMP_NUM_REGIONS > 03) then csr.rdata <= csr.pmpaddr_rd(03); else NULL; end if; -- R/W: pmpaddr3
+          when csr_pmpaddr4_c  => if (PMP_NUM_REGIONS > 04) then csr.rdata <= csr.pmpaddr_rd(04); else NULL; end if; -- R/W: pmpaddr4
+          when csr_pmpaddr5_c  => if (PMP_NUM_REGIONS > 05) then csr.rdata <= csr.pmpaddr_rd(05); else NULL; end if; -- R/W: pmpaddr5
+          when csr_pmpaddr6_c  => if (PMP_NUM_REGIONS > 06) then csr.rdata <= csr.pmpaddr_rd(06); else NULL; end if; -- R/W: pmpaddr6
+          when csr_pmpaddr7_c  => if (PMP_NUM_REGIONS > 07) then csr.rdata <= csr.pmpaddr_rd(07); else NULL; end if; -- R/W: pmpaddr7
+          when csr_pmpaddr8_c  => if (PMP_NUM_REGIONS > 08) then csr.rdata <= csr.pmpaddr_rd(08); else NULL; end if; -- R/W: pmpaddr8
+          when csr_pmpaddr9_c  => if (PMP_NUM_REGIONS > 09) then csr.rdata <= csr.pmpaddr_rd(09); else NULL; end if; -- R/W: pmpaddr9
+          when csr_pmpaddr10_c => if (PMP_NUM_REGIONS > 10) then csr.rdata <= csr.pmpaddr_rd(10); else NULL; end if; -- R/W: pmpaddr10
+          when csr_pmpaddr11_c => if (PMP_NUM_REGIONS > 11) then csr.rdata <= csr.pmpaddr_rd(11); else NULL; end if; -- R/W: pmpaddr11
+          when csr_pmpaddr12_c => if (PMP_NUM_REGIONS > 12) then csr.rdata <= csr.pmpaddr_rd(12); else NULL; end if; -- R/W: pmpaddr12
+          when csr_pmpaddr13_c => if (PMP_NUM_REGIONS > 13) then csr.rdata <= csr.pmpaddr_rd(13); else NULL; end if; -- R/W: pmpaddr13
+          when csr_pmpaddr14_c => if (PMP_NUM_REGIONS > 14) then csr.rdata <= csr.pmpaddr_rd(14); else NULL; end if; -- R/W: pmpaddr14
+          when csr_pmpaddr15_c => if (PMP_NUM_REGIONS > 15) then csr.rdata <= csr.pmpaddr_rd(15); else NULL; end if; -- R/W: pmpaddr15
+          when csr_pmpaddr16_c => if (PMP_NUM_REGIONS > 16) then csr.rdata <= csr.pmpaddr_rd(16); else NULL; end if; -- R/W: pmpaddr16
+          when csr_pmpaddr17_c => if (PMP_NUM_REGIONS > 17) then csr.rdata <= csr.pmpaddr_rd(17); else NULL; end if; -- R/W: pmpaddr17
+          when csr_pmpaddr18_c => if (PMP_NUM_REGIONS > 18) then csr.rdata <= csr.pmpaddr_rd(18); else NULL; end if; -- R/W: pmpaddr18
+          when csr_pmpaddr19_c => if (PMP_NUM_REGIONS > 19) then csr.rdata <= csr.pmpaddr_rd(19); else NULL; end if; -- R/W: pmpaddr19
+          when csr_pmpaddr20_c => if (PMP_NUM_REGIONS > 20) then csr.rdata <= csr.pmpaddr_rd(20); else NULL; end if; -- R/W: pmpaddr20
+          when csr_pmpaddr21_c => if (PMP_NUM_REGIONS > 21) then csr.rdata <= csr.pmpaddr_rd(21); else NULL; end if; -- R/W: pmpaddr21
+          when csr_pmpaddr22_c => if (PMP_NUM_REGIONS > 22) then csr.rdata <= csr.pmpaddr_rd(22); else NULL; end if; -- R/W: pmpaddr22
+          when csr_pmpaddr23_c => if (PMP_NUM_REGIONS > 23) then csr.rdata <= csr.pmpaddr_rd(23); else NULL; end if; -- R/W: pmpaddr23
+          when csr_pmpaddr24_c => if (PMP_NUM_REGIONS > 24) then csr.rdata <= csr.pmpaddr_rd(24); else NULL; end if; -- R/W: pmpaddr24
+          when csr_pmpaddr25_c => if (PMP_NUM_REGIONS > 25) then csr.rdata <= csr.pmpaddr_rd(25); else NULL; end if; -- R/W: pmpaddr25
+          when csr_pmpaddr26_c => if (PMP_NUM_REGIONS > 26) then csr.rdata <= csr.pmpaddr_rd(26); else NULL; end if; -- R/W: pmpaddr26
+          when csr_pmpaddr27_c => if (PMP_NUM_REGIONS > 27) then csr.rdata <= csr.pmpaddr_rd(27); else NULL; end if; -- R/W: pmpaddr27
+          when csr_pmpaddr28_c => if (PMP_NUM_REGIONS > 28) then csr.rdata <= csr.pmpaddr_rd(28); else NULL; end if; -- R/W: pmpaddr28
+          when csr_pmpaddr29_c => if (PMP_NUM_REGIONS > 29) then csr.rdata <= csr.pmpaddr_rd(29); else NULL; end if; -- R/W: pmpaddr29
+          when csr_pmpaddr30_c => if (PMP_NUM_REGIONS > 30) then csr.rdata <= csr.pmpaddr_rd(30); else NULL; end if; -- R/W: pmpaddr30
+          when csr_pmpaddr31_c => if (PMP_NUM_REGIONS > 31) then csr.rdata <= csr.pmpaddr_rd(31); else NULL; end if; -- R/W: pmpaddr31
+          when csr_pmpaddr32_c => if (PMP_NUM_REGIONS > 32) then csr.rdata <= csr.pmpaddr_rd(32); else NULL; end if; -- R/W: pmpaddr32
+          when csr_pmpaddr33_c => if (PMP_NUM_REGIONS > 33) then csr.rdata <= csr.pmpaddr_rd(33); else NULL; end if; -- R/W: pmpaddr33
+          when csr_pmpaddr34_c => if (PMP_NUM_REGIONS > 34) then csr.rdata <= csr.pmpaddr_rd(34); else NULL; end if; -- R/W: pmpaddr34
+          when csr_pmpaddr35_c => if (PMP_NUM_REGIONS > 35) then csr.rdata <= csr.pmpaddr_rd(35); else NULL; end if; -- R/W: pmpaddr35
+          when csr_pmpaddr36_c => if (PMP_NUM_REGIONS > 36) then csr.rdata <= csr.pmpaddr_rd(36); else NULL; end if; -- R/W: pmpaddr36
+          when csr_pmpaddr37_c => if (PMP_NUM_REGIONS > 37) then csr.rdata <= csr.pmpaddr_rd(37); else NULL; end if; -- R/W: pmpaddr37
+          when csr_pmpaddr38_c => if (PMP_NUM_REGIONS > 38) then csr.rdata <= csr.pmpaddr_rd(38); else NULL; end if; -- R/W: pmpaddr38
+          when csr_pmpaddr39_c => if (PMP_NUM_REGIONS > 39) then csr.rdata <= csr.pmpaddr_rd(39); else NULL; end if; -- R/W: pmpaddr39
+          when csr_pmpaddr40_c => if (PMP_NUM_REGIONS > 40) then csr.rdata <= csr.pmpaddr_rd(40); else NULL; end if; -- R/W: pmpaddr40
+          when csr_pmpaddr41_c => if (PMP_NUM_REGIONS > 41) then csr.rdata <= csr.pmpaddr_rd(41); else NULL; end if; -- R/W: pmpaddr41
+          when csr_pmpaddr42_c => if (PMP_NUM_REGIONS > 42) then csr.rdata <= csr.pmpaddr_rd(42); else NULL; end if; -- R/W: pmpaddr42
+          when csr_pmpaddr43_c => if (PMP_NUM_REGIONS > 43) then csr.rdata <= csr.pmpaddr_rd(43); else NULL; end if; -- R/W: pmpaddr43
+          when csr_pmpaddr44_c => if (PMP_NUM_REGIONS > 44) then csr.rdata <= csr.pmpaddr_rd(44); else NULL; end if; -- R/W: pmpaddr44
+          when csr_pmpaddr45_c => if (PMP_NUM_REGIONS > 45) then csr.rdata <= csr.pmpaddr_rd(45); else NULL; end if; -- R/W: pmpaddr45
+          when csr_pmpaddr46_c => if (PMP_NUM_REGIONS > 46) then csr.rdata <= csr.pmpaddr_rd(46); else NULL; end if; -- R/W: pmpaddr46
+          when csr_pmpaddr47_c => if (PMP_NUM_REGIONS > 47) then csr.rdata <= csr.pmpaddr_rd(47); else NULL; end if; -- R/W: pmpaddr47
+          when csr_pmpaddr48_c => if (PMP_NUM_REGIONS > 48) then csr.rdata <= csr.pmpaddr_rd(48); else NULL; end if; -- R/W: pmpaddr48
+          when csr_pmpaddr49_c => if (PMP_NUM_REGIONS > 49) then csr.rdata <= csr.pmpaddr_rd(49); else NULL; end if; -- R/W: pmpaddr49
+          when csr_pmpaddr50_c => if (PMP_NUM_REGIONS > 50) then csr.rdata <= csr.pmpaddr_rd(50); else NULL; end if; -- R/W: pmpaddr50
+          when csr_pmpaddr51_c => if (PMP_NUM_REGIONS > 51) then csr.rdata <= csr.pmpaddr_rd(51); else NULL; end if; -- R/W: pmpaddr51
+          when csr_pmpaddr52_c => if (PMP_NUM_REGIONS > 52) then csr.rdata <= csr.pmpaddr_rd(52); else NULL; end if; -- R/W: pmpaddr52
+          when csr_pmpaddr53_c => if (PMP_NUM_REGIONS > 53) then csr.rdata <= csr.pmpaddr_rd(53); else NULL; end if; -- R/W: pmpaddr53
+          when csr_pmpaddr54_c => if (PMP_NUM_REGIONS > 54) then csr.rdata <= csr.pmpaddr_rd(54); else NULL; end if; -- R/W: pmpaddr54
+          when csr_pmpaddr55_c => if (PMP_NUM_REGIONS > 55) then csr.rdata <= csr.pmpaddr_rd(55); else NULL; end if; -- R/W: pmpaddr55
+          when csr_pmpaddr56_c => if (PMP_NUM_REGIONS > 56) then csr.rdata <= csr.pmpaddr_rd(56); else NULL; end if; -- R/W: pmpaddr56
+          when csr_pmpaddr57_c => if (PMP_NUM_REGIONS > 57) then csr.rdata <= csr.pmpaddr_rd(57); else NULL; end if; -- R/W: pmpaddr57
+          when csr_pmpaddr58_c => if (PMP_NUM_REGIONS > 58) then csr.rdata <= csr.pmpaddr_rd(58); else NULL; end if; -- R/W: pmpaddr58
+          when csr_pmpaddr59_c => if (PMP_NUM_REGIONS > 59) then csr.rdata <= csr.pmpaddr_rd(59); else NULL; end if; -- R/W: pmpaddr59
+          when csr_pmpaddr60_c => if (PMP_NUM_REGIONS > 60) then csr.rdata <= csr.pmpaddr_rd(60); else NULL; end if; -- R/W: pmpaddr60
+          when csr_pmpaddr61_c => if (PMP_NUM_REGIONS > 61) then csr.rdata <= csr.pmpaddr_rd(61); else NULL; end if; -- R/W: pmpaddr61
+          when csr_pmpaddr62_c => if (PMP_NUM_REGIONS > 62) then csr.rdata <= csr.pmpaddr_rd(62); else NULL; end if; -- R/W: pmpaddr62
+          when csr_pmpaddr63_c => if (PMP_NUM_REGIONS > 63) then csr.rdata <= csr.pmpaddr_rd(63); else NULL; end if; -- R/W: pmpaddr63
 
           -- machine counter setup --
           -- --------------------------------------------------------------------
@@ -2793,6 +3006,24 @@ begin
             csr.rdata(8) <= bool_to_ulogic_f(boolean(PMP_NUM_REGIONS > 0)); -- PMP (physical memory protection)
             csr.rdata(9) <= bool_to_ulogic_f(boolean(HPM_NUM_CNTS > 0)); -- HPM (hardware performance monitors)
             csr.rdata(10) <= bool_to_ulogic_f(CPU_EXTENSION_RISCV_DEBUG); -- RISC-V debug mode
+            csr.rdata(11) <= bool_to_ulogic_f(boolean(CPU_NUM_TRIGGERS > 0)); -- Sdtrig (hardware trigger module)
+
+          -- hardware trigger module CSRs --
+          -- --------------------------------------------------------------------
+          when csr_tselect_c => if (CPU_NUM_TRIGGERS > 0) then csr.rdata(3 downto 0) <= trigger.tselect; else NULL; end if; -- tselect (r/w): trigger select
+          when csr_tdata1_c  => if (CPU_NUM_TRIGGERS > 0) then csr.rdata <= trigger.tdata1; else NULL; end if; -- tdata1 (r/w): trigger configuration
+          when csr_tdata2_c  => if (CPU_NUM_TRIGGERS > 0) then csr.rdata <= trigger.tdata2; else NULL; end if; -- tdata2 (r/w): trigger compare address
+          when csr_tdata3_c  => if (CPU_NUM_TRIGGERS > 0) then csr.rdata <= trigger.tdata3; else NULL; end if; -- tdata3 (r/w): trigger match counter (custom)
+          when csr_tinfo_c   => if (CPU_NUM_TRIGGERS > 0) then csr.rdata(2) <= '1';      else NULL; end if; -- tinfo (r/-): supported trigger types: address/data match only
+          when csr_tcontrol_c => if (CPU_NUM_TRIGGERS > 0) then csr.rdata(7) <= trigger.mpte; csr.rdata(3) <= trigger.mte; else NULL; end if; -- tcontrol (r/w): M-mode trigger enable
+
+          -- custom machine read/write CSRs --
+          -- --------------------------------------------------------------------
+          when csr_micachectl_c => -- micachectl (r/w): i-cache locking control and status
+            csr.rdata(0)  <= icache_ctrl.lock; -- lock preloaded blocks
+            csr.rdata(30) <= icache_stat_i(1); -- preload failed
+            csr.rdata(31) <= icache_stat_i(0); -- preload in progress
+          when csr_micachepre_c => csr.rdata <= icache_ctrl.addr; -- micachepre (r/w): i-cache preload address
 
           -- debug mode CSRs --
           -- --------------------------------------------------------------------
@@ -2814,6 +3045,222 @@ begin
   csr_rdata_o <= csr.rdata;
 
 
+  -- Hardware Trigger Module (Sdtrig) -------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  trigger_module_enabled:
+  if (CPU_NUM_TRIGGERS > 0) generate
+
+    -- Trigger Registers --
+    trigger_regs: process(rstn_i, clk_i)
+      variable idx_v   : natural range 0 to 15;
+      variable dmode_v : std_ulogic;
+    begin
+      if (rstn_i = '0') then
+        trigger.tselect <= (others => '0');
+        trigger.ctrl    <= (others => (others => '0'));
+        trigger.addr    <= (others => (others => def_rst_val_c));
+        trigger.mask    <= (others => (others => def_rst_val_c));
+        trigger.cnt     <= (others => (others => '0'));
+        trigger.mte     <= '0';
+        trigger.mpte    <= '0';
+      elsif rising_edge(clk_i) then
+        idx_v := to_integer(unsigned(trigger.tselect));
+
+        -- tcontrol: disable M-mode breakpoint exception triggers while in a trap handler --
+        if (trap_ctrl.env_start_ack = '1') and (debug_ctrl.running = '0') and (trap_ctrl.cause(5) = '0') then -- entering "normal" trap
+          trigger.mpte <= trigger.mte;
+          trigger.mte  <= '0';
+        elsif (trap_ctrl.env_end = '1') and (debug_ctrl.running = '0') then -- mret
+          trigger.mte  <= trigger.mpte;
+        elsif (csr.we = '1') and (csr.addr = csr_tcontrol_c) then
+          trigger.mpte <= csr.wdata(7);
+          trigger.mte  <= csr.wdata(3);
+        end if;
+
+        -- match counters and hit flags --
+        for i in 0 to CPU_NUM_TRIGGERS-1 loop
+          if (trigger.hit(i) = '1') then
+            trigger.cnt(i) <= std_ulogic_vector(unsigned(trigger.cnt(i)) + 1);
+            trigger.ctrl(i)(trig_hit_c) <= '1';
+          end if;
+        end loop;
+
+        -- CSR write access --
+        if (csr.we = '1') and (csr.addr(11 downto 3) = csr_class_trigger_c) then
+          -- R/W: tselect - WARL, only implemented triggers can be selected --
+          if (csr.addr(2 downto 0) = csr_tselect_c(2 downto 0)) then
+            if (unsigned(csr.wdata) < CPU_NUM_TRIGGERS) then
+              trigger.tselect <= csr.wdata(3 downto 0);
+            end if;
+          end if;
+          -- triggers owned by debug mode can only be modified in debug mode --
+          if (trigger.ctrl(idx_v)(trig_dmode_c) = '0') or (debug_ctrl.running = '1') then
+            -- R/W: tdata1 - trigger configuration (mcontrol) --
+            if (csr.addr(2 downto 0) = csr_tdata1_c(2 downto 0)) then
+              dmode_v := csr.wdata(27) and debug_ctrl.running and bool_to_ulogic_f(CPU_EXTENSION_RISCV_DEBUG);
+              trigger.ctrl(idx_v)(trig_load_c)  <= csr.wdata(0);
+              trigger.ctrl(idx_v)(trig_store_c) <= csr.wdata(1);
+              trigger.ctrl(idx_v)(trig_exe_c)   <= csr.wdata(2);
+              trigger.ctrl(idx_v)(trig_u_c)     <= csr.wdata(3) and bool_to_ulogic_f(CPU_EXTENSION_RISCV_U);
+              trigger.ctrl(idx_v)(trig_m_c)     <= csr.wdata(6);
+              if (csr.wdata(10 downto 7) = "0001") then -- NAPOT match
+                trigger.ctrl(idx_v)(trig_napot_c) <= '1';
+              else -- equal match (default)
+                trigger.ctrl(idx_v)(trig_napot_c) <= '0';
+              end if;
+              if (csr.wdata(15 downto 12) = "1111") then -- count only (custom)
+                trigger.ctrl(idx_v)(trig_act1_c downto trig_act0_c) <= "11";
+              elsif (csr.wdata(15 downto 12) = "0001") and (dmode_v = '1') then -- enter debug mode
+                trigger.ctrl(idx_v)(trig_act1_c downto trig_act0_c) <= "01";
+              else -- breakpoint exception (default)
+                trigger.ctrl(idx_v)(trig_act1_c downto trig_act0_c) <= "00";
+              end if;
+              trigger.ctrl(idx_v)(trig_hit_c)   <= csr.wdata(20);
+              trigger.ctrl(idx_v)(trig_dmode_c) <= dmode_v;
+            end if;
+            -- R/W: tdata2 - trigger compare address --
+            if (csr.addr(2 downto 0) = csr_tdata2_c(2 downto 0)) then
+              trigger.addr(idx_v) <= csr.wdata;
+              trigger.mask(idx_v) <= csr.wdata xor std_ulogic_vector(unsigned(csr.wdata) + 1); -- NAPOT: trailing ones + first zero
+            end if;
+            -- R/W: tdata3 - trigger match counter (custom) --
+            if (csr.addr(2 downto 0) = csr_tdata3_c(2 downto 0)) then
+              trigger.cnt(idx_v) <= csr.wdata;
+            end if;
+          end if;
+        end if;
+      end if;
+    end process trigger_regs;
+
+
+    -- Address Match Logic --
+    trigger_match: process(trigger, execute_engine, decode_aux, alu_add_i, csr, debug_ctrl)
+      variable en_v, match_x_v, match_ls_v, is_load_v, hit_v : std_ulogic;
+      variable fire_v, break_v, halt_v : std_ulogic;
+    begin
+      fire_v  := '0';
+      break_v := '0';
+      halt_v  := '0';
+      is_load_v := (not execute_engine.i_reg(instr_opcode_msb_c-1)) or decode_aux.is_atomic_lr; -- normal load or atomic load-reservate
+      for i in 0 to CPU_NUM_TRIGGERS-1 loop
+        -- privilege filter; triggers never fire while in debug mode --
+        en_v := ((trigger.ctrl(i)(trig_m_c) and csr.priv_m_mode) or (trigger.ctrl(i)(trig_u_c) and csr.priv_u_mode)) and (not debug_ctrl.running);
+        -- breakpoint exception triggers do not fire in M-mode while tcontrol.MTE is cleared (prevents re-triggering inside the trap handler) --
+        if (trigger.ctrl(i)(trig_act1_c downto trig_act0_c) = "00") and (csr.priv_m_mode = '1') and (trigger.mte = '0') then
+          en_v := '0';
+        end if;
+        -- address comparators --
+        if (trigger.ctrl(i)(trig_napot_c) = '1') then
+          match_x_v  := bool_to_ulogic_f(boolean((execute_engine.pc or trigger.mask(i)) = (trigger.addr(i) or trigger.mask(i))));
+          match_ls_v := bool_to_ulogic_f(boolean((alu_add_i         or trigger.mask(i)) = (trigger.addr(i) or trigger.mask(i))));
+        else
+          match_x_v  := bool_to_ulogic_f(boolean(execute_engine.pc = trigger.addr(i)));
+          match_ls_v := bool_to_ulogic_f(boolean(alu_add_i         = trigger.addr(i)));
+        end if;
+        -- instruction address is checked in EXECUTE, data address is checked before the bus request is issued --
+        if (execute_engine.state = EXECUTE) then
+          hit_v := en_v and trigger.ctrl(i)(trig_exe_c) and match_x_v;
+        elsif (execute_engine.state = LOADSTORE_0) then
+          hit_v := en_v and match_ls_v and
+                   ((trigger.ctrl(i)(trig_load_c) and is_load_v) or (trigger.ctrl(i)(trig_store_c) and (not is_load_v)));
+        else
+          hit_v := '0';
+        end if;
+        trigger.hit(i) <= hit_v;
+        -- action --
+        if (hit_v = '1') and (trigger.ctrl(i)(trig_act1_c) = '0') then -- not "count only"
+          fire_v := '1';
+          if (trigger.ctrl(i)(trig_act0_c) = '1') then
+            halt_v  := '1'; -- enter debug mode
+          else
+            break_v := '1'; -- breakpoint exception
+          end if;
+        end if;
+      end loop;
+      trigger.fire  <= fire_v;
+      trigger.break <= break_v;
+      trigger.halt  <= halt_v;
+    end process trigger_match;
+
+
+    -- CSR Read-Back (currently selected trigger) --
+    trigger_readback: process(trigger)
+      variable idx_v : natural range 0 to 15;
+    begin
+      idx_v := to_integer(unsigned(trigger.tselect));
+      trigger.tdata1 <= (others => '0');
+      trigger.tdata1(31 downto 28) <= "0010"; -- type: address/data match trigger (mcontrol)
+      trigger.tdata1(27) <= trigger.ctrl(idx_v)(trig_dmode_c); -- dmode: trigger owned by debug mode
+      trigger.tdata1(26 downto 21) <= "011111"; -- maskmax: largest NAPOT range is 2^31 bytes
+      trigger.tdata1(20) <= trigger.ctrl(idx_v)(trig_hit_c); -- hit: trigger has fired
+      trigger.tdata1(19) <= '0'; -- select: address match only
+      trigger.tdata1(18) <= '0'; -- timing: trap before the instruction is committed
+      if (trigger.ctrl(idx_v)(trig_act1_c downto trig_act0_c) = "11") then -- action
+        trigger.tdata1(15 downto 12) <= "1111"; -- count only (custom)
+      else
+        trigger.tdata1(15 downto 12) <= "000" & trigger.ctrl(idx_v)(trig_act0_c); -- breakpoint exception / enter debug mode
+      end if;
+      trigger.tdata1(11) <= '0'; -- chain: not supported
+      trigger.tdata1(07) <= trigger.ctrl(idx_v)(trig_napot_c); -- match: 0 = equal, 1 = NAPOT
+      trigger.tdata1(06) <= trigger.ctrl(idx_v)(trig_m_c); -- m: enabled in machine mode
+      trigger.tdata1(03) <= trigger.ctrl(idx_v)(trig_u_c); -- u: enabled in user mode
+      trigger.tdata1(02) <= trigger.ctrl(idx_v)(trig_exe_c); -- execute: instruction address match
+      trigger.tdata1(01) <= trigger.ctrl(idx_v)(trig_store_c); -- store: store address match
+      trigger.tdata1(00) <= trigger.ctrl(idx_v)(trig_load_c); -- load: load address match
+      trigger.tdata2 <= trigger.addr(idx_v);
+      trigger.tdata3 <= trigger.cnt(idx_v);
+    end process trigger_readback;
+
+  end generate;
+
+  trigger_module_disabled:
+  if (CPU_NUM_TRIGGERS = 0) generate
+    trigger.tselect <= (others => '0');
+    trigger.tdata1  <= (others => '0');
+    trigger.tdata2  <= (others => '0');
+    trigger.tdata3  <= (others => '0');
+    trigger.mte     <= '0';
+    trigger.mpte    <= '0';
+    trigger.fire    <= '0';
+    trigger.break   <= '0';
+    trigger.halt    <= '0';
+  end generate;
+
+
+  -- I-Cache Locking Control --------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  icache_locking: process(rstn_i, clk_i)
+  begin
+    if (rstn_i = '0') then
+      icache_ctrl.lock    <= '0';
+      icache_ctrl.unlock  <= '0';
+      icache_ctrl.preload <= '0';
+      icache_ctrl.addr    <= (others => def_rst_val_c);
+    elsif rising_edge(clk_i) then
+      icache_ctrl.unlock  <= '0';
+      icache_ctrl.preload <= '0';
+      if (csr.we = '1') then
+        -- R/W: micachectl - lock configuration, unlock command --
+        if (csr.addr = csr_micachectl_c) then
+          icache_ctrl.lock   <= csr.wdata(0);
+          icache_ctrl.unlock <= csr.wdata(1);
+        end if;
+        -- R/W: micachepre - preload address, every write triggers a block preload --
+        if (csr.addr = csr_micachepre_c) then
+          icache_ctrl.addr    <= csr.wdata;
+          icache_ctrl.preload <= '1';
+        end if;
+      end if;
+    end if;
+  end process icache_locking;
+
+  -- i-cache interface --
+  icache_ctrl_o(0) <= icache_ctrl.lock;
+  icache_ctrl_o(1) <= icache_ctrl.unlock;
+  icache_ctrl_o(2) <= icache_ctrl.preload;
+  icache_addr_o    <= icache_ctrl.addr;
+
+
   -- Debug Control --------------------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
   debug_control: process(rstn_i, clk_i)
@@ -2833,6 +3280,7 @@ begin
           when DEBUG_OFFLINE => -- not in debug mode, waiting for entering request
             if (debug_ctrl.trig_halt = '1') or -- external request (from DM)
                (debug_ctrl.trig_break = '1') or -- ebreak instruction
+               (debug_ctrl.trig_hw = '1') or -- hardware trigger
                (debug_ctrl.trig_step = '1') then -- single-stepping mode
               debug_ctrl.state <= DEBUG_PENDING;
             end if;
@@ -2873,6 +3321,7 @@ begin
                            (csr.priv_u_mode and csr.dcsr_ebreaku and (not debug_ctrl.running))); -- enabled goto-debug-mode in user mode on "ebreak"
   debug_ctrl.trig_halt <= (not debug_ctrl.ext_halt_req(1)) and debug_ctrl.ext_halt_req(0) and (not debug_ctrl.running); -- rising edge detector from external halt request (if not halted already)
   debug_ctrl.trig_step <= csr.dcsr_step and (not debug_ctrl.running); -- single-step mode (trigger when NOT CURRENTLY in debug mode)
+  debug_ctrl.trig_hw   <= trigger.halt when (CPU_EXTENSION_RISCV_DEBUG = true) else '0'; -- hardware trigger with "enter debug mode" action
 
 
   -- Debug Control and Status Register (dcsr) - Read-Back -----------------------------------
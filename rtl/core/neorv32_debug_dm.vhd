@@ -5,11 +5,13 @@
 -- # -> "Execution-based" debugging scheme                                                         # 
 -- # ********************************************************************************************* #
 -- # Key features:                                                                                 #
--- # * register access commands only                                                               #
+-- # * register access commands                                                                    #
+-- # * memory access commands with post-increment (if SBA_EN = true)                               #
+-- # * system bus access (SBA) master: 8/16/32-bit, auto-increment (if SBA_EN = true)              #
 -- # * auto-execution commands                                                                     #
--- # * for a single hart only                                                                      #
+-- # * up to 4 harts (selected via dmcontrol.hartsel, hart ID of bus accesses via cpu_hart_i)      #
 -- # * 2 general purpose program buffer entries                                                    #
--- # * 1 general purpose data buffer entry                                                         #
+-- # * 1 general purpose data buffer entry (+ 1 address entry if SBA_EN = true)                    #
 -- #                                                                                               #
 -- # CPU access:                                                                                   #
 -- # * ROM for "park loop" code                                                                    #
@@ -56,6 +58,10 @@ library neorv32;
 use neorv32.neorv32_package.all;
 
 entity neorv32_debug_dm is
+  generic (
+    NUM_HARTS : natural := 1;    -- number of harts (1..4)
+    SBA_EN    : boolean := false -- implement system bus access (SBA) master and abstract memory access?
+  );
   port (
     -- global control --
     clk_i            : in  std_ulogic; -- global clock line
@@ -78,9 +84,19 @@ entity neorv32_debug_dm is
     cpu_data_i       : in  std_ulogic_vector(31 downto 0); -- data in
     cpu_data_o       : out std_ulogic_vector(31 downto 0); -- data out
     cpu_ack_o        : out std_ulogic; -- transfer acknowledge
+    cpu_hart_i       : in  std_ulogic_vector(01 downto 0); -- index of the hart that performs the current access
     -- CPU control --
     cpu_ndmrstn_o    : out std_ulogic; -- soc reset
-    cpu_halt_req_o   : out std_ulogic  -- request hart to halt (enter debug mode)
+    cpu_halt_req_o   : out std_ulogic_vector(NUM_HARTS-1 downto 0); -- request hart to halt (enter debug mode)
+    -- system bus access (SBA) master (available if SBA_EN = true) --
+    sba_addr_o       : out std_ulogic_vector(31 downto 0); -- bus access address
+    sba_rdata_i      : in  std_ulogic_vector(31 downto 0); -- bus read data
+    sba_wdata_o      : out std_ulogic_vector(31 downto 0); -- bus write data
+    sba_ben_o        : out std_ulogic_vector(03 downto 0); -- byte enable
+    sba_we_o         : out std_ulogic; -- write enable
+    sba_re_o         : out std_ulogic; -- read enable
+    sba_ack_i        : in  std_ulogic; -- bus transfer acknowledge
+    sba_err_i        : in  std_ulogic  -- bus transfer error
   );
 end neorv32_debug_dm;
 
@@ -94,6 +110,7 @@ architecture neorv32_debug_dm_rtl of neorv32_debug_dm is
 
   -- available DMI registers --
   constant addr_data0_c        : std_ulogic_vector(6 downto 0) := "000" & x"4";
+  constant addr_data1_c        : std_ulogic_vector(6 downto 0) := "000" & x"5";
   constant addr_dmcontrol_c    : std_ulogic_vector(6 downto 0) := "001" & x"0";
   constant addr_dmstatus_c     : std_ulogic_vector(6 downto 0) := "001" & x"1";
   constant addr_hartinfo_c     : std_ulogic_vector(6 downto 0) := "001" & x"2";
@@ -104,6 +121,8 @@ architecture neorv32_debug_dm_rtl of neorv32_debug_dm is
   constant addr_progbuf0_c     : std_ulogic_vector(6 downto 0) := "010" & x"0";
   constant addr_progbuf1_c     : std_ulogic_vector(6 downto 0) := "010" & x"1";
   constant addr_sbcs_c         : std_ulogic_vector(6 downto 0) := "011" & x"8";
+  constant addr_sbaddress0_c   : std_ulogic_vector(6 downto 0) := "011" & x"9";
+  constant addr_sbdata0_c      : std_ulogic_vector(6 downto 0) := "011" & x"c";
   constant addr_haltsum0_c     : std_ulogic_vector(6 downto 0) := "100" & x"0";
 
   -- RISC-V 32-bit instruction prototypes --
@@ -113,34 +132,44 @@ architecture neorv32_debug_dm_rtl of neorv32_debug_dm is
   constant instr_ebreak_c : std_ulogic_vector(31 downto 0) := x"00100073"; -- ebreak
 
   -- debug module controller --
-  type dm_ctrl_state_t is (CMD_IDLE, CMD_EXE_CHECK, CMD_EXE_PREPARE, CMD_EXE_TRIGGER, CMD_EXE_BUSY, CMD_EXE_ERROR);
+  type dm_ctrl_state_t is (CMD_IDLE, CMD_EXE_CHECK, CMD_EXE_PREPARE, CMD_EXE_TRIGGER, CMD_EXE_BUSY, CMD_MEM_TRIGGER, CMD_MEM_BUSY, CMD_EXE_ERROR);
   type dm_ctrl_t is record
     -- fsm --
     state           : dm_ctrl_state_t;
     busy            : std_ulogic;
     ldsw_progbuf    : std_ulogic_vector(31 downto 0);
     pbuf_en         : std_ulogic;
+    -- abstract memory access --
+    mem_req         : std_ulogic; -- request memory access from SBA (single-shot)
+    mem_inc         : std_ulogic; -- post-increment data1 (single-shot)
     -- error flags --
     illegal_state   : std_ulogic;
     illegal_cmd     : std_ulogic;
+    bus_error       : std_ulogic;
     cmderr          : std_ulogic_vector(02 downto 0);
-    -- hart status --
-    hart_halted     : std_ulogic;
-    hart_resume_req : std_ulogic;
-    hart_resume_ack : std_ulogic;
-    hart_reset      : std_ulogic;
+    -- hart status (one bit per hart) --
+    hart_halted     : std_ulogic_vector(3 downto 0);
+    hart_resume_req : std_ulogic_vector(3 downto 0);
+    hart_resume_ack : std_ulogic_vector(3 downto 0);
+    hart_reset      : std_ulogic_vector(3 downto 0);
   end record;
   signal dm_ctrl : dm_ctrl_t;
 
+  -- hart selection --
+  signal hart_sel         : natural range 0 to 3; -- currently selected hart
+  signal hart_nonexistent : std_ulogic; -- selected hart does not exist
+
   -- debug module DMI registers / access --
   type progbuf_t is array (0 to 1) of std_ulogic_vector(31 downto 0);
   type dm_reg_t is record
     dmcontrol_ndmreset : std_ulogic;
     dmcontrol_dmactive : std_ulogic;
+    dmcontrol_hartsel  : std_ulogic_vector(09 downto 0);
     abstractauto_autoexecdata    : std_ulogic;
     abstractauto_autoexecprogbuf : std_ulogic_vector(01 downto 0);
     progbuf     : progbuf_t;
     command     : std_ulogic_vector(31 downto 0);
+    data1       : std_ulogic_vector(31 downto 0); -- abstract memory access address
     --
     halt_req    : std_ulogic;
     resume_req  : std_ulogic;
@@ -157,6 +186,45 @@ architecture neorv32_debug_dm_rtl of neorv32_debug_dm is
   type cpu_progbuf_t is array (0 to 4) of std_ulogic_vector(31 downto 0);
   signal cpu_progbuf : cpu_progbuf_t;
 
+  -- system bus access (SBA) --
+  type sba_state_t is (SBA_IDLE, SBA_CHECK, SBA_BUSY);
+  type sba_t is record
+    -- DMI registers --
+    sbaddress       : std_ulogic_vector(31 downto 0);
+    sbdata          : std_ulogic_vector(31 downto 0);
+    sbreadonaddr    : std_ulogic;
+    sbaccess        : std_ulogic_vector(02 downto 0);
+    sbautoincrement : std_ulogic;
+    sbreadondata    : std_ulogic;
+    sberror         : std_ulogic_vector(02 downto 0);
+    sbbusyerror     : std_ulogic;
+    sbbusy          : std_ulogic;
+    -- pending requests --
+    sb_rd_req       : std_ulogic; -- read request via SBA registers
+    sb_wr_req       : std_ulogic; -- write request via SBA registers
+    abs_req         : std_ulogic; -- request via abstract memory access command
+    -- bus engine --
+    state           : sba_state_t;
+    src             : std_ulogic; -- 0 = SBA registers, 1 = abstract command
+    size            : std_ulogic_vector(02 downto 0); -- 000 = byte, 001 = half-word, 010 = word
+    addr            : std_ulogic_vector(31 downto 0);
+    wdata           : std_ulogic_vector(31 downto 0);
+    ben             : std_ulogic_vector(03 downto 0);
+    we              : std_ulogic;
+    re              : std_ulogic;
+    rnw             : std_ulogic; -- 1 = read, 0 = write
+    -- abstract command status --
+    abs_done        : std_ulogic; -- single-shot
+    abs_err         : std_ulogic; -- single-shot
+    abs_rdata_we    : std_ulogic; -- single-shot
+    abs_rdata       : std_ulogic_vector(31 downto 0);
+  end record;
+  signal sba : sba_t;
+
+  -- SBA bus data alignment --
+  signal sba_wdata : std_ulogic_vector(31 downto 0); -- write data replicated to all byte lanes
+  signal sba_rdata : std_ulogic_vector(31 downto 0); -- read data aligned to bit 0
+
   -- **********************************************************
   -- CPU Bus Interface
   -- **********************************************************
@@ -169,6 +237,7 @@ architecture neorv32_debug_dm_rtl of neorv32_debug_dm is
     execute_req   : std_ulogic; -- DM wants CPU to execute program buffer when set
     execute_ack   : std_ulogic; -- CPU starts executing program buffer when set (single-shot)
     exception_ack : std_ulogic; -- CPU has detected an exception (single-shot)
+    hart          : natural range 0 to 3; -- hart that issued the current acknowledge
     progbuf       : std_ulogic_vector(255 downto 0); -- program buffer, 4 32-bit entries
     data_we       : std_ulogic; -- write abstract data
     wdata         : std_ulogic_vector(31 downto 0); -- abstract write data
@@ -234,6 +303,11 @@ architecture neorv32_debug_dm_rtl of neorv32_debug_dm is
 
 begin
 
+  -- Sanity Checks --------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  assert not ((NUM_HARTS < 1) or (NUM_HARTS > 4)) report "NEORV32 PROCESSOR CONFIG ERROR! Debug module <NUM_HARTS> has to be 1..4." severity error;
+
+
   -- Debug Module Command Controller --------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
   dm_controller: process(clk_i)
@@ -244,21 +318,27 @@ begin
         dm_ctrl.ldsw_progbuf <= (others => '-');
         dci.execute_req      <= '0';
         dm_ctrl.pbuf_en      <= '-';
+        dm_ctrl.mem_req      <= '0';
+        dm_ctrl.mem_inc      <= '0';
         --
         dm_ctrl.illegal_cmd   <= '-';
         dm_ctrl.illegal_state <= '-';
+        dm_ctrl.bus_error     <= '-';
         dm_ctrl.cmderr        <= "000";
         --
-        dm_ctrl.hart_reset      <= '0';
-        dm_ctrl.hart_halted     <= '0';
-        dm_ctrl.hart_resume_req <= '0';
-        dm_ctrl.hart_resume_ack <= '0';
+        dm_ctrl.hart_reset      <= (others => '0');
+        dm_ctrl.hart_halted     <= (others => '0');
+        dm_ctrl.hart_resume_req <= (others => '0');
+        dm_ctrl.hart_resume_ack <= (others => '0');
       else -- DM active
 
         -- defaults --
         dci.execute_req       <= '0';
+        dm_ctrl.mem_req       <= '0';
+        dm_ctrl.mem_inc       <= '0';
         dm_ctrl.illegal_cmd   <= '0';
         dm_ctrl.illegal_state <= '0';
+        dm_ctrl.bus_error     <= '0';
 
         -- command execution fsm --
         case dm_ctrl.state is
@@ -282,12 +362,18 @@ begin
                (dm_reg.command(22 downto 20) = "010") and -- aarsize: has to be 32-bit
                (dm_reg.command(19) = '0') and -- aarpostincrement: not supported
                ((dm_reg.command(17) = '0') or (dm_reg.command(15 downto 05) = "00010000000")) then -- regno: only GPRs are supported: 0x1000..0x101f if transfer is set
-              if (dm_ctrl.hart_halted = '1') then -- CPU is halted
+              if (dm_ctrl.hart_halted(hart_sel) = '1') and (hart_nonexistent = '0') then -- selected CPU is halted
                 dm_ctrl.state <= CMD_EXE_PREPARE;
               else -- error! CPU is still running
                 dm_ctrl.illegal_state <= '1';
                 dm_ctrl.state         <= CMD_EXE_ERROR;
               end if;
+            elsif (SBA_EN = true) and -- memory access via system bus
+                  (dm_reg.command(31 downto 24) = x"02") and -- cmdtype: memory access
+                  (dm_reg.command(23) = '0') and -- aamvirtual: physical addresses only
+                  (dm_reg.command(22) = '0') and (dm_reg.command(21 downto 20) /= "11") and -- aamsize: 8/16/32-bit
+                  (dm_reg.command(18 downto 17) = "00") then -- reserved
+              dm_ctrl.state <= CMD_MEM_TRIGGER; -- does not require the CPU to be halted
             else -- invalid command
               dm_ctrl.illegal_cmd <= '1';
               dm_ctrl.state       <= CMD_EXE_ERROR;
@@ -327,10 +413,25 @@ begin
 
           when CMD_EXE_BUSY => -- wait for CPU to finish
           -- ------------------------------------------------------------
-            if (dci.halt_ack = '1') then -- CPU is parked (halted) again -> execution done
+            if (dci.halt_ack = '1') and (dci.hart = hart_sel) then -- selected CPU is parked (halted) again -> execution done
               dm_ctrl.state <= CMD_IDLE;
             end if;
 
+          when CMD_MEM_TRIGGER => -- request memory access from system bus access unit
+          -- ------------------------------------------------------------
+            dm_ctrl.mem_req <= '1';
+            dm_ctrl.state   <= CMD_MEM_BUSY;
+
+          when CMD_MEM_BUSY => -- wait for bus access to complete
+          -- ------------------------------------------------------------
+            if (sba.abs_err = '1') then -- bus error or misaligned address
+              dm_ctrl.bus_error <= '1';
+              dm_ctrl.state     <= CMD_EXE_ERROR;
+            elsif (sba.abs_done = '1') then
+              dm_ctrl.mem_inc <= dm_reg.command(19); -- aampostincrement
+              dm_ctrl.state   <= CMD_IDLE;
+            end if;
+
           when CMD_EXE_ERROR => -- delay cycle for error to arrive abstracts.cmderr
           -- ------------------------------------------------------------
             dm_ctrl.state <= CMD_IDLE;
@@ -349,6 +450,8 @@ begin
             dm_ctrl.cmderr <= "100";
           elsif (dci.exception_ack = '1') then -- exception during execution
             dm_ctrl.cmderr <= "011";
+          elsif (dm_ctrl.bus_error = '1') then -- bus error during memory access
+            dm_ctrl.cmderr <= "101";
           elsif (dm_ctrl.illegal_cmd = '1') then -- unsupported command
             dm_ctrl.cmderr <= "010";
           elsif (dm_reg.rd_acc_err = '1') or (dm_reg.wr_acc_err = '1') then -- invalid read/write while command is executing
@@ -361,40 +464,43 @@ begin
 
         -- hart status --
         -- ------------------------------------------------------------
+        for i in 0 to NUM_HARTS-1 loop
+
+          -- HALTED --
+          if (dm_reg.dmcontrol_ndmreset = '1') then
+            dm_ctrl.hart_halted(i) <= '0';
+          elsif (dci.halt_ack = '1') and (dci.hart = i) then
+            dm_ctrl.hart_halted(i) <= '1';
+          elsif (dci.resume_ack = '1') and (dci.hart = i) then
+            dm_ctrl.hart_halted(i) <= '0';
+          end if;
 
-        -- HALTED --
-        if (dm_reg.dmcontrol_ndmreset = '1') then
-          dm_ctrl.hart_halted <= '0';
-        elsif (dci.halt_ack = '1') then
-          dm_ctrl.hart_halted <= '1';
-        elsif (dci.resume_ack = '1') then
-          dm_ctrl.hart_halted <= '0';
-        end if;
+          -- RESUME REQ --
+          if (dm_reg.dmcontrol_ndmreset = '1') then
+            dm_ctrl.hart_resume_req(i) <= '0';
+          elsif (dm_reg.resume_req = '1') and (hart_sel = i) and (hart_nonexistent = '0') then
+            dm_ctrl.hart_resume_req(i) <= '1';
+          elsif (dci.resume_ack = '1') and (dci.hart = i) then
+            dm_ctrl.hart_resume_req(i) <= '0';
+          end if;
 
-        -- RESUME REQ --
-        if (dm_reg.dmcontrol_ndmreset = '1') then
-          dm_ctrl.hart_resume_req <= '0';
-        elsif (dm_reg.resume_req = '1') then
-          dm_ctrl.hart_resume_req <= '1';
-        elsif (dci.resume_ack = '1') then
-          dm_ctrl.hart_resume_req <= '0';
-        end if;
+          -- RESUME ACK --
+          if (dm_reg.dmcontrol_ndmreset = '1') then
+            dm_ctrl.hart_resume_ack(i) <= '0';
+          elsif (dci.resume_ack = '1') and (dci.hart = i) then
+            dm_ctrl.hart_resume_ack(i) <= '1';
+          elsif (dm_reg.resume_req = '1') and (hart_sel = i) then
+            dm_ctrl.hart_resume_ack(i) <= '0';
+          end if;
 
-        -- RESUME ACK --
-        if (dm_reg.dmcontrol_ndmreset = '1') then
-          dm_ctrl.hart_resume_ack <= '0';
-        elsif (dci.resume_ack = '1') then
-          dm_ctrl.hart_resume_ack <= '1';
-        elsif (dm_reg.resume_req = '1') then
-          dm_ctrl.hart_resume_ack <= '0';
-        end if;
+          -- hart has been RESET --
+          if (dm_reg.dmcontrol_ndmreset = '1') then
+            dm_ctrl.hart_reset(i) <= '1';
+          elsif (dm_reg.reset_ack = '1') and (hart_sel = i) then
+            dm_ctrl.hart_reset(i) <= '0';
+          end if;
 
-        -- hart has been RESET --
-        if (dm_reg.dmcontrol_ndmreset = '1') then
-          dm_ctrl.hart_reset <= '1';
-        elsif (dm_reg.reset_ack = '1') then
-          dm_ctrl.hart_reset <= '0';
-        end if;
+        end loop; -- i
 
       end if;
     end if;
@@ -411,12 +517,14 @@ begin
     if (rstn_i = '0') then
       dm_reg.dmcontrol_ndmreset <= '0';
       dm_reg.dmcontrol_dmactive <= '0'; -- DM is in reset state after hardware reset
+      dm_reg.dmcontrol_hartsel  <= (others => '0');
       --
       dm_reg.abstractauto_autoexecdata    <= '0';
       dm_reg.abstractauto_autoexecprogbuf <= "00";
       --
       dm_reg.command <= (others => '0');
       dm_reg.progbuf <= (others => instr_nop_c);
+      dm_reg.data1   <= (others => '0');
       --
       dm_reg.halt_req    <= '0';
       dm_reg.resume_req  <= '0';
@@ -442,6 +550,7 @@ begin
           dm_reg.halt_req           <= dmi_req_data_i(31); -- haltreq (-/w): write 1 to request halt
           dm_reg.resume_req         <= dmi_req_data_i(30); -- resumereq (-/w1): write 1 to request resume
           dm_reg.reset_ack          <= dmi_req_data_i(28); -- ackhavereset (-/w1)
+          dm_reg.dmcontrol_hartsel  <= dmi_req_data_i(25 downto 16); -- hartsello (r/w): select hart
           dm_reg.dmcontrol_ndmreset <= dmi_req_data_i(01); -- ndmreset (r/w): soc reset
           dm_reg.dmcontrol_dmactive <= dmi_req_data_i(00); -- dmactive (r/w): DM reset
         end if;
@@ -462,6 +571,13 @@ begin
           end if;
         end if;
 
+        -- write abstract data 1 (memory access address) --
+        if (dmi_req_addr_i = addr_data1_c) and (SBA_EN = true) then
+          if (dm_ctrl.busy = '0') then -- idle
+            dm_reg.data1 <= dmi_req_data_i;
+          end if;
+        end if;
+
         -- auto execution trigger --
         if ((dmi_req_addr_i = addr_data0_c)    and (dm_reg.abstractauto_autoexecdata = '1')) or
            ((dmi_req_addr_i = addr_progbuf0_c) and (dm_reg.abstractauto_autoexecprogbuf(0) = '1')) or
@@ -493,6 +609,7 @@ begin
              (dmi_req_addr_i = addr_command_c) or
              (dmi_req_addr_i = addr_abstractauto_c) or
              (dmi_req_addr_i = addr_data0_c) or
+             ((dmi_req_addr_i = addr_data1_c) and (SBA_EN = true)) or
              (dmi_req_addr_i = addr_progbuf0_c) or
              (dmi_req_addr_i = addr_progbuf1_c) then
             dm_reg.wr_acc_err <= '1';
@@ -500,6 +617,15 @@ begin
         end if;
 
       end if;
+
+      -- abstract memory access: post-increment address --
+      if (dm_ctrl.mem_inc = '1') then
+        case dm_reg.command(21 downto 20) is -- aamsize
+          when "00"   => dm_reg.data1 <= std_ulogic_vector(unsigned(dm_reg.data1) + 1);
+          when "01"   => dm_reg.data1 <= std_ulogic_vector(unsigned(dm_reg.data1) + 2);
+          when others => dm_reg.data1 <= std_ulogic_vector(unsigned(dm_reg.data1) + 4);
+        end case;
+      end if;
     end if;
   end process dmi_write_access;
 
@@ -510,9 +636,16 @@ begin
   dci.data_we <= '1' when (dmi_req_valid_i = '1') and (dmi_req_op_i = '1') and (dmi_req_addr_i = addr_data0_c) and (dm_ctrl.busy = '0') else '0';
   dci.wdata   <= dmi_req_data_i;
 
+  -- hart selection --
+  hart_sel         <= to_integer(unsigned(dm_reg.dmcontrol_hartsel(1 downto 0)));
+  hart_nonexistent <= '1' when (unsigned(dm_reg.dmcontrol_hartsel) >= NUM_HARTS) else '0';
+
   -- CPU halt/resume request --
-  cpu_halt_req_o <= dm_reg.halt_req and dm_reg.dmcontrol_dmactive; -- single shot
-  dci.resume_req <= dm_ctrl.hart_resume_req; -- permanent
+  cpu_halt_req_gen:
+  for i in 0 to NUM_HARTS-1 generate
+    cpu_halt_req_o(i) <= dm_reg.halt_req and dm_reg.dmcontrol_dmactive when (hart_sel = i) else '0'; -- single shot
+  end generate;
+  dci.resume_req <= dm_ctrl.hart_resume_req(to_integer(unsigned(cpu_hart_i))); -- permanent, for the accessing hart
 
   -- SoC reset --
   cpu_ndmrstn_o <= not (dm_reg.dmcontrol_ndmreset and dm_reg.dmcontrol_dmactive);
@@ -545,18 +678,18 @@ begin
           dmi_resp_data_o(31 downto 23) <= (others => '0'); -- reserved (r/-)
           dmi_resp_data_o(22)           <= '1'; -- impebreak (r/-): there is an implicit ebreak instruction after the visible program buffer
           dmi_resp_data_o(21 downto 20) <= (others => '0'); -- reserved (r/-)
-          dmi_resp_data_o(19)           <= dm_ctrl.hart_reset; -- allhavereset (r/-): there is only one hart that can be reset
-          dmi_resp_data_o(18)           <= dm_ctrl.hart_reset; -- anyhavereset (r/-): there is only one hart that can be reset
-          dmi_resp_data_o(17)           <= dm_ctrl.hart_resume_ack; -- allresumeack (r/-): there is only one hart that can acknowledge resume request
-          dmi_resp_data_o(16)           <= dm_ctrl.hart_resume_ack; -- anyresumeack (r/-): there is only one hart that can acknowledge resume request
-          dmi_resp_data_o(15)           <= '0'; -- allnonexistent (r/-): there is only one hart that is always existent
-          dmi_resp_data_o(14)           <= '0'; -- anynonexistent (r/-): there is only one hart that is always existent
-          dmi_resp_data_o(13)           <= dm_reg.dmcontrol_ndmreset; -- allunavail (r/-): there is only one hart that is unavailable during reset
-          dmi_resp_data_o(12)           <= dm_reg.dmcontrol_ndmreset; -- anyunavail (r/-): there is only one hart that is unavailable during reset
-          dmi_resp_data_o(11)           <= not dm_ctrl.hart_halted; -- allrunning (r/-): there is only one hart that can be RUNNING or HALTED
-          dmi_resp_data_o(10)           <= not dm_ctrl.hart_halted; -- anyrunning (r/-): there is only one hart that can be RUNNING or HALTED
-          dmi_resp_data_o(09)           <= dm_ctrl.hart_halted; -- allhalted (r/-): there is only one hart that can be RUNNING or HALTED
-          dmi_resp_data_o(08)           <= dm_ctrl.hart_halted; -- anyhalted (r/-): there is only one hart that can be RUNNING or HALTED
+          dmi_resp_data_o(19)           <= dm_ctrl.hart_reset(hart_sel); -- allhavereset (r/-): there is only one selected hart
+          dmi_resp_data_o(18)           <= dm_ctrl.hart_reset(hart_sel); -- anyhavereset (r/-): there is only one selected hart
+          dmi_resp_data_o(17)           <= dm_ctrl.hart_resume_ack(hart_sel); -- allresumeack (r/-): there is only one selected hart
+          dmi_resp_data_o(16)           <= dm_ctrl.hart_resume_ack(hart_sel); -- anyresumeack (r/-): there is only one selected hart
+          dmi_resp_data_o(15)           <= hart_nonexistent; -- allnonexistent (r/-): selected hart does not exist
+          dmi_resp_data_o(14)           <= hart_nonexistent; -- anynonexistent (r/-): selected hart does not exist
+          dmi_resp_data_o(13)           <= dm_reg.dmcontrol_ndmreset and (not hart_nonexistent); -- allunavail (r/-): harts are unavailable during reset
+          dmi_resp_data_o(12)           <= dm_reg.dmcontrol_ndmreset and (not hart_nonexistent); -- anyunavail (r/-): harts are unavailable during reset
+          dmi_resp_data_o(11)           <= (not dm_ctrl.hart_halted(hart_sel)) and (not hart_nonexistent); -- allrunning (r/-): selected hart is RUNNING
+          dmi_resp_data_o(10)           <= (not dm_ctrl.hart_halted(hart_sel)) and (not hart_nonexistent); -- anyrunning (r/-): selected hart is RUNNING
+          dmi_resp_data_o(09)           <= dm_ctrl.hart_halted(hart_sel); -- allhalted (r/-): selected hart is HALTED
+          dmi_resp_data_o(08)           <= dm_ctrl.hart_halted(hart_sel); -- anyhalted (r/-): selected hart is HALTED
           dmi_resp_data_o(07)           <= '1'; -- authenticated (r/-): authentication passed since there is no authentication
           dmi_resp_data_o(06)           <= '0'; -- authbusy (r/-): always ready since there is no authentication
           dmi_resp_data_o(05)           <= '0'; -- hasresethaltreq (r/-): halt-on-reset not implemented
@@ -571,8 +704,8 @@ begin
           dmi_resp_data_o(28)           <= '0'; -- ackhavereset (-/w1): write-only
           dmi_resp_data_o(27)           <= '0'; -- reserved (r/-)
           dmi_resp_data_o(26)           <= '0'; -- hasel (r/-) - there is a single currently selected hart
-          dmi_resp_data_o(25 downto 16) <= (others => '0'); -- hartsello (r/-) - there is only one hart
-          dmi_resp_data_o(15 downto 06) <= (others => '0'); -- hartselhi (r/-) - there is only one hart
+          dmi_resp_data_o(25 downto 16) <= dm_reg.dmcontrol_hartsel; -- hartsello (r/w) - selected hart
+          dmi_resp_data_o(15 downto 06) <= (others => '0'); -- hartselhi (r/-) - not required for max 4 harts
           dmi_resp_data_o(05 downto 04) <= (others => '0'); -- reserved (r/-)
           dmi_resp_data_o(03)           <= '0'; -- setresethaltreq (-/w1): halt-on-reset request - halt-on-reset not implemented
           dmi_resp_data_o(02)           <= '0'; -- clrresethaltreq (-/w1): halt-on-reset ack - halt-on-reset not implemented
@@ -596,7 +729,11 @@ begin
           dmi_resp_data_o(11)           <= '0'; -- reserved (r/-)
           dmi_resp_data_o(10 downto 08) <= dm_ctrl.cmderr; -- cmderr (r/w1c): any error during execution?
           dmi_resp_data_o(07 downto 04) <= (others => '0'); -- reserved (r/-)
-          dmi_resp_data_o(03 downto 00) <= "0001"; -- datacount (r/-): number of implemented data registers = 1
+          if (SBA_EN = true) then
+            dmi_resp_data_o(03 downto 00) <= "0010"; -- datacount (r/-): number of implemented data registers = 2 (data + address)
+          else
+            dmi_resp_data_o(03 downto 00) <= "0001"; -- datacount (r/-): number of implemented data registers = 1
+          end if;
 
 --      -- abstract command (-/w) --
 --      when addr_command_c =>
@@ -616,19 +753,50 @@ begin
         when addr_data0_c =>
           dmi_resp_data_o <= dci.rdata;
 
+        -- abstract data 1 (r/w) --
+        when addr_data1_c =>
+          if (SBA_EN = true) then
+            dmi_resp_data_o <= dm_reg.data1; -- memory access address
+          end if;
+
         -- program buffer (r/w) --
         when addr_progbuf0_c =>
           dmi_resp_data_o <= dm_reg.progbuf(0); -- program buffer 0
         when addr_progbuf1_c =>
           dmi_resp_data_o <= dm_reg.progbuf(1); -- program buffer 1
 
---      -- system bus access control and status (r/-) --
---      when addr_sbcs_c =>
---        dmi_resp_data_o <= (others => '0'); -- bus access not implemented
+        -- system bus access control and status (r/w) --
+        when addr_sbcs_c =>
+          if (SBA_EN = true) then
+            dmi_resp_data_o(31 downto 29) <= "001"; -- sbversion (r/-): compatible to version 0.13
+            dmi_resp_data_o(22)           <= sba.sbbusyerror; -- sbbusyerror (r/w1c): access while bus is busy
+            dmi_resp_data_o(21)           <= sba.sbbusy; -- sbbusy (r/-): bus access in progress
+            dmi_resp_data_o(20)           <= sba.sbreadonaddr; -- sbreadonaddr (r/w): read when writing sbaddress0
+            dmi_resp_data_o(19 downto 17) <= sba.sbaccess; -- sbaccess (r/w): access size
+            dmi_resp_data_o(16)           <= sba.sbautoincrement; -- sbautoincrement (r/w): increment sbaddress0 after each access
+            dmi_resp_data_o(15)           <= sba.sbreadondata; -- sbreadondata (r/w): read when reading sbdata0
+            dmi_resp_data_o(14 downto 12) <= sba.sberror; -- sberror (r/w1c): bus error
+            dmi_resp_data_o(11 downto 05) <= "0100000"; -- sbasize (r/-): 32-bit addresses
+            dmi_resp_data_o(04 downto 00) <= "00111"; -- sbaccess128..8 (r/-): 8-, 16- and 32-bit accesses
+          else
+            dmi_resp_data_o <= (others => '0'); -- bus access not implemented
+          end if;
+
+        -- system bus address 0 (r/w) --
+        when addr_sbaddress0_c =>
+          if (SBA_EN = true) then
+            dmi_resp_data_o <= sba.sbaddress;
+          end if;
+
+        -- system bus data 0 (r/w) --
+        when addr_sbdata0_c =>
+          if (SBA_EN = true) then
+            dmi_resp_data_o <= sba.sbdata;
+          end if;
 
         -- halt summary 0 (r/-) --
         when addr_haltsum0_c =>
-          dmi_resp_data_o(0) <= dm_ctrl.hart_halted; -- hart is halted
+          dmi_resp_data_o(NUM_HARTS-1 downto 0) <= dm_ctrl.hart_halted(NUM_HARTS-1 downto 0); -- harts are halted
 
         -- not implemented (r/-) --
         when others =>
@@ -640,6 +808,7 @@ begin
       if (dmi_req_valid_i = '1') and (dmi_req_op_i = '0') then -- valid DMI read request
         if (dm_ctrl.busy = '1') then -- busy
           if (dmi_req_addr_i = addr_data0_c) or
+             ((dmi_req_addr_i = addr_data1_c) and (SBA_EN = true)) or
              (dmi_req_addr_i = addr_progbuf0_c) or
              (dmi_req_addr_i = addr_progbuf1_c) then
             dm_reg.rd_acc_err <= '1';
@@ -661,6 +830,251 @@ begin
   end process dmi_read_access;
 
 
+  -- **************************************************************************************************************************
+  -- System Bus Access (SBA)
+  -- **************************************************************************************************************************
+
+  system_bus_access_enabled:
+  if (SBA_EN = true) generate
+
+    -- SBA Controller -----------------------------------------------------------------------
+    -- -----------------------------------------------------------------------------------------
+    sba_controller: process(clk_i)
+    begin
+      if rising_edge(clk_i) then
+        if (dm_reg.dmcontrol_dmactive = '0') or (dmi_rstn_i = '0') then -- DM reset / DM disabled
+          sba.sbaddress       <= (others => '0');
+          sba.sbdata          <= (others => '0');
+          sba.sbreadonaddr    <= '0';
+          sba.sbaccess        <= "010"; -- 32-bit
+          sba.sbautoincrement <= '0';
+          sba.sbreadondata    <= '0';
+          sba.sberror         <= "000";
+          sba.sbbusyerror     <= '0';
+          --
+          sba.sb_rd_req       <= '0';
+          sba.sb_wr_req       <= '0';
+          sba.abs_req         <= '0';
+          --
+          sba.state           <= SBA_IDLE;
+          sba.src             <= '0';
+          sba.size            <= (others => '0');
+          sba.addr            <= (others => '0');
+          sba.wdata           <= (others => '0');
+          sba.rnw             <= '0';
+          sba.we              <= '0';
+          sba.re              <= '0';
+          --
+          sba.abs_done        <= '0';
+          sba.abs_err         <= '0';
+          sba.abs_rdata_we    <= '0';
+          sba.abs_rdata       <= (others => '0');
+        else
+
+          -- defaults --
+          sba.we           <= '0';
+          sba.re           <= '0';
+          sba.abs_done     <= '0';
+          sba.abs_err      <= '0';
+          sba.abs_rdata_we <= '0';
+
+          -- DMI access --
+          if (dmi_req_valid_i = '1') and (dmi_req_op_i = '1') then -- valid DMI write request
+            -- control and status --
+            if (dmi_req_addr_i = addr_sbcs_c) then
+              if (dmi_req_data_i(22) = '1') then -- sbbusyerror: write 1 to clear
+                sba.sbbusyerror <= '0';
+              end if;
+              if (dmi_req_data_i(14 downto 12) /= "000") then -- sberror: write 1 to clear
+                sba.sberror <= "000";
+              end if;
+              sba.sbreadonaddr    <= dmi_req_data_i(20);
+              sba.sbaccess        <= dmi_req_data_i(19 downto 17);
+              sba.sbautoincrement <= dmi_req_data_i(16);
+              sba.sbreadondata    <= dmi_req_data_i(15);
+            end if;
+            -- address --
+            if (dmi_req_addr_i = addr_sbaddress0_c) then
+              if (sba.sbbusy = '1') then
+                sba.sbbusyerror <= '1';
+              else
+                sba.sbaddress <= dmi_req_data_i;
+                if (sba.sbreadonaddr = '1') and (sba.sberror = "000") and (sba.sbbusyerror = '0') then
+                  sba.sb_rd_req <= '1';
+                end if;
+              end if;
+            end if;
+            -- data --
+            if (dmi_req_addr_i = addr_sbdata0_c) then
+              if (sba.sbbusy = '1') then
+                sba.sbbusyerror <= '1';
+              else
+                sba.sbdata <= dmi_req_data_i;
+                if (sba.sberror = "000") and (sba.sbbusyerror = '0') then
+                  sba.sb_wr_req <= '1';
+                end if;
+              end if;
+            end if;
+          elsif (dmi_req_valid_i = '1') and (dmi_req_op_i = '0') then -- valid DMI read request
+            if (dmi_req_addr_i = addr_sbdata0_c) then
+              if (sba.sbbusy = '1') then
+                sba.sbbusyerror <= '1';
+              elsif (sba.sbreadondata = '1') and (sba.sberror = "000") and (sba.sbbusyerror = '0') then
+                sba.sb_rd_req <= '1';
+              end if;
+            end if;
+          end if;
+
+          -- bus access engine --
+          case sba.state is
+
+            when SBA_IDLE => -- wait for request
+            -- ------------------------------------------------------------
+              if (sba.abs_req = '1') then -- abstract memory access command
+                sba.abs_req <= '0';
+                sba.src     <= '1';
+                sba.size    <= dm_reg.command(22 downto 20); -- aamsize
+                sba.addr    <= dm_reg.data1;
+                sba.wdata   <= data_buf;
+                sba.rnw     <= not dm_reg.command(16); -- write
+                sba.state   <= SBA_CHECK;
+              elsif (sba.sb_rd_req = '1') or (sba.sb_wr_req = '1') then -- SBA register access
+                sba.sb_rd_req <= '0';
+                sba.sb_wr_req <= '0';
+                sba.src       <= '0';
+                sba.size      <= sba.sbaccess;
+                sba.addr      <= sba.sbaddress;
+                sba.wdata     <= sba.sbdata;
+                sba.rnw       <= sba.sb_rd_req;
+                sba.state     <= SBA_CHECK;
+              end if;
+
+            when SBA_CHECK => -- check access size and alignment, trigger bus access
+            -- ------------------------------------------------------------
+              if (sba.size(2) = '1') or (sba.size(1 downto 0) = "11") then -- unsupported access size
+                sba.abs_err <= sba.src;
+                if (sba.src = '0') then
+                  sba.sberror <= "100";
+                end if;
+                sba.state <= SBA_IDLE;
+              elsif ((sba.size(1 downto 0) = "01") and (sba.addr(0) = '1')) or
+                    ((sba.size(1 downto 0) = "10") and (sba.addr(1 downto 0) /= "00")) then -- misaligned address
+                sba.abs_err <= sba.src;
+                if (sba.src = '0') then
+                  sba.sberror <= "011";
+                end if;
+                sba.state <= SBA_IDLE;
+              else
+                sba.re    <= sba.rnw;
+                sba.we    <= not sba.rnw;
+                sba.state <= SBA_BUSY;
+              end if;
+
+            when SBA_BUSY => -- bus access in progress
+            -- ------------------------------------------------------------
+              if (sba_err_i = '1') then -- bus error
+                sba.abs_err <= sba.src;
+                if (sba.src = '0') then
+                  sba.sberror <= "010"; -- bad address
+                end if;
+                sba.state <= SBA_IDLE;
+              elsif (sba_ack_i = '1') then -- access completed
+                if (sba.src = '1') then -- abstract command
+                  sba.abs_rdata    <= sba_rdata;
+                  sba.abs_rdata_we <= sba.rnw;
+                  sba.abs_done     <= '1';
+                else -- SBA registers
+                  if (sba.rnw = '1') then
+                    sba.sbdata <= sba_rdata;
+                  end if;
+                  if (sba.sbautoincrement = '1') then
+                    case sba.size(1 downto 0) is
+                      when "00"   => sba.sbaddress <= std_ulogic_vector(unsigned(sba.sbaddress) + 1);
+                      when "01"   => sba.sbaddress <= std_ulogic_vector(unsigned(sba.sbaddress) + 2);
+                      when others => sba.sbaddress <= std_ulogic_vector(unsigned(sba.sbaddress) + 4);
+                    end case;
+                  end if;
+                end if;
+                sba.state <= SBA_IDLE;
+              end if;
+
+            when others => -- undefined
+            -- ------------------------------------------------------------
+              sba.state <= SBA_IDLE;
+
+          end case;
+
+          -- abstract command request --
+          if (dm_ctrl.mem_req = '1') then
+            sba.abs_req <= '1';
+          end if;
+
+        end if;
+      end if;
+    end process sba_controller;
+
+    -- SBA busy flag --
+    sba.sbbusy <= '1' when (sba.state /= SBA_IDLE) or (sba.sb_rd_req = '1') or (sba.sb_wr_req = '1') else '0';
+
+
+    -- SBA Bus Interface --------------------------------------------------------------------
+    -- -----------------------------------------------------------------------------------------
+    sba_bus_interface: process(sba, sba_rdata_i)
+    begin
+      case sba.size(1 downto 0) is
+        when "00" => -- byte
+          sba.ben   <= (others => '0');
+          sba.ben(to_integer(unsigned(sba.addr(1 downto 0)))) <= '1';
+          sba_wdata <= sba.wdata(07 downto 0) & sba.wdata(07 downto 0) & sba.wdata(07 downto 0) & sba.wdata(07 downto 0);
+          sba_rdata <= (others => '0');
+          case sba.addr(1 downto 0) is
+            when "00"   => sba_rdata(07 downto 0) <= sba_rdata_i(07 downto 00);
+            when "01"   => sba_rdata(07 downto 0) <= sba_rdata_i(15 downto 08);
+            when "10"   => sba_rdata(07 downto 0) <= sba_rdata_i(23 downto 16);
+            when others => sba_rdata(07 downto 0) <= sba_rdata_i(31 downto 24);
+          end case;
+        when "01" => -- half-word
+          sba_wdata <= sba.wdata(15 downto 0) & sba.wdata(15 downto 0);
+          sba_rdata <= (others => '0');
+          if (sba.addr(1) = '0') then
+            sba.ben <= "0011";
+            sba_rdata(15 downto 0) <= sba_rdata_i(15 downto 00);
+          else
+            sba.ben <= "1100";
+            sba_rdata(15 downto 0) <= sba_rdata_i(31 downto 16);
+          end if;
+        when others => -- word
+          sba.ben   <= "1111";
+          sba_wdata <= sba.wdata;
+          sba_rdata <= sba_rdata_i;
+      end case;
+    end process sba_bus_interface;
+
+    -- bus output --
+    sba_addr_o  <= sba.addr;
+    sba_wdata_o <= sba_wdata;
+    sba_ben_o   <= sba.ben;
+    sba_we_o    <= sba.we;
+    sba_re_o    <= sba.re;
+
+  end generate;
+
+  system_bus_access_disabled:
+  if (SBA_EN = false) generate
+    sba.sbbusy       <= '0';
+    sba.abs_done     <= '0';
+    sba.abs_err      <= '0';
+    sba.abs_rdata_we <= '0';
+    sba.abs_rdata    <= (others => '0');
+    --
+    sba_addr_o  <= (others => '0');
+    sba_wdata_o <= (others => '0');
+    sba_ben_o   <= (others => '0');
+    sba_we_o    <= '0';
+    sba_re_o    <= '0';
+  end generate;
+
+
   -- **************************************************************************************************************************
   -- CPU Bus Interface
   -- **************************************************************************************************************************
@@ -681,6 +1095,8 @@ begin
       -- Data buffer --
       if (dci.data_we = '1') then -- DM write access
         data_buf <= dci.wdata;
+      elsif (sba.abs_rdata_we = '1') then -- abstract memory read access
+        data_buf <= sba.abs_rdata;
       elsif (acc_en = '1') and (maddr = "10") and (wren = '1') then -- BUS write access
         data_buf <= cpu_data_i;
       end if;
@@ -690,6 +1106,7 @@ begin
       dci.execute_ack   <= '0';
       dci.exception_ack <= '0';
       if (acc_en = '1') and (maddr = "11") and (wren = '1') then
+        dci.hart          <= to_integer(unsigned(cpu_hart_i));
         dci.halt_ack      <= cpu_data_i(sreg_halt_ack_c);
         dci.resume_ack    <= cpu_data_i(sreg_resume_ack_c);
         dci.execute_ack   <= cpu_data_i(sreg_execute_ack_c);
@@ -719,7 +1136,9 @@ begin
             cpu_data_o <= data_buf;
           when others => -- status/control register
             cpu_data_o(sreg_resume_req_c)  <= dci.resume_req;
-            cpu_data_o(sreg_execute_req_c) <= dci.execute_req;
+            if (to_integer(unsigned(cpu_hart_i)) = hart_sel) then -- only the selected hart may execute the program buffer
+              cpu_data_o(sreg_execute_req_c) <= dci.execute_req;
+            end if;
         end case;
       end if;
     end if;
@@ -0,0 +1,460 @@
+-- #################################################################################################
+-- # << NEORV32 - Direct Memory Access Controller (DMA) >>                                         #
+-- # ********************************************************************************************* #
+-- # Multi-channel direct memory access controller. The DMA is an additional bus master of the     #
+-- # processor bus (connected to the processor bus arbiter) that can move data between memories    #
+-- # and memory-mapped peripherals without CPU interaction. Each channel provides a source and a   #
+-- # destination address (each with optional auto-increment), a transfer size (byte, half-word,    #
+-- # word) and a number of transfer units. A channel can be triggered by software (free-running    #
+-- # memory-to-memory transfer) or by one of the processor's fast interrupt request lines          #
+-- # (peripheral-paced transfers; each trigger event moves one burst). Active channels are served  #
+-- # in round-robin order; the bus is released after each burst. An optional interrupt is fired    #
+-- # when a channel completes.                                                                     #
+-- # ********************************************************************************************* #
+-- # BSD 3-Clause License                                                                          #
+-- #                                                                                               #
+-- # Copyright (c) 2021, Stephan Nolting. All rights reserved.                                     #
+-- #                                                                                               #
+-- # Redistribution and use in source and binary forms, with or without modification, are          #
+-- # permitted provided that the following conditions are met:                                     #
+-- #                                                                                               #
+-- # 1. Redistributions of source code must retain the above copyright notice, this list of        #
+-- #    conditions and the following disclaimer.                                                   #
+-- #                                                                                               #
+-- # 2. Redistributions in binary form must reproduce the above copyright notice, this list of     #
+-- #    conditions and the following disclaimer in the documentation and/or other materials        #
+-- #    provided with the distribution.                                                            #
+-- #                                                                                               #
+-- # 3. Neither the name of the copyright holder nor the names of its contributors may be used to  #
+-- #    endorse or promote products derived from this software without specific prior written      #
+-- #    permission.                                                                                #
+-- #                                                                                               #
+-- # THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS   #
+-- # OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF               #
+-- # MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE    #
+-- # COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,     #
+-- # EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE #
+-- # GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED    #
+-- # AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING     #
+-- # NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED  #
+-- # OF THE POSSIBILITY OF SUCH DAMAGE.                                                            #
+-- # ********************************************************************************************* #
+-- # The NEORV32 Processor - https://github.com/stnolting/neorv32              (c) Stephan Nolting #
+-- #################################################################################################
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library neorv32;
+use neorv32.neorv32_package.all;
+
+entity neorv32_dma is
+  generic (
+    DMA_NUM_CH : natural -- number of DMA channels (1..4)
+  );
+  port (
+    -- host access --
+    clk_i       : in  std_ulogic; -- global clock line
+    rstn_i      : in  std_ulogic; -- global reset line, low-active
+    addr_i      : in  std_ulogic_vector(31 downto 0); -- address
+    rden_i      : in  std_ulogic; -- read enable
+    wren_i      : in  std_ulogic; -- write enable
+    data_i      : in  std_ulogic_vector(31 downto 0); -- data in
+    data_o      : out std_ulogic_vector(31 downto 0); -- data out
+    ack_o       : out std_ulogic; -- transfer acknowledge
+    -- bus controller interface --
+    bus_addr_o  : out std_ulogic_vector(31 downto 0); -- bus access address
+    bus_rdata_i : in  std_ulogic_vector(31 downto 0); -- bus read data
+    bus_wdata_o : out std_ulogic_vector(31 downto 0); -- bus write data
+    bus_ben_o   : out std_ulogic_vector(03 downto 0); -- byte enable
+    bus_we_o    : out std_ulogic; -- write enable
+    bus_re_o    : out std_ulogic; -- read enable
+    bus_ack_i   : in  std_ulogic; -- bus transfer acknowledge
+    bus_err_i   : in  std_ulogic; -- bus transfer error
+    -- trigger events --
+    trig_i      : in  std_ulogic_vector(11 downto 0); -- peripheral events (fast interrupt request lines 0..11)
+    -- interrupt --
+    irq_o       : out std_ulogic -- transfer done interrupt
+  );
+end neorv32_dma;
+
+architecture neorv32_dma_rtl of neorv32_dma is
+
+  -- IO space: module base address --
+  constant hi_abb_c : natural := index_size_f(io_size_c)-1; -- high address boundary bit
+  constant lo_abb_c : natural := index_size_f(dma_size_c); -- low address boundary bit
+
+  -- control register bits --
+  constant ctrl_en_c      : natural :=  0; -- r/w: DMA enable (clearing aborts all channels)
+  constant ctrl_sel0_c    : natural :=  2; -- r/w: channel select for banked registers bit 0
+  constant ctrl_sel1_c    : natural :=  3; -- r/w: channel select for banked registers bit 1
+  constant ctrl_irq0_c    : natural :=  8; -- r/w: channel 0 transfer done interrupt enable
+  constant ctrl_irq3_c    : natural := 11; -- r/w: channel 3 transfer done interrupt enable
+  constant ctrl_num_lsb_c : natural := 28; -- r/-: number of implemented channels - 1, LSB
+  constant ctrl_num_msb_c : natural := 29; -- r/-: number of implemented channels - 1, MSB
+
+  -- status register bits --
+  constant stat_done0_c : natural :=  0; -- r/c: channel 0 done (write 0 to clear)
+  constant stat_done3_c : natural :=  3; -- r/c: channel 3 done (write 0 to clear)
+  constant stat_err0_c  : natural :=  8; -- r/c: channel 0 bus error (write 0 to clear)
+  constant stat_err3_c  : natural := 11; -- r/c: channel 3 bus error (write 0 to clear)
+  constant stat_busy0_c : natural := 16; -- r/-: channel 0 busy
+  constant stat_busy3_c : natural := 19; -- r/-: channel 3 busy
+
+  -- channel configuration register bits --
+  constant cfg_num_lsb_c   : natural :=  0; -- r/w: number of transfer units (remaining), LSB
+  constant cfg_num_msb_c   : natural := 15; -- r/w: number of transfer units (remaining), MSB
+  constant cfg_size_lsb_c  : natural := 16; -- r/w: transfer unit size (00 = byte, 01 = half-word, 10 = word), LSB
+  constant cfg_size_msb_c  : natural := 17; -- r/w: transfer unit size, MSB
+  constant cfg_src_inc_c   : natural := 18; -- r/w: increment source address
+  constant cfg_dst_inc_c   : natural := 19; -- r/w: increment destination address
+  constant cfg_burst_lsb_c : natural := 20; -- r/w: log2(burst length), LSB
+  constant cfg_burst_msb_c : natural := 22; -- r/w: log2(burst length), MSB
+  constant cfg_trig_lsb_c  : natural := 24; -- r/w: trigger: 0 = software, n = fast IRQ channel n-1, LSB
+  constant cfg_trig_msb_c  : natural := 27; -- r/w: trigger, MSB
+  constant cfg_pend_c      : natural := 30; -- r/w: trigger event pending
+  constant cfg_start_c     : natural := 31; -- r/w: start transfer (write 1) / abort transfer (write 0); reads busy
+
+  -- access control --
+  signal acc_en : std_ulogic; -- module access enable
+  signal addr   : std_ulogic_vector(31 downto 0); -- access address
+  signal wren   : std_ulogic; -- word write enable
+  signal rden   : std_ulogic; -- read enable
+
+  -- global control --
+  signal enable  : std_ulogic;
+  signal sel     : std_ulogic_vector(1 downto 0);
+  signal irq_en  : std_ulogic_vector(3 downto 0);
+  signal sel_ok  : std_ulogic; -- selected channel is implemented
+
+  -- channels --
+  type channel_t is record
+    src     : std_ulogic_vector(31 downto 0); -- source address
+    dst     : std_ulogic_vector(31 downto 0); -- destination address
+    num     : std_ulogic_vector(15 downto 0); -- remaining transfer units
+    size    : std_ulogic_vector(01 downto 0); -- transfer unit size
+    src_inc : std_ulogic; -- auto-increment source address
+    dst_inc : std_ulogic; -- auto-increment destination address
+    burst   : std_ulogic_vector(02 downto 0); -- log2(burst length)
+    trig    : std_ulogic_vector(03 downto 0); -- trigger source
+    pend    : std_ulogic; -- trigger event pending
+    busy    : std_ulogic; -- transfer in progress
+    done    : std_ulogic; -- transfer completed
+    err     : std_ulogic; -- transfer aborted due to bus error
+  end record;
+  type channel_array_t is array (0 to 3) of channel_t;
+  signal ch : channel_array_t;
+
+  -- channel ready to be served --
+  signal ready : std_ulogic_vector(3 downto 0);
+
+  -- transfer engine --
+  type engine_state_t is (E_IDLE, E_READ, E_READ_WAIT, E_WRITE, E_WRITE_WAIT);
+  type engine_t is record
+    state : engine_state_t;
+    cid   : natural range 0 to 3; -- current channel
+    cnt   : std_ulogic_vector(07 downto 0); -- remaining units in current burst
+    data  : std_ulogic_vector(31 downto 0); -- transfer data (aligned to bit 0)
+  end record;
+  signal engine : engine_t;
+
+begin
+
+  -- Sanity Checks --------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  assert not ((DMA_NUM_CH < 1) or (DMA_NUM_CH > 4)) report "NEORV32 PROCESSOR CONFIG ERROR! Number of DMA channels <IO_DMA_NUM_CH> has to be 1..4." severity error;
+
+
+  -- Access Control -------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  acc_en <= '1' when (addr_i(hi_abb_c downto lo_abb_c) = dma_base_c(hi_abb_c downto lo_abb_c)) else '0';
+  addr   <= dma_base_c(31 downto lo_abb_c) & addr_i(lo_abb_c-1 downto 2) & "00"; -- word aligned
+  wren   <= acc_en and wren_i;
+  rden   <= acc_en and rden_i;
+
+  sel_ok <= '1' when (to_integer(unsigned(sel)) < DMA_NUM_CH) else '0';
+
+
+  -- Channel Ready --------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  channel_ready: process(ch)
+  begin
+    ready <= (others => '0');
+    for i in 0 to DMA_NUM_CH-1 loop
+      if (ch(i).trig = "0000") then -- software-triggered: free-running
+        ready(i) <= ch(i).busy;
+      else -- peripheral-triggered: wait for trigger event
+        ready(i) <= ch(i).busy and ch(i).pend;
+      end if;
+    end loop; -- i
+  end process channel_ready;
+
+
+  -- Register Interface and Transfer Engine -------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  dma_core: process(rstn_i, clk_i)
+    variable next_v : natural range 0 to 3;
+    variable inc_v  : unsigned(2 downto 0);
+  begin
+    if (rstn_i = '0') then
+      enable      <= '0';
+      sel         <= (others => '0');
+      irq_en      <= (others => '0');
+      for i in 0 to 3 loop
+        ch(i).src     <= (others => '0');
+        ch(i).dst     <= (others => '0');
+        ch(i).num     <= (others => '0');
+        ch(i).size    <= (others => '0');
+        ch(i).src_inc <= '0';
+        ch(i).dst_inc <= '0';
+        ch(i).burst   <= (others => '0');
+        ch(i).trig    <= (others => '0');
+        ch(i).pend    <= '0';
+        ch(i).busy    <= '0';
+        ch(i).done    <= '0';
+        ch(i).err     <= '0';
+      end loop; -- i
+      engine.state <= E_IDLE;
+      engine.cid   <= 0;
+      engine.cnt   <= (others => '0');
+      engine.data  <= (others => '0');
+      bus_addr_o   <= (others => '0');
+      bus_wdata_o  <= (others => '0');
+      bus_ben_o    <= (others => '0');
+      bus_we_o     <= '0';
+      bus_re_o     <= '0';
+      irq_o        <= '0';
+    elsif rising_edge(clk_i) then
+      -- defaults --
+      bus_we_o <= '0';
+      bus_re_o <= '0';
+      irq_o    <= '0';
+
+      -- host write access --
+      if (wren = '1') then
+        if (addr = dma_ctrl_addr_c) then
+          enable <= data_i(ctrl_en_c);
+          sel    <= data_i(ctrl_sel1_c downto ctrl_sel0_c);
+          irq_en <= data_i(ctrl_irq3_c downto ctrl_irq0_c);
+        end if;
+        if (addr = dma_stat_addr_c) then -- write 0 to clear flags
+          for i in 0 to 3 loop
+            ch(i).done <= ch(i).done and data_i(stat_done0_c + i);
+            ch(i).err  <= ch(i).err  and data_i(stat_err0_c + i);
+          end loop; -- i
+        end if;
+        if (sel_ok = '1') then
+          if (ch(to_integer(unsigned(sel))).busy = '0') then -- configuration can only be changed while channel is idle
+            if (addr = dma_src_addr_c) then
+              ch(to_integer(unsigned(sel))).src <= data_i;
+            end if;
+            if (addr = dma_dst_addr_c) then
+              ch(to_integer(unsigned(sel))).dst <= data_i;
+            end if;
+            if (addr = dma_cfg_addr_c) then
+              ch(to_integer(unsigned(sel))).num     <= data_i(cfg_num_msb_c downto cfg_num_lsb_c);
+              ch(to_integer(unsigned(sel))).size    <= data_i(cfg_size_msb_c downto cfg_size_lsb_c);
+              ch(to_integer(unsigned(sel))).src_inc <= data_i(cfg_src_inc_c);
+              ch(to_integer(unsigned(sel))).dst_inc <= data_i(cfg_dst_inc_c);
+              ch(to_integer(unsigned(sel))).burst   <= data_i(cfg_burst_msb_c downto cfg_burst_lsb_c);
+              ch(to_integer(unsigned(sel))).trig    <= data_i(cfg_trig_msb_c downto cfg_trig_lsb_c);
+              ch(to_integer(unsigned(sel))).pend    <= data_i(cfg_pend_c);
+              if (data_i(cfg_start_c) = '1') then
+                if (or_reduce_f(data_i(cfg_num_msb_c downto cfg_num_lsb_c)) = '1') then
+                  ch(to_integer(unsigned(sel))).busy <= enable;
+                  ch(to_integer(unsigned(sel))).done <= '0';
+                  ch(to_integer(unsigned(sel))).err  <= '0';
+                else -- nothing to do
+                  ch(to_integer(unsigned(sel))).done <= '1';
+                end if;
+              end if;
+            end if;
+          elsif (addr = dma_cfg_addr_c) and (data_i(cfg_start_c) = '0') then -- abort transfer
+            ch(to_integer(unsigned(sel))).busy <= '0';
+          end if;
+        end if;
+      end if;
+
+      -- transfer engine --
+      case ch(engine.cid).size is -- address increment
+        when "00"   => inc_v := "001"; -- byte
+        when "01"   => inc_v := "010"; -- half-word
+        when others => inc_v := "100"; -- word
+      end case;
+      case engine.state is
+
+        when E_IDLE => -- wait for ready channel (round-robin)
+        -- ------------------------------------------------------------
+          for i in 1 to DMA_NUM_CH loop
+            next_v := (engine.cid + i) mod DMA_NUM_CH;
+            if (ready(next_v) = '1') and (enable = '1') then
+              engine.cid   <= next_v;
+              engine.cnt   <= (others => '0');
+              engine.cnt(to_integer(unsigned(ch(next_v).burst))) <= '1'; -- burst length
+              ch(next_v).pend <= '0'; -- consume trigger event
+              engine.state <= E_READ;
+              exit;
+            end if;
+          end loop; -- i
+
+        when E_READ => -- issue read access
+        -- ------------------------------------------------------------
+          bus_addr_o   <= ch(engine.cid).src;
+          bus_re_o     <= '1';
+          engine.cnt   <= std_ulogic_vector(unsigned(engine.cnt) - 1);
+          engine.state <= E_READ_WAIT;
+
+        when E_READ_WAIT => -- wait for read data
+        -- ------------------------------------------------------------
+          engine.data <= (others => '0');
+          case ch(engine.cid).size is -- align to bit 0
+            when "00" => -- byte
+              case ch(engine.cid).src(1 downto 0) is
+                when "00"   => engine.data(7 downto 0) <= bus_rdata_i(07 downto 00);
+                when "01"   => engine.data(7 downto 0) <= bus_rdata_i(15 downto 08);
+                when "10"   => engine.data(7 downto 0) <= bus_rdata_i(23 downto 16);
+                when others => engine.data(7 downto 0) <= bus_rdata_i(31 downto 24);
+              end case;
+            when "01" => -- half-word
+              if (ch(engine.cid).src(1) = '1') then
+                engine.data(15 downto 0) <= bus_rdata_i(31 downto 16);
+              else
+                engine.data(15 downto 0) <= bus_rdata_i(15 downto 00);
+              end if;
+            when others => -- word
+              engine.data <= bus_rdata_i;
+          end case;
+          if (bus_err_i = '1') then -- abort channel
+            ch(engine.cid).busy <= '0';
+            ch(engine.cid).err  <= '1';
+            ch(engine.cid).done <= '1';
+            irq_o        <= irq_en(engine.cid);
+            engine.state <= E_IDLE;
+          elsif (bus_ack_i = '1') then
+            if (ch(engine.cid).busy = '0') then -- aborted by host
+              engine.state <= E_IDLE;
+            else
+              engine.state <= E_WRITE;
+            end if;
+          end if;
+
+        when E_WRITE => -- issue write access
+        -- ------------------------------------------------------------
+          bus_addr_o <= ch(engine.cid).dst;
+          case ch(engine.cid).size is
+            when "00" => -- byte
+              bus_wdata_o <= engine.data(7 downto 0) & engine.data(7 downto 0) & engine.data(7 downto 0) & engine.data(7 downto 0);
+              bus_ben_o   <= (others => '0');
+              bus_ben_o(to_integer(unsigned(ch(engine.cid).dst(1 downto 0)))) <= '1';
+            when "01" => -- half-word
+              bus_wdata_o <= engine.data(15 downto 0) & engine.data(15 downto 0);
+              if (ch(engine.cid).dst(1) = '1') then
+                bus_ben_o <= "1100";
+              else
+                bus_ben_o <= "0011";
+              end if;
+            when others => -- word
+              bus_wdata_o <= engine.data;
+              bus_ben_o   <= "1111";
+          end case;
+          bus_we_o     <= '1';
+          engine.state <= E_WRITE_WAIT;
+
+        when E_WRITE_WAIT => -- wait for write to complete
+        -- ------------------------------------------------------------
+          if (bus_err_i = '1') then -- abort channel
+            ch(engine.cid).busy <= '0';
+            ch(engine.cid).err  <= '1';
+            ch(engine.cid).done <= '1';
+            irq_o        <= irq_en(engine.cid);
+            engine.state <= E_IDLE;
+          elsif (bus_ack_i = '1') then
+            if (ch(engine.cid).src_inc = '1') then
+              ch(engine.cid).src <= std_ulogic_vector(unsigned(ch(engine.cid).src) + inc_v);
+            end if;
+            if (ch(engine.cid).dst_inc = '1') then
+              ch(engine.cid).dst <= std_ulogic_vector(unsigned(ch(engine.cid).dst) + inc_v);
+            end if;
+            ch(engine.cid).num <= std_ulogic_vector(unsigned(ch(engine.cid).num) - 1);
+            if (ch(engine.cid).num = x"0001") then -- all done
+              ch(engine.cid).busy <= '0';
+              ch(engine.cid).done <= ch(engine.cid).busy; -- not set if aborted by host
+              irq_o        <= irq_en(engine.cid) and ch(engine.cid).busy;
+              engine.state <= E_IDLE;
+            elsif (engine.cnt = x"00") or (ch(engine.cid).busy = '0') or (enable = '0') then -- end of burst / aborted
+              engine.state <= E_IDLE;
+            else -- continue burst
+              engine.state <= E_READ;
+            end if;
+          end if;
+
+      end case;
+
+      -- trigger events --
+      for i in 0 to DMA_NUM_CH-1 loop
+        if (ch(i).busy = '1') and (ch(i).trig /= "0000") and (unsigned(ch(i).trig) <= 12) then
+          if (trig_i(to_integer(unsigned(ch(i).trig))-1) = '1') then
+            ch(i).pend <= '1';
+          end if;
+        end if;
+      end loop; -- i
+
+      -- global disable: abort all channels --
+      if (enable = '0') then
+        for i in 0 to 3 loop
+          ch(i).busy <= '0';
+        end loop; -- i
+      end if;
+    end if;
+  end process dma_core;
+
+
+  -- Read Access ----------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  read_access: process(clk_i)
+  begin
+    if rising_edge(clk_i) then
+      ack_o  <= acc_en and (rden_i or wren_i);
+      data_o <= (others => '0');
+      if (rden = '1') then
+        case addr is
+          when dma_ctrl_addr_c =>
+            data_o(ctrl_en_c) <= enable;
+            data_o(ctrl_sel1_c downto ctrl_sel0_c) <= sel;
+            data_o(ctrl_irq3_c downto ctrl_irq0_c) <= irq_en;
+            data_o(ctrl_num_msb_c downto ctrl_num_lsb_c) <= std_ulogic_vector(to_unsigned(DMA_NUM_CH-1, 2));
+          when dma_stat_addr_c =>
+            for i in 0 to DMA_NUM_CH-1 loop
+              data_o(stat_done0_c + i) <= ch(i).done;
+              data_o(stat_err0_c  + i) <= ch(i).err;
+              data_o(stat_busy0_c + i) <= ch(i).busy;
+            end loop; -- i
+          when dma_src_addr_c =>
+            if (sel_ok = '1') then
+              data_o <= ch(to_integer(unsigned(sel))).src;
+            end if;
+          when dma_dst_addr_c =>
+            if (sel_ok = '1') then
+              data_o <= ch(to_integer(unsigned(sel))).dst;
+            end if;
+          when dma_cfg_addr_c =>
+            if (sel_ok = '1') then
+              data_o(cfg_num_msb_c downto cfg_num_lsb_c)     <= ch(to_integer(unsigned(sel))).num;
+              data_o(cfg_size_msb_c downto cfg_size_lsb_c)   <= ch(to_integer(unsigned(sel))).size;
+              data_o(cfg_src_inc_c)                          <= ch(to_integer(unsigned(sel))).src_inc;
+              data_o(cfg_dst_inc_c)                          <= ch(to_integer(unsigned(sel))).dst_inc;
+              data_o(cfg_burst_msb_c downto cfg_burst_lsb_c) <= ch(to_integer(unsigned(sel))).burst;
+              data_o(cfg_trig_msb_c downto cfg_trig_lsb_c)   <= ch(to_integer(unsigned(sel))).trig;
+              data_o(cfg_pend_c)                             <= ch(to_integer(unsigned(sel))).pend;
+              data_o(cfg_start_c)                            <= ch(to_integer(unsigned(sel))).busy;
+            end if;
+          when others =>
+            NULL;
+        end case;
+      end if;
+    end if;
+  end process read_access;
+
+
+end neorv32_dma_rtl;
@@ -41,18 +41,27 @@ use neorv32.neorv32_package.all;
 
 entity neorv32_dmem is
   generic (
-    DMEM_BASE : std_ulogic_vector(31 downto 0); -- memory base address
-    DMEM_SIZE : natural -- processor-internal instruction memory size in bytes
+    DMEM_BASE   : std_ulogic_vector(31 downto 0); -- memory base address
+    DMEM_SIZE   : natural; -- processor-internal instruction memory size in bytes
+    DMEM_TCM_EN : boolean  -- TCM port in use?
   );
   port (
-    clk_i  : in  std_ulogic; -- global clock line
-    rden_i : in  std_ulogic; -- read enable
-    wren_i : in  std_ulogic; -- write enable
-    ben_i  : in  std_ulogic_vector(03 downto 0); -- byte write enable
-    addr_i : in  std_ulogic_vector(31 downto 0); -- address
-    data_i : in  std_ulogic_vector(31 downto 0); -- data in
-    data_o : out std_ulogic_vector(31 downto 0); -- data out
-    ack_o  : out std_ulogic -- transfer acknowledge
+    clk_i      : in  std_ulogic; -- global clock line
+    -- processor bus --
+    rden_i     : in  std_ulogic; -- read enable
+    wren_i     : in  std_ulogic; -- write enable
+    ben_i      : in  std_ulogic_vector(03 downto 0); -- byte write enable
+    addr_i     : in  std_ulogic_vector(31 downto 0); -- address
+    data_i     : in  std_ulogic_vector(31 downto 0); -- data in
+    data_o     : out std_ulogic_vector(31 downto 0); -- data out
+    ack_o      : out std_ulogic; -- transfer acknowledge
+    -- tightly-coupled memory port (CPU load/store, fixed latency of one cycle) --
+    tcm_re_i   : in  std_ulogic := '0'; -- read enable
+    tcm_we_i   : in  std_ulogic := '0'; -- write enable
+    tcm_ben_i  : in  std_ulogic_vector(03 downto 0) := (others => '0'); -- byte write enable
+    tcm_addr_i : in  std_ulogic_vector(31 downto 0) := (others => '0'); -- address
+    tcm_data_i : in  std_ulogic_vector(31 downto 0) := (others => '0'); -- data in
+    tcm_data_o : out std_ulogic_vector(31 downto 0) -- data out
   );
 end neorv32_dmem;
 
@@ -68,19 +77,18 @@ architecture neorv32_dmem_rtl of neorv32_dmem is
   signal rden   : std_ulogic;
   signal addr   : std_ulogic_vector(index_size_f(DMEM_SIZE/4)-1 downto 0);
 
+  -- tightly-coupled memory port --
+  signal tcm_en   : std_ulogic;
+  signal tcm_addr : std_ulogic_vector(index_size_f(DMEM_SIZE/4)-1 downto 0);
+
   -- -------------------------------------------------------------------------------------------------------------- --
   -- The memory (RAM) is built from 4 individual byte-wide memories b0..b3, since some synthesis tools have         --
   -- problems with 32-bit memories that provide dedicated byte-enable signals AND/OR with multi-dimensional arrays. --
   -- -------------------------------------------------------------------------------------------------------------- --
 
-  -- RAM - not initialized at all --
-  signal mem_ram_b0 : mem8_t(0 to DMEM_SIZE/4-1);
-  signal mem_ram_b1 : mem8_t(0 to DMEM_SIZE/4-1);
-  signal mem_ram_b2 : mem8_t(0 to DMEM_SIZE/4-1);
-  signal mem_ram_b3 : mem8_t(0 to DMEM_SIZE/4-1);
-
   -- read data --
   signal mem_ram_b0_rd, mem_ram_b1_rd, mem_ram_b2_rd, mem_ram_b3_rd : std_ulogic_vector(7 downto 0);
+  signal tcm_ram_b0_rd, tcm_ram_b1_rd, tcm_ram_b2_rd, tcm_ram_b3_rd : std_ulogic_vector(7 downto 0);
 
 begin
 
@@ -94,38 +102,134 @@ begin
   acc_en <= '1' when (addr_i(hi_abb_c downto lo_abb_c) = DMEM_BASE(hi_abb_c downto lo_abb_c)) else '0';
   addr   <= addr_i(index_size_f(DMEM_SIZE/4)+1 downto 2); -- word aligned
 
+  -- the CPU's TCM port is already decoded by the CPU itself --
+  tcm_en   <= tcm_re_i or tcm_we_i;
+  tcm_addr <= tcm_addr_i(index_size_f(DMEM_SIZE/4)+1 downto 2); -- word aligned
+
 
-  -- Memory Access --------------------------------------------------------------------------
+  -- Memory Access (single-ported RAM) -----------------------------------------------------
   -- -------------------------------------------------------------------------------------------
-  mem_access: process(clk_i)
+  dmem_ram_sp:
+  if (DMEM_TCM_EN = false) generate
+
+    -- RAM - not initialized at all --
+    signal mem_ram_b0 : mem8_t(0 to DMEM_SIZE/4-1);
+    signal mem_ram_b1 : mem8_t(0 to DMEM_SIZE/4-1);
+    signal mem_ram_b2 : mem8_t(0 to DMEM_SIZE/4-1);
+    signal mem_ram_b3 : mem8_t(0 to DMEM_SIZE/4-1);
+
   begin
-    if rising_edge(clk_i) then
-      -- this RAM style should not require "no_rw_check" attributes as the read-after-write behavior
-      -- is intended to be defined implicitly via the if-WRITE-else-READ construct
-      if (acc_en = '1') then -- reduce switching activity when not accessed
-        if (wren_i = '1') and (ben_i(0) = '1') then -- byte 0
-          mem_ram_b0(to_integer(unsigned(addr))) <= data_i(07 downto 00);
-        else
-          mem_ram_b0_rd <= mem_ram_b0(to_integer(unsigned(addr)));
-        end if;
-        if (wren_i = '1') and (ben_i(1) = '1') then -- byte 1
-          mem_ram_b1(to_integer(unsigned(addr))) <= data_i(15 downto 08);
-        else
-          mem_ram_b1_rd <= mem_ram_b1(to_integer(unsigned(addr)));
+
+    mem_access: process(clk_i)
+    begin
+      if rising_edge(clk_i) then
+        -- this RAM style should not require "no_rw_check" attributes as the read-after-write behavior
+        -- is intended to be defined implicitly via the if-WRITE-else-READ construct
+        if (acc_en = '1') then -- reduce switching activity when not accessed
+          if (wren_i = '1') and (ben_i(0) = '1') then -- byte 0
+            mem_ram_b0(to_integer(unsigned(addr))) <= data_i(07 downto 00);
+          else
+            mem_ram_b0_rd <= mem_ram_b0(to_integer(unsigned(addr)));
+          end if;
+          if (wren_i = '1') and (ben_i(1) = '1') then -- byte 1
+            mem_ram_b1(to_integer(unsigned(addr))) <= data_i(15 downto 08);
+          else
+            mem_ram_b1_rd <= mem_ram_b1(to_integer(unsigned(addr)));
+          end if;
+          if (wren_i = '1') and (ben_i(2) = '1') then -- byte 2
+            mem_ram_b2(to_integer(unsigned(addr))) <= data_i(23 downto 16);
+          else
+            mem_ram_b2_rd <= mem_ram_b2(to_integer(unsigned(addr)));
+          end if;
+          if (wren_i = '1') and (ben_i(3) = '1') then -- byte 3
+            mem_ram_b3(to_integer(unsigned(addr))) <= data_i(31 downto 24);
+          else
+            mem_ram_b3_rd <= mem_ram_b3(to_integer(unsigned(addr)));
+          end if;
         end if;
-        if (wren_i = '1') and (ben_i(2) = '1') then -- byte 2
-          mem_ram_b2(to_integer(unsigned(addr))) <= data_i(23 downto 16);
-        else
-          mem_ram_b2_rd <= mem_ram_b2(to_integer(unsigned(addr)));
+      end if;
+    end process mem_access;
+
+    -- no TCM port --
+    tcm_ram_b0_rd <= (others => '0');
+    tcm_ram_b1_rd <= (others => '0');
+    tcm_ram_b2_rd <= (others => '0');
+    tcm_ram_b3_rd <= (others => '0');
+  end generate;
+
+
+  -- Memory Access (true dual-ported RAM) ---------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  dmem_ram_dp:
+  if (DMEM_TCM_EN = true) generate
+
+    -- RAM - not initialized at all --
+    -- (shared variables as both ports can write; this is the common true dual-port RAM inference template) --
+    shared variable mem_ram_b0 : mem8_t(0 to DMEM_SIZE/4-1);
+    shared variable mem_ram_b1 : mem8_t(0 to DMEM_SIZE/4-1);
+    shared variable mem_ram_b2 : mem8_t(0 to DMEM_SIZE/4-1);
+    shared variable mem_ram_b3 : mem8_t(0 to DMEM_SIZE/4-1);
+
+  begin
+
+    -- processor bus port --
+    mem_access: process(clk_i)
+    begin
+      if rising_edge(clk_i) then
+        if (acc_en = '1') then -- reduce switching activity when not accessed
+          if (wren_i = '1') and (ben_i(0) = '1') then -- byte 0
+            mem_ram_b0(to_integer(unsigned(addr))) := data_i(07 downto 00);
+          else
+            mem_ram_b0_rd <= mem_ram_b0(to_integer(unsigned(addr)));
+          end if;
+          if (wren_i = '1') and (ben_i(1) = '1') then -- byte 1
+            mem_ram_b1(to_integer(unsigned(addr))) := data_i(15 downto 08);
+          else
+            mem_ram_b1_rd <= mem_ram_b1(to_integer(unsigned(addr)));
+          end if;
+          if (wren_i = '1') and (ben_i(2) = '1') then -- byte 2
+            mem_ram_b2(to_integer(unsigned(addr))) := data_i(23 downto 16);
+          else
+            mem_ram_b2_rd <= mem_ram_b2(to_integer(unsigned(addr)));
+          end if;
+          if (wren_i = '1') and (ben_i(3) = '1') then -- byte 3
+            mem_ram_b3(to_integer(unsigned(addr))) := data_i(31 downto 24);
+          else
+            mem_ram_b3_rd <= mem_ram_b3(to_integer(unsigned(addr)));
+          end if;
         end if;
-        if (wren_i = '1') and (ben_i(3) = '1') then -- byte 3
-          mem_ram_b3(to_integer(unsigned(addr))) <= data_i(31 downto 24);
-        else
-          mem_ram_b3_rd <= mem_ram_b3(to_integer(unsigned(addr)));
+      end if;
+    end process mem_access;
+
+    -- tightly-coupled memory port (second read/write port) --
+    tcm_access: process(clk_i)
+    begin
+      if rising_edge(clk_i) then
+        if (tcm_en = '1') then
+          if (tcm_we_i = '1') and (tcm_ben_i(0) = '1') then -- byte 0
+            mem_ram_b0(to_integer(unsigned(tcm_addr))) := tcm_data_i(07 downto 00);
+          else
+            tcm_ram_b0_rd <= mem_ram_b0(to_integer(unsigned(tcm_addr)));
+          end if;
+          if (tcm_we_i = '1') and (tcm_ben_i(1) = '1') then -- byte 1
+            mem_ram_b1(to_integer(unsigned(tcm_addr))) := tcm_data_i(15 downto 08);
+          else
+            tcm_ram_b1_rd <= mem_ram_b1(to_integer(unsigned(tcm_addr)));
+          end if;
+          if (tcm_we_i = '1') and (tcm_ben_i(2) = '1') then -- byte 2
+            mem_ram_b2(to_integer(unsigned(tcm_addr))) := tcm_data_i(23 downto 16);
+          else
+            tcm_ram_b2_rd <= mem_ram_b2(to_integer(unsigned(tcm_addr)));
+          end if;
+          if (tcm_we_i = '1') and (tcm_ben_i(3) = '1') then -- byte 3
+            mem_ram_b3(to_integer(unsigned(tcm_addr))) := tcm_data_i(31 downto 24);
+          else
+            tcm_ram_b3_rd <= mem_ram_b3(to_integer(unsigned(tcm_addr)));
+          end if;
         end if;
       end if;
-    end if;
-  end process mem_access;
+    end process tcm_access;
+  end generate;
 
 
   -- Bus Feedback ---------------------------------------------------------------------------
@@ -144,5 +248,8 @@ begin
   -- output gate --
   data_o <= rdata when (rden = '1') else (others => '0');
 
+  -- TCM port: no output gate, the CPU only samples the data when it has issued a TCM request --
+  tcm_data_o <= tcm_ram_b3_rd & tcm_ram_b2_rd & tcm_ram_b1_rd & tcm_ram_b0_rd;
+
 
 end neorv32_dmem_rtl;
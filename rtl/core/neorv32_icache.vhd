@@ -1,8 +1,17 @@
 -- #################################################################################################
 -- # << NEORV32 - Processor-Internal Instruction Cache >>                                          #
 -- # ********************************************************************************************* #
--- # Direct mapped (ICACHE_NUM_SETS = 1) or 2-way set-associative (ICACHE_NUM_SETS = 2).           #
--- # Least recently used replacement policy (if ICACHE_NUM_SETS > 1).                              #
+-- # Direct mapped (ICACHE_NUM_SETS = 1) or 2/4/8-way set-associative (ICACHE_NUM_SETS = 2/4/8).   #
+-- # Replacement policy (if ICACHE_NUM_SETS > 1): least recently used (LRU; tree pseudo-LRU for    #
+-- # more than 2 ways) or random. Invalid ways are always replaced first.                          #
+-- # Critical-word-first block refill: the requested word is forwarded to the host as soon as it   #
+-- # arrives; further requests to the block being refilled are served while the download is still  #
+-- # in progress ("hit-under-miss"); all other requests are processed after the refill.            #
+-- # Optional sequential next-line prefetcher: after a block refill the next block is downloaded   #
+-- # to a stream buffer in the background. It is moved to the cache if it is actually needed.      #
+-- # Cache locking: blocks can be preloaded (and locked) by software via custom CSRs. Locked blocks#
+-- # are never replaced and are not invalidated by cache clear (fence.i) operations. Misses to an  #
+-- # index where all ways are locked are served directly from main memory (no allocation).         #
 -- # ********************************************************************************************* #
 -- # BSD 3-Clause License                                                                          #
 -- #                                                                                               #
@@ -44,15 +53,24 @@ use neorv32.neorv32_package.all;
 
 entity neorv32_icache is
   generic (
-    ICACHE_NUM_BLOCKS : natural; -- number of blocks (min 1), has to be a power of 2
-    ICACHE_BLOCK_SIZE : natural; -- block size in bytes (min 4), has to be a power of 2
-    ICACHE_NUM_SETS   : natural  -- associativity / number of sets (1=direct_mapped), has to be a power of 2
+    ICACHE_NUM_BLOCKS  : natural; -- number of blocks (min 1), has to be a power of 2
+    ICACHE_BLOCK_SIZE  : natural; -- block size in bytes (min 4), has to be a power of 2
+    ICACHE_NUM_SETS    : natural; -- associativity / number of sets (1=direct_mapped), has to be a power of 2
+    ICACHE_REPLACEMENT : natural; -- replacement policy: 0 = (pseudo-)LRU, 1 = random
+    ICACHE_PREFETCH    : boolean  -- implement next-line prefetcher
   );
   port (
     -- global control --
     clk_i         : in  std_ulogic; -- global clock, rising edge
     rstn_i        : in  std_ulogic; -- global reset, low-active, async
     clear_i       : in  std_ulogic; -- cache clear
+    hpm_ev_o      : out std_ulogic_vector(03 downto 0); -- HPM events: 0 = useful prefetch, 1 = useless prefetch, 2 = access, 3 = miss
+    -- cache locking --
+    lock_i        : in  std_ulogic; -- lock preloaded blocks
+    unlock_i      : in  std_ulogic; -- unlock all blocks
+    preload_i     : in  std_ulogic; -- preload block request
+    preload_adr_i : in  std_ulogic_vector(data_width_c-1 downto 0); -- preload address
+    stat_o        : out std_ulogic_vector(01 downto 0); -- status: 0 = preload in progress, 1 = preload failed
     -- host controller interface --
     host_addr_i   : in  std_ulogic_vector(data_width_c-1 downto 0); -- bus access address
     host_rdata_o  : out std_ulogic_vector(data_width_c-1 downto 0); -- bus read data
@@ -84,20 +102,23 @@ architecture neorv32_icache_rtl of neorv32_icache is
   -- cache memory --
   component neorv32_icache_memory
   generic (
-    ICACHE_NUM_BLOCKS : natural := 4;  -- number of blocks (min 1), has to be a power of 2
-    ICACHE_BLOCK_SIZE : natural := 16; -- block size in bytes (min 4), has to be a power of 2
-    ICACHE_NUM_SETS   : natural := 1   -- associativity; 0=direct-mapped, 1=2-way set-associative
+    ICACHE_NUM_BLOCKS  : natural := 4;  -- number of blocks (min 1), has to be a power of 2
+    ICACHE_BLOCK_SIZE  : natural := 16; -- block size in bytes (min 4), has to be a power of 2
+    ICACHE_NUM_SETS    : natural := 1;  -- associativity; 1=direct-mapped, 2/4/8=n-way set-associative
+    ICACHE_REPLACEMENT : natural := 0   -- replacement policy; 0=(pseudo-)LRU, 1=random
   );
   port (
     -- global control --
     clk_i          : in  std_ulogic; -- global clock, rising edge
-    invalidate_i   : in  std_ulogic; -- invalidate whole cache
+    invalidate_i   : in  std_ulogic; -- invalidate whole cache (except locked blocks)
+    unlock_i       : in  std_ulogic; -- unlock all blocks
     -- host cache access (read-only) --
     host_addr_i    : in  std_ulogic_vector(31 downto 0); -- access address
     host_re_i      : in  std_ulogic; -- read enable
     host_rdata_o   : out std_ulogic_vector(31 downto 0); -- read data
     -- access status (1 cycle delay to access) --
     hit_o          : out std_ulogic; -- hit access
+    nalloc_o       : out std_ulogic; -- no way available for allocation (all ways locked)
     -- ctrl cache access (write-only) --
     ctrl_en_i      : in  std_ulogic; -- control interface enable
     ctrl_addr_i    : in  std_ulogic_vector(31 downto 0); -- access address
@@ -105,6 +126,7 @@ architecture neorv32_icache_rtl of neorv32_icache is
     ctrl_wdata_i   : in  std_ulogic_vector(31 downto 0); -- write data
     ctrl_tag_we_i  : in  std_ulogic; -- write tag to selected block
     ctrl_valid_i   : in  std_ulogic; -- make selected block valid
+    ctrl_lock_i    : in  std_ulogic; -- lock selected block when making it valid
     ctrl_invalid_i : in  std_ulogic  -- make selected block invalid
   );
   end component;
@@ -117,6 +139,7 @@ architecture neorv32_icache_rtl of neorv32_icache is
     host_rdata      : std_ulogic_vector(31 downto 0); -- cpu read data
     --
     hit             : std_ulogic; -- hit access
+    nalloc          : std_ulogic; -- no way available for allocation
     --
     ctrl_en         : std_ulogic; -- control access enable
     ctrl_addr       : std_ulogic_vector(31 downto 0); -- control access address
@@ -125,26 +148,60 @@ architecture neorv32_icache_rtl of neorv32_icache is
     ctrl_tag_we     : std_ulogic; -- control tag write enabled
     ctrl_valid_we   : std_ulogic; -- control valid flag set
     ctrl_invalid_we : std_ulogic; -- control valid flag clear
+    ctrl_lock       : std_ulogic; -- control lock block
   end record;
   signal cache : cache_if_t;
 
   -- control engine --
   type ctrl_engine_state_t is (S_IDLE, S_CACHE_CLEAR, S_CACHE_CHECK, S_CACHE_MISS, S_BUS_DOWNLOAD_REQ, S_BUS_DOWNLOAD_GET,
-                               S_CACHE_RESYNC_0, S_CACHE_RESYNC_1, S_BUS_ERROR);
+                               S_PF_COPY, S_BYPASS_REQ, S_BYPASS_GET, S_PL_START, S_PL_CHECK, S_BUS_ERROR);
   type ctrl_t is record
     state         : ctrl_engine_state_t; -- current state
     state_nxt     : ctrl_engine_state_t; -- next state
     addr_reg      : std_ulogic_vector(31 downto 0); -- address register for block download
     addr_reg_nxt  : std_ulogic_vector(31 downto 0);
+    cnt           : std_ulogic_vector(cache_offset_size_c-1 downto 0); -- number of downloaded words
+    cnt_nxt       : std_ulogic_vector(cache_offset_size_c-1 downto 0);
     --
     re_buf        : std_ulogic; -- read request buffer
     re_buf_nxt    : std_ulogic;
     --
     clear_buf     : std_ulogic; -- clear request buffer
     clear_buf_nxt : std_ulogic;
+    --
+    pl_buf        : std_ulogic; -- preload request buffer
+    pl_buf_nxt    : std_ulogic;
+    pl_act        : std_ulogic; -- preload in progress
+    pl_act_nxt    : std_ulogic;
+    pl_fail       : std_ulogic; -- preload failed
+    pl_fail_nxt   : std_ulogic;
+    pl_addr       : std_ulogic_vector(31 downto 0); -- preload address
+    pl_lock       : std_ulogic; -- lock preloaded block
   end record;
   signal ctrl : ctrl_t;
 
+  -- next-line prefetcher --
+  type pf_buf_t is array (0 to ICACHE_BLOCK_SIZE/4-1) of std_ulogic_vector(31 downto 0);
+  type pf_t is record
+    valid      : std_ulogic; -- stream buffer is assigned to a block
+    busy       : std_ulogic; -- block download in progress
+    pend       : std_ulogic; -- bus transfer pending
+    tag        : std_ulogic_vector(31 downto 2+cache_offset_size_c); -- block address
+    addr       : std_ulogic_vector(31 downto 0); -- download address
+    wvalid     : std_ulogic_vector(ICACHE_BLOCK_SIZE/4-1 downto 0); -- word valid flags
+    re         : std_ulogic; -- bus read request
+    rdata      : std_ulogic_vector(31 downto 0); -- stream buffer read data
+    -- control engine interface --
+    start      : std_ulogic; -- start prefetch of next block
+    stop       : std_ulogic; -- abort prefetch and discard stream buffer
+    hit        : std_ulogic; -- stream buffer has been moved to cache
+    -- HPM events --
+    ev_useful  : std_ulogic;
+    ev_useless : std_ulogic;
+  end record;
+  signal pf     : pf_t;
+  signal pf_buf : pf_buf_t;
+
 begin
 
   -- Sanity Checks --------------------------------------------------------------------------
@@ -155,7 +212,8 @@ begin
   assert not ((is_power_of_two_f(ICACHE_NUM_SETS) = false)) report "NEORV32 PROCESSOR CONFIG ERROR! i-cache associativity <ICACHE_NUM_SETS> has to be a power of 2." severity error;
   assert not (ICACHE_NUM_BLOCKS < 1) report "NEORV32 PROCESSOR CONFIG ERROR! i-cache number of blocks <ICACHE_NUM_BLOCKS> has to be >= 1." severity error;
   assert not (ICACHE_BLOCK_SIZE < 4) report "NEORV32 PROCESSOR CONFIG ERROR! i-cache block size <ICACHE_BLOCK_SIZE> has to be >= 4." severity error;
-  assert not ((ICACHE_NUM_SETS = 0) or (ICACHE_NUM_SETS > 2)) report "NEORV32 PROCESSOR CONFIG ERROR! i-cache associativity <ICACHE_NUM_SETS> has to be 1 (direct-mapped) or 2 (2-way set-associative)." severity error;
+  assert not ((ICACHE_NUM_SETS = 0) or (ICACHE_NUM_SETS > 8)) report "NEORV32 PROCESSOR CONFIG ERROR! i-cache associativity <ICACHE_NUM_SETS> has to be 1 (direct-mapped), 2, 4 or 8 (n-way set-associative)." severity error;
+  assert not (ICACHE_REPLACEMENT > 1) report "NEORV32 PROCESSOR CONFIG ERROR! i-cache replacement policy <ICACHE_REPLACEMENT> has to be 0 (LRU) or 1 (random)." severity error;
 
 
   -- Control Engine FSM Sync ----------------------------------------------------------------
@@ -167,10 +225,16 @@ begin
       ctrl.state     <= S_CACHE_CLEAR;
       ctrl.re_buf    <= '0';
       ctrl.clear_buf <= '0';
+      ctrl.pl_buf    <= '0';
+      ctrl.pl_act    <= '0';
+      ctrl.pl_fail   <= '0';
     elsif rising_edge(clk_i) then
       ctrl.state     <= ctrl.state_nxt;
       ctrl.re_buf    <= ctrl.re_buf_nxt;
       ctrl.clear_buf <= ctrl.clear_buf_nxt;
+      ctrl.pl_buf    <= ctrl.pl_buf_nxt;
+      ctrl.pl_act    <= ctrl.pl_act_nxt;
+      ctrl.pl_fail   <= ctrl.pl_fail_nxt;
     end if;
   end process ctrl_engine_fsm_sync_rst;
 
@@ -179,19 +243,33 @@ begin
   begin
     if rising_edge(clk_i) then
       ctrl.addr_reg <= ctrl.addr_reg_nxt;
+      ctrl.cnt      <= ctrl.cnt_nxt;
+      if (preload_i = '1') then -- buffer preload request
+        ctrl.pl_addr <= preload_adr_i;
+        ctrl.pl_lock <= lock_i;
+      end if;
     end if;
   end process ctrl_engine_fsm_sync;
 
 
   -- Control Engine FSM Comb ----------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
-  ctrl_engine_fsm_comb: process(ctrl, cache, clear_i, host_addr_i, host_re_i, bus_rdata_i, bus_ack_i, bus_err_i)
+  ctrl_engine_fsm_comb: process(ctrl, cache, pf, clear_i, preload_i, host_addr_i, host_re_i, bus_rdata_i, bus_ack_i, bus_err_i)
   begin
     -- control defaults --
     ctrl.state_nxt        <= ctrl.state;
     ctrl.addr_reg_nxt     <= ctrl.addr_reg;
+    ctrl.cnt_nxt          <= ctrl.cnt;
     ctrl.re_buf_nxt       <= ctrl.re_buf or host_re_i;
     ctrl.clear_buf_nxt    <= ctrl.clear_buf or clear_i; -- buffer clear request from CPU
+    ctrl.pl_buf_nxt       <= ctrl.pl_buf or preload_i; -- buffer preload request from CPU
+    ctrl.pl_act_nxt       <= ctrl.pl_act;
+    ctrl.pl_fail_nxt      <= ctrl.pl_fail and (not preload_i); -- cleared by new preload request
+
+    -- prefetcher defaults --
+    pf.start              <= '0';
+    pf.stop               <= '0';
+    pf.hit                <= '0';
 
     -- cache defaults --
     cache.clear           <= '0';
@@ -203,6 +281,7 @@ begin
     cache.ctrl_tag_we     <= '0';
     cache.ctrl_valid_we   <= '0';
     cache.ctrl_invalid_we <= '0';
+    cache.ctrl_lock       <= ctrl.pl_act and ctrl.pl_lock;
 
     -- host interface defaults --
     host_ack_o            <= '0';
@@ -210,11 +289,15 @@ begin
     host_rdata_o          <= cache.host_rdata;
 
     -- peripheral bus interface defaults --
-    bus_addr_o            <= ctrl.addr_reg;
+    if (pf.busy = '1') or (pf.pend = '1') then -- bus is used by prefetcher
+      bus_addr_o          <= pf.addr;
+    else
+      bus_addr_o          <= ctrl.addr_reg;
+    end if;
     bus_wdata_o           <= (others => '0'); -- cache is read-only
     bus_ben_o             <= (others => '0'); -- cache is read-only
     bus_we_o              <= '0'; -- cache is read-only
-    bus_re_o              <= '0';
+    bus_re_o              <= pf.re;
 
     -- fsm --
     case ctrl.state is
@@ -223,6 +306,11 @@ begin
       -- ------------------------------------------------------------
         if (ctrl.clear_buf = '1') then -- cache control operation?
           ctrl.state_nxt <= S_CACHE_CLEAR;
+        elsif (ctrl.pl_buf = '1') then -- block preload request?
+          ctrl.addr_reg_nxt <= ctrl.pl_addr(31 downto 2+cache_offset_size_c) & std_ulogic_vector(to_unsigned(0, cache_offset_size_c+2)); -- block-aligned
+          ctrl.pl_buf_nxt   <= '0';
+          ctrl.pl_act_nxt   <= '1';
+          ctrl.state_nxt    <= S_PL_START;
         elsif (host_re_i = '1') or (ctrl.re_buf = '1') then -- cache access
           ctrl.re_buf_nxt <= '0';
           ctrl.state_nxt  <= S_CACHE_CHECK;
@@ -243,14 +331,26 @@ begin
           ctrl.state_nxt <= S_CACHE_MISS;
         end if;
 
-      when S_CACHE_MISS => -- 
+      when S_CACHE_MISS => -- start block download with the requested ("critical") word
       -- ------------------------------------------------------------
-        -- compute block base address --
         ctrl.addr_reg_nxt <= host_addr_i;
-        ctrl.addr_reg_nxt((2+cache_offset_size_c)-1 downto 2) <= (others => '0'); -- block-aligned
         ctrl.addr_reg_nxt(1 downto 0) <= "00"; -- word-aligned
+        ctrl.cnt_nxt      <= (others => '0');
+        ctrl.re_buf_nxt   <= '1'; -- host request is still pending
         --
-        ctrl.state_nxt <= S_BUS_DOWNLOAD_REQ;
+        if (cache.nalloc = '1') then -- all ways locked: get requested word without allocating a block
+          pf.stop <= '1'; -- discard stream buffer
+          if (pf.pend = '0') then -- wait for pending prefetch transfer to complete
+            ctrl.state_nxt <= S_BYPASS_REQ;
+          end if;
+        elsif (ICACHE_PREFETCH = true) and (pf.valid = '1') and (pf.tag = host_addr_i(31 downto 2+cache_offset_size_c)) then -- block is in stream buffer
+          ctrl.state_nxt <= S_PF_COPY;
+        else
+          pf.stop <= '1'; -- discard stream buffer
+          if (pf.pend = '0') then -- wait for pending prefetch transfer to complete
+            ctrl.state_nxt <= S_BUS_DOWNLOAD_REQ;
+          end if;
+        end if;
 
       when S_BUS_DOWNLOAD_REQ => -- download new cache block: request new word
       -- ------------------------------------------------------------
@@ -263,29 +363,103 @@ begin
         cache.ctrl_en <= '1'; -- we are in cache control mode
         --
         if (bus_err_i = '1') then -- bus error
-          ctrl.state_nxt <= S_BUS_ERROR;
+          ctrl.pl_act_nxt  <= '0';
+          ctrl.pl_fail_nxt <= ctrl.pl_act; -- preload failed
+          if (ctrl.re_buf = '1') and (host_addr_i(31 downto 2) = ctrl.addr_reg(31 downto 2)) then -- pending host request affected?
+            ctrl.re_buf_nxt <= '0';
+            ctrl.state_nxt  <= S_BUS_ERROR;
+          else -- abort download (block remains invalid), pending host request will be re-checked
+            ctrl.state_nxt  <= S_IDLE;
+          end if;
         elsif (bus_ack_i = '1') then -- ACK = write to cache and get next word
           cache.ctrl_we <= '1'; -- write to cache
-          if (and_reduce_f(ctrl.addr_reg((2+cache_offset_size_c)-1 downto 2)) = '1') then -- block complete?
+          -- forward word to host if there is a buffered request for exactly this word --
+          -- (a request arriving in this cycle is not served: the CPU ignores an ACK in its request cycle) --
+          if (ctrl.re_buf = '1') and (host_addr_i(31 downto 2) = ctrl.addr_reg(31 downto 2)) then
+            host_rdata_o    <= bus_rdata_i;
+            host_ack_o      <= '1';
+            ctrl.re_buf_nxt <= '0';
+          end if;
+          -- next word (wrap-around within block) --
+          ctrl.addr_reg_nxt((2+cache_offset_size_c)-1 downto 2) <= std_ulogic_vector(unsigned(ctrl.addr_reg((2+cache_offset_size_c)-1 downto 2)) + 1);
+          ctrl.cnt_nxt <= std_ulogic_vector(unsigned(ctrl.cnt) + 1);
+          if (and_reduce_f(ctrl.cnt) = '1') then -- block complete?
             cache.ctrl_tag_we   <= '1'; -- current block is valid now
             cache.ctrl_valid_we <= '1'; -- write tag of current address
-            ctrl.state_nxt      <= S_CACHE_RESYNC_0;
+            pf.start            <= bool_to_ulogic_f(ICACHE_PREFETCH) and (not ctrl.pl_act); -- prefetch next block (not for preloads)
+            ctrl.pl_act_nxt     <= '0'; -- preload done
+            ctrl.state_nxt      <= S_IDLE; -- still pending host requests will hit the cache now
           else -- get next word
-            ctrl.addr_reg_nxt <= std_ulogic_vector(unsigned(ctrl.addr_reg) + 4);
-            ctrl.state_nxt    <= S_BUS_DOWNLOAD_REQ;
+            ctrl.state_nxt      <= S_BUS_DOWNLOAD_REQ;
           end if;
         end if;
 
-      when S_CACHE_RESYNC_0 => -- re-sync host/cache access: cache read-latency
+      when S_PF_COPY => -- move block from stream buffer to cache
       -- ------------------------------------------------------------
-        ctrl.state_nxt <= S_CACHE_RESYNC_1;
+        cache.ctrl_en    <= '1'; -- we are in cache control mode
+        cache.ctrl_wdata <= pf.rdata;
+        --
+        if (pf.valid = '0') then -- prefetch has been aborted (bus error or cache clear)
+          ctrl.state_nxt <= S_IDLE; -- block remains invalid, pending host request will be re-checked
+        elsif (pf.wvalid(to_integer(unsigned(ctrl.addr_reg((2+cache_offset_size_c)-1 downto 2)))) = '1') then -- word available?
+          cache.ctrl_we <= '1'; -- write to cache
+          -- forward word to host if there is a buffered request for exactly this word --
+          -- (a request arriving in this cycle is not served: the CPU ignores an ACK in its request cycle) --
+          if (ctrl.re_buf = '1') and (host_addr_i(31 downto 2) = ctrl.addr_reg(31 downto 2)) then
+            host_rdata_o    <= pf.rdata;
+            host_ack_o      <= '1';
+            ctrl.re_buf_nxt <= '0';
+          end if;
+          -- next word (wrap-around within block) --
+          ctrl.addr_reg_nxt((2+cache_offset_size_c)-1 downto 2) <= std_ulogic_vector(unsigned(ctrl.addr_reg((2+cache_offset_size_c)-1 downto 2)) + 1);
+          ctrl.cnt_nxt <= std_ulogic_vector(unsigned(ctrl.cnt) + 1);
+          if (and_reduce_f(ctrl.cnt) = '1') then -- block complete?
+            cache.ctrl_tag_we   <= '1'; -- current block is valid now
+            cache.ctrl_valid_we <= '1'; -- write tag of current address
+            pf.hit              <= '1'; -- stream buffer was useful
+            pf.start            <= '1'; -- prefetch next block
+            ctrl.state_nxt      <= S_IDLE;
+          end if;
+        end if;
 
-      when S_CACHE_RESYNC_1 => -- re-sync host/cache access: finalize CPU request
+      when S_BYPASS_REQ => -- uncached access: request requested word
       -- ------------------------------------------------------------
-        host_ack_o     <= '1';
-        ctrl.state_nxt <= S_IDLE;
+        bus_re_o       <= '1';
+        ctrl.state_nxt <= S_BYPASS_GET;
+
+      when S_BYPASS_GET => -- uncached access: wait for bus response and forward to host
+      -- ------------------------------------------------------------
+        host_rdata_o <= bus_rdata_i;
+        if (bus_err_i = '1') then
+          ctrl.re_buf_nxt <= '0';
+          ctrl.state_nxt  <= S_BUS_ERROR;
+        elsif (bus_ack_i = '1') then
+          host_ack_o      <= '1';
+          ctrl.re_buf_nxt <= '0';
+          ctrl.state_nxt  <= S_IDLE;
+        end if;
 
-      when S_BUS_ERROR => -- bus error during download
+      when S_PL_START => -- block preload: read status of addressed cache line
+      -- ------------------------------------------------------------
+        cache.host_addr <= ctrl.addr_reg;
+        ctrl.state_nxt  <= S_PL_CHECK;
+
+      when S_PL_CHECK => -- block preload: (re-)load block if there is a way available
+      -- ------------------------------------------------------------
+        cache.host_addr <= ctrl.addr_reg; -- cache memory selects the hit way (if any) for replacement
+        ctrl.cnt_nxt    <= (others => '0');
+        if (cache.nalloc = '1') then -- all ways locked by other blocks
+          ctrl.pl_act_nxt  <= '0';
+          ctrl.pl_fail_nxt <= '1';
+          ctrl.state_nxt   <= S_IDLE;
+        else
+          pf.stop <= '1'; -- discard stream buffer
+          if (pf.pend = '0') then -- wait for pending prefetch transfer to complete
+            ctrl.state_nxt <= S_BUS_DOWNLOAD_REQ;
+          end if;
+        end if;
+
+      when S_BUS_ERROR => -- bus error during download of requested word
       -- ------------------------------------------------------------
         host_err_o     <= '1';
         ctrl.state_nxt <= S_IDLE;
@@ -298,24 +472,119 @@ begin
   end process ctrl_engine_fsm_comb;
 
 
-	-- Cache Memory ---------------------------------------------------------------------------
+  -- Next-Line Prefetcher -------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  prefetch_engine: process(rstn_i, clk_i)
+  begin
+    if (rstn_i = '0') then
+      pf.valid      <= '0';
+      pf.busy       <= '0';
+      pf.pend       <= '0';
+      pf.tag        <= (others => def_rst_val_c);
+      pf.addr       <= (others => def_rst_val_c);
+      pf.wvalid     <= (others => '0');
+      pf.ev_useful  <= '0';
+      pf.ev_useless <= '0';
+    elsif rising_edge(clk_i) then
+      -- bus transfer --
+      if (pf.re = '1') then
+        pf.pend <= '1';
+      elsif (bus_ack_i = '1') or (bus_err_i = '1') then
+        pf.pend <= '0';
+      end if;
+
+      -- HPM events --
+      pf.ev_useful  <= pf.hit;
+      pf.ev_useless <= (pf.stop or clear_i) and pf.valid; -- discard prefetched block that was not used
+
+      -- stream buffer control --
+      if (pf.stop = '1') or (clear_i = '1') then -- abort
+        pf.valid <= '0';
+        pf.busy  <= '0';
+      elsif (pf.start = '1') then -- start download of next sequential block
+        pf.valid  <= '1';
+        pf.busy   <= '1';
+        pf.tag    <= std_ulogic_vector(unsigned(ctrl.addr_reg(31 downto 2+cache_offset_size_c)) + 1);
+        pf.addr   <= std_ulogic_vector(unsigned(ctrl.addr_reg(31 downto 2+cache_offset_size_c)) + 1) & std_ulogic_vector(to_unsigned(0, cache_offset_size_c+2));
+        pf.wvalid <= (others => '0');
+      elsif (pf.hit = '1') then -- moved to cache
+        pf.valid <= '0';
+      elsif (pf.busy = '1') and (pf.pend = '1') then
+        if (bus_err_i = '1') then -- discard whole block
+          pf.valid <= '0';
+          pf.busy  <= '0';
+        elsif (bus_ack_i = '1') then
+          pf.wvalid(to_integer(unsigned(pf.addr((2+cache_offset_size_c)-1 downto 2)))) <= '1';
+          pf.addr <= std_ulogic_vector(unsigned(pf.addr) + 4);
+          if (and_reduce_f(pf.addr((2+cache_offset_size_c)-1 downto 2)) = '1') then -- block complete?
+            pf.busy <= '0';
+          end if;
+        end if;
+      end if;
+    end if;
+  end process prefetch_engine;
+
+  -- bus read request (the control engine only accesses the bus when the prefetcher is idle) --
+  pf.re <= pf.busy and (not pf.pend) and (not pf.stop) and (not clear_i);
+
+  -- stream buffer --
+  prefetch_buffer: process(clk_i)
+  begin
+    if rising_edge(clk_i) then
+      if (pf.busy = '1') and (pf.pend = '1') and (bus_ack_i = '1') then
+        pf_buf(to_integer(unsigned(pf.addr((2+cache_offset_size_c)-1 downto 2)))) <= bus_rdata_i;
+      end if;
+    end if;
+  end process prefetch_buffer;
+
+  -- stream buffer read access (async) --
+  pf.rdata <= pf_buf(to_integer(unsigned(ctrl.addr_reg((2+cache_offset_size_c)-1 downto 2))));
+
+  -- HPM events --
+  hpm_ev_o(0) <= pf.ev_useful;
+  hpm_ev_o(1) <= pf.ev_useless;
+
+  -- cache locking status --
+  stat_o(0) <= ctrl.pl_buf or ctrl.pl_act; -- preload in progress
+  stat_o(1) <= ctrl.pl_fail; -- last preload failed (no way available or bus error)
+
+
+  -- Cache Statistics -----------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  cache_statistics: process(clk_i)
+  begin
+    if rising_edge(clk_i) then
+      hpm_ev_o(2) <= host_re_i; -- cache access
+      if (ctrl.state = S_CACHE_CHECK) and (cache.hit = '0') then -- cache miss (block refill)
+        hpm_ev_o(3) <= '1';
+      else
+        hpm_ev_o(3) <= '0';
+      end if;
+    end if;
+  end process cache_statistics;
+
+
+  -- Cache Memory ---------------------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
   neorv32_icache_memory_inst: neorv32_icache_memory
   generic map (
-    ICACHE_NUM_BLOCKS => ICACHE_NUM_BLOCKS,     -- number of blocks (min 1), has to be a power of 2
-    ICACHE_BLOCK_SIZE => ICACHE_BLOCK_SIZE,     -- block size in bytes (min 4), has to be a power of 2
-    ICACHE_NUM_SETS   => ICACHE_NUM_SETS        -- associativity; 0=direct-mapped, 1=2-way set-associative
+    ICACHE_NUM_BLOCKS  => ICACHE_NUM_BLOCKS,    -- number of blocks (min 1), has to be a power of 2
+    ICACHE_BLOCK_SIZE  => ICACHE_BLOCK_SIZE,    -- block size in bytes (min 4), has to be a power of 2
+    ICACHE_NUM_SETS    => ICACHE_NUM_SETS,      -- associativity; 1=direct-mapped, 2/4/8=n-way set-associative
+    ICACHE_REPLACEMENT => ICACHE_REPLACEMENT    -- replacement policy; 0=(pseudo-)LRU, 1=random
   )
   port map (
     -- global control --
     clk_i            => clk_i,                -- global clock, rising edge
-    invalidate_i     => cache.clear,          -- invalidate whole cache
+    invalidate_i     => cache.clear,          -- invalidate whole cache (except locked blocks)
+    unlock_i         => unlock_i,             -- unlock all blocks
     -- host cache access (read-only)          --
     host_addr_i      => cache.host_addr,      -- access address
     host_re_i        => host_re_i,            -- read enable
     host_rdata_o     => cache.host_rdata,     -- read data
     -- access status (1 cycle delay to access) --
     hit_o            => cache.hit,            -- hit access
+    nalloc_o         => cache.nalloc,         -- no way available for allocation
     -- ctrl cache access (write-only) --
     ctrl_en_i        => cache.ctrl_en,        -- control interface enable
     ctrl_addr_i      => cache.ctrl_addr,      -- access address
@@ -323,6 +592,7 @@ begin
     ctrl_wdata_i     => cache.ctrl_wdata,     -- write data
     ctrl_tag_we_i    => cache.ctrl_tag_we,    -- write tag to selected block
     ctrl_valid_i     => cache.ctrl_valid_we,  -- make selected block valid
+    ctrl_lock_i      => cache.ctrl_lock,      -- lock selected block when making it valid
     ctrl_invalid_i   => cache.ctrl_invalid_we -- make selected block invalid
   );
 
@@ -336,8 +606,10 @@ end neorv32_icache_rtl;
 -- #################################################################################################
 -- # << NEORV32 - Cache Memory >>                                                                  #
 -- # ********************************************************************************************* #
--- # Direct mapped (ICACHE_NUM_SETS = 1) or 2-way set-associative (ICACHE_NUM_SETS = 2).           #
--- # Least recently used replacement policy (if ICACHE_NUM_SETS > 1).                              #
+-- # Direct mapped (ICACHE_NUM_SETS = 1) or 2/4/8-way set-associative (ICACHE_NUM_SETS = 2/4/8).   #
+-- # Replacement policy (if ICACHE_NUM_SETS > 1): least recently used (LRU; tree pseudo-LRU for    #
+-- # more than 2 ways) or random. Invalid ways are always replaced first. Locked blocks are never  #
+-- # replaced and are not affected by invalidation.                                                #
 -- # Read-only for host, write-only for control. All output signals have one cycle latency.        #
 -- #                                                                                               #
 -- # Cache sets are mapped to individual memory components - no multi-dimensional memory arrays    #
@@ -383,20 +655,23 @@ use neorv32.neorv32_package.all;
 
 entity neorv32_icache_memory is
   generic (
-    ICACHE_NUM_BLOCKS : natural := 4;  -- number of blocks (min 1), has to be a power of 2
-    ICACHE_BLOCK_SIZE : natural := 16; -- block size in bytes (min 4), has to be a power of 2
-    ICACHE_NUM_SETS   : natural := 1   -- associativity; 1=direct-mapped, 2=2-way set-associative
+    ICACHE_NUM_BLOCKS  : natural := 4;  -- number of blocks (min 1), has to be a power of 2
+    ICACHE_BLOCK_SIZE  : natural := 16; -- block size in bytes (min 4), has to be a power of 2
+    ICACHE_NUM_SETS    : natural := 1;  -- associativity; 1=direct-mapped, 2/4/8=n-way set-associative
+    ICACHE_REPLACEMENT : natural := 0   -- replacement policy; 0=(pseudo-)LRU, 1=random
   );
   port (
     -- global control --
     clk_i            : in  std_ulogic; -- global clock, rising edge
-    invalidate_i     : in  std_ulogic; -- invalidate whole cache
+    invalidate_i     : in  std_ulogic; -- invalidate whole cache (except locked blocks)
+    unlock_i         : in  std_ulogic; -- unlock all blocks
     -- host cache access (read-only) --
     host_addr_i      : in  std_ulogic_vector(31 downto 0); -- access address
     host_re_i        : in  std_ulogic; -- read enable
     host_rdata_o     : out std_ulogic_vector(31 downto 0); -- read data
     -- access status (1 cycle delay to access) --
     hit_o            : out std_ulogic; -- hit access
+    nalloc_o         : out std_ulogic; -- no way available for allocation (all ways locked)
     -- ctrl cache access (write-only) --
     ctrl_en_i        : in  std_ulogic; -- control interface enable
     ctrl_addr_i      : in  std_ulogic_vector(31 downto 0); -- access address
@@ -404,6 +679,7 @@ entity neorv32_icache_memory is
     ctrl_wdata_i     : in  std_ulogic_vector(31 downto 0); -- write data
     ctrl_tag_we_i    : in  std_ulogic; -- write tag to selected block
     ctrl_valid_i     : in  std_ulogic; -- make selected block valid
+    ctrl_lock_i      : in  std_ulogic; -- lock selected block when making it valid
     ctrl_invalid_i   : in  std_ulogic  -- make selected block invalid
   );
 end neorv32_icache_memory;
@@ -415,21 +691,21 @@ architecture neorv32_icache_memory_rtl of neorv32_icache_memory is
   constant cache_index_size_c  : natural := index_size_f(ICACHE_NUM_BLOCKS);
   constant cache_tag_size_c    : natural := 32 - (cache_offset_size_c + cache_index_size_c + 2); -- 2 additonal bits for byte offset
   constant cache_entries_c     : natural := ICACHE_NUM_BLOCKS * (ICACHE_BLOCK_SIZE/4); -- number of 32-bit entries (per set)
+  constant cache_way_size_c    : natural := index_size_f(ICACHE_NUM_SETS); -- number of bits required to address a way
+  constant plru_size_c         : natural := cond_sel_natural_f(boolean(ICACHE_NUM_SETS > 1), ICACHE_NUM_SETS-1, 1); -- PLRU tree bits per block
 
-  -- status flag memory --
-  signal valid_flag_s0 : std_ulogic_vector(ICACHE_NUM_BLOCKS-1 downto 0);
-  signal valid_flag_s1 : std_ulogic_vector(ICACHE_NUM_BLOCKS-1 downto 0);
-  signal valid         : std_ulogic_vector(1 downto 0); -- valid flag read data
+  -- status flag memory read data --
+  signal valid  : std_ulogic_vector(ICACHE_NUM_SETS-1 downto 0);
+  signal locked : std_ulogic_vector(ICACHE_NUM_SETS-1 downto 0);
 
-  -- tag memory --
-  type tag_mem_t is array (0 to ICACHE_NUM_BLOCKS-1) of std_ulogic_vector(cache_tag_size_c-1 downto 0);
-  signal tag_mem_s0 : tag_mem_t;
-  signal tag_mem_s1 : tag_mem_t;
-  type tag_rd_t is array (0 to 1) of std_ulogic_vector(cache_tag_size_c-1 downto 0);
-  signal tag : tag_rd_t; -- tag read data
+  -- tag memory read data --
+  type tag_rd_t is array (0 to ICACHE_NUM_SETS-1) of std_ulogic_vector(cache_tag_size_c-1 downto 0);
+  signal tag : tag_rd_t;
 
   -- access status --
-  signal hit : std_ulogic_vector(1 downto 0);
+  signal hit     : std_ulogic_vector(ICACHE_NUM_SETS-1 downto 0);
+  signal hit_any : std_ulogic; -- hit in any way
+  signal all_lck : std_ulogic; -- all ways of the addressed line are locked
 
   -- access address decomposition --
   type acc_addr_t is record
@@ -439,31 +715,60 @@ architecture neorv32_icache_memory_rtl of neorv32_icache_memory is
   end record;
   signal host_acc_addr, ctrl_acc_addr : acc_addr_t;
 
-  -- cache data memory --
-  type cache_mem_t is array (0 to cache_entries_c-1) of std_ulogic_vector(31 downto 0);
-  signal cache_data_memory_s0 : cache_mem_t; -- set 0
-  signal cache_data_memory_s1 : cache_mem_t; -- set 1
-
   -- cache data memory access --
-  type cache_rdata_t is array (0 to 1) of std_ulogic_vector(31 downto 0);
+  type cache_rdata_t is array (0 to ICACHE_NUM_SETS-1) of std_ulogic_vector(31 downto 0);
   signal cache_rdata  : cache_rdata_t;
   signal cache_index  : std_ulogic_vector(cache_index_size_c-1 downto 0);
   signal cache_offset : std_ulogic_vector(cache_offset_size_c-1 downto 0);
   signal cache_addr   : std_ulogic_vector((cache_index_size_c+cache_offset_size_c)-1 downto 0); -- index & offset
   signal cache_we     : std_ulogic; -- write enable (full-word)
-  signal set_select   : std_ulogic;
+  signal set_select   : std_ulogic_vector(ICACHE_NUM_SETS-1 downto 0); -- way to be replaced (one-hot)
 
   -- access history --
+  type plru_mem_t is array (0 to ICACHE_NUM_BLOCKS-1) of std_ulogic_vector(plru_size_c-1 downto 0);
   type history_t is record
     re_ff          : std_ulogic;
-    last_used_set  : std_ulogic_vector(ICACHE_NUM_BLOCKS-1 downto 0);
-    to_be_replaced : std_ulogic;
+    plru           : plru_mem_t; -- tree pseudo-LRU bits for each block index
+    to_be_replaced : std_ulogic_vector(cache_way_size_c-1 downto 0); -- replacement candidate (way index)
   end record;
   signal history : history_t;
+  signal lfsr    : std_ulogic_vector(7 downto 0) := (others => '0'); -- pseudo-random generator for random replacement
+
+  -- Tree pseudo-LRU: update tree bits on access of way "way" --
+  -- node n (1..NUM_SETS-1, heap order) points to the subtree that is going to be replaced next (0 = left, 1 = right)
+  function plru_update_f(tree : std_ulogic_vector; way : natural) return std_ulogic_vector is
+    variable tmp_v  : std_ulogic_vector(tree'length-1 downto 0);
+    variable node_v : natural;
+    variable dir_v  : std_ulogic;
+  begin
+    tmp_v  := tree;
+    node_v := 1;
+    for i in cache_way_size_c-1 downto 0 loop
+      if (((way / (2**i)) mod 2) = 1) then dir_v := '1'; else dir_v := '0'; end if;
+      tmp_v(node_v-1) := not dir_v; -- point away from the accessed way
+      if (dir_v = '1') then node_v := 2*node_v + 1; else node_v := 2*node_v; end if;
+    end loop;
+    return tmp_v;
+  end function plru_update_f;
+
+  -- Tree pseudo-LRU: get least recently used way --
+  function plru_victim_f(tree : std_ulogic_vector) return std_ulogic_vector is
+    variable tmp_v  : std_ulogic_vector(tree'length-1 downto 0);
+    variable way_v  : std_ulogic_vector(cache_way_size_c-1 downto 0);
+    variable node_v : natural;
+  begin
+    tmp_v  := tree;
+    node_v := 1;
+    for i in cache_way_size_c-1 downto 0 loop
+      way_v(i) := tmp_v(node_v-1);
+      if (tmp_v(node_v-1) = '1') then node_v := 2*node_v + 1; else node_v := 2*node_v; end if;
+    end loop;
+    return way_v;
+  end function plru_victim_f;
 
 begin
 
-	-- Access Address Decomposition -----------------------------------------------------------
+  -- Access Address Decomposition -----------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
   host_acc_addr.tag    <= host_addr_i(31 downto 31-(cache_tag_size_c-1));
   host_acc_addr.index  <= host_addr_i(31-cache_tag_size_c downto 2+cache_offset_size_c);
@@ -474,108 +779,182 @@ begin
   ctrl_acc_addr.offset <= ctrl_addr_i(2+(cache_offset_size_c-1) downto 2); -- discard byte offset
 
 
-	-- Cache Access History -------------------------------------------------------------------
+  -- Cache Access History -------------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
   access_history: process(clk_i)
+    variable victim_v : std_ulogic_vector(cache_way_size_c-1 downto 0);
   begin
     if rising_edge(clk_i) then
       history.re_ff <= host_re_i;
-      if (invalidate_i = '1') then -- invalidate whole cache
-        history.last_used_set <= (others => '1');
-      elsif (history.re_ff = '1') and (or_reduce_f(hit) = '1') and (ctrl_en_i = '0') then -- store last accessed set that caused a hit
-        history.last_used_set(to_integer(unsigned(cache_index))) <= not hit(0);
+      lfsr          <= lfsr(6 downto 0) & (lfsr(7) xnor lfsr(5) xnor lfsr(4) xnor lfsr(3));
+      -- update pseudo-LRU tree --
+      if (ICACHE_NUM_SETS > 1) then
+        if (invalidate_i = '1') then -- invalidate whole cache
+          history.plru <= (others => (others => '0'));
+        elsif (history.re_ff = '1') and (hit_any = '1') and (ctrl_en_i = '0') then -- store last accessed set that caused a hit
+          for i in 0 to ICACHE_NUM_SETS-1 loop
+            if (hit(i) = '1') then
+              history.plru(to_integer(unsigned(cache_index))) <= plru_update_f(history.plru(to_integer(unsigned(cache_index))), i);
+            end if;
+          end loop;
+        elsif (ctrl_en_i = '1') and (ctrl_valid_i = '1') then -- newly allocated block is the most recently used one
+          history.plru(to_integer(unsigned(cache_index))) <= plru_update_f(history.plru(to_integer(unsigned(cache_index))), to_integer(unsigned(history.to_be_replaced)));
+        end if;
+      end if;
+      -- replacement candidate (kept stable while the control interface is active) --
+      if (ctrl_en_i = '0') then
+        if (ICACHE_REPLACEMENT = 1) then -- random
+          victim_v := lfsr(cache_way_size_c-1 downto 0);
+        else -- (pseudo-)LRU
+          victim_v := plru_victim_f(history.plru(to_integer(unsigned(cache_index))));
+        end if;
+        -- do not replace a locked way; use the first unlocked one instead --
+        if (ICACHE_NUM_SETS > 1) and (locked(to_integer(unsigned(victim_v))) = '1') then
+          for i in ICACHE_NUM_SETS-1 downto 0 loop
+            if (locked(i) = '0') then
+              victim_v := std_ulogic_vector(to_unsigned(i, cache_way_size_c));
+            end if;
+          end loop;
+        end if;
+        -- use an invalid way first --
+        for i in ICACHE_NUM_SETS-1 downto 0 loop
+          if (valid(i) = '0') then
+            victim_v := std_ulogic_vector(to_unsigned(i, cache_way_size_c));
+          end if;
+        end loop;
+        -- re-load a block into the way where it is already present (block preload) --
+        for i in ICACHE_NUM_SETS-1 downto 0 loop
+          if (hit(i) = '1') then
+            victim_v := std_ulogic_vector(to_unsigned(i, cache_way_size_c));
+          end if;
+        end loop;
+        history.to_be_replaced <= victim_v;
       end if;
-      history.to_be_replaced <= history.last_used_set(to_integer(unsigned(cache_index)));
     end if;
   end process access_history;
 
-  -- which set is going to be replaced? -> opposite of last used set = least recently used set --
-  set_select <= '0' when (ICACHE_NUM_SETS = 1) else (not history.to_be_replaced);
+  -- which set is going to be replaced? --
+  set_select_gen: process(history.to_be_replaced)
+  begin
+    set_select <= (others => '0');
+    if (ICACHE_NUM_SETS = 1) then
+      set_select(0) <= '1';
+    else
+      set_select(to_integer(unsigned(history.to_be_replaced))) <= '1';
+    end if;
+  end process set_select_gen;
 
 
-	-- Status flag memory ---------------------------------------------------------------------
+  -- Cache Sets (Ways) ----------------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
-  status_memory: process(clk_i)
+  -- each set uses individual memories - no multi-dimensional memory arrays are used as some
+  -- synthesis tools have problems to map these to actual BRAM primitives
+  cache_set_gen:
+  for s in 0 to ICACHE_NUM_SETS-1 generate
+
+    -- status flag memory --
+    signal valid_flag : std_ulogic_vector(ICACHE_NUM_BLOCKS-1 downto 0);
+    signal lock_flag  : std_ulogic_vector(ICACHE_NUM_BLOCKS-1 downto 0);
+
+    -- tag memory --
+    type tag_mem_t is array (0 to ICACHE_NUM_BLOCKS-1) of std_ulogic_vector(cache_tag_size_c-1 downto 0);
+    signal tag_mem : tag_mem_t;
+
+    -- cache data memory --
+    type cache_mem_t is array (0 to cache_entries_c-1) of std_ulogic_vector(31 downto 0);
+    signal cache_data_memory : cache_mem_t;
+
   begin
-    if rising_edge(clk_i) then
-      -- write access --
-      if (invalidate_i = '1') then -- invalidate whole cache
-        valid_flag_s0 <= (others => '0');
-        valid_flag_s1 <= (others => '0');
-      elsif (ctrl_en_i = '1') then
-        if (ctrl_invalid_i = '1') then -- make current block invalid
-          if (set_select = '0') then
-            valid_flag_s0(to_integer(unsigned(cache_index))) <= '0';
-          else
-            valid_flag_s1(to_integer(unsigned(cache_index))) <= '0';
+
+    -- Status flag memory --
+    status_memory: process(clk_i)
+    begin
+      if rising_edge(clk_i) then
+        -- write access --
+        if (invalidate_i = '1') then -- invalidate whole cache (locked blocks remain valid)
+          valid_flag <= valid_flag and lock_flag;
+        elsif (ctrl_en_i = '1') and (set_select(s) = '1') then
+          if (ctrl_invalid_i = '1') then -- make current block invalid
+            valid_flag(to_integer(unsigned(cache_index))) <= '0';
+          elsif (ctrl_valid_i = '1') then -- make current block valid
+            valid_flag(to_integer(unsigned(cache_index))) <= '1';
           end if;
-        elsif (ctrl_valid_i = '1') then -- make current block valid
-          if (set_select = '0') then
-            valid_flag_s0(to_integer(unsigned(cache_index))) <= '1';
-          else
-            valid_flag_s1(to_integer(unsigned(cache_index))) <= '1';
+        end if;
+        if (unlock_i = '1') then -- unlock all blocks
+          lock_flag <= (others => '0');
+        elsif (ctrl_en_i = '1') and (set_select(s) = '1') then
+          if (ctrl_invalid_i = '1') then -- unlock current block
+            lock_flag(to_integer(unsigned(cache_index))) <= '0';
+          elsif (ctrl_valid_i = '1') then -- (un)lock current block
+            lock_flag(to_integer(unsigned(cache_index))) <= ctrl_lock_i;
           end if;
         end if;
+        -- read access (sync) --
+        valid(s)  <= valid_flag(to_integer(unsigned(cache_index)));
+        locked(s) <= lock_flag(to_integer(unsigned(cache_index)));
       end if;
-      -- read access (sync) --
-      valid(0) <= valid_flag_s0(to_integer(unsigned(cache_index)));
-      valid(1) <= valid_flag_s1(to_integer(unsigned(cache_index)));
-    end if;
-  end process status_memory;
-
-
-	-- Tag memory -----------------------------------------------------------------------------
-  -- -------------------------------------------------------------------------------------------
-  tag_memory: process(clk_i)
-  begin
-    if rising_edge(clk_i) then
-      if (ctrl_en_i = '1') and (ctrl_tag_we_i = '1') then -- write access
-        if (set_select = '0') then
-          tag_mem_s0(to_integer(unsigned(cache_index))) <= ctrl_acc_addr.tag;
-        else
-          tag_mem_s1(to_integer(unsigned(cache_index))) <= ctrl_acc_addr.tag;
+    end process status_memory;
+
+    -- Tag memory --
+    tag_memory: process(clk_i)
+    begin
+      if rising_edge(clk_i) then
+        if (ctrl_en_i = '1') and (ctrl_tag_we_i = '1') and (set_select(s) = '1') then -- write access
+          tag_mem(to_integer(unsigned(cache_index))) <= ctrl_acc_addr.tag;
         end if;
+        tag(s) <= tag_mem(to_integer(unsigned(cache_index)));
       end if;
-      tag(0) <= tag_mem_s0(to_integer(unsigned(cache_index)));
-      tag(1) <= tag_mem_s1(to_integer(unsigned(cache_index)));
-    end if;
-  end process tag_memory;
+    end process tag_memory;
+
+    -- Cache data memory --
+    cache_mem_access: process(clk_i)
+    begin
+      if rising_edge(clk_i) then
+        if (cache_we = '1') and (set_select(s) = '1') then -- write access from control (full-word)
+          cache_data_memory(to_integer(unsigned(cache_addr))) <= ctrl_wdata_i;
+        end if;
+        -- read access from host (full-word) --
+        cache_rdata(s) <= cache_data_memory(to_integer(unsigned(cache_addr)));
+      end if;
+    end process cache_mem_access;
 
-  -- comparator --
-  comparator: process(host_acc_addr, tag, valid)
+    -- comparator --
+    hit(s) <= '1' when (host_acc_addr.tag = tag(s)) and (valid(s) = '1') else '0';
+
+  end generate;
+
+  -- global hit / all ways locked --
+  -- (explicit loops as or_reduce_f()/and_reduce_f() do not process single-bit vectors, i.e. direct-mapped configurations) --
+  way_status: process(hit, locked)
+    variable hit_v, lck_v : std_ulogic;
   begin
-    hit <= (others => '0');
+    hit_v := '0';
+    lck_v := '1';
     for i in 0 to ICACHE_NUM_SETS-1 loop
-      if (host_acc_addr.tag = tag(i)) and (valid(i) = '1') then
-        hit(i) <= '1';
-      end if;
-    end loop; -- i
-  end process comparator;
+      hit_v := hit_v or hit(i);
+      lck_v := lck_v and locked(i);
+    end loop;
+    hit_any <= hit_v;
+    all_lck <= lck_v;
+  end process way_status;
 
-  -- global hit --
-  hit_o <= or_reduce_f(hit);
+  hit_o <= hit_any;
 
+  -- no way available for allocation --
+  nalloc_o <= (not hit_any) and all_lck;
 
-	-- Cache Data Memory ----------------------------------------------------------------------
-  -- -------------------------------------------------------------------------------------------
-  cache_mem_access: process(clk_i)
+  -- data output --
+  data_output: process(hit, cache_rdata)
+    variable rdata_v : std_ulogic_vector(31 downto 0);
   begin
-    if rising_edge(clk_i) then
-      if (cache_we = '1') then -- write access from control (full-word)
-        if (set_select = '0') or (ICACHE_NUM_SETS = 1) then
-          cache_data_memory_s0(to_integer(unsigned(cache_addr))) <= ctrl_wdata_i;
-        else
-          cache_data_memory_s1(to_integer(unsigned(cache_addr))) <= ctrl_wdata_i;
-        end if;
+    rdata_v := (others => '0');
+    for i in 0 to ICACHE_NUM_SETS-1 loop
+      if (hit(i) = '1') or (ICACHE_NUM_SETS = 1) then
+        rdata_v := rdata_v or cache_rdata(i); -- there is only one hit at once
       end if;
-      -- read access from host (full-word) --
-      cache_rdata(0) <= cache_data_memory_s0(to_integer(unsigned(cache_addr)));
-      cache_rdata(1) <= cache_data_memory_s1(to_integer(unsigned(cache_addr)));
-    end if;
-  end process cache_mem_access;
-
-  -- data output --
-  host_rdata_o <= cache_rdata(0) when (hit(0) = '1') or (ICACHE_NUM_SETS = 1) else cache_rdata(1);
+    end loop;
+    host_rdata_o <= rdata_v;
+  end process data_output;
 
   -- cache block ram access address --
   cache_addr <= cache_index & cache_offset;
@@ -49,17 +49,23 @@ entity neorv32_imem is
   generic (
     IMEM_BASE    : std_ulogic_vector(31 downto 0); -- memory base address
     IMEM_SIZE    : natural; -- processor-internal instruction memory size in bytes
-    IMEM_AS_IROM : boolean  -- implement IMEM as pre-initialized read-only memory?
+    IMEM_AS_IROM : boolean; -- implement IMEM as pre-initialized read-only memory?
+    IMEM_TCM_EN  : boolean  -- second read port (TCM / bus crossbar) in use?
   );
   port (
-    clk_i  : in  std_ulogic; -- global clock line
-    rden_i : in  std_ulogic; -- read enable
-    wren_i : in  std_ulogic; -- write enable
-    ben_i  : in  std_ulogic_vector(03 downto 0); -- byte write enable
-    addr_i : in  std_ulogic_vector(31 downto 0); -- address
-    data_i : in  std_ulogic_vector(31 downto 0); -- data in
-    data_o : out std_ulogic_vector(31 downto 0); -- data out
-    ack_o  : out std_ulogic  -- transfer acknowledge
+    clk_i      : in  std_ulogic; -- global clock line
+    -- processor bus --
+    rden_i     : in  std_ulogic; -- read enable
+    wren_i     : in  std_ulogic; -- write enable
+    ben_i      : in  std_ulogic_vector(03 downto 0); -- byte write enable
+    addr_i     : in  std_ulogic_vector(31 downto 0); -- address
+    data_i     : in  std_ulogic_vector(31 downto 0); -- data in
+    data_o     : out std_ulogic_vector(31 downto 0); -- data out
+    ack_o      : out std_ulogic; -- transfer acknowledge
+    -- tightly-coupled memory port (CPU instruction fetch, fixed latency of one cycle) --
+    tcm_re_i   : in  std_ulogic := '0'; -- read enable
+    tcm_addr_i : in  std_ulogic_vector(31 downto 0) := (others => '0'); -- address
+    tcm_data_o : out std_ulogic_vector(31 downto 0) -- data out
   );
 end neorv32_imem;
 
@@ -75,6 +81,10 @@ architecture neorv32_imem_rtl of neorv32_imem is
   signal rden   : std_ulogic;
   signal addr   : std_ulogic_vector(index_size_f(IMEM_SIZE/4)-1 downto 0);
 
+  -- tightly-coupled memory port --
+  signal tcm_addr  : std_ulogic_vector(index_size_f(IMEM_SIZE/4)-1 downto 0);
+  signal tcm_rdata : std_ulogic_vector(31 downto 0);
+
   -- --------------------------- --
   -- IMEM as pre-initialized ROM --
   -- --------------------------- --
@@ -86,7 +96,7 @@ architecture neorv32_imem_rtl of neorv32_imem is
   constant mem_rom : mem32_t(0 to IMEM_SIZE/4-1) := mem32_init_f(application_init_image, IMEM_SIZE/4);
 
   -- read data --
-  signal mem_rom_rd : std_ulogic_vector(31 downto 0);
+  signal mem_rom_rd, mem_rom_tcm_rd : std_ulogic_vector(31 downto 0);
 
   -- -------------------------------------------------------------------------------------------------------------- --
   -- The memory (RAM) is built from 4 individual byte-wide memories b0..b3, since some synthesis tools have         --
@@ -101,6 +111,7 @@ architecture neorv32_imem_rtl of neorv32_imem is
 
   -- read data --
   signal mem_b0_rd, mem_b1_rd, mem_b2_rd, mem_b3_rd : std_ulogic_vector(7 downto 0);
+  signal tcm_b0_rd, tcm_b1_rd, tcm_b2_rd, tcm_b3_rd : std_ulogic_vector(7 downto 0);
 
 begin
 
@@ -121,6 +132,9 @@ begin
   acc_en <= '1' when (addr_i(hi_abb_c downto lo_abb_c) = IMEM_BASE(hi_abb_c downto lo_abb_c)) else '0';
   addr   <= addr_i(index_size_f(IMEM_SIZE/4)+1 downto 2); -- word aligned
 
+  -- the CPU's TCM port is already decoded by the CPU itself --
+  tcm_addr <= tcm_addr_i(index_size_f(IMEM_SIZE/4)+1 downto 2); -- word aligned
+
 
   -- Implement IMEM as pre-initialized ROM --------------------------------------------------
   -- -------------------------------------------------------------------------------------------
@@ -136,6 +150,18 @@ begin
     end process mem_access;
     -- read data --
     rdata <= mem_rom_rd;
+
+    -- tightly-coupled memory port (second read port) --
+    tcm_access: process(clk_i)
+    begin
+      if rising_edge(clk_i) then
+        if (IMEM_TCM_EN = true) and (tcm_re_i = '1') then -- second port only if in use
+          mem_rom_tcm_rd <= mem_rom(to_integer(unsigned(tcm_addr)));
+        end if;
+      end if;
+    end process tcm_access;
+    -- read data --
+    tcm_rdata <= mem_rom_tcm_rd;
   end generate;
 
 
@@ -174,6 +200,21 @@ begin
     end process mem_access;
     -- read data --
     rdata <= mem_b3_rd & mem_b2_rd & mem_b1_rd & mem_b0_rd;
+
+    -- tightly-coupled memory port (second read port) --
+    tcm_access: process(clk_i)
+    begin
+      if rising_edge(clk_i) then
+        if (IMEM_TCM_EN = true) and (tcm_re_i = '1') then -- second port only if in use
+          tcm_b0_rd <= mem_ram_b0(to_integer(unsigned(tcm_addr)));
+          tcm_b1_rd <= mem_ram_b1(to_integer(unsigned(tcm_addr)));
+          tcm_b2_rd <= mem_ram_b2(to_integer(unsigned(tcm_addr)));
+          tcm_b3_rd <= mem_ram_b3(to_integer(unsigned(tcm_addr)));
+        end if;
+      end if;
+    end process tcm_access;
+    -- read data --
+    tcm_rdata <= tcm_b3_rd & tcm_b2_rd & tcm_b1_rd & tcm_b0_rd;
   end generate;
 
 
@@ -194,5 +235,8 @@ begin
   -- output gate --
   data_o <= rdata when (rden = '1') else (others => '0');
 
+  -- TCM port: no output gate, the CPU only samples the data when it has issued a TCM request --
+  tcm_data_o <= tcm_rdata;
+
 
 end neorv32_imem_rtl;
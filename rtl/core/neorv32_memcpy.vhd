@@ -0,0 +1,250 @@
+-- #################################################################################################
+-- # << NEORV32 - Block Memory Copy/Fill Engine (MEMCPY) >>                                        #
+-- # ********************************************************************************************* #
+-- # Lightweight block memory copy/fill engine. Additional bus master of the processor bus         #
+-- # (connected to the processor bus arbiter) that copies a block of words from a source to a      #
+-- # destination address or fills a block of words with a constant pattern. The next bus access is #
+-- # issued right after the previous one has been acknowledged, so a block is moved at (shared)    #
+-- # bus speed. Only word-aligned, word-sized accesses are supported; unaligned head/tail bytes    #
+-- # have to be handled by software.                                                               #
+-- # ********************************************************************************************* #
+-- # BSD 3-Clause License                                                                          #
+-- #                                                                                               #
+-- # Copyright (c) 2021, Stephan Nolting. All rights reserved.                                     #
+-- #                                                                                               #
+-- # Redistribution and use in source and binary forms, with or without modification, are          #
+-- # permitted provided that the following conditions are met:                                     #
+-- #                                                                                               #
+-- # 1. Redistributions of source code must retain the above copyright notice, this list of        #
+-- #    conditions and the following disclaimer.                                                   #
+-- #                                                                                               #
+-- # 2. Redistributions in binary form must reproduce the above copyright notice, this list of     #
+-- #    conditions and the following disclaimer in the documentation and/or other materials        #
+-- #    provided with the distribution.                                                            #
+-- #                                                                                               #
+-- # 3. Neither the name of the copyright holder nor the names of its contributors may be used to  #
+-- #    endorse or promote products derived from this software without specific prior written      #
+-- #    permission.                                                                                #
+-- #                                                                                               #
+-- # THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS   #
+-- # OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF               #
+-- # MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE    #
+-- # COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,     #
+-- # EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE #
+-- # GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED    #
+-- # AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING     #
+-- # NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED  #
+-- # OF THE POSSIBILITY OF SUCH DAMAGE.                                                            #
+-- # ********************************************************************************************* #
+-- # The NEORV32 Processor - https://github.com/stnolting/neorv32              (c) Stephan Nolting #
+-- #################################################################################################
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library neorv32;
+use neorv32.neorv32_package.all;
+
+entity neorv32_memcpy is
+  port (
+    -- host access --
+    clk_i       : in  std_ulogic; -- global clock line
+    rstn_i      : in  std_ulogic; -- global reset line, low-active
+    addr_i      : in  std_ulogic_vector(31 downto 0); -- address
+    rden_i      : in  std_ulogic; -- read enable
+    wren_i      : in  std_ulogic; -- write enable
+    data_i      : in  std_ulogic_vector(31 downto 0); -- data in
+    data_o      : out std_ulogic_vector(31 downto 0); -- data out
+    ack_o       : out std_ulogic; -- transfer acknowledge
+    -- bus controller interface --
+    bus_addr_o  : out std_ulogic_vector(31 downto 0); -- bus access address
+    bus_rdata_i : in  std_ulogic_vector(31 downto 0); -- bus read data
+    bus_wdata_o : out std_ulogic_vector(31 downto 0); -- bus write data
+    bus_ben_o   : out std_ulogic_vector(03 downto 0); -- byte enable
+    bus_we_o    : out std_ulogic; -- write enable
+    bus_re_o    : out std_ulogic; -- read enable
+    bus_ack_i   : in  std_ulogic; -- bus transfer acknowledge
+    bus_err_i   : in  std_ulogic  -- bus transfer error
+  );
+end neorv32_memcpy;
+
+architecture neorv32_memcpy_rtl of neorv32_memcpy is
+
+  -- IO space: module base address --
+  constant hi_abb_c : natural := index_size_f(io_size_c)-1; -- high address boundary bit
+  constant lo_abb_c : natural := index_size_f(memcpy_size_c); -- low address boundary bit
+
+  -- control register bits --
+  constant ct_en_c   : natural :=  0; -- r/w: engine enable (clearing aborts current operation)
+  constant ct_fill_c : natural :=  1; -- r/w: operation: 0 = copy SRC -> DST, 1 = fill DST with SRC pattern
+  constant ct_err_c  : natural := 30; -- r/-: last operation was aborted due to a bus error
+  constant ct_busy_c : natural := 31; -- r/-: operation in progress
+
+  -- access control --
+  signal acc_en : std_ulogic; -- module access enable
+  signal addr   : std_ulogic_vector(31 downto 0); -- access address
+  signal wren   : std_ulogic; -- word write enable
+  signal rden   : std_ulogic; -- read enable
+
+  -- registers --
+  signal enable : std_ulogic;
+  signal fill   : std_ulogic;
+  signal err    : std_ulogic;
+  signal src    : std_ulogic_vector(31 downto 0); -- source address / fill pattern
+  signal dst    : std_ulogic_vector(31 downto 0); -- destination address
+  signal num    : std_ulogic_vector(31 downto 0); -- remaining words
+
+  -- engine --
+  type engine_state_t is (E_IDLE, E_READ, E_WRITE);
+  signal state : engine_state_t;
+
+begin
+
+  -- Access Control -------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  acc_en <= '1' when (addr_i(hi_abb_c downto lo_abb_c) = memcpy_base_c(hi_abb_c downto lo_abb_c)) else '0';
+  addr   <= memcpy_base_c(31 downto lo_abb_c) & addr_i(lo_abb_c-1 downto 2) & "00"; -- word aligned
+  wren   <= acc_en and wren_i;
+  rden   <= acc_en and rden_i;
+
+
+  -- Register Interface and Copy/Fill Engine ------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  memcpy_core: process(rstn_i, clk_i)
+  begin
+    if (rstn_i = '0') then
+      enable      <= '0';
+      fill        <= '0';
+      err         <= '0';
+      src         <= (others => '0');
+      dst         <= (others => '0');
+      num         <= (others => '0');
+      state       <= E_IDLE;
+      bus_addr_o  <= (others => '0');
+      bus_wdata_o <= (others => '0');
+      bus_we_o    <= '0';
+      bus_re_o    <= '0';
+    elsif rising_edge(clk_i) then
+      -- defaults --
+      bus_we_o <= '0';
+      bus_re_o <= '0';
+
+      -- host write access --
+      if (wren = '1') then
+        if (addr = memcpy_ct_addr_c) then
+          enable <= data_i(ct_en_c);
+          fill   <= data_i(ct_fill_c);
+        end if;
+        if (state = E_IDLE) then -- configuration can only be changed while idle
+          if (addr = memcpy_src_addr_c) then
+            src <= data_i;
+          end if;
+          if (addr = memcpy_dst_addr_c) then
+            dst <= data_i;
+          end if;
+          if (addr = memcpy_num_addr_c) then
+            num <= data_i;
+          end if;
+        end if;
+      end if;
+
+      -- engine --
+      case state is
+
+        when E_IDLE => -- writing a non-zero word count to NUM starts the operation
+        -- ------------------------------------------------------------
+          bus_addr_o  <= dst(31 downto 2) & "00";
+          bus_wdata_o <= src;
+          if (wren = '1') and (addr = memcpy_num_addr_c) and (or_reduce_f(data_i) = '1') and (enable = '1') then
+            err <= '0';
+            if (fill = '1') then
+              bus_we_o <= '1';
+              state    <= E_WRITE;
+            else
+              bus_addr_o <= src(31 downto 2) & "00";
+              bus_re_o   <= '1';
+              state      <= E_READ;
+            end if;
+          end if;
+
+        when E_READ => -- wait for read data, then issue write access
+        -- ------------------------------------------------------------
+          if (bus_err_i = '1') then
+            err   <= '1';
+            state <= E_IDLE;
+          elsif (bus_ack_i = '1') then
+            src <= std_ulogic_vector(unsigned(src) + 4);
+            if (enable = '0') then -- aborted
+              state <= E_IDLE;
+            else
+              bus_addr_o  <= dst(31 downto 2) & "00";
+              bus_wdata_o <= bus_rdata_i;
+              bus_we_o    <= '1';
+              state       <= E_WRITE;
+            end if;
+          end if;
+
+        when E_WRITE => -- wait for write to complete, then issue next access
+        -- ------------------------------------------------------------
+          if (bus_err_i = '1') then
+            err   <= '1';
+            state <= E_IDLE;
+          elsif (bus_ack_i = '1') then
+            dst <= std_ulogic_vector(unsigned(dst) + 4);
+            num <= std_ulogic_vector(unsigned(num) - 1);
+            if (num = x"00000001") or (enable = '0') then -- done / aborted
+              state <= E_IDLE;
+            elsif (fill = '1') then
+              bus_addr_o <= std_ulogic_vector(unsigned(dst(31 downto 2) & "00") + 4);
+              bus_we_o   <= '1';
+            else
+              bus_addr_o <= src(31 downto 2) & "00";
+              bus_re_o   <= '1';
+              state      <= E_READ;
+            end if;
+          end if;
+
+        when others => -- undefined
+        -- ------------------------------------------------------------
+          state <= E_IDLE;
+
+      end case;
+    end if;
+  end process memcpy_core;
+
+  -- full-word accesses only --
+  bus_ben_o <= (others => '1');
+
+
+  -- Read Access ----------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  read_access: process(clk_i)
+  begin
+    if rising_edge(clk_i) then
+      ack_o  <= acc_en and (rden_i or wren_i);
+      data_o <= (others => '0');
+      if (rden = '1') then
+        case addr is
+          when memcpy_ct_addr_c =>
+            data_o(ct_en_c)   <= enable;
+            data_o(ct_fill_c) <= fill;
+            data_o(ct_err_c)  <= err;
+            if (state /= E_IDLE) then
+              data_o(ct_busy_c) <= '1';
+            end if;
+          when memcpy_src_addr_c =>
+            data_o <= src;
+          when memcpy_dst_addr_c =>
+            data_o <= dst;
+          when memcpy_num_addr_c =>
+            data_o <= num;
+          when others =>
+            NULL;
+        end case;
+      end if;
+    end if;
+  end process read_access;
+
+
+end neorv32_memcpy_rtl;
@@ -64,7 +64,7 @@ package neorv32_package is
   -- Architecture Constants (do not modify!) ------------------------------------------------
   -- -------------------------------------------------------------------------------------------
   constant data_width_c : natural := 32; -- native data path width - do not change!
-  constant hw_version_c : std_ulogic_vector(31 downto 0) := x"01050809"; -- no touchy!
+  constant hw_version_c : std_ulogic_vector(31 downto 0) := x"01050822"; -- no touchy!
   constant archid_c     : natural := 19; -- official NEORV32 architecture ID - hands off!
 
   -- External Interface Types ---------------------------------------------------------------
@@ -78,11 +78,30 @@ package neorv32_package is
   type pmp_addr_if_t is array (0 to 63) of std_ulogic_vector(33 downto 0);
   type cp_data_if_t  is array (0 to 3)  of std_ulogic_vector(data_width_c-1 downto 0);
 
+  -- CPU instruction trace port (program flow discontinuity events) --
+  type cpu_trace_if_t is record
+    exe    : std_ulogic; -- instruction enters execution (sync point)
+    branch : std_ulogic; -- conditional branch resolved
+    taken  : std_ulogic; -- conditional branch taken
+    jump   : std_ulogic; -- uninferable jump (JALR)
+    trap   : std_ulogic; -- trap entry (exception or interrupt)
+    tret   : std_ulogic; -- trap return (MRET)
+    cause  : std_ulogic_vector(06 downto 0); -- trap cause (trap_*_c)
+    pc     : std_ulogic_vector(data_width_c-1 downto 0); -- current PC / trap PC (= mepc)
+    target : std_ulogic_vector(data_width_c-1 downto 0); -- jump/trap destination address
+    debug  : std_ulogic; -- CPU is in (or is entering) debug mode
+  end record;
+
   -- Internal Memory Types Configuration Types ----------------------------------------------
   -- -------------------------------------------------------------------------------------------
   type mem32_t is array (natural range <>) of std_ulogic_vector(31 downto 0); -- memory with 32-bit entries
   type mem8_t  is array (natural range <>) of std_ulogic_vector(07 downto 0); -- memory with 8-bit entries
 
+  -- additional processor-internal memory banks (XMEM) --
+  constant xmem_num_banks_c : natural := 4; -- max number of additional internal memory banks
+  type xmem_base_t is array (0 to xmem_num_banks_c-1) of std_ulogic_vector(31 downto 0); -- bank base addresses
+  type xmem_size_t is array (0 to xmem_num_banks_c-1) of natural; -- bank sizes in bytes (0 = bank not implemented)
+
   -- Helper Functions -----------------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
   function index_size_f(input : natural) return natural;
@@ -103,6 +122,8 @@ package neorv32_package is
   function char_to_lower_f(ch : character) return character;
   function str_equal_f(str0 : string; str1 : string) return boolean;
   impure function mem32_init_f(init : mem32_t; depth : natural) return mem32_t;
+  function xmem_num_f(size : xmem_size_t) return natural;
+  function xmem_access_f(addr : std_ulogic_vector(31 downto 0); base : xmem_base_t; size : xmem_size_t) return std_ulogic;
 
   -- Internal (auto-generated) Configurations -----------------------------------------------
   -- -------------------------------------------------------------------------------------------
@@ -110,10 +131,9 @@ package neorv32_package is
 
   -- Processor-Internal Address Space Layout ------------------------------------------------
   -- -------------------------------------------------------------------------------------------
-  -- Internal Instruction Memory (IMEM) and Date Memory (DMEM) --
-  constant imem_base_c          : std_ulogic_vector(data_width_c-1 downto 0) := ispace_base_c; -- internal instruction memory base address
-  constant dmem_base_c          : std_ulogic_vector(data_width_c-1 downto 0) := dspace_base_c; -- internal data memory base address
-  --> internal data/instruction memory sizes are configured via top's generics
+  -- Internal Instruction Memory (IMEM), Data Memory (DMEM) and additional memory banks (XMEM) --
+  --> internal memory base addresses and sizes are configured via top's generics
+  --> default IMEM base address = ispace_base_c, default DMEM base address = dspace_base_c
 
   -- Internal Bootloader ROM --
   -- Actual bootloader size is determined during runtime via the length of the bootloader initialization image
@@ -128,6 +148,13 @@ package neorv32_package is
   constant dm_data_base_c       : std_ulogic_vector(data_width_c-1 downto 0) := x"fffff900";
   constant dm_sreg_base_c       : std_ulogic_vector(data_width_c-1 downto 0) := x"fffff980";
 
+  -- Execute In Place Flash Controller (XIP): control registers (outside of the IO area) --
+  -- The memory-mapped flash window itself is configured via the XIP_BASE and XIP_SIZE top generics
+  constant xip_base_c           : std_ulogic_vector(data_width_c-1 downto 0) := x"fffffc00"; -- base address, fixed!
+  constant xip_size_c           : natural := 2*4; -- module's address space size in bytes
+  constant xip_ctrl_addr_c      : std_ulogic_vector(data_width_c-1 downto 0) := x"fffffc00";
+  constant xip_data_addr_c      : std_ulogic_vector(data_width_c-1 downto 0) := x"fffffc04";
+
   -- IO: Peripheral Devices ("IO") Area --
   -- Control register(s) (including the device-enable) should be located at the base address of each device
   constant io_base_c            : std_ulogic_vector(data_width_c-1 downto 0) := x"fffffe00";
@@ -193,9 +220,53 @@ package neorv32_package is
   constant slink_base_c         : std_ulogic_vector(data_width_c-1 downto 0) := x"fffffec0"; -- base address
   constant slink_size_c         : natural := 16*4; -- module's address space size in bytes
 
-  -- reserved --
---constant reserved_base_c      : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff00"; -- base address
---constant reserved_size_c      : natural := 32*4; -- module's address space size in bytes
+  -- Instruction Trace Encoder (TRACE) --
+  constant trace_base_c         : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff00"; -- base address
+  constant trace_size_c         : natural := 4*4; -- module's address space size in bytes
+  constant trace_ctrl_addr_c    : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff00";
+  constant trace_wptr_addr_c    : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff04";
+  constant trace_rptr_addr_c    : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff08";
+  constant trace_data_addr_c    : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff0c";
+
+  -- Block Memory Copy/Fill Engine (MEMCPY) --
+  constant memcpy_base_c        : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff10"; -- base address
+  constant memcpy_size_c        : natural := 4*4; -- module's address space size in bytes
+  constant memcpy_ct_addr_c     : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff10";
+  constant memcpy_src_addr_c    : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff14";
+  constant memcpy_dst_addr_c    : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff18";
+  constant memcpy_num_addr_c    : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff1c";
+
+  -- Direct Memory Access Controller (DMA) --
+  constant dma_base_c           : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff20"; -- base address
+  constant dma_size_c           : natural := 8*4; -- module's address space size in bytes
+  constant dma_ctrl_addr_c      : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff20";
+  constant dma_stat_addr_c      : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff24";
+  constant dma_src_addr_c       : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff28";
+  constant dma_dst_addr_c       : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff2c";
+  constant dma_cfg_addr_c       : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff30";
+--constant dma_reserved0_addr_c : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff34";
+--constant dma_reserved1_addr_c : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff38";
+--constant dma_reserved2_addr_c : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff3c";
+
+  -- Core-Local Interruptor (CLINT) --
+  constant clint_base_c         : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff40"; -- base address
+  constant clint_size_c         : natural := 16*4; -- module's address space size in bytes
+  constant clint_msip0_addr_c   : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff40";
+  constant clint_msip1_addr_c   : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff44";
+  constant clint_msip2_addr_c   : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff48";
+  constant clint_msip3_addr_c   : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff4c";
+--constant clint_reserved0_addr_c : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff50";
+--constant clint_reserved1_addr_c : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff54";
+--constant clint_reserved2_addr_c : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff58";
+--constant clint_reserved3_addr_c : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff5c";
+  constant clint_cmp0_lo_addr_c : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff60";
+  constant clint_cmp0_hi_addr_c : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff64";
+  constant clint_cmp1_lo_addr_c : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff68";
+  constant clint_cmp1_hi_addr_c : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff6c";
+  constant clint_cmp2_lo_addr_c : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff70";
+  constant clint_cmp2_hi_addr_c : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff74";
+  constant clint_cmp3_lo_addr_c : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff78";
+  constant clint_cmp3_hi_addr_c : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff7c";
 
   -- External Interrupt Controller (XIRQ) --
   constant xirq_base_c          : std_ulogic_vector(data_width_c-1 downto 0) := x"ffffff80"; -- base address
@@ -631,11 +702,22 @@ package neorv32_package is
   constant csr_pmpaddr61_c      : std_ulogic_vector(11 downto 0) := x"3ed";
   constant csr_pmpaddr62_c      : std_ulogic_vector(11 downto 0) := x"3ee";
   constant csr_pmpaddr63_c      : std_ulogic_vector(11 downto 0) := x"3ef";
+  -- trigger module registers --
+  constant csr_class_trigger_c  : std_ulogic_vector(08 downto 0) := x"7a" & "0"; -- trigger module registers
+  constant csr_tselect_c        : std_ulogic_vector(11 downto 0) := x"7a0";
+  constant csr_tdata1_c         : std_ulogic_vector(11 downto 0) := x"7a1";
+  constant csr_tdata2_c         : std_ulogic_vector(11 downto 0) := x"7a2";
+  constant csr_tdata3_c         : std_ulogic_vector(11 downto 0) := x"7a3";
+  constant csr_tinfo_c          : std_ulogic_vector(11 downto 0) := x"7a4";
+  constant csr_tcontrol_c       : std_ulogic_vector(11 downto 0) := x"7a5";
   -- debug mode registers --
   constant csr_class_debug_c    : std_ulogic_vector(09 downto 0) := x"7b" & "00"; -- debug registers
   constant csr_dcsr_c           : std_ulogic_vector(11 downto 0) := x"7b0";
   constant csr_dpc_c            : std_ulogic_vector(11 downto 0) := x"7b1";
   constant csr_dscratch0_c      : std_ulogic_vector(11 downto 0) := x"7b2";
+  -- <<< custom (NEORV32-specific) read/write CSRs >>> --
+  constant csr_micachectl_c     : std_ulogic_vector(11 downto 0) := x"7c0";
+  constant csr_micachepre_c     : std_ulogic_vector(11 downto 0) := x"7c1";
   -- machine counters/timers --
   constant csr_mcycle_c         : std_ulogic_vector(11 downto 0) := x"b00";
   constant csr_minstret_c       : std_ulogic_vector(11 downto 0) := x"b02";
@@ -782,7 +864,8 @@ package neorv32_package is
   constant trap_firq14_c   : std_ulogic_vector(6 downto 0) := "1" & "0" & "11110"; -- 1.30: fast interrupt 14
   constant trap_firq15_c   : std_ulogic_vector(6 downto 0) := "1" & "0" & "11111"; -- 1.31: fast interrupt 15
   -- entering debug mode - cause --
-  constant trap_db_break_c : std_ulogic_vector(6 downto 0) := "0" & "1" & "00010"; -- break instruction (sync / EXCEPTION)
+  constant trap_db_break_c : std_ulogic_vector(6 downto 0) := "0" & "1" & "00001"; -- break instruction (sync / EXCEPTION)
+  constant trap_db_trig_c  : std_ulogic_vector(6 downto 0) := "0" & "1" & "00010"; -- hardware trigger (sync / EXCEPTION)
   constant trap_db_halt_c  : std_ulogic_vector(6 downto 0) := "1" & "1" & "00011"; -- external halt request (async / IRQ)
   constant trap_db_step_c  : std_ulogic_vector(6 downto 0) := "1" & "1" & "00100"; -- single-stepping (async / IRQ)
 
@@ -801,8 +884,9 @@ package neorv32_package is
   constant exception_laccess_c   : natural :=  9; -- load access fault
   -- for debug mode only --
   constant exception_db_break_c  : natural := 10; -- enter debug mode via ebreak instruction ("sync EXCEPTION")
+  constant exception_db_trig_c   : natural := 11; -- enter debug mode via hardware trigger ("sync EXCEPTION")
   --
-  constant exception_width_c     : natural := 11; -- length of this list in bits
+  constant exception_width_c     : natural := 12; -- length of this list in bits
   -- interrupt source bits --
   constant interrupt_nm_irq_c    : natural :=  0; -- non-maskable interrupt
   constant interrupt_msw_irq_c   : natural :=  1; -- machine software interrupt
@@ -852,8 +936,12 @@ package neorv32_package is
   constant hpmcnt_event_tbranch_c : natural := 12; -- Conditional taken branch
   constant hpmcnt_event_trap_c    : natural := 13; -- Entered trap
   constant hpmcnt_event_illegal_c : natural := 14; -- Illegal instruction exception
+  constant hpmcnt_event_pf_use_c  : natural := 15; -- I-cache: useful prefetch (prefetched block was used)
+  constant hpmcnt_event_pf_nuse_c : natural := 16; -- I-cache: useless prefetch (prefetched block was discarded)
+  constant hpmcnt_event_ic_acc_c  : natural := 17; -- I-cache: access
+  constant hpmcnt_event_ic_miss_c : natural := 18; -- I-cache: miss
   --
-  constant hpmcnt_event_size_c    : natural := 15; -- length of this list
+  constant hpmcnt_event_size_c    : natural := 19; -- length of this list
 
   -- Clock Generator ------------------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
@@ -873,10 +961,12 @@ package neorv32_package is
       -- General --
       CLOCK_FREQUENCY              : natural;           -- clock frequency of clk_i in Hz
       USER_CODE                    : std_ulogic_vector(31 downto 0) := x"00000000"; -- custom user code
-      HW_THREAD_ID                 : natural := 0;      -- hardware thread id (32-bit)
+      HW_THREAD_ID                 : natural := 0;      -- hardware thread id (32-bit) of the first hart
+      CPU_NUM_HARTS                : natural := 1;      -- number of CPU cores (harts) (1..4)
       INT_BOOTLOADER_EN            : boolean := false;  -- boot configuration: true = boot explicit bootloader; false = boot from int/ext (I)MEM
       -- On-Chip Debugger (OCD) --
       ON_CHIP_DEBUGGER_EN          : boolean := false;  -- implement on-chip debugger
+      ON_CHIP_DEBUGGER_SBA_EN      : boolean := false;  -- implement system bus access (SBA) master and abstract memory access in debug module
       -- RISC-V CPU Extensions --
       CPU_EXTENSION_RISCV_A        : boolean := false;  -- implement atomic extension?
       CPU_EXTENSION_RISCV_C        : boolean := false;  -- implement compressed extension?
@@ -892,23 +982,41 @@ package neorv32_package is
       FAST_SHIFT_EN                : boolean := false;  -- use barrel shifter for shift operations
       CPU_CNT_WIDTH                : natural := 64;     -- total width of CPU cycle and instret counters (0..64)
       CPU_IPB_ENTRIES              : natural := 2;      -- entries is instruction prefetch buffer, has to be a power of 2
+      CPU_NUM_TRIGGERS             : natural := 0;      -- number of hardware trigger module triggers (0..16)
       -- Physical Memory Protection (PMP) --
       PMP_NUM_REGIONS              : natural := 0;      -- number of regions (0..64)
-      PMP_MIN_GRANULARITY          : natural := 64*1024; -- minimal region granularity in bytes, has to be a power of 2, min 8 bytes
+      PMP_MIN_GRANULARITY          : natural := 64*1024; -- minimal region granularity in bytes, has to be a power of 2, min 4 bytes
       -- Hardware Performance Monitors (HPM) --
       HPM_NUM_CNTS                 : natural := 0;      -- number of implemented HPM counters (0..29)
       HPM_CNT_WIDTH                : natural := 40;     -- total size of HPM counters (0..64)
       -- Internal Instruction memory (IMEM) --
       MEM_INT_IMEM_EN              : boolean := false;  -- implement processor-internal instruction memory
       MEM_INT_IMEM_SIZE            : natural := 16*1024; -- size of processor-internal instruction memory in bytes
+      MEM_INT_IMEM_BASE            : std_ulogic_vector(31 downto 0) := ispace_base_c; -- base address of processor-internal instruction memory
       -- Internal Data memory (DMEM) --
       MEM_INT_DMEM_EN              : boolean := false;  -- implement processor-internal data memory
       MEM_INT_DMEM_SIZE            : natural := 8*1024; -- size of processor-internal data memory in bytes
+      MEM_INT_DMEM_BASE            : std_ulogic_vector(31 downto 0) := dspace_base_c; -- base address of processor-internal data memory
+      -- Additional internal memory banks (XMEM) --
+      MEM_INT_XMEM_BASE            : xmem_base_t := (others => x"00000000"); -- base addresses of additional internal memory banks
+      MEM_INT_XMEM_SIZE            : xmem_size_t := (others => 0); -- sizes of additional internal memory banks in bytes (0 = not implemented)
+
+      -- Tightly-coupled memory ports (TCM) --
+      MEM_INT_TCM_EN               : boolean := false;  -- connect internal IMEM/DMEM directly to the CPU's fetch/load-store paths
+
+      -- Bus switch crossbar (XBAR) --
+      BUS_XBAR_EN                  : boolean := false;  -- fetch from internal IMEM/BOOTROM in parallel to data accesses
       -- Internal Cache memory (iCACHE) --
       ICACHE_EN                    : boolean := false;  -- implement instruction cache
       ICACHE_NUM_BLOCKS            : natural := 4;      -- i-cache: number of blocks (min 1), has to be a power of 2
       ICACHE_BLOCK_SIZE            : natural := 64;     -- i-cache: block size in bytes (min 4), has to be a power of 2
       ICACHE_ASSOCIATIVITY         : natural := 1;      -- i-cache: associativity / number of sets (1=direct_mapped), has to be a power of 2
+      ICACHE_REPLACEMENT           : natural := 0;      -- i-cache: replacement policy: 0 = (pseudo-)LRU, 1 = random
+      ICACHE_PREFETCH_EN           : boolean := false;  -- i-cache: implement next-line prefetcher
+      -- Execute in place flash controller (XIP) --
+      XIP_EN                       : boolean := false;  -- implement execute-in-place flash controller?
+      XIP_BASE                     : std_ulogic_vector(31 downto 0) := x"20000000"; -- base address of the memory-mapped flash window
+      XIP_SIZE                     : natural := 16*1024*1024; -- size of the memory-mapped flash window in bytes (max 16MB), has to be a power of 2
       -- External memory interface (WISHBONE) --
       MEM_EXT_EN                   : boolean := false;  -- implement external memory bus interface?
       MEM_EXT_TIMEOUT              : natural := 255;    -- cycles after a pending bus access auto-terminates (0 = disabled)
@@ -924,13 +1032,22 @@ package neorv32_package is
       XIRQ_NUM_CH                  : natural := 0;      -- number of external IRQ channels (0..32)
       XIRQ_TRIGGER_TYPE            : std_ulogic_vector(31 downto 0) := x"FFFFFFFF"; -- trigger type: 0=level, 1=edge
       XIRQ_TRIGGER_POLARITY        : std_ulogic_vector(31 downto 0) := x"FFFFFFFF"; -- trigger polarity: 0=low-level/falling-edge, 1=high-level/rising-edge
+      -- Instruction Trace Encoder (TRACE) --
+      TRACE_EN                     : boolean := false;  -- implement instruction trace encoder?
+      TRACE_BUFFER_DEPTH           : natural := 1024;   -- trace buffer size in 32-bit words (0..32k), has to be a power of two; 0 = stream port only
       -- Processor peripherals --
       IO_GPIO_EN                   : boolean := false;  -- implement general purpose input/output port unit (GPIO)?
       IO_MTIME_EN                  : boolean := false;  -- implement machine system timer (MTIME)?
       IO_UART0_EN                  : boolean := false;  -- implement primary universal asynchronous receiver/transmitter (UART0)?
       IO_UART1_EN                  : boolean := false;  -- implement secondary universal asynchronous receiver/transmitter (UART1)?
+      UART0_RX_FIFO                : natural := 1;      -- UART0 RX fifo depth, has to be a power of two, min 1
+      UART0_TX_FIFO                : natural := 1;      -- UART0 TX fifo depth, has to be a power of two, min 1
+      UART1_RX_FIFO                : natural := 1;      -- UART1 RX fifo depth, has to be a power of two, min 1
+      UART1_TX_FIFO                : natural := 1;      -- UART1 TX fifo depth, has to be a power of two, min 1
       IO_SPI_EN                    : boolean := false;  -- implement serial peripheral interface (SPI)?
+      SPI_FIFO                     : natural := 1;      -- SPI TX/RX fifo depth, has to be a power of two, min 1
       IO_TWI_EN                    : boolean := false;  -- implement two-wire interface (TWI)?
+      TWI_FIFO                     : natural := 1;      -- TWI command/RX fifo depth, has to be a power of two, min 1
       IO_PWM_NUM_CH                : natural := 0;      -- number of PWM channels to implement (0..60); 0 = disabled
       IO_WDT_EN                    : boolean := false;  -- implement watch dog timer (WDT)?
       IO_TRNG_EN                   : boolean := false;  -- implement true random number generator (TRNG)?
@@ -939,7 +1056,9 @@ package neorv32_package is
       IO_CFS_IN_SIZE               : positive := 32;    -- size of CFS input conduit in bits
       IO_CFS_OUT_SIZE              : positive := 32;    -- size of CFS output conduit in bits
       IO_NEOLED_EN                 : boolean := false;  -- implement NeoPixel-compatible smart LED interface (NEOLED)?
-      IO_NEOLED_TX_FIFO            : natural := 1       -- NEOLED TX FIFO depth, 1..32k, has to be a power of two
+      IO_NEOLED_TX_FIFO            : natural := 1;      -- NEOLED TX FIFO depth, 1..32k, has to be a power of two
+      IO_DMA_NUM_CH                : natural := 0;      -- number of DMA channels (0..4); 0 = DMA disabled
+      IO_MEMCPY_EN                 : boolean := false   -- implement block memory copy/fill engine (MEMCPY)?
     );
     port (
       -- Global control --
@@ -974,6 +1093,10 @@ package neorv32_package is
       slink_rx_dat_i : in  sdata_8x32_t := (others => (others => 'U')); -- input data
       slink_rx_val_i : in  std_ulogic_vector(7 downto 0) := (others => 'L'); -- valid input
       slink_rx_rdy_o : out std_ulogic_vector(7 downto 0); -- ready to receive
+      -- Instruction trace stream interface (available if TRACE_EN = true) --
+      trace_tx_dat_o : out std_ulogic_vector(31 downto 0); -- output data
+      trace_tx_val_o : out std_ulogic; -- valid output
+      trace_tx_rdy_i : in  std_ulogic := 'L'; -- ready to send
       -- GPIO (available if IO_GPIO_EN = true) --
       gpio_o         : out std_ulogic_vector(63 downto 0); -- parallel output
       gpio_i         : in  std_ulogic_vector(63 downto 0) := (others => 'U'); -- parallel input
@@ -992,6 +1115,12 @@ package neorv32_package is
       spi_sdo_o      : out std_ulogic; -- controller data out, peripheral data in
       spi_sdi_i      : in  std_ulogic := 'U'; -- controller data in, peripheral data out
       spi_csn_o      : out std_ulogic_vector(07 downto 0); -- SPI CS
+      -- XIP flash interface (available if XIP_EN = true) --
+      xip_csn_o      : out std_ulogic; -- chip-select, low-active
+      xip_clk_o      : out std_ulogic; -- serial clock
+      xip_dat_i      : in  std_ulogic_vector(03 downto 0) := (others => 'L'); -- IO0..IO3 input
+      xip_dat_o      : out std_ulogic_vector(03 downto 0); -- IO0..IO3 output
+      xip_dat_oe_o   : out std_ulogic_vector(03 downto 0); -- IO0..IO3 output enable, high-active
       -- TWI (available if IO_TWI_EN = true) --
       twi_sda_io     : inout std_logic := 'U'; -- twi serial data line
       twi_scl_io     : inout std_logic := 'U'; -- twi serial clock line
@@ -1039,12 +1168,18 @@ package neorv32_package is
       FAST_SHIFT_EN                : boolean; -- use barrel shifter for shift operations
       CPU_CNT_WIDTH                : natural; -- total width of CPU cycle and instret counters (0..64)
       CPU_IPB_ENTRIES              : natural; -- entries is instruction prefetch buffer, has to be a power of 2
+      CPU_NUM_TRIGGERS             : natural; -- number of hardware trigger module triggers (0..16)
       -- Physical Memory Protection (PMP) --
       PMP_NUM_REGIONS              : natural; -- number of regions (0..64)
-      PMP_MIN_GRANULARITY          : natural; -- minimal region granularity in bytes, has to be a power of 2, min 8 bytes
+      PMP_MIN_GRANULARITY          : natural; -- minimal region granularity in bytes, has to be a power of 2, min 4 bytes
       -- Hardware Performance Monitors (HPM) --
       HPM_NUM_CNTS                 : natural; -- number of implemented HPM counters (0..29)
-      HPM_CNT_WIDTH                : natural  -- total size of HPM counters (0..64)
+      HPM_CNT_WIDTH                : natural; -- total size of HPM counters (0..64)
+      -- Tightly-Coupled Memories (TCM) --
+      TCM_IMEM_BASE                : std_ulogic_vector(31 downto 0); -- instruction TCM base address
+      TCM_IMEM_SIZE                : natural; -- instruction TCM size in bytes (0 = no instruction TCM)
+      TCM_DMEM_BASE                : std_ulogic_vector(31 downto 0); -- data TCM base address
+      TCM_DMEM_SIZE                : natural  -- data TCM size in bytes (0 = no data TCM)
     );
     port (
       -- global control --
@@ -1075,6 +1210,17 @@ package neorv32_package is
       d_bus_err_i    : in  std_ulogic; -- bus transfer error
       d_bus_fence_o  : out std_ulogic; -- executed FENCE operation
       d_bus_priv_o   : out std_ulogic_vector(1 downto 0); -- privilege level
+      -- instruction tightly-coupled memory (TCM) interface --
+      i_tcm_addr_o   : out std_ulogic_vector(data_width_c-1 downto 0); -- access address
+      i_tcm_re_o     : out std_ulogic; -- read enable
+      i_tcm_rdata_i  : in  std_ulogic_vector(data_width_c-1 downto 0); -- read data
+      -- data tightly-coupled memory (TCM) interface --
+      d_tcm_addr_o   : out std_ulogic_vector(data_width_c-1 downto 0); -- access address
+      d_tcm_wdata_o  : out std_ulogic_vector(data_width_c-1 downto 0); -- write data
+      d_tcm_ben_o    : out std_ulogic_vector(03 downto 0); -- byte enable
+      d_tcm_we_o     : out std_ulogic; -- write enable
+      d_tcm_re_o     : out std_ulogic; -- read enable
+      d_tcm_rdata_i  : in  std_ulogic_vector(data_width_c-1 downto 0); -- read data
       -- system time input from MTIME --
       time_i         : in  std_ulogic_vector(63 downto 0); -- current system time
       -- non-maskable interrupt --
@@ -1086,7 +1232,15 @@ package neorv32_package is
       -- fast interrupts (custom) --
       firq_i         : in  std_ulogic_vector(15 downto 0);
       -- debug mode (halt) request --
-      db_halt_req_i  : in  std_ulogic
+      db_halt_req_i  : in  std_ulogic;
+      -- external HPM events --
+      icache_ev_i    : in  std_ulogic_vector(03 downto 0); -- i-cache events: 0 = useful prefetch, 1 = useless prefetch, 2 = access, 3 = miss
+      -- i-cache locking (custom CSRs) --
+      icache_ctrl_o  : out std_ulogic_vector(02 downto 0); -- i-cache control: 0 = lock preloaded blocks, 1 = unlock all blocks, 2 = preload request
+      icache_addr_o  : out std_ulogic_vector(data_width_c-1 downto 0); -- i-cache preload address
+      icache_stat_i  : in  std_ulogic_vector(01 downto 0); -- i-cache status: 0 = preload in progress, 1 = preload failed
+      -- instruction trace port --
+      trace_o        : out cpu_trace_if_t -- program flow discontinuity events
     );
   end component;
 
@@ -1112,9 +1266,10 @@ package neorv32_package is
       -- Extension Options --
       CPU_CNT_WIDTH                : natural; -- total width of CPU cycle and instret counters (0..64)
       CPU_IPB_ENTRIES              : natural; -- entries is instruction prefetch buffer, has to be a power of 2
+      CPU_NUM_TRIGGERS             : natural; -- number of hardware trigger module triggers (0..16)
       -- Physical memory protection (PMP) --
       PMP_NUM_REGIONS              : natural; -- number of regions (0..64)
-      PMP_MIN_GRANULARITY          : natural; -- minimal region granularity in bytes, has to be a power of 2, min 8 bytes
+      PMP_MIN_GRANULARITY          : natural; -- minimal region granularity in bytes, has to be a power of 2, min 4 bytes
       -- Hardware Performance Monitors (HPM) --
       HPM_NUM_CNTS                 : natural; -- number of implemented HPM counters (0..29)
       HPM_CNT_WIDTH                : natural  -- total size of HPM counters (0..64)
@@ -1127,7 +1282,9 @@ package neorv32_package is
       -- status input --
       alu_idone_i   : in  std_ulogic; -- ALU iterative operation done
       bus_i_wait_i  : in  std_ulogic; -- wait for bus
+      bus_i_pipe_i  : in  std_ulogic; -- fetch address is located in the pipelined instruction TCM
       bus_d_wait_i  : in  std_ulogic; -- wait for bus
+      bus_d_tcm_i   : in  std_ulogic; -- data access address is located in data TCM
       excl_state_i  : in  std_ulogic; -- atomic/exclusive access lock status
       -- data input --
       instr_i       : in  std_ulogic_vector(data_width_c-1 downto 0); -- instruction
@@ -1139,6 +1296,7 @@ package neorv32_package is
       fetch_pc_o    : out std_ulogic_vector(data_width_c-1 downto 0); -- PC for instruction fetch
       curr_pc_o     : out std_ulogic_vector(data_width_c-1 downto 0); -- current PC (corresponding to current instruction)
       csr_rdata_o   : out std_ulogic_vector(data_width_c-1 downto 0); -- CSR read data
+      bus_d_tcm_o   : out std_ulogic_vector(1 downto 0); -- data TCM access request (0 = read, 1 = write)
       -- FPU interface --
       fpu_flags_i   : in  std_ulogic_vector(04 downto 0); -- exception flags
       -- debug mode (halt) request --
@@ -1163,7 +1321,15 @@ package neorv32_package is
       ma_store_i    : in  std_ulogic; -- misaligned store data address
       be_instr_i    : in  std_ulogic; -- bus error on instruction access
       be_load_i     : in  std_ulogic; -- bus error on load data access
-      be_store_i    : in  std_ulogic  -- bus error on store data access
+      be_store_i    : in  std_ulogic; -- bus error on store data access
+      -- external HPM events --
+      icache_ev_i   : in  std_ulogic_vector(03 downto 0); -- i-cache events: 0 = useful prefetch, 1 = useless prefetch, 2 = access, 3 = miss
+      -- i-cache locking (custom CSRs) --
+      icache_ctrl_o : out std_ulogic_vector(02 downto 0); -- i-cache control: 0 = lock preloaded blocks, 1 = unlock all blocks, 2 = preload request
+      icache_addr_o : out std_ulogic_vector(data_width_c-1 downto 0); -- i-cache preload address
+      icache_stat_i : in  std_ulogic_vector(01 downto 0); -- i-cache status: 0 = preload in progress, 1 = preload failed
+      -- instruction trace port --
+      trace_o       : out cpu_trace_if_t -- program flow discontinuity events
     );
   end component;
 
@@ -1292,7 +1458,12 @@ package neorv32_package is
       CPU_EXTENSION_RISCV_C : boolean; -- implement compressed extension?
       -- Physical memory protection (PMP) --
       PMP_NUM_REGIONS       : natural; -- number of regions (0..64)
-      PMP_MIN_GRANULARITY   : natural  -- minimal region granularity in bytes, has to be a power of 2, min 8 bytes
+      PMP_MIN_GRANULARITY   : natural; -- minimal region granularity in bytes, has to be a power of 2, min 4 bytes
+      -- Tightly-coupled memories (TCM) --
+      TCM_IMEM_BASE         : std_ulogic_vector(31 downto 0); -- instruction TCM base address
+      TCM_IMEM_SIZE         : natural; -- instruction TCM size in bytes (0 = no instruction TCM)
+      TCM_DMEM_BASE         : std_ulogic_vector(31 downto 0); -- data TCM base address
+      TCM_DMEM_SIZE         : natural  -- data TCM size in bytes (0 = no data TCM)
     );
     port (
       -- global control --
@@ -1303,6 +1474,7 @@ package neorv32_package is
       fetch_pc_i     : in  std_ulogic_vector(data_width_c-1 downto 0); -- PC for instruction fetch
       instr_o        : out std_ulogic_vector(data_width_c-1 downto 0); -- instruction
       i_wait_o       : out std_ulogic; -- wait for fetch to complete
+      i_pipe_o       : out std_ulogic; -- fetch address is located in the pipelined instruction TCM
       --
       ma_instr_o     : out std_ulogic; -- misaligned instruction address
       be_instr_o     : out std_ulogic; -- bus error on instruction access
@@ -1312,6 +1484,8 @@ package neorv32_package is
       rdata_o        : out std_ulogic_vector(data_width_c-1 downto 0); -- read data
       mar_o          : out std_ulogic_vector(data_width_c-1 downto 0); -- current memory address register
       d_wait_o       : out std_ulogic; -- wait for access to complete
+      d_tcm_o        : out std_ulogic; -- data access address (MAR) is located in data TCM
+      tcm_req_i      : in  std_ulogic_vector(1 downto 0); -- data TCM access request (0 = read, 1 = write)
       --
       excl_state_o   : out std_ulogic; -- atomic/exclusive access status
       ma_load_o      : out std_ulogic; -- misaligned load data address
@@ -1342,7 +1516,18 @@ package neorv32_package is
       d_bus_lock_o   : out std_ulogic; -- exclusive access request
       d_bus_ack_i    : in  std_ulogic; -- bus transfer acknowledge
       d_bus_err_i    : in  std_ulogic; -- bus transfer error
-      d_bus_fence_o  : out std_ulogic  -- fence operation
+      d_bus_fence_o  : out std_ulogic; -- fence operation
+      -- instruction TCM --
+      i_tcm_addr_o   : out std_ulogic_vector(data_width_c-1 downto 0); -- access address
+      i_tcm_re_o     : out std_ulogic; -- read enable
+      i_tcm_rdata_i  : in  std_ulogic_vector(data_width_c-1 downto 0); -- read data
+      -- data TCM --
+      d_tcm_addr_o   : out std_ulogic_vector(data_width_c-1 downto 0); -- access address
+      d_tcm_wdata_o  : out std_ulogic_vector(data_width_c-1 downto 0); -- write data
+      d_tcm_ben_o    : out std_ulogic_vector(03 downto 0); -- byte enable
+      d_tcm_we_o     : out std_ulogic; -- write enable
+      d_tcm_re_o     : out std_ulogic; -- read enable
+      d_tcm_rdata_i  : in  std_ulogic_vector(data_width_c-1 downto 0)  -- read data
     );
   end component;
 
@@ -1355,9 +1540,18 @@ package neorv32_package is
       -- Internal instruction memory --
       MEM_INT_IMEM_EN   : boolean; -- implement processor-internal instruction memory
       MEM_INT_IMEM_SIZE : natural; -- size of processor-internal instruction memory in bytes
+      MEM_INT_IMEM_BASE : std_ulogic_vector(31 downto 0); -- base address of processor-internal instruction memory
       -- Internal data memory --
       MEM_INT_DMEM_EN   : boolean; -- implement processor-internal data memory
-      MEM_INT_DMEM_SIZE : natural  -- size of processor-internal data memory in bytes
+      MEM_INT_DMEM_SIZE : natural; -- size of processor-internal data memory in bytes
+      MEM_INT_DMEM_BASE : std_ulogic_vector(31 downto 0); -- base address of processor-internal data memory
+      -- Additional internal memory banks --
+      MEM_INT_XMEM_BASE : xmem_base_t; -- base addresses of additional internal memory banks
+      MEM_INT_XMEM_SIZE : xmem_size_t; -- sizes of additional internal memory banks in bytes (0 = not implemented)
+      -- Execute in place flash window --
+      XIP_EN            : boolean; -- implement execute-in-place flash controller
+      XIP_BASE          : std_ulogic_vector(31 downto 0); -- base address of the memory-mapped flash window
+      XIP_SIZE          : natural   -- size of the memory-mapped flash window in bytes
     );
     port (
       -- host access --
@@ -1378,13 +1572,22 @@ package neorv32_package is
     generic (
       ICACHE_NUM_BLOCKS : natural; -- number of blocks (min 1), has to be a power of 2
       ICACHE_BLOCK_SIZE : natural; -- block size in bytes (min 4), has to be a power of 2
-      ICACHE_NUM_SETS   : natural  -- associativity / number of sets (1=direct_mapped), has to be a power of 2
+      ICACHE_NUM_SETS    : natural; -- associativity / number of sets (1=direct_mapped), has to be a power of 2
+      ICACHE_REPLACEMENT : natural; -- replacement policy: 0 = (pseudo-)LRU, 1 = random
+      ICACHE_PREFETCH    : boolean  -- implement next-line prefetcher
     );
     port (
       -- global control --
       clk_i         : in  std_ulogic; -- global clock, rising edge
       rstn_i        : in  std_ulogic; -- global reset, low-active, async
       clear_i       : in  std_ulogic; -- cache clear
+      hpm_ev_o      : out std_ulogic_vector(03 downto 0); -- HPM events: 0 = useful prefetch, 1 = useless prefetch, 2 = access, 3 = miss
+      -- cache locking --
+      lock_i        : in  std_ulogic; -- lock preloaded blocks
+      unlock_i      : in  std_ulogic; -- unlock all blocks
+      preload_i     : in  std_ulogic; -- preload block request
+      preload_adr_i : in  std_ulogic_vector(data_width_c-1 downto 0); -- preload address
+      stat_o        : out std_ulogic_vector(01 downto 0); -- status: 0 = preload in progress, 1 = preload failed
       -- host controller interface --
       host_addr_i   : in  std_ulogic_vector(data_width_c-1 downto 0); -- bus access address
       host_rdata_o  : out std_ulogic_vector(data_width_c-1 downto 0); -- bus read data
@@ -1411,7 +1614,8 @@ package neorv32_package is
   component neorv32_busswitch
     generic (
       PORT_CA_READ_ONLY : boolean; -- set if controller port A is read-only
-      PORT_CB_READ_ONLY : boolean  -- set if controller port B is read-only
+      PORT_CB_READ_ONLY : boolean; -- set if controller port B is read-only
+      PORT_CB_XBAR      : boolean  -- implement dedicated (crossbar) read path for controller port B
     );
     port (
       -- global control --
@@ -1437,6 +1641,7 @@ package neorv32_package is
       cb_bus_lock_i   : in  std_ulogic; -- exclusive access request
       cb_bus_ack_o    : out std_ulogic; -- bus transfer acknowledge
       cb_bus_err_o    : out std_ulogic; -- bus transfer error
+      cb_bus_xsel_i   : in  std_ulogic := '0'; -- route access to crossbar port
       -- peripheral bus --
       p_bus_src_o     : out std_ulogic; -- access source: 0 = A, 1 = B
       p_bus_addr_o    : out std_ulogic_vector(data_width_c-1 downto 0); -- bus access address
@@ -1447,7 +1652,51 @@ package neorv32_package is
       p_bus_re_o      : out std_ulogic; -- read enable
       p_bus_lock_o    : out std_ulogic; -- exclusive access request
       p_bus_ack_i     : in  std_ulogic; -- bus transfer acknowledge
-      p_bus_err_i     : in  std_ulogic  -- bus transfer error
+      p_bus_err_i     : in  std_ulogic; -- bus transfer error
+      -- crossbar bus (controller B only, read-only) --
+      x_bus_addr_o    : out std_ulogic_vector(data_width_c-1 downto 0); -- bus access address
+      x_bus_rdata_i   : in  std_ulogic_vector(data_width_c-1 downto 0) := (others => '0'); -- bus read data
+      x_bus_re_o      : out std_ulogic; -- read enable
+      x_bus_ack_i     : in  std_ulogic := '0'; -- bus transfer acknowledge
+      x_bus_err_i     : in  std_ulogic := '0'  -- bus transfer error
+    );
+  end component;
+
+  -- Component: Multi-Port Bus Arbiter ------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  component neorv32_bus_arbiter
+    generic (
+      NUM_PORTS : natural -- number of controller ports (1..8)
+    );
+    port (
+      -- global control --
+      clk_i         : in  std_ulogic; -- global clock, rising edge
+      rstn_i        : in  std_ulogic; -- global reset, low-active, async
+      -- controller interfaces (packed) --
+      m_bus_addr_i  : in  std_ulogic_vector(NUM_PORTS*data_width_c-1 downto 0); -- bus access address
+      m_bus_rdata_o : out std_ulogic_vector(data_width_c-1 downto 0); -- bus read data (shared by all ports)
+      m_bus_wdata_i : in  std_ulogic_vector(NUM_PORTS*data_width_c-1 downto 0); -- bus write data
+      m_bus_ben_i   : in  std_ulogic_vector(NUM_PORTS*4-1 downto 0); -- byte enable
+      m_bus_we_i    : in  std_ulogic_vector(NUM_PORTS-1 downto 0); -- write enable
+      m_bus_re_i    : in  std_ulogic_vector(NUM_PORTS-1 downto 0); -- read enable
+      m_bus_lock_i  : in  std_ulogic_vector(NUM_PORTS-1 downto 0); -- exclusive access request
+      m_bus_src_i   : in  std_ulogic_vector(NUM_PORTS-1 downto 0); -- access source (1=instruction fetch, 0=data access)
+      m_bus_priv_i  : in  std_ulogic_vector(NUM_PORTS*2-1 downto 0); -- current privilege level
+      m_bus_ack_o   : out std_ulogic_vector(NUM_PORTS-1 downto 0); -- bus transfer acknowledge
+      m_bus_err_o   : out std_ulogic_vector(NUM_PORTS-1 downto 0); -- bus transfer error
+      -- peripheral bus --
+      p_bus_sel_o   : out std_ulogic_vector(NUM_PORTS-1 downto 0); -- one-hot: currently selected controller port
+      p_bus_src_o   : out std_ulogic; -- access source of selected port
+      p_bus_priv_o  : out std_ulogic_vector(1 downto 0); -- privilege level of selected port
+      p_bus_addr_o  : out std_ulogic_vector(data_width_c-1 downto 0); -- bus access address
+      p_bus_rdata_i : in  std_ulogic_vector(data_width_c-1 downto 0); -- bus read data
+      p_bus_wdata_o : out std_ulogic_vector(data_width_c-1 downto 0); -- bus write data
+      p_bus_ben_o   : out std_ulogic_vector(03 downto 0); -- byte enable
+      p_bus_we_o    : out std_ulogic; -- write enable
+      p_bus_re_o    : out std_ulogic; -- read enable
+      p_bus_lock_o  : out std_ulogic; -- exclusive access request
+      p_bus_ack_i   : in  std_ulogic; -- bus transfer acknowledge
+      p_bus_err_i   : in  std_ulogic  -- bus transfer error
     );
   end component;
 
@@ -1469,17 +1718,23 @@ package neorv32_package is
     generic (
       IMEM_BASE    : std_ulogic_vector(31 downto 0); -- memory base address
       IMEM_SIZE    : natural; -- processor-internal instruction memory size in bytes
-      IMEM_AS_IROM : boolean  -- implement IMEM as pre-initialized read-only memory?
+      IMEM_AS_IROM : boolean; -- implement IMEM as pre-initialized read-only memory?
+      IMEM_TCM_EN  : boolean  -- second read port (TCM / bus crossbar) in use?
     );
     port (
-      clk_i  : in  std_ulogic; -- global clock line
-      rden_i : in  std_ulogic; -- read enable
-      wren_i : in  std_ulogic; -- write enable
-      ben_i  : in  std_ulogic_vector(03 downto 0); -- byte write enable
-      addr_i : in  std_ulogic_vector(31 downto 0); -- address
-      data_i : in  std_ulogic_vector(31 downto 0); -- data in
-      data_o : out std_ulogic_vector(31 downto 0); -- data out
-      ack_o  : out std_ulogic -- transfer acknowledge
+      clk_i      : in  std_ulogic; -- global clock line
+      -- processor bus --
+      rden_i     : in  std_ulogic; -- read enable
+      wren_i     : in  std_ulogic; -- write enable
+      ben_i      : in  std_ulogic_vector(03 downto 0); -- byte write enable
+      addr_i     : in  std_ulogic_vector(31 downto 0); -- address
+      data_i     : in  std_ulogic_vector(31 downto 0); -- data in
+      data_o     : out std_ulogic_vector(31 downto 0); -- data out
+      ack_o      : out std_ulogic; -- transfer acknowledge
+      -- tightly-coupled memory port (CPU instruction fetch, fixed latency of one cycle) --
+      tcm_re_i   : in  std_ulogic := '0'; -- read enable
+      tcm_addr_i : in  std_ulogic_vector(31 downto 0) := (others => '0'); -- address
+      tcm_data_o : out std_ulogic_vector(31 downto 0) -- data out
     );
   end component;
 
@@ -1487,18 +1742,27 @@ package neorv32_package is
   -- -------------------------------------------------------------------------------------------
   component neorv32_dmem
     generic (
-      DMEM_BASE : std_ulogic_vector(31 downto 0); -- memory base address
-      DMEM_SIZE : natural -- processor-internal instruction memory size in bytes
+      DMEM_BASE   : std_ulogic_vector(31 downto 0); -- memory base address
+      DMEM_SIZE   : natural; -- processor-internal instruction memory size in bytes
+      DMEM_TCM_EN : boolean  -- TCM port in use?
     );
     port (
-      clk_i  : in  std_ulogic; -- global clock line
-      rden_i : in  std_ulogic; -- read enable
-      wren_i : in  std_ulogic; -- write enable
-      ben_i  : in  std_ulogic_vector(03 downto 0); -- byte write enable
-      addr_i : in  std_ulogic_vector(31 downto 0); -- address
-      data_i : in  std_ulogic_vector(31 downto 0); -- data in
-      data_o : out std_ulogic_vector(31 downto 0); -- data out
-      ack_o  : out std_ulogic -- transfer acknowledge
+      clk_i      : in  std_ulogic; -- global clock line
+      -- processor bus --
+      rden_i     : in  std_ulogic; -- read enable
+      wren_i     : in  std_ulogic; -- write enable
+      ben_i      : in  std_ulogic_vector(03 downto 0); -- byte write enable
+      addr_i     : in  std_ulogic_vector(31 downto 0); -- address
+      data_i     : in  std_ulogic_vector(31 downto 0); -- data in
+      data_o     : out std_ulogic_vector(31 downto 0); -- data out
+      ack_o      : out std_ulogic; -- transfer acknowledge
+      -- tightly-coupled memory port (CPU load/store, fixed latency of one cycle) --
+      tcm_re_i   : in  std_ulogic := '0'; -- read enable
+      tcm_we_i   : in  std_ulogic := '0'; -- write enable
+      tcm_ben_i  : in  std_ulogic_vector(03 downto 0) := (others => '0'); -- byte write enable
+      tcm_addr_i : in  std_ulogic_vector(31 downto 0) := (others => '0'); -- address
+      tcm_data_i : in  std_ulogic_vector(31 downto 0) := (others => '0'); -- data in
+      tcm_data_o : out std_ulogic_vector(31 downto 0) -- data out
     );
   end component;
 
@@ -1509,11 +1773,17 @@ package neorv32_package is
       BOOTROM_BASE : std_ulogic_vector(31 downto 0) -- boot ROM base address
     );
     port (
-      clk_i  : in  std_ulogic; -- global clock line
-      rden_i : in  std_ulogic; -- read enable
-      addr_i : in  std_ulogic_vector(31 downto 0); -- address
-      data_o : out std_ulogic_vector(31 downto 0); -- data out
-      ack_o  : out std_ulogic -- transfer acknowledge
+      clk_i       : in  std_ulogic; -- global clock line
+      -- processor bus --
+      rden_i      : in  std_ulogic; -- read enable
+      addr_i      : in  std_ulogic_vector(31 downto 0); -- address
+      data_o      : out std_ulogic_vector(31 downto 0); -- data out
+      ack_o       : out std_ulogic; -- transfer acknowledge
+      -- crossbar port (instruction fetch) --
+      xbar_rden_i : in  std_ulogic := '0'; -- read enable
+      xbar_addr_i : in  std_ulogic_vector(31 downto 0) := (others => '0'); -- address
+      xbar_data_o : out std_ulogic_vector(31 downto 0); -- data out
+      xbar_ack_o  : out std_ulogic -- transfer acknowledge
     );
   end component;
 
@@ -1536,6 +1806,29 @@ package neorv32_package is
     );
   end component;
 
+  -- Component: Core-Local Interruptor (CLINT) ----------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  component neorv32_clint
+    generic (
+      NUM_HARTS : natural -- number of harts (1..4)
+    );
+    port (
+      -- host access --
+      clk_i       : in  std_ulogic; -- global clock line
+      addr_i      : in  std_ulogic_vector(31 downto 0); -- address
+      rden_i      : in  std_ulogic; -- read enable
+      wren_i      : in  std_ulogic; -- write enable
+      data_i      : in  std_ulogic_vector(31 downto 0); -- data in
+      data_o      : out std_ulogic_vector(31 downto 0); -- data out
+      ack_o       : out std_ulogic; -- transfer acknowledge
+      -- system time --
+      time_i      : in  std_ulogic_vector(63 downto 0); -- current system time
+      -- interrupts (one per hart) --
+      msw_irq_o   : out std_ulogic_vector(NUM_HARTS-1 downto 0); -- machine software interrupt
+      mtime_irq_o : out std_ulogic_vector(NUM_HARTS-1 downto 0)  -- machine timer interrupt
+    );
+  end component;
+
   -- Component: General Purpose Input/Output Port (GPIO) ------------------------------------
   -- -------------------------------------------------------------------------------------------
   component neorv32_gpio
@@ -1580,7 +1873,9 @@ package neorv32_package is
   -- -------------------------------------------------------------------------------------------
   component neorv32_uart
     generic (
-      UART_PRIMARY : boolean -- true = primary UART (UART0), false = secondary UART (UART1)
+      UART_PRIMARY : boolean; -- true = primary UART (UART0), false = secondary UART (UART1)
+      UART_RX_FIFO : natural; -- RX fifo depth, has to be a power of two, min 1
+      UART_TX_FIFO : natural  -- TX fifo depth, has to be a power of two, min 1
     );
     port (
       -- host access --
@@ -1609,6 +1904,9 @@ package neorv32_package is
   -- Component: Serial Peripheral Interface (SPI) -------------------------------------------
   -- -------------------------------------------------------------------------------------------
   component neorv32_spi
+    generic (
+      SPI_FIFO : natural -- TX/RX fifo depth, has to be a power of two, min 1
+    );
     port (
       -- host access --
       clk_i       : in  std_ulogic; -- global clock line
@@ -1627,13 +1925,16 @@ package neorv32_package is
       spi_sdi_i   : in  std_ulogic; -- controller data in, peripheral data out
       spi_csn_o   : out std_ulogic_vector(07 downto 0); -- SPI CS
       -- interrupt --
-      irq_o       : out std_ulogic -- transmission done interrupt
+      irq_o       : out std_ulogic -- transmission done / FIFO level interrupt
     );
   end component;
 
   -- Component: Two-Wire Interface (TWI) ----------------------------------------------------
   -- -------------------------------------------------------------------------------------------
   component neorv32_twi
+    generic (
+      TWI_FIFO : natural -- command/RX fifo depth, has to be a power of two, min 1
+    );
     port (
       -- host access --
       clk_i       : in  std_ulogic; -- global clock line
@@ -1650,7 +1951,7 @@ package neorv32_package is
       twi_sda_io  : inout std_logic; -- serial data line
       twi_scl_io  : inout std_logic; -- serial clock line
       -- interrupt --
-      irq_o       : out std_ulogic -- transfer done IRQ
+      irq_o       : out std_ulogic -- transfer done / sequence done IRQ
     );
   end component;
 
@@ -1699,9 +2000,18 @@ package neorv32_package is
       -- Internal instruction memory --
       MEM_INT_IMEM_EN   : boolean; -- implement processor-internal instruction memory
       MEM_INT_IMEM_SIZE : natural; -- size of processor-internal instruction memory in bytes
+      MEM_INT_IMEM_BASE : std_ulogic_vector(31 downto 0); -- base address of processor-internal instruction memory
       -- Internal data memory --
       MEM_INT_DMEM_EN   : boolean; -- implement processor-internal data memory
       MEM_INT_DMEM_SIZE : natural; -- size of processor-internal data memory in bytes
+      MEM_INT_DMEM_BASE : std_ulogic_vector(31 downto 0); -- base address of processor-internal data memory
+      -- Additional internal memory banks --
+      MEM_INT_XMEM_BASE : xmem_base_t; -- base addresses of additional internal memory banks
+      MEM_INT_XMEM_SIZE : xmem_size_t; -- sizes of additional internal memory banks in bytes (0 = not implemented)
+      -- Execute in place flash window --
+      XIP_EN            : boolean; -- implement execute-in-place flash controller
+      XIP_BASE          : std_ulogic_vector(31 downto 0); -- base address of the memory-mapped flash window
+      XIP_SIZE          : natural;  -- size of the memory-mapped flash window in bytes
       -- Interface Configuration --
       BUS_TIMEOUT       : natural; -- cycles after an UNACKNOWLEDGED bus access triggers a bus fault exception
       PIPE_MODE         : boolean; -- protocol: false=classic/standard wishbone mode, true=pipelined wishbone mode
@@ -1827,6 +2137,118 @@ package neorv32_package is
     );
   end component;
 
+  -- Component: Execute In Place Flash Controller (XIP) -------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  component neorv32_xip
+    generic (
+      XIP_BASE : std_ulogic_vector(31 downto 0); -- base address of the memory-mapped flash window
+      XIP_SIZE : natural -- size of the memory-mapped flash window in bytes, has to be a power of 2 (max 16MB)
+    );
+    port (
+      -- global control --
+      clk_i        : in  std_ulogic; -- global clock line
+      rstn_i       : in  std_ulogic; -- global reset line, low-active
+      -- host access --
+      addr_i       : in  std_ulogic_vector(31 downto 0); -- address
+      rden_i       : in  std_ulogic; -- read enable
+      wren_i       : in  std_ulogic; -- write enable
+      data_i       : in  std_ulogic_vector(31 downto 0); -- data in
+      data_o       : out std_ulogic_vector(31 downto 0); -- data out
+      ack_o        : out std_ulogic; -- transfer acknowledge
+      err_o        : out std_ulogic; -- transfer error
+      -- clock generator --
+      clkgen_en_o  : out std_ulogic; -- enable clock generator
+      clkgen_i     : in  std_ulogic_vector(07 downto 0);
+      -- flash interface --
+      xip_csn_o    : out std_ulogic; -- chip-select, low-active
+      xip_clk_o    : out std_ulogic; -- serial clock
+      xip_dat_i    : in  std_ulogic_vector(03 downto 0); -- IO0..IO3 input
+      xip_dat_o    : out std_ulogic_vector(03 downto 0); -- IO0..IO3 output
+      xip_dat_oe_o : out std_ulogic_vector(03 downto 0)  -- IO0..IO3 output enable, high-active
+    );
+  end component;
+
+  -- Component: Block Memory Copy/Fill Engine (MEMCPY) --------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  component neorv32_memcpy
+    port (
+      -- host access --
+      clk_i       : in  std_ulogic; -- global clock line
+      rstn_i      : in  std_ulogic; -- global reset line, low-active
+      addr_i      : in  std_ulogic_vector(31 downto 0); -- address
+      rden_i      : in  std_ulogic; -- read enable
+      wren_i      : in  std_ulogic; -- write enable
+      data_i      : in  std_ulogic_vector(31 downto 0); -- data in
+      data_o      : out std_ulogic_vector(31 downto 0); -- data out
+      ack_o       : out std_ulogic; -- transfer acknowledge
+      -- bus controller interface --
+      bus_addr_o  : out std_ulogic_vector(31 downto 0); -- bus access address
+      bus_rdata_i : in  std_ulogic_vector(31 downto 0); -- bus read data
+      bus_wdata_o : out std_ulogic_vector(31 downto 0); -- bus write data
+      bus_ben_o   : out std_ulogic_vector(03 downto 0); -- byte enable
+      bus_we_o    : out std_ulogic; -- write enable
+      bus_re_o    : out std_ulogic; -- read enable
+      bus_ack_i   : in  std_ulogic; -- bus transfer acknowledge
+      bus_err_i   : in  std_ulogic  -- bus transfer error
+    );
+  end component;
+
+  -- Component: Direct Memory Access Controller (DMA) ---------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  component neorv32_dma
+    generic (
+      DMA_NUM_CH : natural -- number of DMA channels (1..4)
+    );
+    port (
+      -- host access --
+      clk_i       : in  std_ulogic; -- global clock line
+      rstn_i      : in  std_ulogic; -- global reset line, low-active
+      addr_i      : in  std_ulogic_vector(31 downto 0); -- address
+      rden_i      : in  std_ulogic; -- read enable
+      wren_i      : in  std_ulogic; -- write enable
+      data_i      : in  std_ulogic_vector(31 downto 0); -- data in
+      data_o      : out std_ulogic_vector(31 downto 0); -- data out
+      ack_o       : out std_ulogic; -- transfer acknowledge
+      -- bus controller interface --
+      bus_addr_o  : out std_ulogic_vector(31 downto 0); -- bus access address
+      bus_rdata_i : in  std_ulogic_vector(31 downto 0); -- bus read data
+      bus_wdata_o : out std_ulogic_vector(31 downto 0); -- bus write data
+      bus_ben_o   : out std_ulogic_vector(03 downto 0); -- byte enable
+      bus_we_o    : out std_ulogic; -- write enable
+      bus_re_o    : out std_ulogic; -- read enable
+      bus_ack_i   : in  std_ulogic; -- bus transfer acknowledge
+      bus_err_i   : in  std_ulogic; -- bus transfer error
+      -- trigger events --
+      trig_i      : in  std_ulogic_vector(11 downto 0); -- peripheral events (fast interrupt request lines 0..11)
+      -- interrupt --
+      irq_o       : out std_ulogic -- transfer done interrupt
+    );
+  end component;
+
+  -- Component: Instruction Trace Encoder (TRACE) -------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  component neorv32_trace
+    generic (
+      TRACE_BUFFER_DEPTH : natural -- trace buffer size in 32-bit words (0..32k), has to be a power of two; 0 = stream port only
+    );
+    port (
+      -- host access --
+      clk_i          : in  std_ulogic; -- global clock line
+      addr_i         : in  std_ulogic_vector(31 downto 0); -- address
+      rden_i         : in  std_ulogic; -- read enable
+      wren_i         : in  std_ulogic; -- write enable
+      data_i         : in  std_ulogic_vector(31 downto 0); -- data in
+      data_o         : out std_ulogic_vector(31 downto 0); -- data out
+      ack_o          : out std_ulogic; -- transfer acknowledge
+      -- CPU trace port --
+      trace_i        : in  cpu_trace_if_t; -- discontinuity events
+      -- TX stream interface --
+      trace_tx_dat_o : out std_ulogic_vector(31 downto 0); -- output data
+      trace_tx_val_o : out std_ulogic; -- valid output
+      trace_tx_rdy_i : in  std_ulogic  -- ready to send
+    );
+  end component;
+
   -- Component: External Interrupt Controller (XIRQ) ----------------------------------------
   -- -------------------------------------------------------------------------------------------
   component neorv32_xirq
@@ -1859,17 +2281,24 @@ package neorv32_package is
       CLOCK_FREQUENCY      : natural; -- clock frequency of clk_i in Hz
       INT_BOOTLOADER_EN    : boolean; -- boot configuration: true = boot explicit bootloader; false = boot from int/ext (I)MEM
       USER_CODE            : std_ulogic_vector(31 downto 0) := x"00000000"; -- custom user code
+      CPU_NUM_HARTS        : natural := 1; -- number of CPU cores (harts)
       -- Internal Instruction memory --
       MEM_INT_IMEM_EN      : boolean; -- implement processor-internal instruction memory
       MEM_INT_IMEM_SIZE    : natural; -- size of processor-internal instruction memory in bytes
+      MEM_INT_IMEM_BASE    : std_ulogic_vector(31 downto 0) := ispace_base_c; -- base address of processor-internal instruction memory
       -- Internal Data memory --
       MEM_INT_DMEM_EN      : boolean; -- implement processor-internal data memory
       MEM_INT_DMEM_SIZE    : natural; -- size of processor-internal data memory in bytes
+      MEM_INT_DMEM_BASE    : std_ulogic_vector(31 downto 0) := dspace_base_c; -- base address of processor-internal data memory
+      MEM_INT_XMEM_NUM     : natural := 0; -- number of implemented additional internal memory banks
+      MEM_INT_TCM_EN       : boolean := false; -- internal IMEM/DMEM connected via tightly-coupled memory ports
+      BUS_XBAR_EN          : boolean := false; -- bus switch crossbar path for instruction fetches
       -- Internal Cache memory --
       ICACHE_EN            : boolean; -- implement instruction cache
       ICACHE_NUM_BLOCKS    : natural; -- i-cache: number of blocks (min 2), has to be a power of 2
       ICACHE_BLOCK_SIZE    : natural; -- i-cache: block size in bytes (min 4), has to be a power of 2
       ICACHE_ASSOCIATIVITY : natural; -- i-cache: associativity (min 1), has to be a power 2
+      ICACHE_REPLACEMENT   : natural; -- i-cache: replacement policy: 0 = (pseudo-)LRU, 1 = random
       -- External memory interface --
       MEM_EXT_EN           : boolean; -- implement external memory bus interface?
       MEM_EXT_BIG_ENDIAN   : boolean; -- byte order: true=big-endian, false=little-endian
@@ -1888,7 +2317,10 @@ package neorv32_package is
       IO_CFS_EN            : boolean; -- implement custom functions subsystem (CFS)?
       IO_SLINK_EN          : boolean; -- implement stream link interface?
       IO_NEOLED_EN         : boolean; -- implement NeoPixel-compatible smart LED interface (NEOLED)?
-      IO_XIRQ_NUM_CH       : natural  -- number of external interrupt (XIRQ) channels to implement
+      IO_XIRQ_NUM_CH       : natural; -- number of external interrupt (XIRQ) channels to implement
+      IO_TRACE_EN          : boolean; -- implement instruction trace encoder (TRACE)?
+      IO_DMA_EN            : boolean := false; -- implement direct memory access controller (DMA)?
+      IO_MEMCPY_EN         : boolean := false  -- implement block memory copy/fill engine (MEMCPY)?
     );
     port (
       -- host access --
@@ -1929,6 +2361,10 @@ package neorv32_package is
   -- Component: On-Chip Debugger - Debug Module (DM) ----------------------------------------
   -- -------------------------------------------------------------------------------------------
   component neorv32_debug_dm
+    generic (
+      NUM_HARTS : natural := 1;    -- number of harts (1..4)
+      SBA_EN    : boolean := false -- implement system bus access (SBA) master and abstract memory access?
+    );
     port (
       -- global control --
       clk_i            : in  std_ulogic; -- global clock line
@@ -1951,9 +2387,19 @@ package neorv32_package is
       cpu_data_i       : in  std_ulogic_vector(31 downto 0); -- data in
       cpu_data_o       : out std_ulogic_vector(31 downto 0); -- data out
       cpu_ack_o        : out std_ulogic; -- transfer acknowledge
+      cpu_hart_i       : in  std_ulogic_vector(01 downto 0); -- index of the hart that performs the current access
       -- CPU control --
       cpu_ndmrstn_o    : out std_ulogic; -- soc reset
-      cpu_halt_req_o   : out std_ulogic  -- request hart to halt (enter debug mode)
+      cpu_halt_req_o   : out std_ulogic_vector(NUM_HARTS-1 downto 0); -- request hart to halt (enter debug mode)
+      -- system bus access (SBA) master (available if SBA_EN = true) --
+      sba_addr_o       : out std_ulogic_vector(31 downto 0); -- bus access address
+      sba_rdata_i      : in  std_ulogic_vector(31 downto 0); -- bus read data
+      sba_wdata_o      : out std_ulogic_vector(31 downto 0); -- bus write data
+      sba_ben_o        : out std_ulogic_vector(03 downto 0); -- byte enable
+      sba_we_o         : out std_ulogic; -- write enable
+      sba_re_o         : out std_ulogic; -- read enable
+      sba_ack_i        : in  std_ulogic; -- bus transfer acknowledge
+      sba_err_i        : in  std_ulogic  -- bus transfer error
     );
   end component;
 
@@ -2281,5 +2727,40 @@ package body neorv32_package is
     return mem_v;
   end function mem32_init_f;
 
+  -- Function: Number of implemented additional internal memory banks (XMEM) ----------------
+  -- -------------------------------------------------------------------------------------------
+  function xmem_num_f(size : xmem_size_t) return natural is
+    variable tmp_v : natural;
+  begin
+    tmp_v := 0;
+    for i in 0 to xmem_num_banks_c-1 loop
+      if (size(i) /= 0) then
+        tmp_v := tmp_v + 1;
+      end if;
+    end loop; -- i
+    return tmp_v;
+  end function xmem_num_f;
+
+  -- Function: Address hits any implemented additional internal memory bank (XMEM) ----------
+  -- -------------------------------------------------------------------------------------------
+  function xmem_access_f(addr : std_ulogic_vector(31 downto 0); base : xmem_base_t; size : xmem_size_t) return std_ulogic is
+    variable hit_v : std_ulogic;
+    variable tmp_v : std_ulogic;
+  begin
+    tmp_v := '0';
+    for i in 0 to xmem_num_banks_c-1 loop
+      if (size(i) /= 0) then
+        hit_v := '1';
+        for j in 0 to 31 loop -- compare all address bits above the bank's size boundary
+          if (j >= index_size_f(size(i))) and (addr(j) /= base(i)(j)) then
+            hit_v := '0';
+          end if;
+        end loop; -- j
+        tmp_v := tmp_v or hit_v;
+      end if;
+    end loop; -- i
+    return tmp_v;
+  end function xmem_access_f;
+
 
 end neorv32_package;
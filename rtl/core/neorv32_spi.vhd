@@ -3,7 +3,8 @@
 -- # ********************************************************************************************* #
 -- # Frame format: 8/16/24/32-bit receive/transmit data, always MSB first, 2 clock modes,          #
 -- # 8 pre-scaled clocks (derived from system clock), 8 dedicated chip-select lines (low-active).  #
--- # Interrupt: SPI_transfer_done                                                                  #
+-- # Configurable TX/RX FIFOs allow back-to-back (continuous) multi-word transfers.                #
+-- # Interrupt: transfer done / TX FIFO empty / TX FIFO < half-full / RX FIFO >= half-full         #
 -- # ********************************************************************************************* #
 -- # BSD 3-Clause License                                                                          #
 -- #                                                                                               #
@@ -44,6 +45,9 @@ library neorv32;
 use neorv32.neorv32_package.all;
 
 entity neorv32_spi is
+  generic (
+    SPI_FIFO : natural -- TX/RX fifo depth, has to be a power of two, min 1
+  );
   port (
     -- host access --
     clk_i       : in  std_ulogic; -- global clock line
@@ -62,7 +66,7 @@ entity neorv32_spi is
     spi_sdi_i   : in  std_ulogic; -- controller data in, peripheral data out
     spi_csn_o   : out std_ulogic_vector(07 downto 0); -- SPI CS
     -- interrupt --
-    irq_o       : out std_ulogic -- transmission done interrupt
+    irq_o       : out std_ulogic -- transmission done / FIFO level interrupt
   );
 end neorv32_spi;
 
@@ -73,24 +77,36 @@ architecture neorv32_spi_rtl of neorv32_spi is
   constant lo_abb_c : natural := index_size_f(spi_size_c); -- low address boundary bit
 
   -- control reg bits --
-  constant ctrl_spi_cs0_c    : natural :=  0; -- r/w: spi CS 0
-  constant ctrl_spi_cs1_c    : natural :=  1; -- r/w: spi CS 1
-  constant ctrl_spi_cs2_c    : natural :=  2; -- r/w: spi CS 2
-  constant ctrl_spi_cs3_c    : natural :=  3; -- r/w: spi CS 3
-  constant ctrl_spi_cs4_c    : natural :=  4; -- r/w: spi CS 4
-  constant ctrl_spi_cs5_c    : natural :=  5; -- r/w: spi CS 5
-  constant ctrl_spi_cs6_c    : natural :=  6; -- r/w: spi CS 6
-  constant ctrl_spi_cs7_c    : natural :=  7; -- r/w: spi CS 7
+  constant ctrl_spi_cs0_c      : natural :=  0; -- r/w: spi CS 0
+  constant ctrl_spi_cs1_c      : natural :=  1; -- r/w: spi CS 1
+  constant ctrl_spi_cs2_c      : natural :=  2; -- r/w: spi CS 2
+  constant ctrl_spi_cs3_c      : natural :=  3; -- r/w: spi CS 3
+  constant ctrl_spi_cs4_c      : natural :=  4; -- r/w: spi CS 4
+  constant ctrl_spi_cs5_c      : natural :=  5; -- r/w: spi CS 5
+  constant ctrl_spi_cs6_c      : natural :=  6; -- r/w: spi CS 6
+  constant ctrl_spi_cs7_c      : natural :=  7; -- r/w: spi CS 7
+  --
+  constant ctrl_spi_en_c       : natural :=  8; -- r/w: spi enable
+  constant ctrl_spi_cpha_c     : natural :=  9; -- r/w: spi clock phase
+  constant ctrl_spi_prsc0_c    : natural := 10; -- r/w: spi prescaler select bit 0
+  constant ctrl_spi_prsc1_c    : natural := 11; -- r/w: spi prescaler select bit 1
+  constant ctrl_spi_prsc2_c    : natural := 12; -- r/w: spi prescaler select bit 2
+  constant ctrl_spi_size0_c    : natural := 13; -- r/w: data size (00:  8-bit, 01: 16-bit)
+  constant ctrl_spi_size1_c    : natural := 14; -- r/w: data size (10: 24-bit, 11: 32-bit)
+  constant ctrl_spi_irq0_c     : natural := 15; -- r/w: IRQ mode (00: each transfer done, 01: TX FIFO empty and idle)
+  constant ctrl_spi_irq1_c     : natural := 16; -- r/w: IRQ mode (10: TX FIFO < half-full, 11: RX FIFO >= half-full)
+  --
+  constant ctrl_spi_rx_avail_c : natural := 17; -- r/-: RX FIFO not empty
+  constant ctrl_spi_rx_half_c  : natural := 18; -- r/-: RX FIFO at least half-full
+  constant ctrl_spi_rx_full_c  : natural := 19; -- r/-: RX FIFO full
+  constant ctrl_spi_tx_empty_c : natural := 20; -- r/-: TX FIFO empty
+  constant ctrl_spi_tx_nhalf_c : natural := 21; -- r/-: TX FIFO not at least half-full
+  constant ctrl_spi_tx_full_c  : natural := 22; -- r/-: TX FIFO full
   --
-  constant ctrl_spi_en_c     : natural :=  8; -- r/w: spi enable
-  constant ctrl_spi_cpha_c   : natural :=  9; -- r/w: spi clock phase
-  constant ctrl_spi_prsc0_c  : natural := 10; -- r/w: spi prescaler select bit 0
-  constant ctrl_spi_prsc1_c  : natural := 11; -- r/w: spi prescaler select bit 1
-  constant ctrl_spi_prsc2_c  : natural := 12; -- r/w: spi prescaler select bit 2
-  constant ctrl_spi_size0_c  : natural := 13; -- r/w: data size (00:  8-bit, 01: 16-bit)
-  constant ctrl_spi_size1_c  : natural := 14; -- r/w: data size (10: 24-bit, 11: 32-bit)
+  constant ctrl_spi_fifo_lsb_c : natural := 23; -- r/-: log2(FIFO size), lsb
+  constant ctrl_spi_fifo_msb_c : natural := 26; -- r/-: log2(FIFO size), msb
   --
-  constant ctrl_spi_busy_c   : natural := 31; -- r/-: spi transceiver is busy
+  constant ctrl_spi_busy_c     : natural := 31; -- r/-: spi transceiver is busy or TX FIFO not empty
 
   -- access control --
   signal acc_en : std_ulogic; -- module access enable
@@ -99,27 +115,53 @@ architecture neorv32_spi_rtl of neorv32_spi is
   signal rden   : std_ulogic; -- read enable
 
   -- accessible regs --
-  signal ctrl        : std_ulogic_vector(14 downto 0);
-  signal tx_data_reg : std_ulogic_vector(31 downto 0);
-  signal rx_data     : std_ulogic_vector(31 downto 0);
+  signal ctrl    : std_ulogic_vector(16 downto 0);
+  signal rx_data : std_ulogic_vector(31 downto 0);
+  signal data_rd : std_ulogic_vector(31 downto 0); -- last data read from RX FIFO
 
   -- clock generator --
   signal spi_clk : std_ulogic;
 
   -- spi transceiver --
-  signal spi_start      : std_ulogic;
   signal spi_busy       : std_ulogic;
+  signal spi_done       : std_ulogic; -- transfer completed (data in shift register is valid)
   signal spi_state0     : std_ulogic;
   signal spi_state1     : std_ulogic;
   signal spi_rtx_sreg   : std_ulogic_vector(31 downto 0);
-  signal spi_rx_data    : std_ulogic_vector(31 downto 0);
   signal spi_bitcnt     : std_ulogic_vector(05 downto 0);
   signal spi_bitcnt_max : std_ulogic_vector(05 downto 0);
   signal spi_sdi_ff0    : std_ulogic;
   signal spi_sdi_ff1    : std_ulogic;
 
+  -- FIFO interface --
+  type fifo_t is record
+    clear : std_ulogic; -- sync reset, high-active
+    level : std_ulogic_vector(15 downto 0); -- fill level (zero-extended)
+    we    : std_ulogic; -- write enable
+    re    : std_ulogic; -- read enable
+    wdata : std_ulogic_vector(31 downto 0); -- write data
+    rdata : std_ulogic_vector(31 downto 0); -- read data
+    avail : std_ulogic; -- data available?
+    free  : std_ulogic; -- free entry available?
+    half  : std_ulogic; -- at least half-full?
+  end record;
+  signal rx_fifo, tx_fifo : fifo_t;
+
+  -- interrupt generator --
+  type irq_t is record
+    fire : std_ulogic;
+    ff   : std_ulogic;
+  end record;
+  signal irq : irq_t;
+
 begin
 
+  -- Sanity Checks --------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  assert not (is_power_of_two_f(SPI_FIFO) = false) report "NEORV32 PROCESSOR CONFIG ERROR: SPI <SPI_FIFO> has to be a power of two." severity error;
+  assert not (SPI_FIFO > 2**15) report "NEORV32 PROCESSOR CONFIG ERROR: SPI <SPI_FIFO> has to be 1..32768." severity error;
+
+
   -- Access Control -------------------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
   acc_en <= '1' when (addr_i(hi_abb_c downto lo_abb_c) = spi_base_c(hi_abb_c downto lo_abb_c)) else '0';
@@ -135,15 +177,10 @@ begin
     if rising_edge(clk_i) then
       ack_o <= acc_en and (rden_i or wren_i);
       -- write access --
-      spi_start <= '0';
       if (wren = '1') then
         if (addr = spi_ctrl_addr_c) then -- control
           ctrl <= data_i(ctrl'left downto 0);
         end if;
-        if (addr = spi_rtx_addr_c) then -- tx data
-          tx_data_reg <= data_i;
-          spi_start   <= '1';
-        end if;
       end if;
       -- read access --
       data_o <= (others => '0');
@@ -165,12 +202,33 @@ begin
           data_o(ctrl_spi_prsc2_c)  <= ctrl(ctrl_spi_prsc2_c);
           data_o(ctrl_spi_size0_c)  <= ctrl(ctrl_spi_size0_c);
           data_o(ctrl_spi_size1_c)  <= ctrl(ctrl_spi_size1_c);
+          data_o(ctrl_spi_irq0_c)   <= ctrl(ctrl_spi_irq0_c);
+          data_o(ctrl_spi_irq1_c)   <= ctrl(ctrl_spi_irq1_c);
+          --
+          data_o(ctrl_spi_rx_avail_c) <= rx_fifo.avail;
+          data_o(ctrl_spi_rx_half_c)  <= rx_fifo.half;
+          data_o(ctrl_spi_rx_full_c)  <= not rx_fifo.free;
+          data_o(ctrl_spi_tx_empty_c) <= not tx_fifo.avail;
+          data_o(ctrl_spi_tx_nhalf_c) <= not tx_fifo.half;
+          data_o(ctrl_spi_tx_full_c)  <= not tx_fifo.free;
           --
-          data_o(ctrl_spi_busy_c)   <= spi_busy;
+          data_o(ctrl_spi_fifo_msb_c downto ctrl_spi_fifo_lsb_c) <= std_ulogic_vector(to_unsigned(index_size_f(SPI_FIFO), 4));
+          --
+          data_o(ctrl_spi_busy_c)   <= spi_busy or tx_fifo.avail;
         else -- spi_rtx_addr_c
-          data_o <= rx_data;
+          if (rx_fifo.avail = '1') then -- read from RX FIFO
+            data_o <= rx_fifo.rdata;
+          else -- RX FIFO empty: return last received data
+            data_o <= data_rd;
+          end if;
         end if;
       end if;
+      -- keep last read data --
+      if (rx_fifo.clear = '1') then
+        data_rd <= (others => '0');
+      elsif (rden = '1') and (addr = spi_rtx_addr_c) and (rx_fifo.avail = '1') then
+        data_rd <= rx_fifo.rdata;
+      end if;
     end if;
   end process rw_access;
 
@@ -187,6 +245,42 @@ begin
   spi_clk <= clkgen_i(to_integer(unsigned(ctrl(ctrl_spi_prsc2_c downto ctrl_spi_prsc0_c))));
 
 
+  -- TX FIFO --------------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  tx_fifo_inst: neorv32_fifo
+  generic map (
+    FIFO_DEPTH => SPI_FIFO, -- number of fifo entries; has to be a power of two; min 1
+    FIFO_WIDTH => 32,       -- size of data elements in fifo
+    FIFO_RSYNC => false,    -- false = async read; true = sync read
+    FIFO_SAFE  => true      -- true = allow read/write only if entry available
+  )
+  port map (
+    -- control --
+    clk_i   => clk_i,                                       -- clock, rising edge
+    rstn_i  => '1',                                         -- async reset, low-active
+    clear_i => tx_fifo.clear,                               -- sync reset, high-active
+    level_o => tx_fifo.level(index_size_f(SPI_FIFO) downto 0), -- fill level
+    -- write port --
+    wdata_i => tx_fifo.wdata,                               -- write data
+    we_i    => tx_fifo.we,                                  -- write enable
+    free_o  => tx_fifo.free,                                -- at least one entry is free when set
+    -- read port --
+    re_i    => tx_fifo.re,                                  -- read enable
+    rdata_o => tx_fifo.rdata,                               -- read data
+    avail_o => tx_fifo.avail                                -- data available when set
+  );
+
+  tx_fifo.clear <= not ctrl(ctrl_spi_en_c);
+  tx_fifo.wdata <= data_i;
+  tx_fifo.we    <= '1' when (wren = '1') and (addr = spi_rtx_addr_c) else '0';
+  tx_fifo.re    <= '1' when (spi_state0 = '0') and (spi_busy = '0') and (tx_fifo.avail = '1') and (ctrl(ctrl_spi_en_c) = '1') else '0';
+
+  tx_fifo.level(15 downto index_size_f(SPI_FIFO)+1) <= (others => '0');
+
+  -- fill level monitor --
+  tx_fifo.half <= '1' when (unsigned(tx_fifo.level) >= to_unsigned(cond_sel_natural_f(boolean(SPI_FIFO > 1), SPI_FIFO/2, 1), 16)) else '0';
+
+
   -- SPI Transceiver ------------------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
   spi_rtx_unit: process(clk_i)
@@ -197,7 +291,7 @@ begin
       spi_sdi_ff1 <= spi_sdi_ff0;
 
       -- serial engine --
-      irq_o <= '0';
+      spi_done <= '0';
       if (spi_state0 = '0') or (ctrl(ctrl_spi_en_c) = '0') then -- idle or disabled
       -- --------------------------------------------------------------
         spi_bitcnt <= (others => '0');
@@ -206,8 +300,8 @@ begin
         spi_sck_o  <= '0';
         if (ctrl(ctrl_spi_en_c) = '0') then -- disabled
           spi_busy <= '0';
-        elsif (spi_start = '1') then -- start new transmission
-          spi_rtx_sreg <= tx_data_reg;
+        elsif (tx_fifo.re = '1') then -- start new transmission (data available in TX FIFO)
+          spi_rtx_sreg <= tx_fifo.rdata;
           spi_busy     <= '1';
         end if;
         spi_state0 <= spi_busy and spi_clk; -- start with next new clock pulse
@@ -245,7 +339,7 @@ begin
             if (spi_bitcnt = spi_bitcnt_max) then
               spi_state0 <= '0';
               spi_busy   <= '0';
-              irq_o      <= '1';
+              spi_done   <= '1';
             end if;
           end if;
         end if;
@@ -280,4 +374,72 @@ begin
   end process rx_mapping;
 
 
+  -- RX FIFO --------------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  rx_fifo_inst: neorv32_fifo
+  generic map (
+    FIFO_DEPTH => SPI_FIFO, -- number of fifo entries; has to be a power of two; min 1
+    FIFO_WIDTH => 32,       -- size of data elements in fifo
+    FIFO_RSYNC => false,    -- false = async read; true = sync read
+    FIFO_SAFE  => false     -- true = allow read/write only if entry available
+  )
+  port map (
+    -- control --
+    clk_i   => clk_i,                                       -- clock, rising edge
+    rstn_i  => '1',                                         -- async reset, low-active
+    clear_i => rx_fifo.clear,                               -- sync reset, high-active
+    level_o => rx_fifo.level(index_size_f(SPI_FIFO) downto 0), -- fill level
+    -- write port --
+    wdata_i => rx_fifo.wdata,                               -- write data
+    we_i    => rx_fifo.we,                                  -- write enable
+    free_o  => rx_fifo.free,                                -- at least one entry is free when set
+    -- read port --
+    re_i    => rx_fifo.re,                                  -- read enable
+    rdata_o => rx_fifo.rdata,                               -- read data
+    avail_o => rx_fifo.avail                                -- data available when set
+  );
+
+  rx_fifo.clear <= not ctrl(ctrl_spi_en_c);
+  rx_fifo.wdata <= rx_data; -- shift register is stable in the cycle after the last bit
+  rx_fifo.we    <= spi_done;
+  -- CPU read; if the FIFO is full a new word discards the oldest entry (like the legacy single data register) --
+  rx_fifo.re    <= '1' when ((rden = '1') and (addr = spi_rtx_addr_c) and (rx_fifo.avail = '1')) or ((spi_done = '1') and (rx_fifo.free = '0')) else '0';
+
+  rx_fifo.level(15 downto index_size_f(SPI_FIFO)+1) <= (others => '0');
+
+  -- fill level monitor --
+  rx_fifo.half <= '1' when (unsigned(rx_fifo.level) >= to_unsigned(cond_sel_natural_f(boolean(SPI_FIFO > 1), SPI_FIFO/2, 1), 16)) else '0';
+
+
+  -- Interrupt ------------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  -- interrupt condition: TX FIFO empty and idle / TX FIFO not at least half-full / RX FIFO at least half-full --
+  irq_select: process(ctrl, tx_fifo, rx_fifo, spi_busy)
+  begin
+    case ctrl(ctrl_spi_irq1_c downto ctrl_spi_irq0_c) is
+      when "01"   => irq.fire <= (not tx_fifo.avail) and (not spi_busy);
+      when "10"   => irq.fire <= not tx_fifo.half;
+      when "11"   => irq.fire <= rx_fifo.half;
+      when others => irq.fire <= '0'; -- "00": each completed transfer (see below)
+    end case;
+  end process irq_select;
+
+  -- IRQ event detector: fire on rising edge of the according condition --
+  irq_generator: process(clk_i)
+  begin
+    if rising_edge(clk_i) then
+      if (ctrl(ctrl_spi_en_c) = '0') then -- disabled
+        irq.ff <= '1';
+        irq_o  <= '0';
+      elsif (ctrl(ctrl_spi_irq1_c downto ctrl_spi_irq0_c) = "00") then -- single transfer done
+        irq.ff <= '1';
+        irq_o  <= spi_done;
+      else
+        irq.ff <= irq.fire;
+        irq_o  <= irq.fire and (not irq.ff);
+      end if;
+    end if;
+  end process irq_generator;
+
+
 end neorv32_spi_rtl;
@@ -48,17 +48,24 @@ entity neorv32_sysinfo is
     CLOCK_FREQUENCY      : natural; -- clock frequency of clk_i in Hz
     INT_BOOTLOADER_EN    : boolean; -- boot configuration: true = boot explicit bootloader; false = boot from int/ext (I)MEM
     USER_CODE            : std_ulogic_vector(31 downto 0) := x"00000000"; -- custom user code
+    CPU_NUM_HARTS        : natural := 1; -- number of CPU cores (harts)
     -- Internal Instruction memory --
     MEM_INT_IMEM_EN      : boolean; -- implement processor-internal instruction memory
     MEM_INT_IMEM_SIZE    : natural; -- size of processor-internal instruction memory in bytes
+    MEM_INT_IMEM_BASE    : std_ulogic_vector(31 downto 0) := ispace_base_c; -- base address of processor-internal instruction memory
     -- Internal Data memory --
     MEM_INT_DMEM_EN      : boolean; -- implement processor-internal data memory
     MEM_INT_DMEM_SIZE    : natural; -- size of processor-internal data memory in bytes
+    MEM_INT_DMEM_BASE    : std_ulogic_vector(31 downto 0) := dspace_base_c; -- base address of processor-internal data memory
+    MEM_INT_XMEM_NUM     : natural := 0; -- number of implemented additional internal memory banks
+    MEM_INT_TCM_EN       : boolean := false; -- internal IMEM/DMEM connected via tightly-coupled memory ports
+    BUS_XBAR_EN          : boolean := false; -- bus switch crossbar path for instruction fetches
     -- Internal Cache memory --
     ICACHE_EN            : boolean; -- implement instruction cache
     ICACHE_NUM_BLOCKS    : natural; -- i-cache: number of blocks (min 2), has to be a power of 2
     ICACHE_BLOCK_SIZE    : natural; -- i-cache: block size in bytes (min 4), has to be a power of 2
     ICACHE_ASSOCIATIVITY : natural; -- i-cache: associativity (min 1), has to be a power 2
+    ICACHE_REPLACEMENT   : natural; -- i-cache: replacement policy: 0 = (pseudo-)LRU, 1 = random
     -- External memory interface --
     MEM_EXT_EN           : boolean; -- implement external memory bus interface?
     MEM_EXT_BIG_ENDIAN   : boolean; -- byte order: true=big-endian, false=little-endian
@@ -77,7 +84,10 @@ entity neorv32_sysinfo is
     IO_CFS_EN            : boolean; -- implement custom functions subsystem (CFS)?
     IO_SLINK_EN          : boolean; -- implement stream link interface?
     IO_NEOLED_EN         : boolean; -- implement NeoPixel-compatible smart LED interface (NEOLED)?
-    IO_XIRQ_NUM_CH       : natural  -- number of external interrupt (XIRQ) channels to implement
+    IO_XIRQ_NUM_CH       : natural; -- number of external interrupt (XIRQ) channels to implement
+    IO_TRACE_EN          : boolean; -- implement instruction trace encoder (TRACE)?
+    IO_DMA_EN            : boolean := false; -- implement direct memory access controller (DMA)?
+    IO_MEMCPY_EN         : boolean := false  -- implement block memory copy/fill engine (MEMCPY)?
   );
   port (
     -- host access --
@@ -133,7 +143,11 @@ begin
   sysinfo_mem(2)(04) <= bool_to_ulogic_f(MEM_EXT_BIG_ENDIAN); -- is external memory bus interface using BIG-endian byte-order?
   sysinfo_mem(2)(05) <= bool_to_ulogic_f(ICACHE_EN);         -- processor-internal instruction cache implemented?
   --
-  sysinfo_mem(2)(13 downto 06) <= (others => '0'); -- reserved
+  sysinfo_mem(2)(07 downto 06) <= std_ulogic_vector(to_unsigned(CPU_NUM_HARTS-1, 2)); -- number of harts - 1
+  sysinfo_mem(2)(08) <= bool_to_ulogic_f(MEM_INT_TCM_EN); -- internal IMEM/DMEM connected via tightly-coupled memory ports?
+  sysinfo_mem(2)(09) <= bool_to_ulogic_f(BUS_XBAR_EN);    -- bus switch crossbar path for instruction fetches?
+  sysinfo_mem(2)(10) <= bool_to_ulogic_f(IO_MEMCPY_EN);   -- block memory copy/fill engine (MEMCPY) implemented?
+  sysinfo_mem(2)(13 downto 11) <= std_ulogic_vector(to_unsigned(MEM_INT_XMEM_NUM, 3)); -- number of additional internal memory banks (XMEM)
   -- Misc --
   sysinfo_mem(2)(14) <= bool_to_ulogic_f(ON_CHIP_DEBUGGER_EN); -- on-chip debugger implemented?
   sysinfo_mem(2)(15) <= bool_to_ulogic_f(dedicated_reset_c);   -- dedicated hardware reset of all core registers?
@@ -151,14 +165,16 @@ begin
   sysinfo_mem(2)(26) <= bool_to_ulogic_f(IO_UART1_EN);  -- secondary universal asynchronous receiver/transmitter (UART1) implemented?
   sysinfo_mem(2)(27) <= bool_to_ulogic_f(IO_NEOLED_EN); -- NeoPixel-compatible smart LED interface (NEOLED) implemented?
   sysinfo_mem(2)(28) <= bool_to_ulogic_f(boolean(IO_XIRQ_NUM_CH > 0)); -- external interrupt controller (XIRQ) implemented?
+  sysinfo_mem(2)(29) <= bool_to_ulogic_f(IO_TRACE_EN);  -- instruction trace encoder (TRACE) implemented?
+  sysinfo_mem(2)(30) <= bool_to_ulogic_f(boolean(CPU_NUM_HARTS > 1)); -- core-local interruptor (CLINT) implemented?
   --
-  sysinfo_mem(2)(31 downto 29) <= (others => '0'); -- reserved
+  sysinfo_mem(2)(31) <= bool_to_ulogic_f(IO_DMA_EN); -- direct memory access controller (DMA) implemented?
 
   -- SYSINFO(3): Cache configuration --
   sysinfo_mem(3)(03 downto 00) <= std_ulogic_vector(to_unsigned(index_size_f(ICACHE_BLOCK_SIZE),    4)) when (ICACHE_EN = true) else (others => '0'); -- i-cache: log2(block_size_in_bytes)
   sysinfo_mem(3)(07 downto 04) <= std_ulogic_vector(to_unsigned(index_size_f(ICACHE_NUM_BLOCKS),    4)) when (ICACHE_EN = true) else (others => '0'); -- i-cache: log2(number_of_block)
   sysinfo_mem(3)(11 downto 08) <= std_ulogic_vector(to_unsigned(index_size_f(ICACHE_ASSOCIATIVITY), 4)) when (ICACHE_EN = true) else (others => '0'); -- i-cache: log2(associativity)
-  sysinfo_mem(3)(15 downto 12) <= "0001" when (ICACHE_ASSOCIATIVITY > 1) and (ICACHE_EN = true) else (others => '0'); -- i-cache: replacement strategy (LRU only (yet))
+  sysinfo_mem(3)(15 downto 12) <= std_ulogic_vector(to_unsigned(ICACHE_REPLACEMENT+1, 4)) when (ICACHE_ASSOCIATIVITY > 1) and (ICACHE_EN = true) else (others => '0'); -- i-cache: replacement strategy (1 = LRU, 2 = random)
   --
   sysinfo_mem(3)(19 downto 16) <= (others => '0'); -- reserved - d-cache: log2(block_size)
   sysinfo_mem(3)(23 downto 20) <= (others => '0'); -- reserved - d-cache: log2(num_blocks)
@@ -166,10 +182,10 @@ begin
   sysinfo_mem(3)(31 downto 28) <= (others => '0'); -- reserved - d-cache: replacement strategy
 
   -- SYSINFO(4): Base address of instruction memory space --
-  sysinfo_mem(4) <= ispace_base_c; -- defined in neorv32_package.vhd file
+  sysinfo_mem(4) <= MEM_INT_IMEM_BASE when (MEM_INT_IMEM_EN = true) else ispace_base_c; -- IMEM base or default (neorv32_package.vhd)
 
   -- SYSINFO(5): Base address of data memory space --
-  sysinfo_mem(5) <= dspace_base_c; -- defined in neorv32_package.vhd file
+  sysinfo_mem(5) <= MEM_INT_DMEM_BASE when (MEM_INT_DMEM_EN = true) else dspace_base_c; -- DMEM base or default (neorv32_package.vhd)
 
   -- SYSINFO(6): Size of IMEM in bytes --
   sysinfo_mem(6) <= std_ulogic_vector(to_unsigned(MEM_INT_IMEM_SIZE, 32)) when (MEM_INT_IMEM_EN = true) else (others => '0');
@@ -50,11 +50,13 @@ entity neorv32_top is
     -- General --
     CLOCK_FREQUENCY              : natural;           -- clock frequency of clk_i in Hz
     USER_CODE                    : std_ulogic_vector(31 downto 0) := x"00000000"; -- custom user code
-    HW_THREAD_ID                 : natural := 0;      -- hardware thread id (32-bit)
+    HW_THREAD_ID                 : natural := 0;      -- hardware thread id (32-bit) of the first hart
+    CPU_NUM_HARTS                : natural := 1;      -- number of CPU cores (harts) (1..4)
     INT_BOOTLOADER_EN            : boolean := false;  -- boot configuration: true = boot explicit bootloader; false = boot from int/ext (I)MEM
 
     -- On-Chip Debugger (OCD) --
     ON_CHIP_DEBUGGER_EN          : boolean := false;  -- implement on-chip debugger
+    ON_CHIP_DEBUGGER_SBA_EN      : boolean := false;  -- implement system bus access (SBA) master and abstract memory access in debug module
 
     -- RISC-V CPU Extensions --
     CPU_EXTENSION_RISCV_A        : boolean := false;  -- implement atomic extension?
@@ -72,10 +74,11 @@ entity neorv32_top is
     FAST_SHIFT_EN                : boolean := false;  -- use barrel shifter for shift operations
     CPU_CNT_WIDTH                : natural := 64;     -- total width of CPU cycle and instret counters (0..64)
     CPU_IPB_ENTRIES              : natural := 2;      -- entries is instruction prefetch buffer, has to be a power of 2
+    CPU_NUM_TRIGGERS             : natural := 0;      -- number of hardware trigger module triggers (0..16)
 
     -- Physical Memory Protection (PMP) --
     PMP_NUM_REGIONS              : natural := 0;      -- number of regions (0..64)
-    PMP_MIN_GRANULARITY          : natural := 64*1024; -- minimal region granularity in bytes, has to be a power of 2, min 8 bytes
+    PMP_MIN_GRANULARITY          : natural := 64*1024; -- minimal region granularity in bytes, has to be a power of 2, min 4 bytes
 
     -- Hardware Performance Monitors (HPM) --
     HPM_NUM_CNTS                 : natural := 0;      -- number of implemented HPM counters (0..29)
@@ -84,16 +87,35 @@ entity neorv32_top is
     -- Internal Instruction memory (IMEM) --
     MEM_INT_IMEM_EN              : boolean := false;  -- implement processor-internal instruction memory
     MEM_INT_IMEM_SIZE            : natural := 16*1024; -- size of processor-internal instruction memory in bytes
+    MEM_INT_IMEM_BASE            : std_ulogic_vector(31 downto 0) := ispace_base_c; -- base address of processor-internal instruction memory
 
     -- Internal Data memory (DMEM) --
     MEM_INT_DMEM_EN              : boolean := false;  -- implement processor-internal data memory
     MEM_INT_DMEM_SIZE            : natural := 8*1024; -- size of processor-internal data memory in bytes
+    MEM_INT_DMEM_BASE            : std_ulogic_vector(31 downto 0) := dspace_base_c; -- base address of processor-internal data memory
+
+    -- Additional internal memory banks (XMEM) --
+    MEM_INT_XMEM_BASE            : xmem_base_t := (others => x"00000000"); -- base addresses of additional internal memory banks
+    MEM_INT_XMEM_SIZE            : xmem_size_t := (others => 0); -- sizes of additional internal memory banks in bytes (0 = not implemented)
+
+    -- Tightly-coupled memory ports (TCM) --
+    MEM_INT_TCM_EN               : boolean := false;  -- connect internal IMEM/DMEM directly to the CPU's fetch/load-store paths
+
+    -- Bus switch crossbar (XBAR) --
+    BUS_XBAR_EN                  : boolean := false;  -- fetch from internal IMEM/BOOTROM in parallel to data accesses
 
     -- Internal Cache memory (iCACHE) --
     ICACHE_EN                    : boolean := false;  -- implement instruction cache
     ICACHE_NUM_BLOCKS            : natural := 4;      -- i-cache: number of blocks (min 1), has to be a power of 2
     ICACHE_BLOCK_SIZE            : natural := 64;     -- i-cache: block size in bytes (min 4), has to be a power of 2
     ICACHE_ASSOCIATIVITY         : natural := 1;      -- i-cache: associativity / number of sets (1=direct_mapped), has to be a power of 2
+    ICACHE_REPLACEMENT           : natural := 0;      -- i-cache: replacement policy: 0 = (pseudo-)LRU, 1 = random
+    ICACHE_PREFETCH_EN           : boolean := false;  -- i-cache: implement next-line prefetcher
+
+    -- Execute in place flash controller (XIP) --
+    XIP_EN                       : boolean := false;  -- implement execute-in-place flash controller?
+    XIP_BASE                     : std_ulogic_vector(31 downto 0) := x"20000000"; -- base address of the memory-mapped flash window
+    XIP_SIZE                     : natural := 16*1024*1024; -- size of the memory-mapped flash window in bytes (max 16MB), has to be a power of 2
 
     -- External memory interface (WISHBONE) --
     MEM_EXT_EN                   : boolean := false;  -- implement external memory bus interface?
@@ -113,13 +135,23 @@ entity neorv32_top is
     XIRQ_TRIGGER_TYPE            : std_ulogic_vector(31 downto 0) := x"FFFFFFFF"; -- trigger type: 0=level, 1=edge
     XIRQ_TRIGGER_POLARITY        : std_ulogic_vector(31 downto 0) := x"FFFFFFFF"; -- trigger polarity: 0=low-level/falling-edge, 1=high-level/rising-edge
 
+    -- Instruction Trace Encoder (TRACE) --
+    TRACE_EN                     : boolean := false;  -- implement instruction trace encoder?
+    TRACE_BUFFER_DEPTH           : natural := 1024;   -- trace buffer size in 32-bit words (0..32k), has to be a power of two; 0 = stream port only
+
     -- Processor peripherals --
     IO_GPIO_EN                   : boolean := false;  -- implement general purpose input/output port unit (GPIO)?
     IO_MTIME_EN                  : boolean := false;  -- implement machine system timer (MTIME)?
     IO_UART0_EN                  : boolean := false;  -- implement primary universal asynchronous receiver/transmitter (UART0)?
     IO_UART1_EN                  : boolean := false;  -- implement secondary universal asynchronous receiver/transmitter (UART1)?
+    UART0_RX_FIFO                : natural := 1;      -- UART0 RX fifo depth, has to be a power of two, min 1
+    UART0_TX_FIFO                : natural := 1;      -- UART0 TX fifo depth, has to be a power of two, min 1
+    UART1_RX_FIFO                : natural := 1;      -- UART1 RX fifo depth, has to be a power of two, min 1
+    UART1_TX_FIFO                : natural := 1;      -- UART1 TX fifo depth, has to be a power of two, min 1
     IO_SPI_EN                    : boolean := false;  -- implement serial peripheral interface (SPI)?
+    SPI_FIFO                     : natural := 1;      -- SPI TX/RX fifo depth, has to be a power of two, min 1
     IO_TWI_EN                    : boolean := false;  -- implement two-wire interface (TWI)?
+    TWI_FIFO                     : natural := 1;      -- TWI command/RX fifo depth, has to be a power of two, min 1
     IO_PWM_NUM_CH                : natural := 0;      -- number of PWM channels to implement (0..60); 0 = disabled
     IO_WDT_EN                    : boolean := false;  -- implement watch dog timer (WDT)?
     IO_TRNG_EN                   : boolean := false;  -- implement true random number generator (TRNG)?
@@ -128,7 +160,9 @@ entity neorv32_top is
     IO_CFS_IN_SIZE               : positive := 32;    -- size of CFS input conduit in bits
     IO_CFS_OUT_SIZE              : positive := 32;    -- size of CFS output conduit in bits
     IO_NEOLED_EN                 : boolean := false;  -- implement NeoPixel-compatible smart LED interface (NEOLED)?
-    IO_NEOLED_TX_FIFO            : natural := 1       -- NEOLED TX FIFO depth, 1..32k, has to be a power of two
+    IO_NEOLED_TX_FIFO            : natural := 1;      -- NEOLED TX FIFO depth, 1..32k, has to be a power of two
+    IO_DMA_NUM_CH                : natural := 0;      -- number of DMA channels (0..4); 0 = DMA disabled
+    IO_MEMCPY_EN                 : boolean := false   -- implement block memory copy/fill engine (MEMCPY)?
   );
   port (
     -- Global control --
@@ -169,6 +203,11 @@ entity neorv32_top is
     slink_rx_val_i : in  std_ulogic_vector(7 downto 0) := (others => 'L'); -- valid input
     slink_rx_rdy_o : out std_ulogic_vector(7 downto 0); -- ready to receive
 
+    -- Instruction trace stream interface (available if TRACE_EN = true) --
+    trace_tx_dat_o : out std_ulogic_vector(31 downto 0); -- output data
+    trace_tx_val_o : out std_ulogic; -- valid output
+    trace_tx_rdy_i : in  std_ulogic := 'L'; -- ready to send
+
     -- GPIO (available if IO_GPIO_EN = true) --
     gpio_o         : out std_ulogic_vector(63 downto 0); -- parallel output
     gpio_i         : in  std_ulogic_vector(63 downto 0) := (others => 'U'); -- parallel input
@@ -191,6 +230,13 @@ entity neorv32_top is
     spi_sdi_i      : in  std_ulogic := 'U'; -- controller data in, peripheral data out
     spi_csn_o      : out std_ulogic_vector(07 downto 0); -- chip-select
 
+    -- XIP flash interface (available if XIP_EN = true) --
+    xip_csn_o      : out std_ulogic; -- chip-select, low-active
+    xip_clk_o      : out std_ulogic; -- serial clock
+    xip_dat_i      : in  std_ulogic_vector(03 downto 0) := (others => 'L'); -- IO0..IO3 input
+    xip_dat_o      : out std_ulogic_vector(03 downto 0); -- IO0..IO3 output
+    xip_dat_oe_o   : out std_ulogic_vector(03 downto 0); -- IO0..IO3 output enable, high-active
+
     -- TWI (available if IO_TWI_EN = true) --
     twi_sda_io     : inout std_logic := 'U'; -- twi serial data line
     twi_scl_io     : inout std_logic := 'U'; -- twi serial clock line
@@ -223,14 +269,31 @@ end neorv32_top;
 architecture neorv32_top_rtl of neorv32_top is
 
   -- CPU boot configuration --
-  constant cpu_boot_addr_c : std_ulogic_vector(31 downto 0) := cond_sel_stdulogicvector_f(INT_BOOTLOADER_EN, boot_rom_base_c, ispace_base_c);
+  constant cpu_boot_addr_c : std_ulogic_vector(31 downto 0) := cond_sel_stdulogicvector_f(INT_BOOTLOADER_EN, boot_rom_base_c,
+                                                                cond_sel_stdulogicvector_f(MEM_INT_IMEM_EN, MEM_INT_IMEM_BASE, ispace_base_c));
 
   -- alignment check for internal memories --
   constant imem_align_check_c : std_ulogic_vector(index_size_f(MEM_INT_IMEM_SIZE)-1 downto 0) := (others => '0');
   constant dmem_align_check_c : std_ulogic_vector(index_size_f(MEM_INT_DMEM_SIZE)-1 downto 0) := (others => '0');
 
   -- helpers --
-  constant io_slink_en_c : boolean := boolean(SLINK_NUM_RX > 0) or boolean(SLINK_NUM_TX > 0); -- implement slink at all?
+  constant io_slink_en_c   : boolean := boolean(SLINK_NUM_RX > 0) or boolean(SLINK_NUM_TX > 0); -- implement slink at all?
+  constant io_clint_en_c   : boolean := boolean(CPU_NUM_HARTS > 1); -- implement core-local interruptor?
+  constant io_dma_en_c     : boolean := boolean(IO_DMA_NUM_CH > 0); -- implement DMA controller?
+  constant sba_en_c        : boolean := ON_CHIP_DEBUGGER_EN and ON_CHIP_DEBUGGER_SBA_EN; -- implement debugger system bus access?
+  constant dma_port_c      : natural := CPU_NUM_HARTS + cond_sel_natural_f(sba_en_c, 1, 0); -- DMA bus arbiter port
+  constant memcpy_port_c   : natural := dma_port_c + cond_sel_natural_f(io_dma_en_c, 1, 0); -- MEMCPY bus arbiter port
+  constant num_bus_ports_c : natural := memcpy_port_c + cond_sel_natural_f(IO_MEMCPY_EN, 1, 0); -- bus arbiter ports
+
+  -- tightly-coupled memories (single-hart configurations only; LR/SC reservations are tracked on the processor bus) --
+  constant tcm_en_c      : boolean := MEM_INT_TCM_EN and (CPU_NUM_HARTS = 1);
+  constant tcm_imem_en_c : boolean := tcm_en_c and MEM_INT_IMEM_EN;
+  constant tcm_dmem_en_c : boolean := tcm_en_c and MEM_INT_DMEM_EN;
+
+  -- bus switch crossbar: dedicated instruction fetch path to IMEM (if not used as TCM) and BOOTROM (single-hart configurations only) --
+  constant xbar_en_c      : boolean := BUS_XBAR_EN and (CPU_NUM_HARTS = 1);
+  constant xbar_imem_en_c : boolean := xbar_en_c and MEM_INT_IMEM_EN and (not tcm_imem_en_c);
+  constant xbar_boot_en_c : boolean := xbar_en_c and INT_BOOTLOADER_EN;
 
   -- reset generator --
   signal rstn_gen : std_ulogic_vector(7 downto 0);
@@ -248,6 +311,7 @@ architecture neorv32_top_rtl of neorv32_top is
   signal uart0_cg_en  : std_ulogic;
   signal uart1_cg_en  : std_ulogic;
   signal spi_cg_en    : std_ulogic;
+  signal xip_cg_en    : std_ulogic;
   signal twi_cg_en    : std_ulogic;
   signal pwm_cg_en    : std_ulogic;
   signal cfs_cg_en    : std_ulogic;
@@ -268,11 +332,48 @@ architecture neorv32_top_rtl of neorv32_top is
     src    : std_ulogic; -- access source (1=instruction fetch, 0=data access)
     lock   : std_ulogic; -- exclusive access request
   end record;
-  signal cpu_i, i_cache, cpu_d, p_bus : bus_interface_t;
+  type bus_interface_array_t is array (0 to CPU_NUM_HARTS-1) of bus_interface_t;
+  signal cpu_i, i_cache, cpu_d, h_bus : bus_interface_array_t; -- per-hart busses
+
+  -- tightly-coupled memory interface --
+  type tcm_interface_t is record
+    addr  : std_ulogic_vector(data_width_c-1 downto 0); -- access address
+    rdata : std_ulogic_vector(data_width_c-1 downto 0); -- read data
+    wdata : std_ulogic_vector(data_width_c-1 downto 0); -- write data
+    ben   : std_ulogic_vector(03 downto 0); -- byte enable
+    we    : std_ulogic; -- write enable
+    re    : std_ulogic; -- read enable
+  end record;
+  type tcm_interface_array_t is array (0 to CPU_NUM_HARTS-1) of tcm_interface_t;
+  signal cpu_i_tcm, cpu_d_tcm : tcm_interface_array_t; -- per-hart TCM ports (only hart 0 is connected)
+  signal tcm_i_rdata, tcm_d_rdata : std_ulogic_vector(data_width_c-1 downto 0); -- IMEM/DMEM TCM read data
+
+  -- bus switch crossbar path --
+  signal x_bus           : bus_interface_array_t; -- per-hart crossbar busses (only hart 0 is connected)
+  signal xbar_sel        : std_ulogic_vector(CPU_NUM_HARTS-1 downto 0); -- route instruction fetch to crossbar bus
+  signal xbar_imem_sel   : std_ulogic; -- crossbar access to IMEM
+  signal xbar_boot_sel   : std_ulogic; -- crossbar access to BOOTROM
+  signal xbar_imem_ack   : std_ulogic; -- IMEM crossbar response
+  signal xbar_boot_rdata : std_ulogic_vector(data_width_c-1 downto 0); -- BOOTROM crossbar read data
+  signal xbar_boot_ack   : std_ulogic; -- BOOTROM crossbar response
+  signal imem_p2_re      : std_ulogic; -- IMEM second port (TCM or crossbar): read enable
+  signal imem_p2_addr    : std_ulogic_vector(data_width_c-1 downto 0); -- IMEM second port (TCM or crossbar): address
+  signal dm_sba, dma_m, memcpy_m, p_bus : bus_interface_t;
+  signal p_bus_hart    : std_ulogic_vector(1 downto 0); -- hart that currently owns the processor bus
+
+  -- processor bus arbiter (packed controller ports) --
+  signal arb_addr, arb_wdata : std_ulogic_vector(num_bus_ports_c*data_width_c-1 downto 0);
+  signal arb_rdata           : std_ulogic_vector(data_width_c-1 downto 0);
+  signal arb_ben             : std_ulogic_vector(num_bus_ports_c*4-1 downto 0);
+  signal arb_priv            : std_ulogic_vector(num_bus_ports_c*2-1 downto 0);
+  signal arb_we, arb_re      : std_ulogic_vector(num_bus_ports_c-1 downto 0);
+  signal arb_lock, arb_src   : std_ulogic_vector(num_bus_ports_c-1 downto 0);
+  signal arb_ack, arb_err    : std_ulogic_vector(num_bus_ports_c-1 downto 0);
+  signal arb_sel             : std_ulogic_vector(num_bus_ports_c-1 downto 0);
 
   -- debug core interface (DCI) --
   signal dci_ndmrstn  : std_ulogic;
-  signal dci_halt_req : std_ulogic;
+  signal dci_halt_req : std_ulogic_vector(CPU_NUM_HARTS-1 downto 0);
 
   -- debug module interface (DMI) --
   type dmi_t is record
@@ -304,7 +405,9 @@ architecture neorv32_top_rtl of neorv32_top is
 
   -- module response bus - device ID --
   type resp_bus_id_t is (RESP_IMEM, RESP_DMEM, RESP_BOOTROM, RESP_WISHBONE, RESP_GPIO, RESP_MTIME, RESP_UART0, RESP_UART1, RESP_SPI,
-                         RESP_TWI, RESP_PWM, RESP_WDT, RESP_TRNG, RESP_CFS, RESP_NEOLED, RESP_SYSINFO, RESP_OCD, RESP_SLINK, RESP_XIRQ);
+                         RESP_TWI, RESP_PWM, RESP_WDT, RESP_TRNG, RESP_CFS, RESP_NEOLED, RESP_SYSINFO, RESP_OCD, RESP_SLINK, RESP_XIRQ,
+                         RESP_TRACE, RESP_CLINT, RESP_DMA, RESP_MEMCPY,
+                         RESP_XMEM0, RESP_XMEM1, RESP_XMEM2, RESP_XMEM3, RESP_XIP);
 
   -- module response bus --
   type resp_bus_t is array (resp_bus_id_t) of resp_bus_entry_t;
@@ -325,6 +428,7 @@ architecture neorv32_top_rtl of neorv32_top is
   signal slink_tx_irq  : std_ulogic;
   signal slink_rx_irq  : std_ulogic;
   signal xirq_irq      : std_ulogic;
+  signal dma_irq       : std_ulogic;
 
   -- machine (CPU) interrupts --
   signal x_nm_irq,    nm_irq_ff    : std_ulogic;
@@ -332,10 +436,31 @@ architecture neorv32_top_rtl of neorv32_top is
   signal x_msw_irq,   msw_irq_ff   : std_ulogic;
   signal x_mext_irq,  mext_irq_ff  : std_ulogic;
 
+  -- per-hart interrupts --
+  type hart_firq_t is array (0 to CPU_NUM_HARTS-1) of std_ulogic_vector(15 downto 0);
+  signal hart_fast_irq   : hart_firq_t;
+  signal hart_nm_irq     : std_ulogic_vector(CPU_NUM_HARTS-1 downto 0);
+  signal hart_mext_irq   : std_ulogic_vector(CPU_NUM_HARTS-1 downto 0);
+  signal hart_msw_irq    : std_ulogic_vector(CPU_NUM_HARTS-1 downto 0);
+  signal hart_mtime_irq  : std_ulogic_vector(CPU_NUM_HARTS-1 downto 0);
+  signal clint_msw_irq   : std_ulogic_vector(CPU_NUM_HARTS-1 downto 0);
+  signal clint_mtime_irq : std_ulogic_vector(CPU_NUM_HARTS-1 downto 0);
+
   -- misc --
+  type cpu_trace_array_t is array (0 to CPU_NUM_HARTS-1) of cpu_trace_if_t;
+  type icache_ev_array_t is array (0 to CPU_NUM_HARTS-1) of std_ulogic_vector(03 downto 0);
+  type icache_ctrl_array_t is array (0 to CPU_NUM_HARTS-1) of std_ulogic_vector(02 downto 0);
+  type icache_addr_array_t is array (0 to CPU_NUM_HARTS-1) of std_ulogic_vector(data_width_c-1 downto 0);
+  type icache_stat_array_t is array (0 to CPU_NUM_HARTS-1) of std_ulogic_vector(01 downto 0);
   signal mtime_time     : std_ulogic_vector(63 downto 0); -- current system time from MTIME
-  signal cpu_sleep      : std_ulogic; -- CPU is in sleep mode when set
+  signal cpu_sleep      : std_ulogic_vector(CPU_NUM_HARTS-1 downto 0); -- CPU is in sleep mode when set
+  signal sys_sleep      : std_ulogic; -- all CPUs are in sleep mode
   signal bus_keeper_err : std_ulogic; -- bus keeper: bus access timeout
+  signal cpu_trace      : cpu_trace_array_t; -- CPU instruction trace ports
+  signal icache_ev      : icache_ev_array_t; -- i-cache HPM events
+  signal icache_ctrl    : icache_ctrl_array_t; -- i-cache locking control
+  signal icache_addr    : icache_addr_array_t; -- i-cache preload address
+  signal icache_stat    : icache_stat_array_t; -- i-cache locking status
 
 begin
 
@@ -356,6 +481,10 @@ begin
   cond_sel_string_f(io_slink_en_c, "SLINK ", "") &
   cond_sel_string_f(IO_NEOLED_EN, "NEOLED ", "") &
   cond_sel_string_f(boolean(XIRQ_NUM_CH > 0), "XIRQ ", "") &
+  cond_sel_string_f(TRACE_EN, "TRACE ", "") &
+  cond_sel_string_f(io_clint_en_c, "CLINT ", "") &
+  cond_sel_string_f(io_dma_en_c, "DMA ", "") &
+  cond_sel_string_f(IO_MEMCPY_EN, "MEMCPY ", "") &
   ""
   severity note;
 
@@ -377,18 +506,43 @@ begin
   -- memory system - alignment --
   assert not (ispace_base_c(1 downto 0) /= "00") report "NEORV32 PROCESSOR CONFIG ERROR! Instruction memory space base address must be 4-byte-aligned." severity error;
   assert not (dspace_base_c(1 downto 0) /= "00") report "NEORV32 PROCESSOR CONFIG ERROR! Data memory space base address must be 4-byte-aligned." severity error;
-  assert not ((ispace_base_c(index_size_f(MEM_INT_IMEM_SIZE)-1 downto 0) /= imem_align_check_c) and (MEM_INT_IMEM_EN = true)) report "NEORV32 PROCESSOR CONFIG ERROR! Instruction memory space base address has to be aligned to IMEM size." severity error;
-  assert not ((dspace_base_c(index_size_f(MEM_INT_DMEM_SIZE)-1 downto 0) /= dmem_align_check_c) and (MEM_INT_DMEM_EN = true)) report "NEORV32 PROCESSOR CONFIG ERROR! Data memory space base address has to be aligned to DMEM size." severity error;
+  assert not ((MEM_INT_IMEM_BASE(index_size_f(MEM_INT_IMEM_SIZE)-1 downto 0) /= imem_align_check_c) and (MEM_INT_IMEM_EN = true)) report "NEORV32 PROCESSOR CONFIG ERROR! <MEM_INT_IMEM_BASE> has to be aligned to IMEM size." severity error;
+  assert not ((MEM_INT_DMEM_BASE(index_size_f(MEM_INT_DMEM_SIZE)-1 downto 0) /= dmem_align_check_c) and (MEM_INT_DMEM_EN = true)) report "NEORV32 PROCESSOR CONFIG ERROR! <MEM_INT_DMEM_BASE> has to be aligned to DMEM size." severity error;
 
   -- memory system - layout warning --
   assert not (ispace_base_c /= x"00000000") report "NEORV32 PROCESSOR CONFIG WARNING! Non-default base address for instruction address space. Make sure this is sync with the software framework." severity warning;
   assert not (dspace_base_c /= x"80000000") report "NEORV32 PROCESSOR CONFIG WARNING! Non-default base address for data address space. Make sure this is sync with the software framework." severity warning;
+  assert not ((MEM_INT_IMEM_BASE /= ispace_base_c) and (MEM_INT_IMEM_EN = true)) report "NEORV32 PROCESSOR CONFIG WARNING! Non-default IMEM base address <MEM_INT_IMEM_BASE>. Make sure the linker script is configured accordingly (__neorv32_rom_base)." severity warning;
+  assert not ((MEM_INT_DMEM_BASE /= dspace_base_c) and (MEM_INT_DMEM_EN = true)) report "NEORV32 PROCESSOR CONFIG WARNING! Non-default DMEM base address <MEM_INT_DMEM_BASE>. Make sure the linker script is configured accordingly (__neorv32_ram_base)." severity warning;
+
+  -- memory system - additional internal memory banks --
+  assert not (xmem_num_f(MEM_INT_XMEM_SIZE) /= 0) report "NEORV32 PROCESSOR CONFIG NOTE: Implementing " & integer'image(xmem_num_f(MEM_INT_XMEM_SIZE)) & " additional processor-internal memory bank(s) (XMEM)." severity note;
 
   -- memory system - the i-cache is intended to accelerate instruction fetch via the external memory interface only --
   assert not ((ICACHE_EN = true) and (MEM_EXT_EN = false)) report "NEORV32 PROCESSOR CONFIG NOTE. Implementing i-cache without having the external memory interface implemented. The i-cache is intended to accelerate instruction fetch via the external memory interface." severity note;
 
+  -- multi-hart configuration --
+  assert not ((CPU_NUM_HARTS < 1) or (CPU_NUM_HARTS > 4)) report "NEORV32 PROCESSOR CONFIG ERROR! <CPU_NUM_HARTS> has to be 1..4." severity error;
+  assert not (CPU_NUM_HARTS > 1) report "NEORV32 PROCESSOR CONFIG NOTE: Implementing " & integer'image(CPU_NUM_HARTS) & " harts (SMP) sharing the processor bus." severity note;
+  assert not ((CPU_NUM_HARTS > 1) and (TRACE_EN = true)) report "NEORV32 PROCESSOR CONFIG NOTE: Instruction trace encoder (TRACE) only observes the first hart." severity note;
+
+  -- tightly-coupled memories --
+  assert not (tcm_en_c = true) report "NEORV32 PROCESSOR CONFIG NOTE: Connecting processor-internal IMEM/DMEM via tightly-coupled memory (TCM) ports." severity note;
+  assert not ((MEM_INT_TCM_EN = true) and (CPU_NUM_HARTS > 1)) report "NEORV32 PROCESSOR CONFIG WARNING! TCM ports are not available for multi-hart (SMP) configurations. Ignoring <MEM_INT_TCM_EN>." severity warning;
+  assert not ((MEM_INT_TCM_EN = true) and (MEM_INT_IMEM_EN = false) and (MEM_INT_DMEM_EN = false)) report "NEORV32 PROCESSOR CONFIG WARNING! <MEM_INT_TCM_EN> requires the processor-internal IMEM and/or DMEM." severity warning;
+
+  -- bus switch crossbar --
+  assert not (xbar_en_c = true) report "NEORV32 PROCESSOR CONFIG NOTE: Implementing bus switch crossbar path for instruction fetches from IMEM/BOOTROM." severity note;
+  assert not ((BUS_XBAR_EN = true) and (CPU_NUM_HARTS > 1)) report "NEORV32 PROCESSOR CONFIG WARNING! Bus switch crossbar is not available for multi-hart (SMP) configurations. Ignoring <BUS_XBAR_EN>." severity warning;
+  assert not ((xbar_en_c = true) and (xbar_imem_en_c = false) and (xbar_boot_en_c = false)) report "NEORV32 PROCESSOR CONFIG WARNING! <BUS_XBAR_EN> has no effect without (non-TCM) IMEM or BOOTROM." severity warning;
+
   -- on-chip debugger --
   assert not (ON_CHIP_DEBUGGER_EN = true) report "NEORV32 PROCESSOR CONFIG NOTE: Implementing on-chip debugger (OCD)." severity note;
+  assert not ((ON_CHIP_DEBUGGER_EN = true) and (ON_CHIP_DEBUGGER_SBA_EN = true)) report "NEORV32 PROCESSOR CONFIG NOTE: Implementing on-chip debugger system bus access (SBA)." severity note;
+
+  -- direct memory access controller --
+  assert not (IO_DMA_NUM_CH > 4) report "NEORV32 PROCESSOR CONFIG ERROR! <IO_DMA_NUM_CH> has to be 0..4." severity error;
+  assert not (io_dma_en_c = true) report "NEORV32 PROCESSOR CONFIG NOTE: Implementing " & integer'image(IO_DMA_NUM_CH) & " DMA channel(s) as additional bus controller." severity note;
 
 
   -- Reset Generator ------------------------------------------------------------------------
@@ -424,7 +578,7 @@ begin
       clk_gen_en(0) <= wdt_cg_en;
       clk_gen_en(1) <= uart0_cg_en;
       clk_gen_en(2) <= uart1_cg_en;
-      clk_gen_en(3) <= spi_cg_en;
+      clk_gen_en(3) <= spi_cg_en or xip_cg_en;
       clk_gen_en(4) <= twi_cg_en;
       clk_gen_en(5) <= pwm_cg_en;
       clk_gen_en(6) <= cfs_cg_en;
@@ -447,86 +601,148 @@ begin
   end process clock_generator;
 
 
-  -- CPU Core -------------------------------------------------------------------------------
+  -- CPU Core(s) ----------------------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
-  neorv32_cpu_inst: neorv32_cpu
-  generic map (
-    -- General --
-    HW_THREAD_ID                 => HW_THREAD_ID,        -- hardware thread id
-    CPU_BOOT_ADDR                => cpu_boot_addr_c,     -- cpu boot address
-    CPU_DEBUG_ADDR               => dm_base_c,           -- cpu debug mode start address
-    -- RISC-V CPU Extensions --
-    CPU_EXTENSION_RISCV_A        => CPU_EXTENSION_RISCV_A,        -- implement atomic extension?
-    CPU_EXTENSION_RISCV_C        => CPU_EXTENSION_RISCV_C,        -- implement compressed extension?
-    CPU_EXTENSION_RISCV_E        => CPU_EXTENSION_RISCV_E,        -- implement embedded RF extension?
-    CPU_EXTENSION_RISCV_M        => CPU_EXTENSION_RISCV_M,        -- implement muld/div extension?
-    CPU_EXTENSION_RISCV_U        => CPU_EXTENSION_RISCV_U,        -- implement user mode extension?
-    CPU_EXTENSION_RISCV_Zfinx    => CPU_EXTENSION_RISCV_Zfinx,    -- implement 32-bit floating-point extension (using INT reg!)
-    CPU_EXTENSION_RISCV_Zicsr    => CPU_EXTENSION_RISCV_Zicsr,    -- implement CSR system?
-    CPU_EXTENSION_RISCV_Zifencei => CPU_EXTENSION_RISCV_Zifencei, -- implement instruction stream sync.?
-    CPU_EXTENSION_RISCV_Zmmul    => CPU_EXTENSION_RISCV_Zmmul,    -- implement multiply-only M sub-extension?
-    CPU_EXTENSION_RISCV_DEBUG    => ON_CHIP_DEBUGGER_EN,          -- implement CPU debug mode?
-    -- Extension Options --
-    FAST_MUL_EN                  => FAST_MUL_EN,         -- use DSPs for M extension's multiplier
-    FAST_SHIFT_EN                => FAST_SHIFT_EN,       -- use barrel shifter for shift operations
-    CPU_CNT_WIDTH                => CPU_CNT_WIDTH,       -- total width of CPU cycle and instret counters (0..64)
-    CPU_IPB_ENTRIES              => CPU_IPB_ENTRIES,     -- entries is instruction prefetch buffer, has to be a power of 2
-    -- Physical Memory Protection (PMP) --
-    PMP_NUM_REGIONS              => PMP_NUM_REGIONS,     -- number of regions (0..64)
-    PMP_MIN_GRANULARITY          => PMP_MIN_GRANULARITY, -- minimal region granularity in bytes, has to be a power of 2, min 8 bytes
-    -- Hardware Performance Monitors (HPM) --
-    HPM_NUM_CNTS                 => HPM_NUM_CNTS,        -- number of implemented HPM counters (0..29)
-    HPM_CNT_WIDTH                => HPM_CNT_WIDTH        -- total size of HPM counters (0..64)
-  )
-  port map (
-    -- global control --
-    clk_i          => clk_i,        -- global clock, rising edge
-    rstn_i         => sys_rstn,     -- global reset, low-active, async
-    sleep_o        => cpu_sleep,    -- cpu is in sleep mode when set
-    -- instruction bus interface --
-    i_bus_addr_o   => cpu_i.addr,   -- bus access address
-    i_bus_rdata_i  => cpu_i.rdata,  -- bus read data
-    i_bus_wdata_o  => cpu_i.wdata,  -- bus write data
-    i_bus_ben_o    => cpu_i.ben,    -- byte enable
-    i_bus_we_o     => cpu_i.we,     -- write enable
-    i_bus_re_o     => cpu_i.re,     -- read enable
-    i_bus_lock_o   => cpu_i.lock,   -- exclusive access request
-    i_bus_ack_i    => cpu_i.ack,    -- bus transfer acknowledge
-    i_bus_err_i    => cpu_i.err,    -- bus transfer error
-    i_bus_fence_o  => cpu_i.fence,  -- executed FENCEI operation
-    i_bus_priv_o   => cpu_i.priv,   -- privilege level
-    -- data bus interface --
-    d_bus_addr_o   => cpu_d.addr,   -- bus access address
-    d_bus_rdata_i  => cpu_d.rdata,  -- bus read data
-    d_bus_wdata_o  => cpu_d.wdata,  -- bus write data
-    d_bus_ben_o    => cpu_d.ben,    -- byte enable
-    d_bus_we_o     => cpu_d.we,     -- write enable
-    d_bus_re_o     => cpu_d.re,     -- read enable
-    d_bus_lock_o   => cpu_d.lock,   -- exclusive access request
-    d_bus_ack_i    => cpu_d.ack,    -- bus transfer acknowledge
-    d_bus_err_i    => cpu_d.err,    -- bus transfer error
-    d_bus_fence_o  => cpu_d.fence,  -- executed FENCE operation
-    d_bus_priv_o   => cpu_d.priv,   -- privilege level
-    -- system time input from MTIME --
-    time_i         => mtime_time,   -- current system time
-    -- non-maskable interrupt --
-    nm_irq_i       => x_nm_irq,     -- NMI
-    msw_irq_i      => x_msw_irq,    -- machine software interrupt
-    mext_irq_i     => x_mext_irq,   -- machine external interrupt request
-    mtime_irq_i    => mtime_irq,    -- machine timer interrupt
-    -- fast interrupts (custom) --
-    firq_i         => fast_irq,     -- fast interrupt trigger
-    -- debug mode (halt) request --
-    db_halt_req_i  => dci_halt_req
-  );
+  neorv32_cpu_inst_gen:
+  for i in 0 to CPU_NUM_HARTS-1 generate
+    neorv32_cpu_inst: neorv32_cpu
+    generic map (
+      -- General --
+      HW_THREAD_ID                 => HW_THREAD_ID + i,    -- hardware thread id
+      CPU_BOOT_ADDR                => cpu_boot_addr_c,     -- cpu boot address
+      CPU_DEBUG_ADDR               => dm_base_c,           -- cpu debug mode start address
+      -- RISC-V CPU Extensions --
+      CPU_EXTENSION_RISCV_A        => CPU_EXTENSION_RISCV_A,        -- implement atomic extension?
+      CPU_EXTENSION_RISCV_C        => CPU_EXTENSION_RISCV_C,        -- implement compressed extension?
+      CPU_EXTENSION_RISCV_E        => CPU_EXTENSION_RISCV_E,        -- implement embedded RF extension?
+      CPU_EXTENSION_RISCV_M        => CPU_EXTENSION_RISCV_M,        -- implement muld/div extension?
+      CPU_EXTENSION_RISCV_U        => CPU_EXTENSION_RISCV_U,        -- implement user mode extension?
+      CPU_EXTENSION_RISCV_Zfinx    => CPU_EXTENSION_RISCV_Zfinx,    -- implement 32-bit floating-point extension (using INT reg!)
+      CPU_EXTENSION_RISCV_Zicsr    => CPU_EXTENSION_RISCV_Zicsr,    -- implement CSR system?
+      CPU_EXTENSION_RISCV_Zifencei => CPU_EXTENSION_RISCV_Zifencei, -- implement instruction stream sync.?
+      CPU_EXTENSION_RISCV_Zmmul    => CPU_EXTENSION_RISCV_Zmmul,    -- implement multiply-only M sub-extension?
+      CPU_EXTENSION_RISCV_DEBUG    => ON_CHIP_DEBUGGER_EN,          -- implement CPU debug mode?
+      -- Extension Options --
+      FAST_MUL_EN                  => FAST_MUL_EN,         -- use DSPs for M extension's multiplier
+      FAST_SHIFT_EN                => FAST_SHIFT_EN,       -- use barrel shifter for shift operations
+      CPU_CNT_WIDTH                => CPU_CNT_WIDTH,       -- total width of CPU cycle and instret counters (0..64)
+      CPU_IPB_ENTRIES              => CPU_IPB_ENTRIES,     -- entries is instruction prefetch buffer, has to be a power of 2
+      CPU_NUM_TRIGGERS             => CPU_NUM_TRIGGERS,    -- number of hardware trigger module triggers (0..16)
+      -- Physical Memory Protection (PMP) --
+      PMP_NUM_REGIONS              => PMP_NUM_REGIONS,     -- number of regions (0..64)
+      PMP_MIN_GRANULARITY          => PMP_MIN_GRANULARITY, -- minimal region granularity in bytes, has to be a power of 2, min 4 bytes
+      -- Hardware Performance Monitors (HPM) --
+      HPM_NUM_CNTS                 => HPM_NUM_CNTS,        -- number of implemented HPM counters (0..29)
+      HPM_CNT_WIDTH                => HPM_CNT_WIDTH,       -- total size of HPM counters (0..64)
+      -- Tightly-Coupled Memories (TCM) --
+      TCM_IMEM_BASE                => MEM_INT_IMEM_BASE,   -- instruction TCM base address
+      TCM_IMEM_SIZE                => cond_sel_natural_f(tcm_imem_en_c, MEM_INT_IMEM_SIZE, 0), -- instruction TCM size in bytes
+      TCM_DMEM_BASE                => MEM_INT_DMEM_BASE,   -- data TCM base address
+      TCM_DMEM_SIZE                => cond_sel_natural_f(tcm_dmem_en_c, MEM_INT_DMEM_SIZE, 0)  -- data TCM size in bytes
+    )
+    port map (
+      -- global control --
+      clk_i          => clk_i,              -- global clock, rising edge
+      rstn_i         => sys_rstn,           -- global reset, low-active, async
+      sleep_o        => cpu_sleep(i),       -- cpu is in sleep mode when set
+      -- instruction bus interface --
+      i_bus_addr_o   => cpu_i(i).addr,      -- bus access address
+      i_bus_rdata_i  => cpu_i(i).rdata,     -- bus read data
+      i_bus_wdata_o  => cpu_i(i).wdata,     -- bus write data
+      i_bus_ben_o    => cpu_i(i).ben,       -- byte enable
+      i_bus_we_o     => cpu_i(i).we,        -- write enable
+      i_bus_re_o     => cpu_i(i).re,        -- read enable
+      i_bus_lock_o   => cpu_i(i).lock,      -- exclusive access request
+      i_bus_ack_i    => cpu_i(i).ack,       -- bus transfer acknowledge
+      i_bus_err_i    => cpu_i(i).err,       -- bus transfer error
+      i_bus_fence_o  => cpu_i(i).fence,     -- executed FENCEI operation
+      i_bus_priv_o   => cpu_i(i).priv,      -- privilege level
+      -- data bus interface --
+      d_bus_addr_o   => cpu_d(i).addr,      -- bus access address
+      d_bus_rdata_i  => cpu_d(i).rdata,     -- bus read data
+      d_bus_wdata_o  => cpu_d(i).wdata,     -- bus write data
+      d_bus_ben_o    => cpu_d(i).ben,       -- byte enable
+      d_bus_we_o     => cpu_d(i).we,        -- write enable
+      d_bus_re_o     => cpu_d(i).re,        -- read enable
+      d_bus_lock_o   => cpu_d(i).lock,      -- exclusive access request
+      d_bus_ack_i    => cpu_d(i).ack,       -- bus transfer acknowledge
+      d_bus_err_i    => cpu_d(i).err,       -- bus transfer error
+      d_bus_fence_o  => cpu_d(i).fence,     -- executed FENCE operation
+      d_bus_priv_o   => cpu_d(i).priv,      -- privilege level
+      -- instruction TCM interface --
+      i_tcm_addr_o   => cpu_i_tcm(i).addr,  -- access address
+      i_tcm_re_o     => cpu_i_tcm(i).re,    -- read enable
+      i_tcm_rdata_i  => cpu_i_tcm(i).rdata, -- read data
+      -- data TCM interface --
+      d_tcm_addr_o   => cpu_d_tcm(i).addr,  -- access address
+      d_tcm_wdata_o  => cpu_d_tcm(i).wdata, -- write data
+      d_tcm_ben_o    => cpu_d_tcm(i).ben,   -- byte enable
+      d_tcm_we_o     => cpu_d_tcm(i).we,    -- write enable
+      d_tcm_re_o     => cpu_d_tcm(i).re,    -- read enable
+      d_tcm_rdata_i  => cpu_d_tcm(i).rdata, -- read data
+      -- system time input from MTIME --
+      time_i         => mtime_time,         -- current system time
+      -- non-maskable interrupt --
+      nm_irq_i       => hart_nm_irq(i),     -- NMI
+      msw_irq_i      => hart_msw_irq(i),    -- machine software interrupt
+      mext_irq_i     => hart_mext_irq(i),   -- machine external interrupt request
+      mtime_irq_i    => hart_mtime_irq(i),  -- machine timer interrupt
+      -- fast interrupts (custom) --
+      firq_i         => hart_fast_irq(i),   -- fast interrupt trigger
+      -- debug mode (halt) request --
+      db_halt_req_i  => dci_halt_req(i),
+      -- external HPM events --
+      icache_ev_i    => icache_ev(i),       -- i-cache events
+      -- i-cache locking (custom CSRs) --
+      icache_ctrl_o  => icache_ctrl(i),     -- i-cache control
+      icache_addr_o  => icache_addr(i),     -- i-cache preload address
+      icache_stat_i  => icache_stat(i),     -- i-cache status
+      -- instruction trace port --
+      trace_o        => cpu_trace(i)        -- program flow discontinuity events
+    );
 
-  -- misc --
-  cpu_i.src <= '1'; -- initialized but unused
-  cpu_d.src <= '0'; -- initialized but unused
+    -- misc --
+    cpu_i(i).src <= '1'; -- initialized but unused
+    cpu_d(i).src <= '0'; -- initialized but unused
+
+    -- unconnected TCM ports (further harts or TCM not implemented) --
+    cpu_i_tcm_term:
+    if (i > 0) or (tcm_imem_en_c = false) generate
+      cpu_i_tcm(i).rdata <= (others => '0');
+    end generate;
+    cpu_d_tcm_term:
+    if (i > 0) or (tcm_dmem_en_c = false) generate
+      cpu_d_tcm(i).rdata <= (others => '0');
+    end generate;
+    cpu_i_tcm(i).wdata <= (others => '0'); -- instruction fetch is read-only
+    cpu_i_tcm(i).ben   <= (others => '0');
+    cpu_i_tcm(i).we    <= '0';
+
+    -- machine-level interrupts --
+    -- platform interrupts are routed to the first hart only; all further harts are driven by the CLINT
+    hart_nm_irq(i)    <= x_nm_irq   when (i = 0) else '0';
+    hart_mext_irq(i)  <= x_mext_irq when (i = 0) else '0';
+    hart_fast_irq(i)  <= fast_irq   when (i = 0) else (others => '0');
+    hart_msw_irq(i)   <= (x_msw_irq or clint_msw_irq(i))   when (i = 0) else clint_msw_irq(i);
+    hart_mtime_irq(i) <= (mtime_irq or clint_mtime_irq(i)) when (i = 0) else clint_mtime_irq(i);
+  end generate;
 
   -- advanced memory control --
-  fence_o  <= cpu_d.fence; -- indicates an executed FENCE operation
-  fencei_o <= cpu_i.fence; -- indicates an executed FENCEI operation
+  advanced_mem_ctrl: process(cpu_i, cpu_d, cpu_sleep)
+    variable fence_v, fencei_v, sleep_v : std_ulogic;
+  begin
+    fence_v  := '0';
+    fencei_v := '0';
+    sleep_v  := '1';
+    for i in 0 to CPU_NUM_HARTS-1 loop
+      fence_v  := fence_v  or cpu_d(i).fence;
+      fencei_v := fencei_v or cpu_i(i).fence;
+      sleep_v  := sleep_v  and cpu_sleep(i);
+    end loop; -- i
+    fence_o   <= fence_v;  -- indicates an executed FENCE operation (any hart)
+    fencei_o  <= fencei_v; -- indicates an executed FENCEI operation (any hart)
+    sys_sleep <= sleep_v;  -- all harts are in sleep mode
+  end process advanced_mem_ctrl;
 
   -- external machine-level (CPU) interrupts --
   nm_irq_ff    <= nm_irq_i    when rising_edge(clk_i);
@@ -553,113 +769,322 @@ begin
   fast_irq(10) <= slink_rx_irq;  -- SLINK data received
   fast_irq(11) <= slink_tx_irq;  -- SLINK data send
   --
-  fast_irq(12) <= '0'; -- reserved
+  fast_irq(12) <= dma_irq;       -- DMA transfer done
   fast_irq(13) <= '0'; -- reserved
   fast_irq(14) <= '0'; -- reserved
   fast_irq(15) <= '0'; -- reserved
 
 
-  -- CPU Instruction Cache ------------------------------------------------------------------
+  -- CPU Instruction Cache(s) ---------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
-  neorv32_icache_inst_true:
-  if (ICACHE_EN = true) generate
-    neorv32_icache_inst: neorv32_icache
+  neorv32_icache_inst_gen:
+  for i in 0 to CPU_NUM_HARTS-1 generate
+    neorv32_icache_inst_true:
+    if (ICACHE_EN = true) generate
+      neorv32_icache_inst: neorv32_icache
+      generic map (
+        ICACHE_NUM_BLOCKS  => ICACHE_NUM_BLOCKS,    -- number of blocks (min 2), has to be a power of 2
+        ICACHE_BLOCK_SIZE  => ICACHE_BLOCK_SIZE,    -- block size in bytes (min 4), has to be a power of 2
+        ICACHE_NUM_SETS    => ICACHE_ASSOCIATIVITY, -- associativity / number of sets (1=direct_mapped), has to be a power of 2
+        ICACHE_REPLACEMENT => ICACHE_REPLACEMENT,   -- replacement policy: 0 = (pseudo-)LRU, 1 = random
+        ICACHE_PREFETCH    => ICACHE_PREFETCH_EN    -- implement next-line prefetcher
+      )
+      port map (
+        -- global control --
+        clk_i         => clk_i,             -- global clock, rising edge
+        rstn_i        => sys_rstn,          -- global reset, low-active, async
+        clear_i       => cpu_i(i).fence,    -- cache clear
+        hpm_ev_o      => icache_ev(i),      -- HPM events
+        -- cache locking --
+        lock_i        => icache_ctrl(i)(0), -- lock preloaded blocks
+        unlock_i      => icache_ctrl(i)(1), -- unlock all blocks
+        preload_i     => icache_ctrl(i)(2), -- preload block request
+        preload_adr_i => icache_addr(i),    -- preload address
+        stat_o        => icache_stat(i),    -- status
+        -- host controller interface --
+        host_addr_i   => cpu_i(i).addr,     -- bus access address
+        host_rdata_o  => cpu_i(i).rdata,    -- bus read data
+        host_wdata_i  => cpu_i(i).wdata,    -- bus write data
+        host_ben_i    => cpu_i(i).ben,      -- byte enable
+        host_we_i     => cpu_i(i).we,       -- write enable
+        host_re_i     => cpu_i(i).re,       -- read enable
+        host_ack_o    => cpu_i(i).ack,      -- bus transfer acknowledge
+        host_err_o    => cpu_i(i).err,      -- bus transfer error
+        -- peripheral bus interface --
+        bus_addr_o    => i_cache(i).addr,   -- bus access address
+        bus_rdata_i   => i_cache(i).rdata,  -- bus read data
+        bus_wdata_o   => i_cache(i).wdata,  -- bus write data
+        bus_ben_o     => i_cache(i).ben,    -- byte enable
+        bus_we_o      => i_cache(i).we,     -- write enable
+        bus_re_o      => i_cache(i).re,     -- read enable
+        bus_ack_i     => i_cache(i).ack,    -- bus transfer acknowledge
+        bus_err_i     => i_cache(i).err     -- bus transfer error
+      );
+    end generate;
+
+    -- TODO: do not use LOCKED instruction fetch --
+    i_cache(i).lock <= '0';
+
+    neorv32_icache_inst_false:
+    if (ICACHE_EN = false) generate
+      i_cache(i).addr  <= cpu_i(i).addr;
+      cpu_i(i).rdata   <= i_cache(i).rdata;
+      i_cache(i).wdata <= cpu_i(i).wdata;
+      i_cache(i).ben   <= cpu_i(i).ben;
+      i_cache(i).we    <= cpu_i(i).we;
+      i_cache(i).re    <= cpu_i(i).re;
+      cpu_i(i).ack     <= i_cache(i).ack;
+      cpu_i(i).err     <= i_cache(i).err;
+      icache_ev(i)     <= (others => '0');
+      icache_stat(i)   <= (others => '0');
+    end generate;
+  end generate;
+
+
+  -- CPU Bus Switch(es) ---------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  -- merge instruction and data bus of each hart into a single hart bus
+  neorv32_busswitch_inst_gen:
+  for i in 0 to CPU_NUM_HARTS-1 generate
+    neorv32_busswitch_inst: neorv32_busswitch
     generic map (
-      ICACHE_NUM_BLOCKS => ICACHE_NUM_BLOCKS,   -- number of blocks (min 2), has to be a power of 2
-      ICACHE_BLOCK_SIZE => ICACHE_BLOCK_SIZE,   -- block size in bytes (min 4), has to be a power of 2
-      ICACHE_NUM_SETS   => ICACHE_ASSOCIATIVITY -- associativity / number of sets (1=direct_mapped), has to be a power of 2
+      PORT_CA_READ_ONLY => false,    -- set if controller port A is read-only
+      PORT_CB_READ_ONLY => true,     -- set if controller port B is read-only
+      PORT_CB_XBAR      => xbar_en_c -- implement dedicated (crossbar) read path for controller port B
     )
     port map (
       -- global control --
-      clk_i         => clk_i,          -- global clock, rising edge
-      rstn_i        => sys_rstn,       -- global reset, low-active, async
-      clear_i       => cpu_i.fence,    -- cache clear
-      -- host controller interface --
-      host_addr_i   => cpu_i.addr,     -- bus access address
-      host_rdata_o  => cpu_i.rdata,    -- bus read data
-      host_wdata_i  => cpu_i.wdata,    -- bus write data
-      host_ben_i    => cpu_i.ben,      -- byte enable
-      host_we_i     => cpu_i.we,       -- write enable
-      host_re_i     => cpu_i.re,       -- read enable
-      host_ack_o    => cpu_i.ack,      -- bus transfer acknowledge
-      host_err_o    => cpu_i.err,      -- bus transfer error
-      -- peripheral bus interface --
-      bus_addr_o    => i_cache.addr,   -- bus access address
-      bus_rdata_i   => i_cache.rdata,  -- bus read data
-      bus_wdata_o   => i_cache.wdata,  -- bus write data
-      bus_ben_o     => i_cache.ben,    -- byte enable
-      bus_we_o      => i_cache.we,     -- write enable
-      bus_re_o      => i_cache.re,     -- read enable
-      bus_ack_i     => i_cache.ack,    -- bus transfer acknowledge
-      bus_err_i     => i_cache.err     -- bus transfer error
+      clk_i           => clk_i,             -- global clock, rising edge
+      rstn_i          => sys_rstn,          -- global reset, low-active, async
+      -- controller interface a --
+      ca_bus_addr_i   => cpu_d(i).addr,     -- bus access address
+      ca_bus_rdata_o  => cpu_d(i).rdata,    -- bus read data
+      ca_bus_wdata_i  => cpu_d(i).wdata,    -- bus write data
+      ca_bus_ben_i    => cpu_d(i).ben,      -- byte enable
+      ca_bus_we_i     => cpu_d(i).we,       -- write enable
+      ca_bus_re_i     => cpu_d(i).re,       -- read enable
+      ca_bus_lock_i   => cpu_d(i).lock,     -- exclusive access request
+      ca_bus_ack_o    => cpu_d(i).ack,      -- bus transfer acknowledge
+      ca_bus_err_o    => cpu_d(i).err,      -- bus transfer error
+      -- controller interface b --
+      cb_bus_addr_i   => i_cache(i).addr,   -- bus access address
+      cb_bus_rdata_o  => i_cache(i).rdata,  -- bus read data
+      cb_bus_wdata_i  => i_cache(i).wdata,  -- bus write data
+      cb_bus_ben_i    => i_cache(i).ben,    -- byte enable
+      cb_bus_we_i     => i_cache(i).we,     -- write enable
+      cb_bus_re_i     => i_cache(i).re,     -- read enable
+      cb_bus_lock_i   => i_cache(i).lock,   -- exclusive access request
+      cb_bus_ack_o    => i_cache(i).ack,    -- bus transfer acknowledge
+      cb_bus_err_o    => i_cache(i).err,    -- bus transfer error
+      cb_bus_xsel_i   => xbar_sel(i),       -- route access to crossbar port
+      -- peripheral bus --
+      p_bus_src_o     => h_bus(i).src,      -- access source: 0 = A (data), 1 = B (instructions)
+      p_bus_addr_o    => h_bus(i).addr,     -- bus access address
+      p_bus_rdata_i   => h_bus(i).rdata,    -- bus read data
+      p_bus_wdata_o   => h_bus(i).wdata,    -- bus write data
+      p_bus_ben_o     => h_bus(i).ben,      -- byte enable
+      p_bus_we_o      => h_bus(i).we,       -- write enable
+      p_bus_re_o      => h_bus(i).re,       -- read enable
+      p_bus_lock_o    => h_bus(i).lock,     -- exclusive access request
+      p_bus_ack_i     => h_bus(i).ack,      -- bus transfer acknowledge
+      p_bus_err_i     => h_bus(i).err,      -- bus transfer error
+      -- crossbar bus --
+      x_bus_addr_o    => x_bus(i).addr,     -- bus access address
+      x_bus_rdata_i   => x_bus(i).rdata,    -- bus read data
+      x_bus_re_o      => x_bus(i).re,       -- read enable
+      x_bus_ack_i     => x_bus(i).ack,      -- bus transfer acknowledge
+      x_bus_err_i     => x_bus(i).err       -- bus transfer error
     );
+
+    -- crossbar bus: instruction fetches from IMEM/BOOTROM (hart 0 only) --
+    neorv32_busswitch_xbar_true:
+    if (i = 0) and (xbar_en_c = true) generate
+      xbar_sel(i) <= xbar_imem_sel or xbar_boot_sel;
+    end generate;
+
+    neorv32_busswitch_xbar_false:
+    if (i > 0) or (xbar_en_c = false) generate
+      xbar_sel(i)    <= '0';
+      x_bus(i).rdata <= (others => '0');
+      x_bus(i).ack   <= '0';
+      x_bus(i).err   <= '0';
+    end generate;
+
+    -- current CPU privilege level --
+    h_bus(i).priv <= cpu_i(i).priv; -- note: cpu_i.priv == cpu_d.priv
+
+    -- connect to processor bus arbiter --
+    arb_addr(i*data_width_c+data_width_c-1 downto i*data_width_c)  <= h_bus(i).addr;
+    arb_wdata(i*data_width_c+data_width_c-1 downto i*data_width_c) <= h_bus(i).wdata;
+    arb_ben(i*4+3 downto i*4)  <= h_bus(i).ben;
+    arb_priv(i*2+1 downto i*2) <= h_bus(i).priv;
+    arb_we(i)      <= h_bus(i).we;
+    arb_re(i)      <= h_bus(i).re;
+    arb_lock(i)    <= h_bus(i).lock;
+    arb_src(i)     <= h_bus(i).src;
+    h_bus(i).rdata <= arb_rdata;
+    h_bus(i).ack   <= arb_ack(i);
+    h_bus(i).err   <= arb_err(i);
   end generate;
 
-  -- TODO: do not use LOCKED instruction fetch --
-  i_cache.lock <= '0';
-
-  neorv32_icache_inst_false:
-  if (ICACHE_EN = false) generate
-    i_cache.addr  <= cpu_i.addr;
-    cpu_i.rdata   <= i_cache.rdata;
-    i_cache.wdata <= cpu_i.wdata;
-    i_cache.ben   <= cpu_i.ben;
-    i_cache.we    <= cpu_i.we;
-    i_cache.re    <= cpu_i.re;
-    cpu_i.ack     <= i_cache.ack;
-    cpu_i.err     <= i_cache.err;
+
+  -- Bus Switch Crossbar Path ---------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  -- hart 0's instruction fetches from IMEM/BOOTROM use the memories' second read ports so they can
+  -- be processed in parallel to data accesses on the processor bus
+  xbar_imem_sel <= '1' when (xbar_imem_en_c = true) and (i_cache(0).addr(31 downto index_size_f(MEM_INT_IMEM_SIZE)) = MEM_INT_IMEM_BASE(31 downto index_size_f(MEM_INT_IMEM_SIZE))) else '0';
+  xbar_boot_sel <= '1' when (xbar_boot_en_c = true) and (i_cache(0).addr(31 downto index_size_f(boot_rom_max_size_c)) = boot_rom_base_c(31 downto index_size_f(boot_rom_max_size_c))) else '0';
+
+  -- IMEM does not provide an ACK on its second port (fixed latency) --
+  xbar_imem_response: process(sys_rstn, clk_i)
+  begin
+    if (sys_rstn = '0') then
+      xbar_imem_ack <= '0';
+    elsif rising_edge(clk_i) then
+      xbar_imem_ack <= x_bus(0).re and xbar_imem_sel;
+    end if;
+  end process xbar_imem_response;
+
+  neorv32_xbar_response:
+  if (xbar_en_c = true) generate
+    x_bus(0).rdata <= (xbar_boot_rdata or tcm_i_rdata) when (xbar_imem_ack = '1') else xbar_boot_rdata;
+    x_bus(0).ack   <= xbar_imem_ack or xbar_boot_ack;
+    x_bus(0).err   <= '0'; -- no access error possible
+  end generate;
+
+  -- IMEM second port: instruction TCM or crossbar path --
+  imem_p2_re   <= (x_bus(0).re and xbar_imem_sel) when (xbar_imem_en_c = true) else cpu_i_tcm(0).re;
+  imem_p2_addr <= x_bus(0).addr when (xbar_imem_en_c = true) else cpu_i_tcm(0).addr;
+
+
+  -- Debugger System Bus Access -------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  -- the debug module's system bus access master is connected to the arbiter port following the harts
+  neorv32_arbiter_sba_true:
+  if (sba_en_c = true) generate
+    arb_addr(CPU_NUM_HARTS*data_width_c+data_width_c-1 downto CPU_NUM_HARTS*data_width_c)  <= dm_sba.addr;
+    arb_wdata(CPU_NUM_HARTS*data_width_c+data_width_c-1 downto CPU_NUM_HARTS*data_width_c) <= dm_sba.wdata;
+    arb_ben(CPU_NUM_HARTS*4+3 downto CPU_NUM_HARTS*4)  <= dm_sba.ben;
+    arb_priv(CPU_NUM_HARTS*2+1 downto CPU_NUM_HARTS*2) <= priv_mode_m_c; -- debugger always accesses in machine mode
+    arb_we(CPU_NUM_HARTS)   <= dm_sba.we;
+    arb_re(CPU_NUM_HARTS)   <= dm_sba.re;
+    arb_lock(CPU_NUM_HARTS) <= '0'; -- no exclusive accesses
+    arb_src(CPU_NUM_HARTS)  <= '0'; -- data access
+    dm_sba.rdata <= arb_rdata;
+    dm_sba.ack   <= arb_ack(CPU_NUM_HARTS);
+    dm_sba.err   <= arb_err(CPU_NUM_HARTS);
+  end generate;
+
+  neorv32_arbiter_sba_false:
+  if (sba_en_c = false) generate
+    dm_sba.rdata <= (others => '0');
+    dm_sba.ack   <= '0';
+    dm_sba.err   <= '0';
+  end generate;
+
+
+  -- DMA Bus Controller ---------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  -- the DMA's bus controller interface is connected to the arbiter port following the debugger
+  neorv32_arbiter_dma_true:
+  if (io_dma_en_c = true) generate
+    arb_addr(dma_port_c*data_width_c+data_width_c-1 downto dma_port_c*data_width_c)  <= dma_m.addr;
+    arb_wdata(dma_port_c*data_width_c+data_width_c-1 downto dma_port_c*data_width_c) <= dma_m.wdata;
+    arb_ben(dma_port_c*4+3 downto dma_port_c*4)  <= dma_m.ben;
+    arb_priv(dma_port_c*2+1 downto dma_port_c*2) <= priv_mode_m_c; -- DMA always accesses in machine mode
+    arb_we(dma_port_c)   <= dma_m.we;
+    arb_re(dma_port_c)   <= dma_m.re;
+    arb_lock(dma_port_c) <= '0'; -- no exclusive accesses
+    arb_src(dma_port_c)  <= '0'; -- data access
+    dma_m.rdata <= arb_rdata;
+    dma_m.ack   <= arb_ack(dma_port_c);
+    dma_m.err   <= arb_err(dma_port_c);
+  end generate;
+
+  neorv32_arbiter_dma_false:
+  if (io_dma_en_c = false) generate
+    dma_m.rdata <= (others => '0');
+    dma_m.ack   <= '0';
+    dma_m.err   <= '0';
+  end generate;
+
+
+  -- MEMCPY Bus Controller ------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  -- the copy/fill engine's bus controller interface is connected to the very last arbiter port
+  neorv32_arbiter_memcpy_true:
+  if (IO_MEMCPY_EN = true) generate
+    arb_addr(memcpy_port_c*data_width_c+data_width_c-1 downto memcpy_port_c*data_width_c)  <= memcpy_m.addr;
+    arb_wdata(memcpy_port_c*data_width_c+data_width_c-1 downto memcpy_port_c*data_width_c) <= memcpy_m.wdata;
+    arb_ben(memcpy_port_c*4+3 downto memcpy_port_c*4)  <= memcpy_m.ben;
+    arb_priv(memcpy_port_c*2+1 downto memcpy_port_c*2) <= priv_mode_m_c; -- engine always accesses in machine mode
+    arb_we(memcpy_port_c)   <= memcpy_m.we;
+    arb_re(memcpy_port_c)   <= memcpy_m.re;
+    arb_lock(memcpy_port_c) <= '0'; -- no exclusive accesses
+    arb_src(memcpy_port_c)  <= '0'; -- data access
+    memcpy_m.rdata <= arb_rdata;
+    memcpy_m.ack   <= arb_ack(memcpy_port_c);
+    memcpy_m.err   <= arb_err(memcpy_port_c);
+  end generate;
+
+  neorv32_arbiter_memcpy_false:
+  if (IO_MEMCPY_EN = false) generate
+    memcpy_m.rdata <= (others => '0');
+    memcpy_m.ack   <= '0';
+    memcpy_m.err   <= '0';
   end generate;
 
 
-  -- CPU Bus Switch -------------------------------------------------------------------------
+  -- Processor Bus Arbiter ------------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
-  neorv32_busswitch_inst: neorv32_busswitch
+  neorv32_bus_arbiter_inst: neorv32_bus_arbiter
   generic map (
-    PORT_CA_READ_ONLY => false, -- set if controller port A is read-only
-    PORT_CB_READ_ONLY => true   -- set if controller port B is read-only
+    NUM_PORTS => num_bus_ports_c -- number of controller ports
   )
   port map (
     -- global control --
-    clk_i           => clk_i,          -- global clock, rising edge
-    rstn_i          => sys_rstn,       -- global reset, low-active, async
-    -- controller interface a --
-    ca_bus_addr_i   => cpu_d.addr,     -- bus access address
-    ca_bus_rdata_o  => cpu_d.rdata,    -- bus read data
-    ca_bus_wdata_i  => cpu_d.wdata,    -- bus write data
-    ca_bus_ben_i    => cpu_d.ben,      -- byte enable
-    ca_bus_we_i     => cpu_d.we,       -- write enable
-    ca_bus_re_i     => cpu_d.re,       -- read enable
-    ca_bus_lock_i   => cpu_d.lock,     -- exclusive access request
-    ca_bus_ack_o    => cpu_d.ack,      -- bus transfer acknowledge
-    ca_bus_err_o    => cpu_d.err,      -- bus transfer error
-    -- controller interface b --
-    cb_bus_addr_i   => i_cache.addr,   -- bus access address
-    cb_bus_rdata_o  => i_cache.rdata,  -- bus read data
-    cb_bus_wdata_i  => i_cache.wdata,  -- bus write data
-    cb_bus_ben_i    => i_cache.ben,    -- byte enable
-    cb_bus_we_i     => i_cache.we,     -- write enable
-    cb_bus_re_i     => i_cache.re,     -- read enable
-    cb_bus_lock_i   => i_cache.lock,   -- exclusive access request
-    cb_bus_ack_o    => i_cache.ack,    -- bus transfer acknowledge
-    cb_bus_err_o    => i_cache.err,    -- bus transfer error
+    clk_i         => clk_i,       -- global clock, rising edge
+    rstn_i        => sys_rstn,    -- global reset, low-active, async
+    -- controller interfaces (packed) --
+    m_bus_addr_i  => arb_addr,    -- bus access address
+    m_bus_rdata_o => arb_rdata,   -- bus read data (shared by all ports)
+    m_bus_wdata_i => arb_wdata,   -- bus write data
+    m_bus_ben_i   => arb_ben,     -- byte enable
+    m_bus_we_i    => arb_we,      -- write enable
+    m_bus_re_i    => arb_re,      -- read enable
+    m_bus_lock_i  => arb_lock,    -- exclusive access request
+    m_bus_src_i   => arb_src,     -- access source (1=instruction fetch, 0=data access)
+    m_bus_priv_i  => arb_priv,    -- current privilege level
+    m_bus_ack_o   => arb_ack,     -- bus transfer acknowledge
+    m_bus_err_o   => arb_err,     -- bus transfer error
     -- peripheral bus --
-    p_bus_src_o     => p_bus.src,      -- access source: 0 = A (data), 1 = B (instructions)
-    p_bus_addr_o    => p_bus.addr,     -- bus access address
-    p_bus_rdata_i   => p_bus.rdata,    -- bus read data
-    p_bus_wdata_o   => p_bus.wdata,    -- bus write data
-    p_bus_ben_o     => p_bus.ben,      -- byte enable
-    p_bus_we_o      => p_bus.we,       -- write enable
-    p_bus_re_o      => p_bus.re,       -- read enable
-    p_bus_lock_o    => p_bus.lock,     -- exclusive access request
-    p_bus_ack_i     => p_bus.ack,      -- bus transfer acknowledge
-    p_bus_err_i     => p_bus.err       -- bus transfer error
+    p_bus_sel_o   => arb_sel,     -- one-hot: currently selected controller port
+    p_bus_src_o   => p_bus.src,   -- access source of selected port
+    p_bus_priv_o  => p_bus.priv,  -- privilege level of selected port
+    p_bus_addr_o  => p_bus.addr,  -- bus access address
+    p_bus_rdata_i => p_bus.rdata, -- bus read data
+    p_bus_wdata_o => p_bus.wdata, -- bus write data
+    p_bus_ben_o   => p_bus.ben,   -- byte enable
+    p_bus_we_o    => p_bus.we,    -- write enable
+    p_bus_re_o    => p_bus.re,    -- read enable
+    p_bus_lock_o  => p_bus.lock,  -- exclusive access request
+    p_bus_ack_i   => p_bus.ack,   -- bus transfer acknowledge
+    p_bus_err_i   => p_bus.err    -- bus transfer error
   );
 
-  -- current CPU privilege level --
-  p_bus.priv <= cpu_i.priv; -- note: cpu_i.priv == cpu_d.priv
+  -- index of the hart that currently owns the bus (for the debug module) --
+  bus_owner: process(arb_sel)
+  begin
+    p_bus_hart <= (others => '0');
+    for i in 0 to CPU_NUM_HARTS-1 loop
+      if (arb_sel(i) = '1') then
+        p_bus_hart <= std_ulogic_vector(to_unsigned(i, 2));
+      end if;
+    end loop; -- i
+  end process bus_owner;
 
   -- fence operation (unused) --
-  p_bus.fence <= cpu_d.fence or cpu_i.fence;
+  p_bus.fence <= '0';
 
   -- bus response --
   bus_response: process(resp_bus, bus_keeper_err)
@@ -690,9 +1115,18 @@ begin
     -- Internal instruction memory --
     MEM_INT_IMEM_EN   => MEM_INT_IMEM_EN,   -- implement processor-internal instruction memory
     MEM_INT_IMEM_SIZE => MEM_INT_IMEM_SIZE, -- size of processor-internal instruction memory in bytes
+    MEM_INT_IMEM_BASE => MEM_INT_IMEM_BASE, -- base address of processor-internal instruction memory
     -- Internal data memory --
     MEM_INT_DMEM_EN   => MEM_INT_DMEM_EN,   -- implement processor-internal data memory
-    MEM_INT_DMEM_SIZE => MEM_INT_DMEM_SIZE  -- size of processor-internal data memory in bytes
+    MEM_INT_DMEM_SIZE => MEM_INT_DMEM_SIZE, -- size of processor-internal data memory in bytes
+    MEM_INT_DMEM_BASE => MEM_INT_DMEM_BASE, -- base address of processor-internal data memory
+    -- Additional internal memory banks --
+    MEM_INT_XMEM_BASE => MEM_INT_XMEM_BASE, -- base addresses of additional internal memory banks
+    MEM_INT_XMEM_SIZE => MEM_INT_XMEM_SIZE, -- sizes of additional internal memory banks in bytes
+    -- Execute in place flash window --
+    XIP_EN            => XIP_EN,            -- implement execute-in-place flash controller
+    XIP_BASE          => XIP_BASE,          -- base address of the memory-mapped flash window
+    XIP_SIZE          => XIP_SIZE           -- size of the memory-mapped flash window in bytes
   )
   port map (
     -- host access --
@@ -713,20 +1147,33 @@ begin
   if (MEM_INT_IMEM_EN = true) generate
     neorv32_int_imem_inst: neorv32_imem
     generic map (
-      IMEM_BASE    => imem_base_c,          -- memory base address
+      IMEM_BASE    => MEM_INT_IMEM_BASE,    -- memory base address
       IMEM_SIZE    => MEM_INT_IMEM_SIZE,    -- processor-internal instruction memory size in bytes
-      IMEM_AS_IROM => not INT_BOOTLOADER_EN -- implement IMEM as pre-initialized read-only memory?
+      IMEM_AS_IROM => not INT_BOOTLOADER_EN, -- implement IMEM as pre-initialized read-only memory?
+      IMEM_TCM_EN  => tcm_imem_en_c or xbar_imem_en_c -- second read port (TCM / bus crossbar) in use?
     )
     port map (
-      clk_i  => clk_i,                     -- global clock line
-      rden_i => p_bus.re,                  -- read enable
-      wren_i => p_bus.we,                  -- write enable
-      ben_i  => p_bus.ben,                 -- byte write enable
-      addr_i => p_bus.addr,                -- address
-      data_i => p_bus.wdata,               -- data in
-      data_o => resp_bus(RESP_IMEM).rdata, -- data out
-      ack_o  => resp_bus(RESP_IMEM).ack    -- transfer acknowledge
+      clk_i      => clk_i,                     -- global clock line
+      -- processor bus --
+      rden_i     => p_bus.re,                  -- read enable
+      wren_i     => p_bus.we,                  -- write enable
+      ben_i      => p_bus.ben,                 -- byte write enable
+      addr_i     => p_bus.addr,                -- address
+      data_i     => p_bus.wdata,               -- data in
+      data_o     => resp_bus(RESP_IMEM).rdata, -- data out
+      ack_o      => resp_bus(RESP_IMEM).ack,   -- transfer acknowledge
+      -- tightly-coupled memory port --
+      tcm_re_i   => imem_p2_re,                -- read enable
+      tcm_addr_i => imem_p2_addr,              -- address
+      tcm_data_o => tcm_i_rdata                -- data out
     );
+
+    -- TCM read data is only valid when the TCM is actually connected to the CPU --
+    neorv32_int_imem_tcm:
+    if (tcm_imem_en_c = true) generate
+      cpu_i_tcm(0).rdata <= tcm_i_rdata;
+    end generate;
+
     resp_bus(RESP_IMEM).err <= '0'; -- no access error possible
   end generate;
 
@@ -742,19 +1189,35 @@ begin
   if (MEM_INT_DMEM_EN = true) generate
     neorv32_int_dmem_inst: neorv32_dmem
     generic map (
-      DMEM_BASE => dmem_base_c,      -- memory base address
-      DMEM_SIZE => MEM_INT_DMEM_SIZE -- processor-internal data memory size in bytes
+      DMEM_BASE   => MEM_INT_DMEM_BASE, -- memory base address
+      DMEM_SIZE   => MEM_INT_DMEM_SIZE, -- processor-internal data memory size in bytes
+      DMEM_TCM_EN => tcm_dmem_en_c      -- TCM port in use?
     )
     port map (
-      clk_i  => clk_i,                     -- global clock line
-      rden_i => p_bus.re,                  -- read enable
-      wren_i => p_bus.we,                  -- write enable
-      ben_i  => p_bus.ben,                 -- byte write enable
-      addr_i => p_bus.addr,                -- address
-      data_i => p_bus.wdata,               -- data in
-      data_o => resp_bus(RESP_DMEM).rdata, -- data out
-      ack_o  => resp_bus(RESP_DMEM).ack    -- transfer acknowledge
+      clk_i      => clk_i,                     -- global clock line
+      -- processor bus --
+      rden_i     => p_bus.re,                  -- read enable
+      wren_i     => p_bus.we,                  -- write enable
+      ben_i      => p_bus.ben,                 -- byte write enable
+      addr_i     => p_bus.addr,                -- address
+      data_i     => p_bus.wdata,               -- data in
+      data_o     => resp_bus(RESP_DMEM).rdata, -- data out
+      ack_o      => resp_bus(RESP_DMEM).ack,   -- transfer acknowledge
+      -- tightly-coupled memory port --
+      tcm_re_i   => cpu_d_tcm(0).re,           -- read enable
+      tcm_we_i   => cpu_d_tcm(0).we,           -- write enable
+      tcm_ben_i  => cpu_d_tcm(0).ben,          -- byte write enable
+      tcm_addr_i => cpu_d_tcm(0).addr,         -- address
+      tcm_data_i => cpu_d_tcm(0).wdata,        -- data in
+      tcm_data_o => tcm_d_rdata                -- data out
     );
+
+    -- TCM read data is only valid when the TCM is actually connected to the CPU --
+    neorv32_int_dmem_tcm:
+    if (tcm_dmem_en_c = true) generate
+      cpu_d_tcm(0).rdata <= tcm_d_rdata;
+    end generate;
+
     resp_bus(RESP_DMEM).err <= '0'; -- no access error possible
   end generate;
 
@@ -764,6 +1227,49 @@ begin
   end generate;
 
 
+  -- Additional Processor-Internal Memory Banks (XMEM) --------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  neorv32_int_xmem_gen:
+  for i in 0 to xmem_num_banks_c-1 generate
+
+    neorv32_int_xmem_inst_true:
+    if (MEM_INT_XMEM_SIZE(i) /= 0) generate
+      constant resp_id_c : resp_bus_id_t := resp_bus_id_t'val(resp_bus_id_t'pos(RESP_XMEM0) + i); -- bank's response bus entry
+    begin
+      assert not (is_power_of_two_f(MEM_INT_XMEM_SIZE(i)) = false) report "NEORV32 PROCESSOR CONFIG ERROR! <MEM_INT_XMEM_SIZE(" & integer'image(i) & ")> has to be a power of 2." severity error;
+      assert not (or_reduce_f(MEM_INT_XMEM_BASE(i)(index_size_f(MEM_INT_XMEM_SIZE(i))-1 downto 0)) /= '0') report "NEORV32 PROCESSOR CONFIG ERROR! <MEM_INT_XMEM_BASE(" & integer'image(i) & ")> has to be aligned to the bank's size." severity error;
+
+      -- the DMEM module is used as plain RAM bank (TCM port unused) --
+      neorv32_int_xmem_inst: neorv32_dmem
+      generic map (
+        DMEM_BASE   => MEM_INT_XMEM_BASE(i), -- memory base address
+        DMEM_SIZE   => MEM_INT_XMEM_SIZE(i), -- memory size in bytes
+        DMEM_TCM_EN => false                 -- TCM port not used
+      )
+      port map (
+        clk_i  => clk_i,                     -- global clock line
+        -- processor bus --
+        rden_i => p_bus.re,                  -- read enable
+        wren_i => p_bus.we,                  -- write enable
+        ben_i  => p_bus.ben,                 -- byte write enable
+        addr_i => p_bus.addr,                -- address
+        data_i => p_bus.wdata,               -- data in
+        data_o => resp_bus(resp_id_c).rdata, -- data out
+        ack_o  => resp_bus(resp_id_c).ack    -- transfer acknowledge
+      );
+      resp_bus(resp_id_c).err <= '0'; -- no access error possible
+    end generate;
+
+    neorv32_int_xmem_inst_false:
+    if (MEM_INT_XMEM_SIZE(i) = 0) generate
+      resp_bus(resp_bus_id_t'val(resp_bus_id_t'pos(RESP_XMEM0) + i)) <= resp_bus_entry_terminate_c;
+    end generate;
+
+  end generate;
+
+  end generate;
+
+
   -- Processor-Internal Bootloader ROM (BOOTROM) --------------------------------------------
   -- -------------------------------------------------------------------------------------------
   neorv32_boot_rom_inst_true:
@@ -773,11 +1279,17 @@ begin
       BOOTROM_BASE => boot_rom_base_c -- boot ROM base address
     )
     port map (
-      clk_i  => clk_i,                        -- global clock line
-      rden_i => p_bus.re,                     -- read enable
-      addr_i => p_bus.addr,                   -- address
-      data_o => resp_bus(RESP_BOOTROM).rdata, -- data out
-      ack_o  => resp_bus(RESP_BOOTROM).ack    -- transfer acknowledge
+      clk_i       => clk_i,                        -- global clock line
+      -- processor bus --
+      rden_i      => p_bus.re,                     -- read enable
+      addr_i      => p_bus.addr,                   -- address
+      data_o      => resp_bus(RESP_BOOTROM).rdata, -- data out
+      ack_o       => resp_bus(RESP_BOOTROM).ack,   -- transfer acknowledge
+      -- crossbar port --
+      xbar_rden_i => x_bus(0).re,                  -- read enable
+      xbar_addr_i => x_bus(0).addr,                -- address
+      xbar_data_o => xbar_boot_rdata,              -- data out
+      xbar_ack_o  => xbar_boot_ack                 -- transfer acknowledge
     );
     resp_bus(RESP_BOOTROM).err <= '0'; -- no access error possible
   end generate;
@@ -785,6 +1297,53 @@ begin
   neorv32_boot_rom_inst_false:
   if (INT_BOOTLOADER_EN = false) generate
     resp_bus(RESP_BOOTROM) <= resp_bus_entry_terminate_c;
+    xbar_boot_rdata        <= (others => '0');
+    xbar_boot_ack          <= '0';
+  end generate;
+
+
+  -- Execute In Place Flash Controller (XIP) -----------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  neorv32_xip_inst_true:
+  if (XIP_EN = true) generate
+    neorv32_xip_inst: neorv32_xip
+    generic map (
+      XIP_BASE => XIP_BASE, -- base address of the memory-mapped flash window
+      XIP_SIZE => XIP_SIZE  -- size of the memory-mapped flash window in bytes
+    )
+    port map (
+      -- global control --
+      clk_i        => clk_i,                    -- global clock line
+      rstn_i       => sys_rstn,                 -- global reset line, low-active
+      -- host access --
+      addr_i       => p_bus.addr,               -- address
+      rden_i       => p_bus.re,                 -- read enable
+      wren_i       => p_bus.we,                 -- write enable
+      data_i       => p_bus.wdata,              -- data in
+      data_o       => resp_bus(RESP_XIP).rdata, -- data out
+      ack_o        => resp_bus(RESP_XIP).ack,   -- transfer acknowledge
+      err_o        => resp_bus(RESP_XIP).err,   -- transfer error
+      -- clock generator --
+      clkgen_en_o  => xip_cg_en,                -- enable clock generator
+      clkgen_i     => clk_gen,
+      -- flash interface --
+      xip_csn_o    => xip_csn_o,                -- chip-select, low-active
+      xip_clk_o    => xip_clk_o,                -- serial clock
+      xip_dat_i    => xip_dat_i,                -- IO0..IO3 input
+      xip_dat_o    => xip_dat_o,                -- IO0..IO3 output
+      xip_dat_oe_o => xip_dat_oe_o              -- IO0..IO3 output enable, high-active
+    );
+  end generate;
+
+  neorv32_xip_inst_false:
+  if (XIP_EN = false) generate
+    resp_bus(RESP_XIP) <= resp_bus_entry_terminate_c;
+    --
+    xip_cg_en    <= '0';
+    xip_csn_o    <= '1';
+    xip_clk_o    <= '0';
+    xip_dat_o    <= (others => '0');
+    xip_dat_oe_o <= (others => '0');
   end generate;
 
 
@@ -797,9 +1356,18 @@ begin
       -- Internal instruction memory --
       MEM_INT_IMEM_EN   => MEM_INT_IMEM_EN,    -- implement processor-internal instruction memory
       MEM_INT_IMEM_SIZE => MEM_INT_IMEM_SIZE,  -- size of processor-internal instruction memory in bytes
+      MEM_INT_IMEM_BASE => MEM_INT_IMEM_BASE,  -- base address of processor-internal instruction memory
       -- Internal data memory --
       MEM_INT_DMEM_EN   => MEM_INT_DMEM_EN,    -- implement processor-internal data memory
       MEM_INT_DMEM_SIZE => MEM_INT_DMEM_SIZE,  -- size of processor-internal data memory in bytes
+      MEM_INT_DMEM_BASE => MEM_INT_DMEM_BASE,  -- base address of processor-internal data memory
+      -- Additional internal memory banks --
+      MEM_INT_XMEM_BASE => MEM_INT_XMEM_BASE,  -- base addresses of additional internal memory banks
+      MEM_INT_XMEM_SIZE => MEM_INT_XMEM_SIZE,  -- sizes of additional internal memory banks in bytes
+      -- Execute in place flash window --
+      XIP_EN            => XIP_EN,             -- implement execute-in-place flash controller
+      XIP_BASE          => XIP_BASE,           -- base address of the memory-mapped flash window
+      XIP_SIZE          => XIP_SIZE,           -- size of the memory-mapped flash window in bytes
       -- Interface Configuration --
       BUS_TIMEOUT       => MEM_EXT_TIMEOUT,    -- cycles after an UNACKNOWLEDGED bus access triggers a bus fault exception
       PIPE_MODE         => MEM_EXT_PIPE_MODE,  -- protocol: false=classic/standard wishbone mode, true=pipelined wishbone mode
@@ -884,7 +1452,7 @@ begin
       clkgen_en_o => cfs_cg_en,                -- enable clock generator
       clkgen_i    => clk_gen,                  -- "clock" inputs
       -- CPU state --
-      sleep_i     => cpu_sleep,                -- set if cpu is in sleep mode
+      sleep_i     => sys_sleep,                -- set if cpu is in sleep mode
       -- interrupt --
       irq_o       => cfs_irq,                  -- interrupt request
       -- custom io (conduit) --
@@ -995,6 +1563,40 @@ begin
   end generate;
 
 
+  -- Core-Local Interruptor (CLINT) ---------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  neorv32_clint_inst_true:
+  if (io_clint_en_c = true) generate
+    neorv32_clint_inst: neorv32_clint
+    generic map (
+      NUM_HARTS => CPU_NUM_HARTS -- number of harts
+    )
+    port map (
+      -- host access --
+      clk_i       => clk_i,                      -- global clock line
+      addr_i      => p_bus.addr,                 -- address
+      rden_i      => io_rden,                    -- read enable
+      wren_i      => io_wren,                    -- write enable
+      data_i      => p_bus.wdata,                -- data in
+      data_o      => resp_bus(RESP_CLINT).rdata, -- data out
+      ack_o       => resp_bus(RESP_CLINT).ack,   -- transfer acknowledge
+      -- system time --
+      time_i      => mtime_time,                 -- current system time
+      -- interrupts (one per hart) --
+      msw_irq_o   => clint_msw_irq,              -- machine software interrupt
+      mtime_irq_o => clint_mtime_irq             -- machine timer interrupt
+    );
+    resp_bus(RESP_CLINT).err <= '0'; -- no access error possible
+  end generate;
+
+  neorv32_clint_inst_false:
+  if (io_clint_en_c = false) generate
+    resp_bus(RESP_CLINT) <= resp_bus_entry_terminate_c;
+    clint_msw_irq   <= (others => '0');
+    clint_mtime_irq <= (others => '0');
+  end generate;
+
+
   -- system time output LO --
   mtime_sync: process(clk_i)
   begin
@@ -1021,7 +1623,9 @@ begin
   if (IO_UART0_EN = true) generate
     neorv32_uart0_inst: neorv32_uart
     generic map (
-      UART_PRIMARY => true -- true = primary UART (UART0), false = secondary UART (UART1)
+      UART_PRIMARY => true,          -- true = primary UART (UART0), false = secondary UART (UART1)
+      UART_RX_FIFO => UART0_RX_FIFO, -- RX fifo depth, has to be a power of two, min 1
+      UART_TX_FIFO => UART0_TX_FIFO  -- TX fifo depth, has to be a power of two, min 1
     )
     port map (
       -- host access --
@@ -1065,7 +1669,9 @@ begin
   if (IO_UART1_EN = true) generate
     neorv32_uart1_inst: neorv32_uart
     generic map (
-      UART_PRIMARY => false -- true = primary UART (UART0), false = secondary UART (UART1)
+      UART_PRIMARY => false,         -- true = primary UART (UART0), false = secondary UART (UART1)
+      UART_RX_FIFO => UART1_RX_FIFO, -- RX fifo depth, has to be a power of two, min 1
+      UART_TX_FIFO => UART1_TX_FIFO  -- TX fifo depth, has to be a power of two, min 1
     )
     port map (
       -- host access --
@@ -1108,6 +1714,9 @@ begin
   neorv32_spi_inst_true:
   if (IO_SPI_EN = true) generate
     neorv32_spi_inst: neorv32_spi
+    generic map (
+      SPI_FIFO => SPI_FIFO -- TX/RX fifo depth, has to be a power of two, min 1
+    )
     port map (
       -- host access --
       clk_i       => clk_i,                    -- global clock line
@@ -1147,6 +1756,9 @@ begin
   neorv32_twi_inst_true:
   if (IO_TWI_EN = true) generate
     neorv32_twi_inst: neorv32_twi
+    generic map (
+      TWI_FIFO => TWI_FIFO -- command/RX fifo depth, has to be a power of two, min 1
+    )
     port map (
       -- host access --
       clk_i       => clk_i,                    -- global clock line
@@ -1163,7 +1775,7 @@ begin
       twi_sda_io  => twi_sda_io,               -- serial data line
       twi_scl_io  => twi_scl_io,               -- serial clock line
       -- interrupt --
-      irq_o       => twi_irq                   -- transfer done IRQ
+      irq_o       => twi_irq                   -- transfer done / sequence done IRQ
     );
     resp_bus(RESP_TWI).err <= '0'; -- no access error possible
   end generate;
@@ -1353,6 +1965,127 @@ begin
   end generate;
 
 
+  -- Instruction Trace Encoder (TRACE) ------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  neorv32_trace_inst_true:
+  if (TRACE_EN = true) generate
+    neorv32_trace_inst: neorv32_trace
+    generic map (
+      TRACE_BUFFER_DEPTH => TRACE_BUFFER_DEPTH -- trace buffer size in 32-bit words (0..32k), has to be a power of two; 0 = stream port only
+    )
+    port map (
+      -- host access --
+      clk_i          => clk_i,                      -- global clock line
+      addr_i         => p_bus.addr,                 -- address
+      rden_i         => io_rden,                    -- read enable
+      wren_i         => io_wren,                    -- write enable
+      data_i         => p_bus.wdata,                -- data in
+      data_o         => resp_bus(RESP_TRACE).rdata, -- data out
+      ack_o          => resp_bus(RESP_TRACE).ack,   -- transfer acknowledge
+      -- CPU trace port --
+      trace_i        => cpu_trace(0),               -- discontinuity events (first hart only)
+      -- TX stream interface --
+      trace_tx_dat_o => trace_tx_dat_o,             -- output data
+      trace_tx_val_o => trace_tx_val_o,             -- valid output
+      trace_tx_rdy_i => trace_tx_rdy_i              -- ready to send
+    );
+    resp_bus(RESP_TRACE).err <= '0'; -- no access error possible
+  end generate;
+
+  neorv32_trace_inst_false:
+  if (TRACE_EN = false) generate
+    resp_bus(RESP_TRACE) <= resp_bus_entry_terminate_c;
+    trace_tx_dat_o <= (others => '0');
+    trace_tx_val_o <= '0';
+  end generate;
+
+
+  -- Direct Memory Access Controller (DMA) --------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  neorv32_dma_inst_true:
+  if (io_dma_en_c = true) generate
+    neorv32_dma_inst: neorv32_dma
+    generic map (
+      DMA_NUM_CH => IO_DMA_NUM_CH -- number of DMA channels (1..4)
+    )
+    port map (
+      -- host access --
+      clk_i       => clk_i,                    -- global clock line
+      rstn_i      => sys_rstn,                 -- global reset line, low-active
+      addr_i      => p_bus.addr,               -- address
+      rden_i      => io_rden,                  -- read enable
+      wren_i      => io_wren,                  -- write enable
+      data_i      => p_bus.wdata,              -- data in
+      data_o      => resp_bus(RESP_DMA).rdata, -- data out
+      ack_o       => resp_bus(RESP_DMA).ack,   -- transfer acknowledge
+      -- bus controller interface --
+      bus_addr_o  => dma_m.addr,               -- bus access address
+      bus_rdata_i => dma_m.rdata,              -- bus read data
+      bus_wdata_o => dma_m.wdata,              -- bus write data
+      bus_ben_o   => dma_m.ben,                -- byte enable
+      bus_we_o    => dma_m.we,                 -- write enable
+      bus_re_o    => dma_m.re,                 -- read enable
+      bus_ack_i   => dma_m.ack,                -- bus transfer acknowledge
+      bus_err_i   => dma_m.err,                -- bus transfer error
+      -- trigger events --
+      trig_i      => fast_irq(11 downto 0),    -- peripheral events (fast interrupt request lines 0..11)
+      -- interrupt --
+      irq_o       => dma_irq                   -- transfer done interrupt
+    );
+    resp_bus(RESP_DMA).err <= '0'; -- no access error possible
+  end generate;
+
+  neorv32_dma_inst_false:
+  if (io_dma_en_c = false) generate
+    resp_bus(RESP_DMA) <= resp_bus_entry_terminate_c;
+    dma_m.addr  <= (others => '0');
+    dma_m.wdata <= (others => '0');
+    dma_m.ben   <= (others => '0');
+    dma_m.we    <= '0';
+    dma_m.re    <= '0';
+    dma_irq     <= '0';
+  end generate;
+
+
+  -- Block Memory Copy/Fill Engine (MEMCPY) -------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  neorv32_memcpy_inst_true:
+  if (IO_MEMCPY_EN = true) generate
+    neorv32_memcpy_inst: neorv32_memcpy
+    port map (
+      -- host access --
+      clk_i       => clk_i,                       -- global clock line
+      rstn_i      => sys_rstn,                    -- global reset line, low-active
+      addr_i      => p_bus.addr,                  -- address
+      rden_i      => io_rden,                     -- read enable
+      wren_i      => io_wren,                     -- write enable
+      data_i      => p_bus.wdata,                 -- data in
+      data_o      => resp_bus(RESP_MEMCPY).rdata, -- data out
+      ack_o       => resp_bus(RESP_MEMCPY).ack,   -- transfer acknowledge
+      -- bus controller interface --
+      bus_addr_o  => memcpy_m.addr,               -- bus access address
+      bus_rdata_i => memcpy_m.rdata,              -- bus read data
+      bus_wdata_o => memcpy_m.wdata,              -- bus write data
+      bus_ben_o   => memcpy_m.ben,                -- byte enable
+      bus_we_o    => memcpy_m.we,                 -- write enable
+      bus_re_o    => memcpy_m.re,                 -- read enable
+      bus_ack_i   => memcpy_m.ack,                -- bus transfer acknowledge
+      bus_err_i   => memcpy_m.err                 -- bus transfer error
+    );
+    resp_bus(RESP_MEMCPY).err <= '0'; -- no access error possible
+  end generate;
+
+  neorv32_memcpy_inst_false:
+  if (IO_MEMCPY_EN = false) generate
+    resp_bus(RESP_MEMCPY) <= resp_bus_entry_terminate_c;
+    memcpy_m.addr  <= (others => '0');
+    memcpy_m.wdata <= (others => '0');
+    memcpy_m.ben   <= (others => '0');
+    memcpy_m.we    <= '0';
+    memcpy_m.re    <= '0';
+  end generate;
+
+
   -- System Configuration Information Memory (SYSINFO) --------------------------------------
   -- -------------------------------------------------------------------------------------------
   neorv32_sysinfo_inst: neorv32_sysinfo
@@ -1361,17 +2094,24 @@ begin
     CLOCK_FREQUENCY      => CLOCK_FREQUENCY,      -- clock frequency of clk_i in Hz
     INT_BOOTLOADER_EN    => INT_BOOTLOADER_EN,    -- implement processor-internal bootloader?
     USER_CODE            => USER_CODE,            -- custom user code
+    CPU_NUM_HARTS        => CPU_NUM_HARTS,        -- number of CPU cores (harts)
     -- internal Instruction memory --
     MEM_INT_IMEM_EN      => MEM_INT_IMEM_EN,      -- implement processor-internal instruction memory
     MEM_INT_IMEM_SIZE    => MEM_INT_IMEM_SIZE,    -- size of processor-internal instruction memory in bytes
+    MEM_INT_IMEM_BASE    => MEM_INT_IMEM_BASE,    -- base address of processor-internal instruction memory
     -- Internal Data memory --
     MEM_INT_DMEM_EN      => MEM_INT_DMEM_EN,      -- implement processor-internal data memory
     MEM_INT_DMEM_SIZE    => MEM_INT_DMEM_SIZE,    -- size of processor-internal data memory in bytes
+    MEM_INT_DMEM_BASE    => MEM_INT_DMEM_BASE,    -- base address of processor-internal data memory
+    MEM_INT_XMEM_NUM     => xmem_num_f(MEM_INT_XMEM_SIZE), -- number of additional internal memory banks
+    MEM_INT_TCM_EN       => tcm_en_c,             -- internal IMEM/DMEM connected via tightly-coupled memory ports
+    BUS_XBAR_EN          => xbar_en_c,            -- bus switch crossbar path for instruction fetches
     -- Internal Cache memory --
     ICACHE_EN            => ICACHE_EN,            -- implement instruction cache
     ICACHE_NUM_BLOCKS    => ICACHE_NUM_BLOCKS,    -- i-cache: number of blocks (min 2), has to be a power of 2
     ICACHE_BLOCK_SIZE    => ICACHE_BLOCK_SIZE,    -- i-cache: block size in bytes (min 4), has to be a power of 2
     ICACHE_ASSOCIATIVITY => ICACHE_ASSOCIATIVITY, -- i-cache: associativity (min 1), has to be a power 2
+    ICACHE_REPLACEMENT   => ICACHE_REPLACEMENT,   -- i-cache: replacement policy: 0 = (pseudo-)LRU, 1 = random
     -- External memory interface --
     MEM_EXT_EN           => MEM_EXT_EN,           -- implement external memory bus interface?
     MEM_EXT_BIG_ENDIAN   => MEM_EXT_BIG_ENDIAN,   -- byte order: true=big-endian, false=little-endian
@@ -1390,7 +2130,10 @@ begin
     IO_CFS_EN            => IO_CFS_EN,            -- implement custom functions subsystem (CFS)?
     IO_SLINK_EN          => io_slink_en_c,        -- implement stream link interface?
     IO_NEOLED_EN         => IO_NEOLED_EN,         -- implement NeoPixel-compatible smart LED interface (NEOLED)?
-    IO_XIRQ_NUM_CH       => XIRQ_NUM_CH           -- number of external interrupt (XIRQ) channels to implement
+    IO_XIRQ_NUM_CH       => XIRQ_NUM_CH,          -- number of external interrupt (XIRQ) channels to implement
+    IO_TRACE_EN          => TRACE_EN,             -- implement instruction trace encoder (TRACE)?
+    IO_DMA_EN            => io_dma_en_c,          -- implement direct memory access controller (DMA)?
+    IO_MEMCPY_EN         => IO_MEMCPY_EN          -- implement block memory copy/fill engine (MEMCPY)?
   )
   port map (
     -- host access --
@@ -1414,6 +2157,10 @@ begin
   neorv32_neorv32_debug_dm_true:
   if (ON_CHIP_DEBUGGER_EN = true) generate
     neorv32_debug_dm_inst: neorv32_debug_dm
+    generic map (
+      NUM_HARTS => CPU_NUM_HARTS,          -- number of harts
+      SBA_EN    => ON_CHIP_DEBUGGER_SBA_EN -- implement system bus access (SBA) master and abstract memory access?
+    )
     port map (
       -- global control --
       clk_i            => clk_i,                    -- global clock line
@@ -1436,9 +2183,19 @@ begin
       cpu_data_i       => p_bus.wdata,              -- data in
       cpu_data_o       => resp_bus(RESP_OCD).rdata, -- data out
       cpu_ack_o        => resp_bus(RESP_OCD).ack,   -- transfer acknowledge
+      cpu_hart_i       => p_bus_hart,               -- index of the hart that performs the current access
       -- CPU control --
       cpu_ndmrstn_o    => dci_ndmrstn,              -- soc reset
-      cpu_halt_req_o   => dci_halt_req              -- request hart to halt (enter debug mode)
+      cpu_halt_req_o   => dci_halt_req,             -- request hart to halt (enter debug mode)
+      -- system bus access (SBA) master --
+      sba_addr_o       => dm_sba.addr,              -- bus access address
+      sba_rdata_i      => dm_sba.rdata,             -- bus read data
+      sba_wdata_o      => dm_sba.wdata,             -- bus write data
+      sba_ben_o        => dm_sba.ben,               -- byte enable
+      sba_we_o         => dm_sba.we,                -- write enable
+      sba_re_o         => dm_sba.re,                -- read enable
+      sba_ack_i        => dm_sba.ack,               -- bus transfer acknowledge
+      sba_err_i        => dm_sba.err                -- bus transfer error
     );
     resp_bus(RESP_OCD).err <= '0'; -- no access error possible
   end generate;
@@ -1452,7 +2209,13 @@ begin
     --
     resp_bus(RESP_OCD) <= resp_bus_entry_terminate_c;
     dci_ndmrstn  <= '1';
-    dci_halt_req <= '0';
+    dci_halt_req <= (others => '0');
+    --
+    dm_sba.addr  <= (others => '0');
+    dm_sba.wdata <= (others => '0');
+    dm_sba.ben   <= (others => '0');
+    dm_sba.we    <= '0';
+    dm_sba.re    <= '0';
   end generate;
 
 
@@ -0,0 +1,486 @@
+-- #################################################################################################
+-- # << NEORV32 - Instruction Trace Encoder (TRACE) >>                                             #
+-- # ********************************************************************************************* #
+-- # Non-intrusive branch trace encoder. Only program flow discontinuities that cannot be inferred #
+-- # from the executable are recorded ("E-Trace-style"): the outcome of each conditional branch is #
+-- # collected in a branch map, uninferable jumps (JALR), trap entries and trap returns emit their #
+-- # target address. Linear execution and direct jumps (JAL) do not generate any trace data.       #
+-- #                                                                                               #
+-- # Trace packets are serialized into 32-bit words that are either written to an on-chip ring     #
+-- # buffer (TRACE_BUFFER_DEPTH > 0, read via the processor bus) or sent out via a SLINK-          #
+-- # compatible stream port. Packet header words always have bit 0 set, payload words always have  #
+-- # bit 0 cleared, so a decoder can re-synchronize at any point of the trace stream.              #
+-- # Events are buffered in a small FIFO; the CPU is never stalled. If this FIFO overflows, the    #
+-- # according packets are dropped, the overflow flag is set and a new SYNC packet is generated.   #
+-- # ********************************************************************************************* #
+-- # BSD 3-Clause License                                                                          #
+-- #                                                                                               #
+-- # Copyright (c) 2021, Stephan Nolting. All rights reserved.                                     #
+-- #                                                                                               #
+-- # Redistribution and use in source and binary forms, with or without modification, are          #
+-- # permitted provided that the following conditions are met:                                     #
+-- #                                                                                               #
+-- # 1. Redistributions of source code must retain the above copyright notice, this list of        #
+-- #    conditions and the following disclaimer.                                                   #
+-- #                                                                                               #
+-- # 2. Redistributions in binary form must reproduce the above copyright notice, this list of     #
+-- #    conditions and the following disclaimer in the documentation and/or other materials        #
+-- #    provided with the distribution.                                                            #
+-- #                                                                                               #
+-- # 3. Neither the name of the copyright holder nor the names of its contributors may be used to  #
+-- #    endorse or promote products derived from this software without specific prior written      #
+-- #    permission.                                                                                #
+-- #                                                                                               #
+-- # THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS   #
+-- # OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF               #
+-- # MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE    #
+-- # COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,     #
+-- # EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE #
+-- # GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED    #
+-- # AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING     #
+-- # NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED  #
+-- # OF THE POSSIBILITY OF SUCH DAMAGE.                                                            #
+-- # ********************************************************************************************* #
+-- # The NEORV32 Processor - https://github.com/stnolting/neorv32              (c) Stephan Nolting #
+-- #################################################################################################
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library neorv32;
+use neorv32.neorv32_package.all;
+
+entity neorv32_trace is
+  generic (
+    TRACE_BUFFER_DEPTH : natural -- trace buffer size in 32-bit words (0..32k), has to be a power of two; 0 = stream port only
+  );
+  port (
+    -- host access --
+    clk_i          : in  std_ulogic; -- global clock line
+    addr_i         : in  std_ulogic_vector(31 downto 0); -- address
+    rden_i         : in  std_ulogic; -- read enable
+    wren_i         : in  std_ulogic; -- write enable
+    data_i         : in  std_ulogic_vector(31 downto 0); -- data in
+    data_o         : out std_ulogic_vector(31 downto 0); -- data out
+    ack_o          : out std_ulogic; -- transfer acknowledge
+    -- CPU trace port --
+    trace_i        : in  cpu_trace_if_t; -- discontinuity events
+    -- TX stream interface --
+    trace_tx_dat_o : out std_ulogic_vector(31 downto 0); -- output data
+    trace_tx_val_o : out std_ulogic; -- valid output
+    trace_tx_rdy_i : in  std_ulogic  -- ready to send
+  );
+end neorv32_trace;
+
+architecture neorv32_trace_rtl of neorv32_trace is
+
+  -- IO space: module base address --
+  constant hi_abb_c : natural := index_size_f(io_size_c)-1; -- high address boundary bit
+  constant lo_abb_c : natural := index_size_f(trace_size_c); -- low address boundary bit
+
+  -- trace buffer configuration --
+  constant buf_en_c   : boolean := boolean(TRACE_BUFFER_DEPTH > 0);
+  constant buf_size_c : natural := cond_sel_natural_f(buf_en_c, TRACE_BUFFER_DEPTH, 1);
+  constant buf_abw_c  : natural := index_size_f(buf_size_c); -- buffer address width
+
+  -- control register bits --
+  constant ctrl_en_c        : natural :=  0; -- r/w: trace enable (clears buffer and forces SYNC on rising edge)
+  constant ctrl_stream_c    : natural :=  1; -- r/w: trace sink: 0 = trace buffer, 1 = stream port
+  constant ctrl_stop_c      : natural :=  2; -- r/w: buffer mode: 0 = ring buffer, 1 = stop when full
+  constant ctrl_sync0_c     : natural :=  3; -- r/w: SYNC period: 2^(n+3) packets, 0 = off; bit 0
+  constant ctrl_sync3_c     : natural :=  6; -- r/w: SYNC period: 2^(n+3) packets, 0 = off; bit 3
+  --
+  constant ctrl_buf_s0_c    : natural := 24; -- r/-: log2(trace buffer size) bit 0
+  constant ctrl_buf_s3_c    : natural := 27; -- r/-: log2(trace buffer size) bit 3
+  constant ctrl_buf_en_c    : natural := 28; -- r/-: trace buffer implemented
+  constant ctrl_wrap_c      : natural := 29; -- r/-: ring buffer has wrapped around (oldest data was overwritten)
+  constant ctrl_ovfl_c      : natural := 30; -- r/-: trace packets were dropped (event FIFO overflow)
+  constant ctrl_full_c      : natural := 31; -- r/-: trace buffer is full (stop mode only)
+
+  -- trace packet types --
+  constant pkt_bmap_c : std_ulogic_vector(2 downto 0) := "000"; -- branch map only
+  constant pkt_sync_c : std_ulogic_vector(2 downto 0) := "001"; -- synchronization: hdr, pc, time
+  constant pkt_jump_c : std_ulogic_vector(2 downto 0) := "010"; -- uninferable jump: hdr, target
+  constant pkt_trap_c : std_ulogic_vector(2 downto 0) := "011"; -- trap entry: hdr, epc, target, time
+  constant pkt_tret_c : std_ulogic_vector(2 downto 0) := "100"; -- trap return: hdr, target, time
+
+  -- event FIFO: 4x 32-bit packet words + 2-bit packet length (number of words - 1) --
+  constant evt_fifo_depth_c : natural := 4;
+
+  -- bus access control --
+  signal ack_read  : std_ulogic;
+  signal ack_write : std_ulogic;
+  signal acc_en    : std_ulogic;
+  signal addr      : std_ulogic_vector(31 downto 0);
+  signal wren      : std_ulogic;
+  signal rden      : std_ulogic;
+
+  -- control register --
+  type ctrl_t is record
+    enable : std_ulogic;
+    stream : std_ulogic;
+    stop   : std_ulogic;
+    sync   : std_ulogic_vector(3 downto 0);
+  end record;
+  signal ctrl : ctrl_t;
+
+  -- packet encoder --
+  type encoder_t is record
+    enable_ff : std_ulogic; -- enable edge detector
+    sync_req  : std_ulogic; -- SYNC packet required
+    lost      : std_ulogic; -- trace data lost before next SYNC packet (or trace start)
+    sync_cnt  : std_ulogic_vector(18 downto 0); -- packet counter for periodic SYNC
+    bmap      : std_ulogic_vector(15 downto 0); -- branch map
+    bcnt      : std_ulogic_vector(04 downto 0); -- number of valid branch map entries
+    time      : std_ulogic_vector(31 downto 0); -- cycle counter (time stamp)
+    ovfl      : std_ulogic; -- packets dropped
+    -- packet --
+    we        : std_ulogic;
+    ptype     : std_ulogic_vector(2 downto 0);
+    cause     : std_ulogic_vector(6 downto 0);
+    word1     : std_ulogic_vector(31 downto 0);
+    word2     : std_ulogic_vector(31 downto 0);
+    word3     : std_ulogic_vector(31 downto 0);
+    len       : std_ulogic_vector(1 downto 0);
+  end record;
+  signal encoder : encoder_t;
+
+  -- event FIFO --
+  type evt_fifo_t is record
+    clear : std_ulogic;
+    wdata : std_ulogic_vector(2+127 downto 0);
+    we    : std_ulogic;
+    free  : std_ulogic;
+    re    : std_ulogic;
+    rdata : std_ulogic_vector(2+127 downto 0);
+    avail : std_ulogic;
+  end record;
+  signal evt_fifo : evt_fifo_t;
+
+  -- packet serializer --
+  type serializer_t is record
+    cnt   : std_ulogic_vector(1 downto 0); -- current word
+    word  : std_ulogic_vector(31 downto 0);
+    valid : std_ulogic; -- word valid
+    ack   : std_ulogic; -- word consumed by sink
+  end record;
+  signal serializer : serializer_t;
+
+  -- trace buffer --
+  type buf_mem_t is array (0 to buf_size_c-1) of std_ulogic_vector(31 downto 0);
+  type buf_t is record
+    mem   : buf_mem_t; -- dual-port memory
+    wptr  : std_ulogic_vector(buf_abw_c downto 0); -- write pointer, incl. wrap-around bit
+    rptr  : std_ulogic_vector(buf_abw_c-1 downto 0); -- read pointer (CPU access)
+    rdata : std_ulogic_vector(31 downto 0);
+    we    : std_ulogic;
+    wrap  : std_ulogic;
+    full  : std_ulogic;
+  end record;
+  signal buf : buf_t;
+
+begin
+
+  -- Sanity Checks --------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  assert not ((buf_en_c = true) and (is_power_of_two_f(TRACE_BUFFER_DEPTH) = false)) report "NEORV32 PROCESSOR CONFIG ERROR: TRACE <TRACE_BUFFER_DEPTH> has to be a power of two." severity error;
+  assert not (TRACE_BUFFER_DEPTH > 2**15) report "NEORV32 PROCESSOR CONFIG ERROR: TRACE <TRACE_BUFFER_DEPTH> has to be 0..32768." severity error;
+  --
+  assert false report "NEORV32 PROCESSOR CONFIG NOTE: Implementing instruction trace encoder with " & integer'image(TRACE_BUFFER_DEPTH) & " words trace buffer." severity note;
+
+
+  -- Access Control -------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  acc_en <= '1' when (addr_i(hi_abb_c downto lo_abb_c) = trace_base_c(hi_abb_c downto lo_abb_c)) else '0';
+  addr   <= trace_base_c(31 downto lo_abb_c) & addr_i(lo_abb_c-1 downto 2) & "00"; -- word aligned
+  wren   <= acc_en and wren_i;
+  rden   <= acc_en and rden_i;
+
+
+  -- Read/Write Access ----------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  rw_access: process(clk_i)
+  begin
+    if rising_edge(clk_i) then
+      -- write access --
+      ack_write <= wren;
+      if (wren = '1') then
+        if (addr = trace_ctrl_addr_c) then
+          ctrl.enable <= data_i(ctrl_en_c);
+          ctrl.stream <= data_i(ctrl_stream_c);
+          ctrl.stop   <= data_i(ctrl_stop_c);
+          ctrl.sync   <= data_i(ctrl_sync3_c downto ctrl_sync0_c);
+        end if;
+      end if;
+
+      -- read access --
+      ack_read <= rden;
+      data_o   <= (others => '0');
+      if (rden = '1') then
+        case addr is
+          when trace_ctrl_addr_c =>
+            data_o(ctrl_en_c)     <= ctrl.enable;
+            data_o(ctrl_stream_c) <= ctrl.stream;
+            data_o(ctrl_stop_c)   <= ctrl.stop;
+            data_o(ctrl_sync3_c downto ctrl_sync0_c) <= ctrl.sync;
+            --
+            if (buf_en_c = true) then
+              data_o(ctrl_buf_s3_c downto ctrl_buf_s0_c) <= std_ulogic_vector(to_unsigned(buf_abw_c, 4));
+              data_o(ctrl_buf_en_c) <= '1';
+              data_o(ctrl_wrap_c)   <= buf.wrap;
+              data_o(ctrl_full_c)   <= buf.full;
+            end if;
+            data_o(ctrl_ovfl_c) <= encoder.ovfl;
+          when trace_wptr_addr_c =>
+            if (buf_en_c = true) then
+              data_o(buf_abw_c-1 downto 0) <= buf.wptr(buf_abw_c-1 downto 0);
+            end if;
+          when trace_rptr_addr_c =>
+            if (buf_en_c = true) then
+              data_o(buf_abw_c-1 downto 0) <= buf.rptr;
+            end if;
+          when others => -- trace_data_addr_c
+            if (buf_en_c = true) then
+              data_o <= buf.rdata;
+            end if;
+        end case;
+      end if;
+    end if;
+  end process rw_access;
+
+  -- bus access acknowledge --
+  ack_o <= ack_write or ack_read;
+
+
+  -- Packet Encoder -------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  packet_encoder: process(clk_i)
+    variable sync_period_v : natural range 0 to 2**18;
+  begin
+    if rising_edge(clk_i) then
+      encoder.enable_ff <= ctrl.enable;
+      encoder.we        <= '0';
+      sync_period_v     := 2**(to_integer(unsigned(ctrl.sync)) + 3);
+
+      if (ctrl.enable = '0') then
+        encoder.sync_req <= '1';
+        encoder.lost     <= '1';
+        encoder.sync_cnt <= (others => '0');
+        encoder.bcnt     <= (others => '0');
+        encoder.time     <= (others => '0');
+      else
+        encoder.time <= std_ulogic_vector(unsigned(encoder.time) + 1);
+
+        -- overflow flag: cleared when trace gets enabled --
+        if (encoder.enable_ff = '0') then
+          encoder.ovfl <= '0';
+        elsif (encoder.we = '1') and (evt_fifo.free = '0') then
+          encoder.ovfl <= '1';
+        end if;
+
+        -- event processing (ignore anything while CPU is in debug mode) --
+        if (trace_i.debug = '0') then
+          if (encoder.sync_req = '1') then -- wait for next executed instruction
+            if (trace_i.exe = '1') then
+              encoder.sync_req <= '0';
+              encoder.lost     <= '0';
+              encoder.we       <= '1';
+              encoder.ptype    <= pkt_sync_c;
+              encoder.cause    <= "000000" & encoder.lost; -- set if trace data was lost before this packet
+              encoder.word1    <= trace_i.pc;
+              encoder.word2    <= encoder.time(30 downto 0) & '0';
+              encoder.len      <= "10";
+            end if;
+          elsif (trace_i.branch = '1') then -- conditional branch: add outcome to branch map
+            encoder.bmap(to_integer(unsigned(encoder.bcnt(3 downto 0)))) <= trace_i.taken;
+            encoder.bcnt <= std_ulogic_vector(unsigned(encoder.bcnt) + 1);
+            if (encoder.bcnt(3 downto 0) = "1111") then -- branch map full
+              encoder.we    <= '1';
+              encoder.ptype <= pkt_bmap_c;
+              encoder.cause <= (others => '0');
+              encoder.len   <= "00";
+            end if;
+          elsif (trace_i.jump = '1') then -- uninferable jump
+            encoder.we    <= '1';
+            encoder.ptype <= pkt_jump_c;
+            encoder.cause <= (others => '0');
+            encoder.word1 <= trace_i.target;
+            encoder.len   <= "01";
+          elsif (trace_i.trap = '1') then -- trap entry
+            encoder.we    <= '1';
+            encoder.ptype <= pkt_trap_c;
+            encoder.cause <= trace_i.cause;
+            encoder.word1 <= trace_i.pc;
+            encoder.word2 <= trace_i.target;
+            encoder.word3 <= encoder.time(30 downto 0) & '0';
+            encoder.len   <= "11";
+          elsif (trace_i.tret = '1') then -- trap return
+            encoder.we    <= '1';
+            encoder.ptype <= pkt_tret_c;
+            encoder.cause <= (others => '0');
+            encoder.word1 <= trace_i.target;
+            encoder.word2 <= encoder.time(30 downto 0) & '0';
+            encoder.len   <= "10";
+          end if;
+        end if;
+
+        -- packet is written to FIFO: the branch map is always flushed together with the packet --
+        if (encoder.we = '1') then
+          if (trace_i.branch = '1') and (trace_i.debug = '0') and (encoder.sync_req = '0') then -- branch resolved in the same cycle
+            encoder.bmap(0) <= trace_i.taken;
+            encoder.bcnt    <= "00001";
+          else
+            encoder.bcnt    <= (others => '0');
+          end if;
+          -- periodic re-synchronization --
+          if (ctrl.sync /= "0000") and (to_integer(unsigned(encoder.sync_cnt)) >= sync_period_v-1) then
+            encoder.sync_req <= '1';
+            encoder.sync_cnt <= (others => '0');
+          else
+            encoder.sync_cnt <= std_ulogic_vector(unsigned(encoder.sync_cnt) + 1);
+          end if;
+          -- packet lost: start over with a fresh SYNC --
+          if (evt_fifo.free = '0') then
+            encoder.sync_req <= '1';
+            encoder.lost     <= '1';
+          end if;
+        end if;
+      end if;
+    end if;
+  end process packet_encoder;
+
+
+  -- Event FIFO -----------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  evt_fifo.clear <= not ctrl.enable;
+  evt_fifo.we    <= encoder.we;
+
+  -- header: [0] marker, [3:1] type, [8:4] branch count, [15:9] trap cause, [31:16] branch map --
+  evt_fifo.wdata(129 downto 128) <= encoder.len;
+  evt_fifo.wdata(031 downto 000) <= encoder.bmap(15 downto 0) & encoder.cause & encoder.bcnt & encoder.ptype & '1';
+  evt_fifo.wdata(063 downto 032) <= encoder.word1;
+  evt_fifo.wdata(095 downto 064) <= encoder.word2;
+  evt_fifo.wdata(127 downto 096) <= encoder.word3;
+
+  trace_event_fifo_inst: neorv32_fifo
+  generic map (
+    FIFO_DEPTH => evt_fifo_depth_c, -- number of fifo entries; has to be a power of two; min 1
+    FIFO_WIDTH => 2+128,            -- size of data elements in fifo
+    FIFO_RSYNC => false,            -- false = async read; true = sync read
+    FIFO_SAFE  => true              -- true = allow read/write only if entry available
+  )
+  port map (
+    -- control --
+    clk_i   => clk_i,          -- clock, rising edge
+    rstn_i  => '1',            -- async reset, low-active
+    clear_i => evt_fifo.clear, -- sync reset, high-active
+    level_o => open,
+    -- write port --
+    wdata_i => evt_fifo.wdata, -- write data
+    we_i    => evt_fifo.we,    -- write enable
+    free_o  => evt_fifo.free,  -- at least one entry is free when set
+    -- read port --
+    re_i    => evt_fifo.re,    -- read enable
+    rdata_o => evt_fifo.rdata, -- read data
+    avail_o => evt_fifo.avail  -- data available when set
+  );
+
+
+  -- Packet Serializer ----------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  packet_serializer: process(clk_i)
+  begin
+    if rising_edge(clk_i) then
+      if (ctrl.enable = '0') then
+        serializer.cnt <= (others => '0');
+      elsif (serializer.ack = '1') then
+        if (serializer.cnt = evt_fifo.rdata(129 downto 128)) then -- last word of packet
+          serializer.cnt <= (others => '0');
+        else
+          serializer.cnt <= std_ulogic_vector(unsigned(serializer.cnt) + 1);
+        end if;
+      end if;
+    end if;
+  end process packet_serializer;
+
+  -- current word --
+  with serializer.cnt select serializer.word <=
+    evt_fifo.rdata(031 downto 000) when "00",
+    evt_fifo.rdata(063 downto 032) when "01",
+    evt_fifo.rdata(095 downto 064) when "10",
+    evt_fifo.rdata(127 downto 096) when others;
+
+  serializer.valid <= evt_fifo.avail and ctrl.enable;
+
+  -- sink handshake: stream port has to be ready, trace buffer always accepts (data is discarded when full) --
+  serializer.ack <= serializer.valid and (trace_tx_rdy_i or (not ctrl.stream));
+
+  -- remove packet from FIFO after its last word --
+  evt_fifo.re <= serializer.ack when (serializer.cnt = evt_fifo.rdata(129 downto 128)) else '0';
+
+  -- stream output --
+  trace_tx_dat_o <= serializer.word;
+  trace_tx_val_o <= serializer.valid and ctrl.stream;
+
+
+  -- Trace Buffer ---------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  trace_buffer_true:
+  if (buf_en_c = true) generate
+
+    -- buffer control --
+    buffer_control: process(clk_i)
+    begin
+      if rising_edge(clk_i) then
+        -- write pointer (buffer content is kept until trace gets re-enabled) --
+        if (ctrl.enable = '1') then
+          if (encoder.enable_ff = '0') then -- trace has just been enabled: start over
+            buf.wptr <= (others => '0');
+            buf.wrap <= '0';
+            buf.full <= '0';
+          elsif (buf.we = '1') then
+            buf.wptr <= std_ulogic_vector(unsigned(buf.wptr) + 1);
+            if (buf.wptr(buf_abw_c-1 downto 0) = std_ulogic_vector(to_unsigned(buf_size_c-1, buf_abw_c))) then -- last entry
+              buf.wrap <= buf.wrap or (not ctrl.stop);
+              buf.full <= ctrl.stop;
+            end if;
+          end if;
+        end if;
+        -- read pointer --
+        if (wren = '1') and (addr = trace_rptr_addr_c) then
+          buf.rptr <= data_i(buf_abw_c-1 downto 0);
+        elsif (rden = '1') and (addr = trace_data_addr_c) then -- auto-increment
+          buf.rptr <= std_ulogic_vector(unsigned(buf.rptr) + 1);
+        end if;
+      end if;
+    end process buffer_control;
+
+    -- write access --
+    buf.we <= serializer.ack and (not ctrl.stream) and (not buf.full);
+
+    -- dual-port memory --
+    buffer_memory: process(clk_i)
+    begin
+      if rising_edge(clk_i) then
+        if (buf.we = '1') then
+          buf.mem(to_integer(unsigned(buf.wptr(buf_abw_c-1 downto 0)))) <= serializer.word;
+        end if;
+        buf.rdata <= buf.mem(to_integer(unsigned(buf.rptr)));
+      end if;
+    end process buffer_memory;
+
+  end generate;
+
+  trace_buffer_false:
+  if (buf_en_c = false) generate
+    buf.wptr  <= (others => '0');
+    buf.rptr  <= (others => '0');
+    buf.rdata <= (others => '0');
+    buf.we    <= '0';
+    buf.wrap  <= '0';
+    buf.full  <= '0';
+  end generate;
+
+
+end neorv32_trace_rtl;
@@ -3,7 +3,9 @@
 -- # ********************************************************************************************* #
 -- # Supports START and STOP conditions, 8 bit data + ACK/NACK transfers and clock stretching.     #
 -- # Supports ACKs by the constroller. No multi-controller support and no peripheral mode support  #
--- # yet. Interrupt: TWI_transfer_done                                                             #
+-- # yet. A command FIFO allows to execute complete START/data/STOP sequences autonomously, read   #
+-- # data is buffered in a RX FIFO. Fine clock divider for fast-mode-plus (1MHz) timing.           #
+-- # Interrupt: transfer done / command sequence done                                              #
 -- # ********************************************************************************************* #
 -- # BSD 3-Clause License                                                                          #
 -- #                                                                                               #
@@ -44,6 +46,9 @@ library neorv32;
 use neorv32.neorv32_package.all;
 
 entity neorv32_twi is
+  generic (
+    TWI_FIFO : natural -- command/RX fifo depth, has to be a power of two, min 1
+  );
   port (
     -- host access --
     clk_i       : in  std_ulogic; -- global clock line
@@ -60,7 +65,7 @@ entity neorv32_twi is
     twi_sda_io  : inout std_logic; -- serial data line
     twi_scl_io  : inout std_logic; -- serial clock line
     -- interrupt --
-    irq_o       : out std_ulogic -- transfer done IRQ
+    irq_o       : out std_ulogic -- transfer done / sequence done IRQ
   );
 end neorv32_twi;
 
@@ -71,17 +76,34 @@ architecture neorv32_twi_rtl of neorv32_twi is
   constant lo_abb_c : natural := index_size_f(twi_size_c); -- low address boundary bit
 
   -- control reg bits --
-  constant ctrl_twi_en_c     : natural := 0; -- r/w: TWI enable
-  constant ctrl_twi_start_c  : natural := 1; -- -/w: Generate START condition
-  constant ctrl_twi_stop_c   : natural := 2; -- -/w: Generate STOP condition
-  constant ctrl_twi_prsc0_c  : natural := 3; -- r/w: CLK prsc bit 0
-  constant ctrl_twi_prsc1_c  : natural := 4; -- r/w: CLK prsc bit 1
-  constant ctrl_twi_prsc2_c  : natural := 5; -- r/w: CLK prsc bit 2
-  constant ctrl_twi_mack_c   : natural := 6; -- r/w: generate ACK by controller for transmission
-  constant ctrl_twi_cksten_c : natural := 7; -- r/w: enable clock stretching by peripheral
+  constant ctrl_twi_en_c        : natural :=  0; -- r/w: TWI enable
+  constant ctrl_twi_start_c     : natural :=  1; -- -/w: Generate START condition
+  constant ctrl_twi_stop_c      : natural :=  2; -- -/w: Generate STOP condition
+  constant ctrl_twi_prsc0_c     : natural :=  3; -- r/w: CLK prsc bit 0
+  constant ctrl_twi_prsc1_c     : natural :=  4; -- r/w: CLK prsc bit 1
+  constant ctrl_twi_prsc2_c     : natural :=  5; -- r/w: CLK prsc bit 2
+  constant ctrl_twi_mack_c      : natural :=  6; -- r/w: generate ACK by controller for transmission
+  constant ctrl_twi_cksten_c    : natural :=  7; -- r/w: enable clock stretching by peripheral
+  constant ctrl_twi_cdiv0_c     : natural :=  8; -- r/w: clock divider bit 0
+  constant ctrl_twi_cdiv3_c     : natural := 11; -- r/w: clock divider bit 3
+  constant ctrl_twi_irq_seq_c   : natural := 12; -- r/w: IRQ mode: 0 = each transfer done, 1 = command FIFO empty and idle
+  --
+  constant ctrl_twi_rx_avail_c  : natural := 20; -- r/-: RX FIFO not empty
+  constant ctrl_twi_rx_full_c   : natural := 21; -- r/-: RX FIFO full
+  constant ctrl_twi_cmd_empty_c : natural := 22; -- r/-: command FIFO empty
+  constant ctrl_twi_cmd_full_c  : natural := 23; -- r/-: command FIFO full
+  constant ctrl_twi_fifo_lsb_c  : natural := 24; -- r/-: log2(FIFO size), lsb
+  constant ctrl_twi_fifo_msb_c  : natural := 27; -- r/-: log2(FIFO size), msb
   --
-  constant ctrl_twi_ack_c    : natural := 30; -- r/-: Set if ACK received
-  constant ctrl_twi_busy_c   : natural := 31; -- r/-: Set if TWI unit is busy
+  constant ctrl_twi_nack_c      : natural := 29; -- r/-: Set if a transmitted byte was not acknowledged (sticky, cleared by CTRL write)
+  constant ctrl_twi_ack_c       : natural := 30; -- r/-: Set if ACK received
+  constant ctrl_twi_busy_c      : natural := 31; -- r/-: Set if TWI unit is busy or command FIFO not empty
+
+  -- data register write bits (command FIFO entry) --
+  constant data_mack_c : natural :=  8; -- generate ACK by controller for this byte
+  constant data_rx_c   : natural :=  9; -- write received byte to RX FIFO
+  constant data_cmd0_c : natural := 10; -- command: 00/11 = data transfer, 01 = START, 10 = STOP
+  constant data_cmd1_c : natural := 11;
 
   -- access control --
   signal acc_en : std_ulogic; -- module access enable
@@ -91,6 +113,7 @@ architecture neorv32_twi_rtl of neorv32_twi is
 
   -- twi clocking --
   signal twi_clk        : std_ulogic;
+  signal twi_clk_cnt    : std_ulogic_vector(3 downto 0);
   signal twi_phase_gen  : std_ulogic_vector(3 downto 0);
   signal twi_clk_phase  : std_ulogic_vector(3 downto 0);
 
@@ -98,10 +121,16 @@ architecture neorv32_twi_rtl of neorv32_twi is
   signal twi_clk_halt : std_ulogic;
 
   -- twi transceiver core --
-  signal ctrl         : std_ulogic_vector(7 downto 0); -- unit's control register
+  signal ctrl         : std_ulogic_vector(12 downto 0); -- unit's control register
   signal arbiter      : std_ulogic_vector(2 downto 0);
   signal twi_bitcnt   : std_ulogic_vector(3 downto 0);
   signal twi_rtx_sreg : std_ulogic_vector(8 downto 0); -- main rx/tx shift reg
+  signal twi_rx_en    : std_ulogic; -- current byte goes to RX FIFO
+  signal twi_mack     : std_ulogic; -- current byte is acknowledged by controller
+  signal twi_done     : std_ulogic; -- data transfer completed (shift register is valid)
+  signal twi_busy     : std_ulogic;
+  signal twi_nack     : std_ulogic; -- sticky NACK flag
+  signal twi_claimed  : std_ulogic; -- bus claimed by this controller (START sent, no STOP yet)
 
   -- tri-state I/O --
   signal twi_sda_i_ff0, twi_sda_i_ff1 : std_ulogic; -- sda input sync
@@ -109,8 +138,43 @@ architecture neorv32_twi_rtl of neorv32_twi is
   signal twi_sda_i,     twi_sda_o     : std_ulogic;
   signal twi_scl_i,     twi_scl_o     : std_ulogic;
 
+  -- FIFO interface --
+  type cmd_fifo_t is record
+    clear : std_ulogic; -- sync reset, high-active
+    we    : std_ulogic; -- write enable
+    re    : std_ulogic; -- read enable
+    wdata : std_ulogic_vector(11 downto 0); -- write data
+    rdata : std_ulogic_vector(11 downto 0); -- read data
+    avail : std_ulogic; -- data available?
+    free  : std_ulogic; -- free entry available?
+  end record;
+  signal cmd_fifo : cmd_fifo_t;
+
+  type rx_fifo_t is record
+    clear : std_ulogic; -- sync reset, high-active
+    we    : std_ulogic; -- write enable
+    re    : std_ulogic; -- read enable
+    rdata : std_ulogic_vector(7 downto 0); -- read data
+    avail : std_ulogic; -- data available?
+    free  : std_ulogic; -- free entry available?
+  end record;
+  signal rx_fifo : rx_fifo_t;
+
+  -- interrupt generator --
+  type irq_t is record
+    fire : std_ulogic;
+    ff   : std_ulogic;
+  end record;
+  signal irq : irq_t;
+
 begin
 
+  -- Sanity Checks --------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  assert not (is_power_of_two_f(TWI_FIFO) = false) report "NEORV32 PROCESSOR CONFIG ERROR: TWI <TWI_FIFO> has to be a power of two." severity error;
+  assert not (TWI_FIFO > 2**15) report "NEORV32 PROCESSOR CONFIG ERROR: TWI <TWI_FIFO> has to be 1..32768." severity error;
+
+
   -- Access Control -------------------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
   acc_en <= '1' when (addr_i(hi_abb_c downto lo_abb_c) = twi_base_c(hi_abb_c downto lo_abb_c)) else '0';
@@ -141,12 +205,24 @@ begin
           data_o(ctrl_twi_prsc2_c)  <= ctrl(ctrl_twi_prsc2_c);
           data_o(ctrl_twi_mack_c)   <= ctrl(ctrl_twi_mack_c);
           data_o(ctrl_twi_cksten_c) <= ctrl(ctrl_twi_cksten_c);
+          data_o(ctrl_twi_cdiv3_c downto ctrl_twi_cdiv0_c) <= ctrl(ctrl_twi_cdiv3_c downto ctrl_twi_cdiv0_c);
+          data_o(ctrl_twi_irq_seq_c) <= ctrl(ctrl_twi_irq_seq_c);
           --
+          data_o(ctrl_twi_rx_avail_c)  <= rx_fifo.avail;
+          data_o(ctrl_twi_rx_full_c)   <= not rx_fifo.free;
+          data_o(ctrl_twi_cmd_empty_c) <= not cmd_fifo.avail;
+          data_o(ctrl_twi_cmd_full_c)  <= not cmd_fifo.free;
+          data_o(ctrl_twi_fifo_msb_c downto ctrl_twi_fifo_lsb_c) <= std_ulogic_vector(to_unsigned(index_size_f(TWI_FIFO), 4));
+          --
+          data_o(ctrl_twi_nack_c)   <= twi_nack;
           data_o(ctrl_twi_ack_c)    <= not twi_rtx_sreg(0);
-          data_o(ctrl_twi_busy_c)   <= arbiter(1) or arbiter(0);
+          data_o(ctrl_twi_busy_c)   <= twi_busy;
         else -- twi_rtx_addr_c =>
-          data_o(7 downto 0)        <= twi_rtx_sreg(8 downto 1);
-          
+          if (rx_fifo.avail = '1') then -- read from RX FIFO
+            data_o(7 downto 0) <= rx_fifo.rdata;
+          else -- RX FIFO empty: return last transferred data
+            data_o(7 downto 0) <= twi_rtx_sreg(8 downto 1);
+          end if;
         end if;
       end if;
     end if;
@@ -158,8 +234,21 @@ begin
   -- clock generator enable --
   clkgen_en_o <= ctrl(ctrl_twi_en_c);
 
+  -- fine clock divider: every (CDIV+1)-th prescaler tick --
+  clock_divider: process(clk_i)
+  begin
+    if rising_edge(clk_i) then
+      if (arbiter(2) = '0') or (twi_clk = '1') then
+        twi_clk_cnt <= (others => '0');
+      elsif (clkgen_i(to_integer(unsigned(ctrl(ctrl_twi_prsc2_c downto ctrl_twi_prsc0_c)))) = '1') then
+        twi_clk_cnt <= std_ulogic_vector(unsigned(twi_clk_cnt) + 1);
+      end if;
+    end if;
+  end process clock_divider;
+
   -- main twi clock select --
-  twi_clk <= clkgen_i(to_integer(unsigned(ctrl(ctrl_twi_prsc2_c downto ctrl_twi_prsc0_c))));
+  twi_clk <= clkgen_i(to_integer(unsigned(ctrl(ctrl_twi_prsc2_c downto ctrl_twi_prsc0_c)))) when
+             (twi_clk_cnt = ctrl(ctrl_twi_cdiv3_c downto ctrl_twi_cdiv0_c)) else '0';
 
   -- generate four non-overlapping clock ticks at twi_clk/4 --
   clock_phase_gen: process(clk_i)
@@ -179,6 +268,57 @@ begin
   twi_clk_phase(3) <= twi_phase_gen(3) and twi_clk; -- last step
 
 
+  -- Command FIFO ---------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  cmd_fifo_inst: neorv32_fifo
+  generic map (
+    FIFO_DEPTH => TWI_FIFO, -- number of fifo entries; has to be a power of two; min 1
+    FIFO_WIDTH => 12,       -- size of data elements in fifo
+    FIFO_RSYNC => false,    -- false = async read; true = sync read
+    FIFO_SAFE  => true      -- true = allow read/write only if entry available
+  )
+  port map (
+    -- control --
+    clk_i   => clk_i,          -- clock, rising edge
+    rstn_i  => '1',            -- async reset, low-active
+    clear_i => cmd_fifo.clear, -- sync reset, high-active
+    level_o => open,           -- fill level
+    -- write port --
+    wdata_i => cmd_fifo.wdata, -- write data
+    we_i    => cmd_fifo.we,    -- write enable
+    free_o  => cmd_fifo.free,  -- at least one entry is free when set
+    -- read port --
+    re_i    => cmd_fifo.re,    -- read enable
+    rdata_o => cmd_fifo.rdata, -- read data
+    avail_o => cmd_fifo.avail  -- data available when set
+  );
+
+  cmd_fifo.clear <= not ctrl(ctrl_twi_en_c);
+
+  -- legacy START/STOP via control register or command/data via data register --
+  cmd_fifo_write: process(wr_en, addr, data_i)
+  begin
+    cmd_fifo.we    <= '0';
+    cmd_fifo.wdata <= data_i(11 downto 0);
+    if (wr_en = '1') then
+      if (addr = twi_ctrl_addr_c) then
+        if (data_i(ctrl_twi_start_c) = '1') then -- issue START condition
+          cmd_fifo.we    <= '1';
+          cmd_fifo.wdata <= "01" & "00" & x"00";
+        elsif (data_i(ctrl_twi_stop_c) = '1') then -- issue STOP condition
+          cmd_fifo.we    <= '1';
+          cmd_fifo.wdata <= "10" & "00" & x"00";
+        end if;
+      else -- twi_rtx_addr_c
+        cmd_fifo.we <= '1';
+      end if;
+    end if;
+  end process cmd_fifo_write;
+
+  -- commands are also popped (and discarded) while the NACK flag is set --
+  cmd_fifo.re <= '1' when (arbiter = "100") and (cmd_fifo.avail = '1') else '0';
+
+
   -- TWI Transceiver ------------------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
   twi_rtx_unit: process(clk_i)
@@ -191,41 +331,49 @@ begin
       twi_scl_i_ff1 <= twi_scl_i_ff0;
 
       -- defaults --
-      irq_o      <= '0';
       arbiter(2) <= ctrl(ctrl_twi_en_c); -- still activated?
 
+      -- sticky NACK flag --
+      if (arbiter(2) = '0') or ((wr_en = '1') and (addr = twi_ctrl_addr_c)) then
+        twi_nack <= '0';
+      elsif (twi_done = '1') and (twi_mack = '0') and (twi_rx_en = '0') and (twi_rtx_sreg(0) = '1') then -- NACK from peripheral
+        twi_nack <= '1';
+      end if;
+
       -- serial engine --
       -- TWI bus signals are set/sampled using 4 clock phases
       case arbiter is
 
-        when "100" => -- IDLE: waiting for requests, bus might be still claimed by this controller if no STOP condition was generated
+        when "100" => -- IDLE: waiting for commands, bus might be still claimed by this controller if no STOP condition was generated
           twi_bitcnt <= (others => '0');
-          if (wr_en = '1') then
-            if (addr = twi_ctrl_addr_c) then
-              if (data_i(ctrl_twi_start_c) = '1') then -- issue START condition
+          if (cmd_fifo.avail = '1') and (twi_nack = '0') then -- queued commands are discarded after a NACK
+            case cmd_fifo.rdata(data_cmd1_c downto data_cmd0_c) is
+              when "01"   => -- issue (repeated) START condition
                 arbiter(1 downto 0) <= "01";
-              elsif (data_i(ctrl_twi_stop_c) = '1') then  -- issue STOP condition
-                arbiter(1 downto 0) <= "10";
-              end if;
-            elsif (addr = twi_rtx_addr_c) then -- start a data transmission
-              -- one bit extra for ack, issued by controller if ctrl_twi_mack_c is set,
-              -- sampled from peripheral if ctrl_twi_mack_c is cleared
-              twi_rtx_sreg <= data_i(7 downto 0) & (not ctrl(ctrl_twi_mack_c));
-              arbiter(1 downto 0) <= "11";
-            end if;
+              when "10"   => -- issue STOP condition (only if the bus has not been released yet)
+                arbiter(1 downto 0) <= twi_claimed & '0';
+              when others => -- start a data transmission
+                -- one bit extra for ack, issued by controller if mack is set,
+                -- sampled from peripheral if mack is cleared
+                twi_rtx_sreg <= cmd_fifo.rdata(7 downto 0) & (not (cmd_fifo.rdata(data_mack_c) or ctrl(ctrl_twi_mack_c)));
+                twi_mack     <= cmd_fifo.rdata(data_mack_c) or ctrl(ctrl_twi_mack_c);
+                twi_rx_en    <= cmd_fifo.rdata(data_rx_c);
+                arbiter(1 downto 0) <= "11";
+            end case;
           end if;
 
-        when "101" => -- START: generate START condition
-          if (twi_clk_phase(0) = '1') then
+        when "101" => -- START: generate (repeated) START condition
+          if (twi_clk_phase(0) = '1') then -- release SDA while SCL is still low (repeated START)
             twi_sda_o <= '1';
-          elsif (twi_clk_phase(1) = '1') then
+          elsif (twi_clk_phase(2) = '1') then -- SDA falling while SCL is high
             twi_sda_o <= '0';
           end if;
 
-          if (twi_clk_phase(0) = '1') then
+          if (twi_clk_phase(1) = '1') then
             twi_scl_o <= '1';
           elsif (twi_clk_phase(3) = '1') then
-            twi_scl_o <= '0';
+            twi_scl_o   <= '0';
+            twi_claimed <= '1';
             arbiter(1 downto 0) <= "00"; -- go back to IDLE
           end if;
 
@@ -233,10 +381,11 @@ begin
           if (twi_clk_phase(0) = '1') then
             twi_sda_o <= '0';
           elsif (twi_clk_phase(3) = '1') then
-            twi_sda_o <= '1';
+            twi_sda_o   <= '1';
+            twi_claimed <= '0';
             arbiter(1 downto 0) <= "00"; -- go back to IDLE
           end if;
-          
+
           if (twi_clk_phase(0) = '1') then
             twi_scl_o <= '0';
           elsif (twi_clk_phase(1) = '1') then
@@ -255,20 +404,61 @@ begin
             twi_scl_o    <= '0';
           end if;
 
-          if (twi_bitcnt = "1010") then -- 8 data bits + 1 bit for ACK + 1 tick delay
-            arbiter(1 downto 0) <= "00"; -- go back to IDLE
-            irq_o <= '1'; -- fire IRQ
+          if (twi_done = '1') then -- 8 data bits + 1 bit for ACK + 1 tick delay
+            if (twi_mack = '0') and (twi_rx_en = '0') and (twi_rtx_sreg(0) = '1') then -- NACK from peripheral
+              arbiter(1 downto 0) <= "10"; -- abort: release the bus right away
+            else
+              arbiter(1 downto 0) <= "00"; -- go back to IDLE
+            end if;
           end if;
 
         when others => -- "0--" OFFLINE: TWI deactivated
-          twi_sda_o <= '1';
-          twi_scl_o <= '1';
-          arbiter   <= ctrl(ctrl_twi_en_c) & "00"; -- stay here, go to idle when activated
+          twi_sda_o   <= '1';
+          twi_scl_o   <= '1';
+          twi_claimed <= '0';
+          arbiter     <= ctrl(ctrl_twi_en_c) & "00"; -- stay here, go to idle when activated
 
       end case;
     end if;
   end process twi_rtx_unit;
 
+  -- transfer done: shift register holds the received byte + ACK for exactly this cycle --
+  twi_done <= '1' when (arbiter = "111") and (twi_bitcnt = "1010") else '0';
+
+  -- busy: transfer in progress or commands pending --
+  twi_busy <= arbiter(1) or arbiter(0) or cmd_fifo.avail;
+
+
+  -- RX FIFO --------------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  rx_fifo_inst: neorv32_fifo
+  generic map (
+    FIFO_DEPTH => TWI_FIFO, -- number of fifo entries; has to be a power of two; min 1
+    FIFO_WIDTH => 8,        -- size of data elements in fifo
+    FIFO_RSYNC => false,    -- false = async read; true = sync read
+    FIFO_SAFE  => false     -- true = allow read/write only if entry available
+  )
+  port map (
+    -- control --
+    clk_i   => clk_i,                     -- clock, rising edge
+    rstn_i  => '1',                       -- async reset, low-active
+    clear_i => rx_fifo.clear,             -- sync reset, high-active
+    level_o => open,                      -- fill level
+    -- write port --
+    wdata_i => twi_rtx_sreg(8 downto 1),  -- write data
+    we_i    => rx_fifo.we,                -- write enable
+    free_o  => rx_fifo.free,              -- at least one entry is free when set
+    -- read port --
+    re_i    => rx_fifo.re,                -- read enable
+    rdata_o => rx_fifo.rdata,             -- read data
+    avail_o => rx_fifo.avail              -- data available when set
+  );
+
+  rx_fifo.clear <= not ctrl(ctrl_twi_en_c);
+  rx_fifo.we    <= twi_done and twi_rx_en;
+  -- CPU read; if the FIFO is full a new byte discards the oldest entry --
+  rx_fifo.re    <= '1' when ((rd_en = '1') and (addr = twi_rtx_addr_c) and (rx_fifo.avail = '1')) or ((rx_fifo.we = '1') and (rx_fifo.free = '0')) else '0';
+
 
   -- Clock Stretching Detector --------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
@@ -286,6 +476,28 @@ begin
   end process clock_stretching;
 
 
+  -- Interrupt ------------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  -- sequence done: all commands executed --
+  irq.fire <= not twi_busy;
+
+  irq_generator: process(clk_i)
+  begin
+    if rising_edge(clk_i) then
+      if (arbiter(2) = '0') then -- disabled
+        irq.ff <= '1';
+        irq_o  <= '0';
+      elsif (ctrl(ctrl_twi_irq_seq_c) = '0') then -- single transfer done
+        irq.ff <= '1';
+        irq_o  <= twi_done;
+      else
+        irq.ff <= irq.fire;
+        irq_o  <= irq.fire and (not irq.ff);
+      end if;
+    end if;
+  end process irq_generator;
+
+
   -- Tri-State Driver -----------------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
   -- SDA and SCL need to be of type std_logic to be correctly resolved in simulation
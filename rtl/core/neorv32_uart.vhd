@@ -2,9 +2,13 @@
 -- # << NEORV32 - Universal Asynchronous Receiver and Transmitter (UART0/1) >>                     #
 -- # ********************************************************************************************* #
 -- # Frame configuration: 1 start bit, 8 bit data, parity bit (none/even/odd), 1 stop bit,         #
--- # programmable BAUD rate via clock pre-scaler and 12-bit BAUD value config register. RX engine  #
--- # a simple 2-entry data buffer (for double-buffering).                                          #
--- # Interrupts: UART_RX_available, UART_TX_done                                                   #
+-- # programmable BAUD rate via clock pre-scaler and 12-bit BAUD value config register. RX and TX  #
+-- # engines use configurable FIFOs (UART_RX_FIFO / UART_TX_FIFO generics, power of two, min 1).   #
+-- # Interrupts: RX FIFO not empty or RX FIFO at least half-full (configurable),                   #
+-- #             TX done (FIFO empty & TX idle) or TX FIFO less than half-full (configurable)      #
+-- #                                                                                               #
+-- # High-speed mode (CTRL.ctrl_uart_hs_en_c): fractional baud generator (8-bit integer + 4-bit    #
+-- # fractional divider of the main clock), 16x or 8x oversampling and 3-sample RX majority vote.  #
 -- #                                                                                               #
 -- # Support for RTS("RTR")/CTS hardware flow control:                                             #
 -- # * uart_rts_o = 0: RX is ready to receive a new char, enabled via CTRL.ctrl_uart_rts_en_c      #
@@ -66,7 +70,9 @@ use std.textio.all; -- obviously only for simulation
 
 entity neorv32_uart is
   generic (
-    UART_PRIMARY : boolean -- true = primary UART (UART0), false = secondary UART (UART1)
+    UART_PRIMARY : boolean; -- true = primary UART (UART0), false = secondary UART (UART1)
+    UART_RX_FIFO : natural; -- RX fifo depth, has to be a power of two, min 1
+    UART_TX_FIFO : natural  -- TX fifo depth, has to be a power of two, min 1
   );
   port (
     -- host access --
@@ -117,31 +123,38 @@ architecture neorv32_uart_rtl of neorv32_uart is
   signal ctrl : std_ulogic_vector(31 downto 0);
 
   -- control register bits --
-  constant ctrl_uart_baud00_c  : natural :=  0; -- r/w: UART baud config bit 0
-  constant ctrl_uart_baud01_c  : natural :=  1; -- r/w: UART baud config bit 1
-  constant ctrl_uart_baud02_c  : natural :=  2; -- r/w: UART baud config bit 2
-  constant ctrl_uart_baud03_c  : natural :=  3; -- r/w: UART baud config bit 3
-  constant ctrl_uart_baud04_c  : natural :=  4; -- r/w: UART baud config bit 4
-  constant ctrl_uart_baud05_c  : natural :=  5; -- r/w: UART baud config bit 5
-  constant ctrl_uart_baud06_c  : natural :=  6; -- r/w: UART baud config bit 6
-  constant ctrl_uart_baud07_c  : natural :=  7; -- r/w: UART baud config bit 7
-  constant ctrl_uart_baud08_c  : natural :=  8; -- r/w: UART baud config bit 8
-  constant ctrl_uart_baud09_c  : natural :=  9; -- r/w: UART baud config bit 9
-  constant ctrl_uart_baud10_c  : natural := 10; -- r/w: UART baud config bit 10
-  constant ctrl_uart_baud11_c  : natural := 11; -- r/w: UART baud config bit 11
-  constant ctrl_uart_sim_en_c  : natural := 12; -- r/w: UART <<SIMULATION MODE>> enable
-  -- ...
-  constant ctrl_uart_rts_en_c  : natural := 20; -- r/w: enable hardware flow control: assert rts_o if ready to receive
-  constant ctrl_uart_cts_en_c  : natural := 21; -- r/w: enable hardware flow control: send only if cts_i is asserted
-  constant ctrl_uart_pmode0_c  : natural := 22; -- r/w: Parity config (0=even; 1=odd)
-  constant ctrl_uart_pmode1_c  : natural := 23; -- r/w: Enable parity bit
-  constant ctrl_uart_prsc0_c   : natural := 24; -- r/w: UART baud prsc bit 0
-  constant ctrl_uart_prsc1_c   : natural := 25; -- r/w: UART baud prsc bit 1
-  constant ctrl_uart_prsc2_c   : natural := 26; -- r/w: UART baud prsc bit 2
-  constant ctrl_uart_cts_c     : natural := 27; -- r/-: current state of CTS input
-  constant ctrl_uart_en_c      : natural := 28; -- r/w: UART enable
-  -- ...
-  constant ctrl_uart_tx_busy_c : natural := 31; -- r/-: UART transmitter is busy
+  constant ctrl_uart_baud00_c   : natural :=  0; -- r/w: UART baud config bit 0
+  constant ctrl_uart_baud01_c   : natural :=  1; -- r/w: UART baud config bit 1
+  constant ctrl_uart_baud02_c   : natural :=  2; -- r/w: UART baud config bit 2
+  constant ctrl_uart_baud03_c   : natural :=  3; -- r/w: UART baud config bit 3
+  constant ctrl_uart_baud04_c   : natural :=  4; -- r/w: UART baud config bit 4
+  constant ctrl_uart_baud05_c   : natural :=  5; -- r/w: UART baud config bit 5
+  constant ctrl_uart_baud06_c   : natural :=  6; -- r/w: UART baud config bit 6
+  constant ctrl_uart_baud07_c   : natural :=  7; -- r/w: UART baud config bit 7
+  constant ctrl_uart_baud08_c   : natural :=  8; -- r/w: UART baud config bit 8
+  constant ctrl_uart_baud09_c   : natural :=  9; -- r/w: UART baud config bit 9
+  constant ctrl_uart_baud10_c   : natural := 10; -- r/w: UART baud config bit 10
+  constant ctrl_uart_baud11_c   : natural := 11; -- r/w: UART baud config bit 11
+  constant ctrl_uart_sim_en_c   : natural := 12; -- r/w: UART <<SIMULATION MODE>> enable
+  constant ctrl_uart_rx_nemp_c  : natural := 13; -- r/-: RX FIFO not empty
+  constant ctrl_uart_rx_half_c  : natural := 14; -- r/-: RX FIFO at least half-full
+  constant ctrl_uart_rx_full_c  : natural := 15; -- r/-: RX FIFO full
+  constant ctrl_uart_tx_empty_c : natural := 16; -- r/-: TX FIFO empty
+  constant ctrl_uart_tx_nhalf_c : natural := 17; -- r/-: TX FIFO not at least half-full
+  constant ctrl_uart_tx_full_c  : natural := 18; -- r/-: TX FIFO full
+  constant ctrl_uart_hs_en_c    : natural := 19; -- r/w: high-speed mode: fractional baud divider, oversampling, RX majority vote
+  constant ctrl_uart_rts_en_c   : natural := 20; -- r/w: enable hardware flow control: assert rts_o if ready to receive
+  constant ctrl_uart_cts_en_c   : natural := 21; -- r/w: enable hardware flow control: send only if cts_i is asserted
+  constant ctrl_uart_pmode0_c   : natural := 22; -- r/w: Parity config (0=even; 1=odd)
+  constant ctrl_uart_pmode1_c   : natural := 23; -- r/w: Enable parity bit
+  constant ctrl_uart_prsc0_c    : natural := 24; -- r/w: UART baud prsc bit 0
+  constant ctrl_uart_prsc1_c    : natural := 25; -- r/w: UART baud prsc bit 1
+  constant ctrl_uart_prsc2_c    : natural := 26; -- r/w: UART baud prsc bit 2
+  constant ctrl_uart_cts_c      : natural := 27; -- r/-: current state of CTS input
+  constant ctrl_uart_en_c       : natural := 28; -- r/w: UART enable
+  constant ctrl_uart_rx_irq_c   : natural := 29; -- r/w: RX IRQ mode: 0 = RX FIFO not empty, 1 = RX FIFO at least half-full
+  constant ctrl_uart_tx_irq_c   : natural := 30; -- r/w: TX IRQ mode: 0 = TX FIFO empty and transmitter idle, 1 = TX FIFO not at least half-full
+  constant ctrl_uart_tx_busy_c  : natural := 31; -- r/-: UART transmitter is busy or TX FIFO not empty
 
   -- data register flags --
   constant data_rx_perr_c  : natural := 28; -- r/-: Rx parity error
@@ -158,6 +171,16 @@ architecture neorv32_uart_rtl of neorv32_uart is
   -- clock generator --
   signal uart_clk : std_ulogic;
 
+  -- high-speed mode: fractional baud generator (oversampling tick) --
+  type hs_gen_t is record
+    cnt  : std_ulogic_vector(7 downto 0); -- integer divider counter
+    frac : std_ulogic_vector(3 downto 0); -- fractional accumulator
+    tick : std_ulogic; -- oversampling tick
+  end record;
+  signal hs_gen  : hs_gen_t;
+  signal os_last : std_ulogic_vector(3 downto 0); -- last oversampling tick of a bit (16x: 15, 8x: 7)
+  signal os_mid  : std_ulogic_vector(3 downto 0); -- RX majority vote: last sample point (16x: 9, 8x: 5)
+
   -- numbers of bits in transmission frame --
   signal num_bits : std_ulogic_vector(03 downto 0);
 
@@ -172,34 +195,65 @@ architecture neorv32_uart_rtl of neorv32_uart is
     bitcnt     : std_ulogic_vector(03 downto 0);
     sreg       : std_ulogic_vector(10 downto 0);
     baud_cnt   : std_ulogic_vector(11 downto 0);
+    os_cnt     : std_ulogic_vector(03 downto 0); -- high-speed mode: oversampling tick counter
     tx_granted : std_ulogic; -- allowed to start sending when 1
     cts        : std_ulogic; -- allow new transmission when 1
   end record;
   signal uart_tx : uart_tx_t;
 
   -- uart rx unit --
-  type ry_data_buf_t is array (0 to 1) of std_ulogic_vector(07 downto 0);
   type uart_rx_t is record
     sync     : std_ulogic_vector(04 downto 0);
     busy     : std_ulogic;
     busy_ff  : std_ulogic;
+    done     : std_ulogic;
     bitcnt   : std_ulogic_vector(03 downto 0);
     sreg     : std_ulogic_vector(09 downto 0);
     baud_cnt : std_ulogic_vector(11 downto 0);
+    os_cnt   : std_ulogic_vector(03 downto 0); -- high-speed mode: oversampling tick counter
+    vote     : std_ulogic_vector(01 downto 0); -- high-speed mode: previous samples for majority vote
+    maj      : std_ulogic; -- high-speed mode: majority of the last three samples
     rtr      : std_ulogic; -- ready to receive when 1
     --
-    avail    : std_ulogic_vector(02 downto 0);
-    data     : ry_data_buf_t;
-    data_rd  : std_ulogic_vector(07 downto 0);
-    ferr     : std_ulogic_vector(01 downto 0); -- frame error (stop bit not set)
-    ferr_rd  : std_ulogic;
-    perr     : std_ulogic_vector(01 downto 0); -- parity error
-    perr_rd  : std_ulogic;
+    data_rd  : std_ulogic_vector(09 downto 0); -- last data read from RX FIFO
+    overr    : std_ulogic; -- data overrun (RX FIFO full)
   end record;
   signal uart_rx : uart_rx_t;
 
+  -- FIFO interface --
+  type fifo_t is record
+    clear : std_ulogic; -- sync reset, high-active
+    level : std_ulogic_vector(15 downto 0); -- fill level (zero-extended)
+    we    : std_ulogic; -- write enable
+    re    : std_ulogic; -- read enable
+    wdata : std_ulogic_vector(09 downto 0); -- write data
+    rdata : std_ulogic_vector(09 downto 0); -- read data
+    avail : std_ulogic; -- data available?
+    free  : std_ulogic; -- free entry available?
+    half  : std_ulogic; -- at least half-full?
+  end record;
+  signal rx_fifo, tx_fifo : fifo_t;
+
+  -- interrupt generator --
+  type irq_t is record
+    rx_fire : std_ulogic;
+    rx_ff   : std_ulogic;
+    tx_fire : std_ulogic;
+    tx_ff   : std_ulogic;
+  end record;
+  signal irq : irq_t;
+
 begin
 
+  -- Sanity Checks --------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  assert not (is_power_of_two_f(UART_RX_FIFO) = false) report "NEORV32 PROCESSOR CONFIG ERROR: UART <UART_RX_FIFO> has to be a power of two." severity error;
+  assert not (UART_RX_FIFO > 2**15) report "NEORV32 PROCESSOR CONFIG ERROR: UART <UART_RX_FIFO> has to be 1..32768." severity error;
+  --
+  assert not (is_power_of_two_f(UART_TX_FIFO) = false) report "NEORV32 PROCESSOR CONFIG ERROR: UART <UART_TX_FIFO> has to be a power of two." severity error;
+  assert not (UART_TX_FIFO > 2**15) report "NEORV32 PROCESSOR CONFIG ERROR: UART <UART_TX_FIFO> has to be 1..32768." severity error;
+
+
   -- Access Control -------------------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
   acc_en <= '1' when (addr_i(hi_abb_c downto lo_abb_c) = uart_id_base_c(hi_abb_c downto lo_abb_c)) else '0';
@@ -220,11 +274,14 @@ begin
           ctrl <= (others => '0');
           ctrl(ctrl_uart_baud11_c downto ctrl_uart_baud00_c) <= data_i(ctrl_uart_baud11_c downto ctrl_uart_baud00_c);
           ctrl(ctrl_uart_sim_en_c)                           <= data_i(ctrl_uart_sim_en_c);
+          ctrl(ctrl_uart_hs_en_c)                            <= data_i(ctrl_uart_hs_en_c);
           ctrl(ctrl_uart_pmode1_c downto ctrl_uart_pmode0_c) <= data_i(ctrl_uart_pmode1_c downto ctrl_uart_pmode0_c);
           ctrl(ctrl_uart_prsc2_c  downto ctrl_uart_prsc0_c)  <= data_i(ctrl_uart_prsc2_c  downto ctrl_uart_prsc0_c);
           ctrl(ctrl_uart_rts_en_c)                           <= data_i(ctrl_uart_rts_en_c);
           ctrl(ctrl_uart_cts_en_c)                           <= data_i(ctrl_uart_cts_en_c);
           ctrl(ctrl_uart_en_c)                               <= data_i(ctrl_uart_en_c);
+          ctrl(ctrl_uart_rx_irq_c)                           <= data_i(ctrl_uart_rx_irq_c);
+          ctrl(ctrl_uart_tx_irq_c)                           <= data_i(ctrl_uart_tx_irq_c);
         end if;
       end if;
       -- read access --
@@ -233,19 +290,35 @@ begin
         if (addr = uart_id_ctrl_addr_c) then
           data_o(ctrl_uart_baud11_c downto ctrl_uart_baud00_c) <= ctrl(ctrl_uart_baud11_c downto ctrl_uart_baud00_c);
           data_o(ctrl_uart_sim_en_c)                           <= ctrl(ctrl_uart_sim_en_c);
+          data_o(ctrl_uart_hs_en_c)                            <= ctrl(ctrl_uart_hs_en_c);
           data_o(ctrl_uart_pmode1_c downto ctrl_uart_pmode0_c) <= ctrl(ctrl_uart_pmode1_c downto ctrl_uart_pmode0_c);
           data_o(ctrl_uart_prsc2_c  downto ctrl_uart_prsc0_c)  <= ctrl(ctrl_uart_prsc2_c  downto ctrl_uart_prsc0_c);
           data_o(ctrl_uart_rts_en_c)                           <= ctrl(ctrl_uart_rts_en_c);
           data_o(ctrl_uart_cts_en_c)                           <= ctrl(ctrl_uart_cts_en_c);
           data_o(ctrl_uart_en_c)                               <= ctrl(ctrl_uart_en_c);
-          data_o(ctrl_uart_tx_busy_c)                          <= uart_tx.busy;
+          data_o(ctrl_uart_rx_irq_c)                           <= ctrl(ctrl_uart_rx_irq_c);
+          data_o(ctrl_uart_tx_irq_c)                           <= ctrl(ctrl_uart_tx_irq_c);
+          data_o(ctrl_uart_tx_busy_c)                          <= uart_tx.busy or tx_fifo.avail;
           data_o(ctrl_uart_cts_c)                              <= uart_cts_ff(1);
+          --
+          data_o(ctrl_uart_rx_nemp_c)  <= rx_fifo.avail;
+          data_o(ctrl_uart_rx_half_c)  <= rx_fifo.half;
+          data_o(ctrl_uart_rx_full_c)  <= not rx_fifo.free;
+          data_o(ctrl_uart_tx_empty_c) <= not tx_fifo.avail;
+          data_o(ctrl_uart_tx_nhalf_c) <= not tx_fifo.half;
+          data_o(ctrl_uart_tx_full_c)  <= not tx_fifo.free;
         else -- uart_id_rtx_addr_c
-          data_o(data_rx_avail_c) <= or_reduce_f(uart_rx.avail);
-          data_o(data_rx_overr_c) <= and_reduce_f(uart_rx.avail);
-          data_o(data_rx_ferr_c)  <= uart_rx.ferr_rd;
-          data_o(data_rx_perr_c)  <= uart_rx.perr_rd;
-          data_o(7 downto 0)      <= uart_rx.data_rd;
+          data_o(data_rx_avail_c) <= rx_fifo.avail;
+          data_o(data_rx_overr_c) <= uart_rx.overr;
+          if (rx_fifo.avail = '1') then -- read from RX FIFO
+            data_o(data_rx_perr_c) <= rx_fifo.rdata(9);
+            data_o(data_rx_ferr_c) <= rx_fifo.rdata(8);
+            data_o(7 downto 0)     <= rx_fifo.rdata(7 downto 0);
+          else -- RX FIFO empty: return the last received data again
+            data_o(data_rx_perr_c) <= uart_rx.data_rd(9);
+            data_o(data_rx_ferr_c) <= uart_rx.data_rd(8);
+            data_o(7 downto 0)     <= uart_rx.data_rd(7 downto 0);
+          end if;
         end if;
       end if;
     end if;
@@ -266,6 +339,72 @@ begin
   uart_clk <= clkgen_i(to_integer(unsigned(ctrl(ctrl_uart_prsc2_c downto ctrl_uart_prsc0_c))));
 
 
+  -- High-Speed Mode: Fractional Baud Generator ---------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  -- ctrl(baud11:baud04) = integer part (1..255), ctrl(baud03:baud00) = fractional part (1/16) of the main clock divider
+  -- for the oversampling tick; ctrl(prsc0) selects 16x (0) or 8x (1) oversampling
+  hs_baud_generator: process(clk_i)
+    variable frac_sum_v : unsigned(4 downto 0);
+  begin
+    if rising_edge(clk_i) then
+      hs_gen.tick <= '0';
+      if (ctrl(ctrl_uart_en_c) = '0') or (ctrl(ctrl_uart_hs_en_c) = '0') then
+        hs_gen.cnt  <= (others => '0');
+        hs_gen.frac <= (others => '0');
+      elsif (hs_gen.cnt = x"00") then
+        hs_gen.tick <= '1';
+        frac_sum_v  := unsigned('0' & hs_gen.frac) + unsigned('0' & ctrl(ctrl_uart_baud03_c downto ctrl_uart_baud00_c));
+        hs_gen.frac <= std_ulogic_vector(frac_sum_v(3 downto 0));
+        -- next tick period: integer part or integer part + 1 (on fractional overflow)
+        hs_gen.cnt  <= std_ulogic_vector(unsigned(ctrl(ctrl_uart_baud11_c downto ctrl_uart_baud04_c)) - 1 + frac_sum_v(4 downto 4));
+      else
+        hs_gen.cnt <= std_ulogic_vector(unsigned(hs_gen.cnt) - 1);
+      end if;
+    end if;
+  end process hs_baud_generator;
+
+  -- oversampling configuration --
+  os_last <= "0111" when (ctrl(ctrl_uart_prsc0_c) = '1') else "1111";
+  os_mid  <= "0101" when (ctrl(ctrl_uart_prsc0_c) = '1') else "1001";
+
+
+  -- TX FIFO --------------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  tx_engine_fifo_inst: neorv32_fifo
+  generic map (
+    FIFO_DEPTH => UART_TX_FIFO, -- number of fifo entries; has to be a power of two; min 1
+    FIFO_WIDTH => 8,            -- size of data elements in fifo
+    FIFO_RSYNC => false,        -- false = async read; true = sync read
+    FIFO_SAFE  => true          -- true = allow read/write only if entry available
+  )
+  port map (
+    -- control --
+    clk_i   => clk_i,                                           -- clock, rising edge
+    rstn_i  => '1',                                             -- async reset, low-active
+    clear_i => tx_fifo.clear,                                   -- sync reset, high-active
+    level_o => tx_fifo.level(index_size_f(UART_TX_FIFO) downto 0), -- fill level
+    -- write port --
+    wdata_i => tx_fifo.wdata(7 downto 0),                       -- write data
+    we_i    => tx_fifo.we,                                      -- write enable
+    free_o  => tx_fifo.free,                                    -- at least one entry is free when set
+    -- read port --
+    re_i    => tx_fifo.re,                                      -- read enable
+    rdata_o => tx_fifo.rdata(7 downto 0),                       -- read data
+    avail_o => tx_fifo.avail                                    -- data available when set
+  );
+
+  tx_fifo.clear <= '1' when (ctrl(ctrl_uart_en_c) = '0') or (ctrl(ctrl_uart_sim_en_c) = '1') else '0';
+  tx_fifo.wdata <= "00" & data_i(7 downto 0);
+  tx_fifo.we    <= '1' when (wr_en = '1') and (addr = uart_id_rtx_addr_c) else '0';
+  tx_fifo.re    <= '1' when (uart_tx.busy = '0') and (tx_fifo.avail = '1') and (ctrl(ctrl_uart_en_c) = '1') and (ctrl(ctrl_uart_sim_en_c) = '0') else '0';
+
+  tx_fifo.level(15 downto index_size_f(UART_TX_FIFO)+1) <= (others => '0');
+  tx_fifo.rdata(9 downto 8) <= (others => '0');
+
+  -- fill level monitor --
+  tx_fifo.half <= '1' when (unsigned(tx_fifo.level) >= to_unsigned(cond_sel_natural_f(boolean(UART_TX_FIFO > 1), UART_TX_FIFO/2, 1), 16)) else '0';
+
+
   -- UART Transmitter -----------------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
   uart_tx_unit: process(clk_i)
@@ -277,26 +416,43 @@ begin
         uart_tx.busy     <= '0';
         uart_tx.baud_cnt <= ctrl(ctrl_uart_baud11_c downto ctrl_uart_baud00_c);
         uart_tx.bitcnt   <= num_bits;
+        uart_tx.os_cnt   <= (others => '0');
         uart_tx.sreg(0)  <= '1';
-        if (wr_en = '1') and (ctrl(ctrl_uart_en_c) = '1') and (addr = uart_id_rtx_addr_c) and (ctrl(ctrl_uart_sim_en_c) = '0') then -- write trigger and not in SIM mode
+        if (tx_fifo.re = '1') then -- new data in TX FIFO (and not in SIM mode)
           if (ctrl(ctrl_uart_pmode1_c) = '1') then -- add parity flag
-            uart_tx.sreg <= '1' & (xor_reduce_f(data_i(7 downto 0)) xor ctrl(ctrl_uart_pmode0_c)) & data_i(7 downto 0) & '0'; -- stopbit & parity bit & data & startbit
+            uart_tx.sreg <= '1' & (xor_reduce_f(tx_fifo.rdata(7 downto 0)) xor ctrl(ctrl_uart_pmode0_c)) & tx_fifo.rdata(7 downto 0) & '0'; -- stopbit & parity bit & data & startbit
           else
-            uart_tx.sreg <= '1' & '1' & data_i(7 downto 0) & '0'; -- (dummy fill-bit &) stopbit & data & startbit
+            uart_tx.sreg <= '1' & '1' & tx_fifo.rdata(7 downto 0) & '0'; -- (dummy fill-bit &) stopbit & data & startbit
           end if;
           uart_tx.busy <= '1';
         end if;
-      elsif (uart_clk = '1') and (uart_tx.tx_granted = '1') then
-        if (uart_tx.baud_cnt = x"000") then
-          uart_tx.baud_cnt <= ctrl(ctrl_uart_baud11_c downto ctrl_uart_baud00_c);
-          uart_tx.bitcnt   <= std_ulogic_vector(unsigned(uart_tx.bitcnt) - 1);
-          uart_tx.sreg     <= '1' & uart_tx.sreg(uart_tx.sreg'left downto 1);
-        else
-          uart_tx.baud_cnt <= std_ulogic_vector(unsigned(uart_tx.baud_cnt) - 1);
+      elsif (ctrl(ctrl_uart_hs_en_c) = '0') then -- standard mode
+        if (uart_clk = '1') and (uart_tx.tx_granted = '1') then
+          if (uart_tx.baud_cnt = x"000") then
+            uart_tx.baud_cnt <= ctrl(ctrl_uart_baud11_c downto ctrl_uart_baud00_c);
+            uart_tx.bitcnt   <= std_ulogic_vector(unsigned(uart_tx.bitcnt) - 1);
+            uart_tx.sreg     <= '1' & uart_tx.sreg(uart_tx.sreg'left downto 1);
+          else
+            uart_tx.baud_cnt <= std_ulogic_vector(unsigned(uart_tx.baud_cnt) - 1);
+          end if;
+          if (uart_tx.bitcnt = "0000") then
+            uart_tx.busy <= '0'; -- done
+            uart_tx.done <= '1';
+          end if;
         end if;
-        if (uart_tx.bitcnt = "0000") then
-          uart_tx.busy <= '0'; -- done
-          uart_tx.done <= '1';
+      else -- high-speed mode
+        if (hs_gen.tick = '1') and (uart_tx.tx_granted = '1') then
+          if (uart_tx.os_cnt = os_last) then -- end of bit
+            uart_tx.os_cnt <= (others => '0');
+            uart_tx.bitcnt <= std_ulogic_vector(unsigned(uart_tx.bitcnt) - 1);
+            uart_tx.sreg   <= '1' & uart_tx.sreg(uart_tx.sreg'left downto 1);
+          else
+            uart_tx.os_cnt <= std_ulogic_vector(unsigned(uart_tx.os_cnt) + 1);
+          end if;
+          if (uart_tx.bitcnt = "0000") then
+            uart_tx.busy <= '0'; -- done
+            uart_tx.done <= '1';
+          end if;
         end if;
       end if;
       -- transmission granted --
@@ -322,60 +478,119 @@ begin
       uart_rx.sync <= uart_rxd_i & uart_rx.sync(4 downto 1);
 
       -- serial engine --
+      uart_rx.done <= '0';
       if (uart_rx.busy = '0') or (ctrl(ctrl_uart_en_c) = '0') or (ctrl(ctrl_uart_sim_en_c) = '1') then -- idle or disabled or in SIM mode
         uart_rx.busy     <= '0';
         uart_rx.baud_cnt <= '0' & ctrl(ctrl_uart_baud11_c downto ctrl_uart_baud01_c); -- half baud delay at the beginning to sample in the middle of each bit
         uart_rx.bitcnt   <= num_bits;
+        uart_rx.os_cnt   <= (others => '0');
         if (ctrl(ctrl_uart_en_c) = '0') then -- to ensure defined state when reading
-          uart_rx.perr <= (others => '0');
-          uart_rx.ferr <= (others => '0');
-          uart_rx.data <= (others => (others => '0'));
+          uart_rx.sreg <= (others => '0');
         elsif (uart_rx.sync(2 downto 0) = "001") then -- start bit? (falling edge)
           uart_rx.busy <= '1';
         end if;
-      elsif (uart_clk = '1') then
-        if (uart_rx.baud_cnt = x"000") then
-          uart_rx.baud_cnt <= ctrl(ctrl_uart_baud11_c downto ctrl_uart_baud00_c);
-          uart_rx.bitcnt   <= std_ulogic_vector(unsigned(uart_rx.bitcnt) - 1);
-          uart_rx.sreg     <= uart_rx.sync(0) & uart_rx.sreg(uart_rx.sreg'left downto 1);
-        else
-          uart_rx.baud_cnt <= std_ulogic_vector(unsigned(uart_rx.baud_cnt) - 1);
+      elsif (ctrl(ctrl_uart_hs_en_c) = '0') then -- standard mode
+        if (uart_clk = '1') then
+          if (uart_rx.baud_cnt = x"000") then
+            uart_rx.baud_cnt <= ctrl(ctrl_uart_baud11_c downto ctrl_uart_baud00_c);
+            uart_rx.bitcnt   <= std_ulogic_vector(unsigned(uart_rx.bitcnt) - 1);
+            uart_rx.sreg     <= uart_rx.sync(0) & uart_rx.sreg(uart_rx.sreg'left downto 1);
+          else
+            uart_rx.baud_cnt <= std_ulogic_vector(unsigned(uart_rx.baud_cnt) - 1);
+          end if;
+          if (uart_rx.bitcnt = "0000") then
+            uart_rx.busy <= '0'; -- done
+            uart_rx.done <= '1';
+          end if;
         end if;
-        if (uart_rx.bitcnt = "0000") then
-          uart_rx.busy <= '0'; -- done
-          -- data buffer (double buffering) --
-          uart_rx.perr(0) <= ctrl(ctrl_uart_pmode1_c) and (xor_reduce_f(uart_rx.sreg(8 downto 0)) xor ctrl(ctrl_uart_pmode0_c));
-          uart_rx.ferr(0) <= not uart_rx.sreg(9); -- check stop bit (error if not set)
-          if (ctrl(ctrl_uart_pmode1_c) = '1') then -- add parity flag
-            uart_rx.data(0) <= uart_rx.sreg(7 downto 0);
+      else -- high-speed mode: sample three times around the middle of each bit
+        if (hs_gen.tick = '1') then
+          uart_rx.vote <= uart_rx.vote(0) & uart_rx.sync(0);
+          if (uart_rx.os_cnt = os_last) then
+            uart_rx.os_cnt <= (others => '0');
           else
-            uart_rx.data(0) <= uart_rx.sreg(8 downto 1);
+            uart_rx.os_cnt <= std_ulogic_vector(unsigned(uart_rx.os_cnt) + 1);
+          end if;
+          if (uart_rx.os_cnt = os_mid) then -- last sample point: evaluate majority vote
+            if (uart_rx.bitcnt = num_bits) and (uart_rx.maj = '1') then -- start bit not valid (glitch)
+              uart_rx.busy <= '0';
+            else
+              uart_rx.bitcnt <= std_ulogic_vector(unsigned(uart_rx.bitcnt) - 1);
+              uart_rx.sreg   <= uart_rx.maj & uart_rx.sreg(uart_rx.sreg'left downto 1);
+            end if;
+          end if;
+          if (uart_rx.bitcnt = "0000") then
+            uart_rx.busy <= '0'; -- done
+            uart_rx.done <= '1';
           end if;
-          uart_rx.perr(1) <= uart_rx.perr(0);
-          uart_rx.ferr(1) <= uart_rx.ferr(0);
-          uart_rx.data(1) <= uart_rx.data(0);
         end if;
       end if;
-
-      -- RX available flag --
       uart_rx.busy_ff <= uart_rx.busy;
+
+      -- RX data overrun: new data but RX FIFO is full --
       if (ctrl(ctrl_uart_en_c) = '0') then -- disabled
-        uart_rx.avail <= "000";
-      elsif ((uart_rx.avail(0) = '1') or (uart_rx.avail(1) = '1')) and (rd_en = '1') and (addr = uart_id_rtx_addr_c) then -- RX read access
-        uart_rx.avail <= '0' & '0' & uart_rx.avail(1);
-      elsif (uart_rx.busy_ff = '1') and (uart_rx.busy = '0') then -- RX done
-        uart_rx.avail <= uart_rx.avail(1 downto 0) & '1';
+        uart_rx.overr <= '0';
+      elsif (uart_rx.done = '1') and (rx_fifo.free = '0') then
+        uart_rx.overr <= '1';
+      elsif (rd_en = '1') and (addr = uart_id_rtx_addr_c) then -- clear when reading data register
+        uart_rx.overr <= '0';
+      end if;
+
+      -- last data read from RX FIFO --
+      if (ctrl(ctrl_uart_en_c) = '0') then -- to ensure defined state when reading
+        uart_rx.data_rd <= (others => '0');
+      elsif (rx_fifo.re = '1') then
+        uart_rx.data_rd <= rx_fifo.rdata;
       end if;
     end if;
   end process uart_rx_unit;
 
-  -- Receiver double-buffering - buffer read --
-  uart_rx.perr_rd <= uart_rx.perr(1) when (uart_rx.avail(1) = '1') else uart_rx.perr(0);
-  uart_rx.ferr_rd <= uart_rx.ferr(1) when (uart_rx.avail(1) = '1') else uart_rx.ferr(0);
-  uart_rx.data_rd <= uart_rx.data(1) when (uart_rx.avail(1) = '1') else uart_rx.data(0);
+  -- high-speed mode: majority of the last three samples --
+  uart_rx.maj <= (uart_rx.vote(1) and uart_rx.vote(0)) or (uart_rx.vote(1) and uart_rx.sync(0)) or (uart_rx.vote(0) and uart_rx.sync(0));
 
   -- RX engine ready for a new char? --
-  uart_rx.rtr <= '1' when (uart_rx.avail(2 downto 0) = "000") and (uart_rx.busy = '0') and (uart_rx.busy_ff = '0') and (ctrl(ctrl_uart_en_c) = '1') else '0';
+  -- single-entry FIFO: only if the FIFO is empty and the receiver is idle; FIFO: only if the FIFO is less than half-full
+  uart_rx.rtr <= '0' when (ctrl(ctrl_uart_en_c) = '0') else
+                 (not rx_fifo.avail) and (not uart_rx.busy) and (not uart_rx.busy_ff) and (not uart_rx.done) when (UART_RX_FIFO = 1) else
+                 (not rx_fifo.half);
+
+
+  -- RX FIFO --------------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  rx_engine_fifo_inst: neorv32_fifo
+  generic map (
+    FIFO_DEPTH => UART_RX_FIFO, -- number of fifo entries; has to be a power of two; min 1
+    FIFO_WIDTH => 10,           -- size of data elements in fifo
+    FIFO_RSYNC => false,        -- false = async read; true = sync read
+    FIFO_SAFE  => true          -- true = allow read/write only if entry available
+  )
+  port map (
+    -- control --
+    clk_i   => clk_i,                                           -- clock, rising edge
+    rstn_i  => '1',                                             -- async reset, low-active
+    clear_i => rx_fifo.clear,                                   -- sync reset, high-active
+    level_o => rx_fifo.level(index_size_f(UART_RX_FIFO) downto 0), -- fill level
+    -- write port --
+    wdata_i => rx_fifo.wdata,                                   -- write data
+    we_i    => rx_fifo.we,                                      -- write enable
+    free_o  => rx_fifo.free,                                    -- at least one entry is free when set
+    -- read port --
+    re_i    => rx_fifo.re,                                      -- read enable
+    rdata_o => rx_fifo.rdata,                                   -- read data
+    avail_o => rx_fifo.avail                                    -- data available when set
+  );
+
+  rx_fifo.clear <= '1' when (ctrl(ctrl_uart_en_c) = '0') or (ctrl(ctrl_uart_sim_en_c) = '1') else '0';
+  rx_fifo.wdata(9) <= ctrl(ctrl_uart_pmode1_c) and (xor_reduce_f(uart_rx.sreg(8 downto 0)) xor ctrl(ctrl_uart_pmode0_c)); -- parity error
+  rx_fifo.wdata(8) <= not uart_rx.sreg(9); -- frame error: check stop bit (error if not set)
+  rx_fifo.wdata(7 downto 0) <= uart_rx.sreg(7 downto 0) when (ctrl(ctrl_uart_pmode1_c) = '1') else uart_rx.sreg(8 downto 1);
+  rx_fifo.we    <= uart_rx.done;
+  rx_fifo.re    <= '1' when (rd_en = '1') and (addr = uart_id_rtx_addr_c) else '0';
+
+  rx_fifo.level(15 downto index_size_f(UART_RX_FIFO)+1) <= (others => '0');
+
+  -- fill level monitor --
+  rx_fifo.half <= '1' when (unsigned(rx_fifo.level) >= to_unsigned(cond_sel_natural_f(boolean(UART_RX_FIFO > 1), UART_RX_FIFO/2, 1), 16)) else '0';
 
 
   -- Hardware Flow Control ------------------------------------------------------------------
@@ -395,10 +610,28 @@ begin
 
   -- Interrupts -----------------------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
-  -- UART RX data available
-  irq_rxd_o <= uart_rx.busy_ff and (not uart_rx.busy);
-  -- UART TX complete
-  irq_txd_o <= uart_tx.done;
+  -- RX interrupt condition: RX FIFO not empty / RX FIFO at least half-full
+  irq.rx_fire <= rx_fifo.avail when (ctrl(ctrl_uart_rx_irq_c) = '0') else rx_fifo.half;
+  -- TX interrupt condition: TX FIFO empty and transmitter idle / TX FIFO not at least half-full
+  irq.tx_fire <= (not tx_fifo.avail) and (not uart_tx.busy) when (ctrl(ctrl_uart_tx_irq_c) = '0') else (not tx_fifo.half);
+
+  -- IRQ event detector: fire on rising edge of the according condition --
+  irq_generator: process(clk_i)
+  begin
+    if rising_edge(clk_i) then
+      if (ctrl(ctrl_uart_en_c) = '0') then -- disabled
+        irq.rx_ff <= '0';
+        irq.tx_ff <= '1';
+        irq_rxd_o <= '0';
+        irq_txd_o <= '0';
+      else
+        irq.rx_ff <= irq.rx_fire;
+        irq.tx_ff <= irq.tx_fire;
+        irq_rxd_o <= irq.rx_fire and (not irq.rx_ff);
+        irq_txd_o <= irq.tx_fire and (not irq.tx_ff);
+      end if;
+    end if;
+  end process irq_generator;
 
 
   -- SIMULATION Output ----------------------------------------------------------------------
@@ -52,9 +52,18 @@ entity neorv32_wishbone is
     -- Internal instruction memory --
     MEM_INT_IMEM_EN   : boolean; -- implement processor-internal instruction memory
     MEM_INT_IMEM_SIZE : natural; -- size of processor-internal instruction memory in bytes
+    MEM_INT_IMEM_BASE : std_ulogic_vector(31 downto 0); -- base address of processor-internal instruction memory
     -- Internal data memory --
     MEM_INT_DMEM_EN   : boolean; -- implement processor-internal data memory
     MEM_INT_DMEM_SIZE : natural; -- size of processor-internal data memory in bytes
+    MEM_INT_DMEM_BASE : std_ulogic_vector(31 downto 0); -- base address of processor-internal data memory
+    -- Additional internal memory banks --
+    MEM_INT_XMEM_BASE : xmem_base_t; -- base addresses of additional internal memory banks
+    MEM_INT_XMEM_SIZE : xmem_size_t; -- sizes of additional internal memory banks in bytes (0 = not implemented)
+    -- Execute in place flash window --
+    XIP_EN            : boolean; -- implement execute-in-place flash controller
+    XIP_BASE          : std_ulogic_vector(31 downto 0); -- base address of the memory-mapped flash window
+    XIP_SIZE          : natural;  -- size of the memory-mapped flash window in bytes
     -- Interface Configuration --
     BUS_TIMEOUT       : natural; -- cycles after an UNACKNOWLEDGED bus access triggers a bus fault exception
     PIPE_MODE         : boolean; -- protocol: false=classic/standard wishbone mode, true=pipelined wishbone mode
@@ -100,7 +109,9 @@ architecture neorv32_wishbone_rtl of neorv32_wishbone is
   -- access control --
   signal int_imem_acc : std_ulogic;
   signal int_dmem_acc : std_ulogic;
+  signal int_xmem_acc : std_ulogic;
   signal int_boot_acc : std_ulogic;
+  signal int_xip_acc  : std_ulogic;
   signal xbus_access  : std_ulogic;
 
   -- bus arbiter
@@ -151,13 +162,16 @@ begin
 
   -- Access Control -------------------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
-  -- access to processor-internal IMEM or DMEM? --
-  int_imem_acc <= '1' when (addr_i(31 downto index_size_f(MEM_INT_IMEM_SIZE)) = imem_base_c(31 downto index_size_f(MEM_INT_IMEM_SIZE))) and (MEM_INT_IMEM_EN = true) else '0';
-  int_dmem_acc <= '1' when (addr_i(31 downto index_size_f(MEM_INT_DMEM_SIZE)) = dmem_base_c(31 downto index_size_f(MEM_INT_DMEM_SIZE))) and (MEM_INT_DMEM_EN = true) else '0';
+  -- access to processor-internal IMEM, DMEM or additional memory banks? --
+  int_imem_acc <= '1' when (addr_i(31 downto index_size_f(MEM_INT_IMEM_SIZE)) = MEM_INT_IMEM_BASE(31 downto index_size_f(MEM_INT_IMEM_SIZE))) and (MEM_INT_IMEM_EN = true) else '0';
+  int_dmem_acc <= '1' when (addr_i(31 downto index_size_f(MEM_INT_DMEM_SIZE)) = MEM_INT_DMEM_BASE(31 downto index_size_f(MEM_INT_DMEM_SIZE))) and (MEM_INT_DMEM_EN = true) else '0';
+  int_xmem_acc <= xmem_access_f(addr_i, MEM_INT_XMEM_BASE, MEM_INT_XMEM_SIZE);
   -- access to processor-internal BOOTROM or IO devices? --
   int_boot_acc <= '1' when (addr_i(31 downto 16) = boot_rom_base_c(31 downto 16)) else '0'; -- hacky!
+  -- access to the XIP flash window? --
+  int_xip_acc  <= '1' when (addr_i(31 downto index_size_f(XIP_SIZE)) = XIP_BASE(31 downto index_size_f(XIP_SIZE))) and (XIP_EN = true) else '0';
   -- actual external bus access? --
-  xbus_access <= (not int_imem_acc) and (not int_dmem_acc) and (not int_boot_acc);
+  xbus_access <= (not int_imem_acc) and (not int_dmem_acc) and (not int_xmem_acc) and (not int_boot_acc) and (not int_xip_acc);
 
 
   -- Bus Arbiter -----------------------------------------------------------------------------
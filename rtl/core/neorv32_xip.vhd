@@ -0,0 +1,400 @@
+-- #################################################################################################
+-- # << NEORV32 - Execute In Place Flash Controller (XIP) >>                                       #
+-- # ********************************************************************************************* #
+-- # Maps an external SPI flash into the processor's address space (XIP_BASE, up to 16MB). Each    #
+-- # word read issues a configurable read command (e.g. 0x0B fast read / 0x3B dual output / 0x6B   #
+-- # quad output / 0xEB quad I/O) with 24-bit address, optional dummy cycles and 1/2/4 data lanes. #
+-- # Sequential word accesses (e.g. i-cache block refills) continue the running burst without      #
+-- # issuing a new command as long as chip-select stays asserted. A direct byte-wise SPI mode      #
+-- # (XIP disabled) allows sending arbitrary commands to the flash (e.g. to set the QE bit).       #
+-- # ********************************************************************************************* #
+-- # BSD 3-Clause License                                                                          #
+-- #                                                                                               #
+-- # Copyright (c) 2021, Stephan Nolting. All rights reserved.                                     #
+-- #                                                                                               #
+-- # Redistribution and use in source and binary forms, with or without modification, are          #
+-- # permitted provided that the following conditions are met:                                     #
+-- #                                                                                               #
+-- # 1. Redistributions of source code must retain the above copyright notice, this list of        #
+-- #    conditions and the following disclaimer.                                                   #
+-- #                                                                                               #
+-- # 2. Redistributions in binary form must reproduce the above copyright notice, this list of     #
+-- #    conditions and the following disclaimer in the documentation and/or other materials        #
+-- #    provided with the distribution.                                                            #
+-- #                                                                                               #
+-- # 3. Neither the name of the copyright holder nor the names of its contributors may be used to  #
+-- #    endorse or promote products derived from this software without specific prior written      #
+-- #    permission.                                                                                #
+-- #                                                                                               #
+-- # THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS   #
+-- # OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF               #
+-- # MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE    #
+-- # COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,     #
+-- # EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE #
+-- # GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED    #
+-- # AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING     #
+-- # NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED  #
+-- # OF THE POSSIBILITY OF SUCH DAMAGE.                                                            #
+-- # ********************************************************************************************* #
+-- # The NEORV32 Processor - https://github.com/stnolting/neorv32              (c) Stephan Nolting #
+-- #################################################################################################
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library neorv32;
+use neorv32.neorv32_package.all;
+
+entity neorv32_xip is
+  generic (
+    XIP_BASE : std_ulogic_vector(31 downto 0); -- base address of the memory-mapped flash window
+    XIP_SIZE : natural -- size of the memory-mapped flash window in bytes, has to be a power of 2 (max 16MB)
+  );
+  port (
+    -- global control --
+    clk_i        : in  std_ulogic; -- global clock line
+    rstn_i       : in  std_ulogic; -- global reset line, low-active
+    -- host access --
+    addr_i       : in  std_ulogic_vector(31 downto 0); -- address
+    rden_i       : in  std_ulogic; -- read enable
+    wren_i       : in  std_ulogic; -- write enable
+    data_i       : in  std_ulogic_vector(31 downto 0); -- data in
+    data_o       : out std_ulogic_vector(31 downto 0); -- data out
+    ack_o        : out std_ulogic; -- transfer acknowledge
+    err_o        : out std_ulogic; -- transfer error
+    -- clock generator --
+    clkgen_en_o  : out std_ulogic; -- enable clock generator
+    clkgen_i     : in  std_ulogic_vector(07 downto 0);
+    -- flash interface --
+    xip_csn_o    : out std_ulogic; -- chip-select, low-active
+    xip_clk_o    : out std_ulogic; -- serial clock
+    xip_dat_i    : in  std_ulogic_vector(03 downto 0); -- IO0..IO3 input
+    xip_dat_o    : out std_ulogic_vector(03 downto 0); -- IO0..IO3 output
+    xip_dat_oe_o : out std_ulogic_vector(03 downto 0)  -- IO0..IO3 output enable, high-active
+  );
+end neorv32_xip;
+
+architecture neorv32_xip_rtl of neorv32_xip is
+
+  -- flash window address boundary bit --
+  constant lo_abb_c : natural := index_size_f(XIP_SIZE);
+
+  -- control register bits --
+  constant ctrl_en_c      : natural :=  0; -- r/w: XIP enable (memory-mapped flash access); direct SPI mode when cleared
+  constant ctrl_prsc0_c   : natural :=  1; -- r/w: clock prescaler select bit 0
+  constant ctrl_prsc1_c   : natural :=  2; -- r/w: clock prescaler select bit 1
+  constant ctrl_prsc2_c   : natural :=  3; -- r/w: clock prescaler select bit 2
+  constant ctrl_mode0_c   : natural :=  4; -- r/w: read mode (00: SPI 1-1-1, 01: dual output 1-1-2)
+  constant ctrl_mode1_c   : natural :=  5; -- r/w: read mode (10: quad output 1-1-4, 11: quad I/O 1-4-4)
+  constant ctrl_dummy0_c  : natural :=  6; -- r/w: number of dummy clock cycles, bit 0
+  constant ctrl_dummy3_c  : natural :=  9; -- r/w: number of dummy clock cycles, bit 3
+  constant ctrl_cmd_lsb_c : natural := 10; -- r/w: read command, lsb
+  constant ctrl_cmd_msb_c : natural := 17; -- r/w: read command, msb
+  constant ctrl_burst_c   : natural := 18; -- r/w: allow burst continuation of sequential accesses
+  constant ctrl_dcs_c     : natural := 19; -- r/w: direct SPI mode: assert chip-select
+  --
+  constant ctrl_busy_c    : natural := 31; -- r/-: serial engine busy
+
+  -- read modes --
+  constant mode_spi_c  : std_ulogic_vector(1 downto 0) := "00"; -- 1-1-1
+  constant mode_dual_c : std_ulogic_vector(1 downto 0) := "01"; -- 1-1-2
+  constant mode_qout_c : std_ulogic_vector(1 downto 0) := "10"; -- 1-1-4
+  constant mode_qio_c  : std_ulogic_vector(1 downto 0) := "11"; -- 1-4-4
+
+  -- access control --
+  signal acc_ctrl : std_ulogic; -- access to control registers
+  signal acc_mem  : std_ulogic; -- access to memory-mapped flash window
+
+  -- control register --
+  signal ctrl : std_ulogic_vector(ctrl_dcs_c downto 0);
+  signal mode : std_ulogic_vector(1 downto 0);
+
+  -- clock generator --
+  signal spi_clk : std_ulogic;
+
+  -- host request buffer --
+  type req_t is record
+    pend   : std_ulogic; -- memory read pending
+    addr   : std_ulogic_vector(23 downto 2); -- word address inside flash
+    direct : std_ulogic; -- direct SPI transfer pending
+    wdata  : std_ulogic_vector(07 downto 0); -- direct SPI transfer data
+    kill   : std_ulogic; -- terminate running burst (configuration changed)
+  end record;
+  signal req : req_t;
+
+  -- serial engine --
+  type state_t is (S_IDLE, S_CSH, S_CMD, S_ADDR, S_MODE, S_DUMMY, S_DATA, S_DIRECT);
+  type engine_t is record
+    state : state_t;
+    half  : std_ulogic; -- second half of serial clock period (clock high)
+    cnt   : std_ulogic_vector(05 downto 0); -- remaining clock cycles in current phase
+    sreg  : std_ulogic_vector(31 downto 0); -- transmit shift register
+    rreg  : std_ulogic_vector(31 downto 0); -- receive shift register
+    csn   : std_ulogic; -- chip-select, low-active
+    sck   : std_ulogic; -- serial clock
+    burst : std_ulogic; -- chip-select is still asserted after a read: sequential access can continue
+    naddr : std_ulogic_vector(23 downto 2); -- next sequential word address
+    done  : std_ulogic; -- memory read completed
+  end record;
+  signal engine : engine_t;
+
+  -- engine helpers --
+  signal tx_quad  : std_ulogic; -- current phase transmits via four lanes
+  signal rx_lanes : std_ulogic_vector(1 downto 0); -- current phase receive lanes (00: 1, 01: 2, 1-: 4)
+  signal dat_ff0  : std_ulogic_vector(3 downto 0); -- input synchronizer
+  signal dat_ff1  : std_ulogic_vector(3 downto 0);
+
+begin
+
+  -- Sanity Checks --------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  assert not (is_power_of_two_f(XIP_SIZE) = false) report "NEORV32 PROCESSOR CONFIG ERROR! XIP <XIP_SIZE> has to be a power of 2." severity error;
+  assert not ((XIP_SIZE < 4) or (XIP_SIZE > 16*1024*1024)) report "NEORV32 PROCESSOR CONFIG ERROR! XIP <XIP_SIZE> has to be 4 bytes .. 16MB." severity error;
+  assert not (or_reduce_f(XIP_BASE(lo_abb_c-1 downto 0)) /= '0') report "NEORV32 PROCESSOR CONFIG ERROR! XIP <XIP_BASE> has to be aligned to <XIP_SIZE>." severity error;
+
+
+  -- Access Control -------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  acc_ctrl <= '1' when (addr_i(31 downto index_size_f(xip_size_c)) = xip_base_c(31 downto index_size_f(xip_size_c))) else '0';
+  acc_mem  <= '1' when (addr_i(31 downto lo_abb_c) = XIP_BASE(31 downto lo_abb_c)) else '0';
+
+  -- configuration shortcuts --
+  mode <= ctrl(ctrl_mode1_c downto ctrl_mode0_c);
+
+
+  -- Host Access ----------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  host_access: process(rstn_i, clk_i)
+  begin
+    if (rstn_i = '0') then
+      ctrl       <= (others => '0');
+      req.pend   <= '0';
+      req.addr   <= (others => '0');
+      req.direct <= '0';
+      req.wdata  <= (others => '0');
+      req.kill   <= '0';
+      ack_o      <= '0';
+      err_o      <= '0';
+      data_o     <= (others => '0');
+    elsif rising_edge(clk_i) then
+      -- defaults --
+      ack_o  <= '0';
+      err_o  <= '0';
+      data_o <= (others => '0');
+      if (engine.state = S_DIRECT) then -- direct transfer has been started
+        req.direct <= '0';
+      end if;
+      if (engine.state = S_IDLE) and (engine.burst = '0') then -- burst has been terminated
+        req.kill <= '0';
+      end if;
+
+      -- control register access --
+      if (acc_ctrl = '1') and ((rden_i or wren_i) = '1') then
+        ack_o <= '1';
+        if (wren_i = '1') then
+          if (addr_i = xip_ctrl_addr_c) then
+            ctrl     <= data_i(ctrl'left downto 0);
+            req.kill <= '1'; -- configuration change: terminate a running burst
+          else -- xip_data_addr_c: direct SPI transfer
+            req.direct <= not ctrl(ctrl_en_c);
+            req.wdata  <= data_i(7 downto 0);
+          end if;
+        else
+          if (addr_i = xip_ctrl_addr_c) then
+            data_o(ctrl'left downto 0) <= ctrl;
+            data_o(ctrl_busy_c)        <= req.direct or req.pend or bool_to_ulogic_f(engine.state /= S_IDLE);
+          else -- xip_data_addr_c
+            data_o(7 downto 0) <= engine.rreg(7 downto 0);
+          end if;
+        end if;
+      end if;
+
+      -- memory-mapped flash access --
+      if (acc_mem = '1') then
+        if (wren_i = '1') or ((rden_i = '1') and (ctrl(ctrl_en_c) = '0')) then -- read-only; XIP has to be enabled
+          err_o <= '1';
+        elsif (rden_i = '1') then
+          req.pend <= '1';
+          req.addr <= (others => '0');
+          req.addr(lo_abb_c-1 downto 2) <= addr_i(lo_abb_c-1 downto 2);
+        end if;
+      end if;
+
+      -- request completed --
+      if (engine.done = '1') then
+        req.pend <= '0';
+        ack_o    <= '1';
+        data_o   <= engine.rreg(07 downto 00) & engine.rreg(15 downto 08) & -- first byte from flash is the lowest byte
+                    engine.rreg(23 downto 16) & engine.rreg(31 downto 24);   -- (little-endian)
+      end if;
+    end if;
+  end process host_access;
+
+
+  -- Clock Selection ------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  clkgen_en_o <= ctrl(ctrl_en_c) or ctrl(ctrl_dcs_c) or req.direct;
+  spi_clk     <= clkgen_i(to_integer(unsigned(ctrl(ctrl_prsc2_c downto ctrl_prsc0_c))));
+
+
+  -- Serial Engine --------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  serial_engine: process(rstn_i, clk_i)
+  begin
+    if (rstn_i = '0') then
+      engine.state <= S_IDLE;
+      engine.half  <= '0';
+      engine.cnt   <= (others => '0');
+      engine.sreg  <= (others => '0');
+      engine.rreg  <= (others => '0');
+      engine.csn   <= '1';
+      engine.sck   <= '0';
+      engine.burst <= '0';
+      engine.naddr <= (others => '0');
+      engine.done  <= '0';
+      dat_ff0      <= (others => '0');
+      dat_ff1      <= (others => '0');
+    elsif rising_edge(clk_i) then
+      -- input synchronizer --
+      dat_ff0 <= xip_dat_i;
+      dat_ff1 <= dat_ff0;
+
+      -- defaults --
+      engine.done <= '0';
+
+      if (engine.state = S_IDLE) then -- wait for request
+      -- ------------------------------------------------------------
+        engine.half <= '0';
+        engine.sck  <= '0';
+        if (ctrl(ctrl_en_c) = '0') then -- direct SPI mode
+          engine.burst <= '0';
+          engine.csn   <= not ctrl(ctrl_dcs_c);
+          if (req.direct = '1') then
+            engine.sreg(31 downto 24) <= req.wdata;
+            engine.cnt   <= "001000"; -- 8 clock cycles
+            engine.state <= S_DIRECT;
+          end if;
+        elsif (engine.burst = '1') and ((req.kill = '1') or (ctrl(ctrl_burst_c) = '0')) then -- terminate burst
+          engine.burst <= '0';
+          engine.csn   <= '1';
+          engine.state <= S_CSH;
+        elsif (req.pend = '1') and (req.kill = '0') then
+          if (engine.burst = '1') and (req.addr = engine.naddr) then -- sequential access: continue burst
+            engine.cnt   <= cond_sel_stdulogicvector_f(boolean(mode = mode_spi_c), "100000", cond_sel_stdulogicvector_f(boolean(mode = mode_dual_c), "010000", "001000"));
+            engine.state <= S_DATA;
+          elsif (engine.burst = '1') then -- non-sequential access: terminate burst and start new command
+            engine.burst <= '0';
+            engine.csn   <= '1';
+            engine.state <= S_CSH;
+          else -- start new command
+            engine.csn   <= '0';
+            engine.sreg  <= ctrl(ctrl_cmd_msb_c downto ctrl_cmd_lsb_c) & req.addr & "00"; -- command & 24-bit address
+            engine.cnt   <= "001000"; -- 8 clock cycles
+            engine.state <= S_CMD;
+          end if;
+        end if;
+
+      elsif (engine.state = S_CSH) then -- keep chip-select de-asserted for at least one clock period
+      -- ------------------------------------------------------------
+        if (spi_clk = '1') then
+          engine.half <= not engine.half;
+          if (engine.half = '1') then
+            engine.state <= S_IDLE;
+          end if;
+        end if;
+
+      else -- serial transfer in progress
+      -- ------------------------------------------------------------
+        if (spi_clk = '1') then
+          engine.half <= not engine.half;
+          if (engine.half = '0') then -- rising edge
+            engine.sck <= '1';
+          else -- falling edge: sample input, shift output, next clock cycle
+            engine.sck <= '0';
+            case rx_lanes is
+              when "00"   => engine.rreg <= engine.rreg(30 downto 0) & dat_ff1(1); -- IO1
+              when "01"   => engine.rreg <= engine.rreg(29 downto 0) & dat_ff1(1 downto 0); -- IO1..IO0
+              when others => engine.rreg <= engine.rreg(27 downto 0) & dat_ff1(3 downto 0); -- IO3..IO0
+            end case;
+            if (tx_quad = '1') then
+              engine.sreg <= engine.sreg(27 downto 0) & "0000";
+            else
+              engine.sreg <= engine.sreg(30 downto 0) & '0';
+            end if;
+            engine.cnt <= std_ulogic_vector(unsigned(engine.cnt) - 1);
+            -- end of phase --
+            if (engine.cnt = "000001") then
+              case engine.state is
+                when S_CMD => -- command done, send address
+                  engine.cnt   <= cond_sel_stdulogicvector_f(boolean(mode = mode_qio_c), "000110", "011000");
+                  engine.state <= S_ADDR;
+                when S_ADDR => -- address done: mode bits / dummy cycles / data
+                  if (mode = mode_qio_c) and (unsigned(ctrl(ctrl_dummy3_c downto ctrl_dummy0_c)) >= 2) then
+                    engine.sreg  <= (others => '1'); -- mode bits 0xFF: no "continuous read" mode
+                    engine.cnt   <= "000010";
+                    engine.state <= S_MODE;
+                  elsif (or_reduce_f(ctrl(ctrl_dummy3_c downto ctrl_dummy0_c)) = '1') then
+                    engine.cnt   <= "00" & ctrl(ctrl_dummy3_c downto ctrl_dummy0_c);
+                    engine.state <= S_DUMMY;
+                  else
+                    engine.cnt   <= cond_sel_stdulogicvector_f(boolean(mode = mode_spi_c), "100000", cond_sel_stdulogicvector_f(boolean(mode = mode_dual_c), "010000", "001000"));
+                    engine.state <= S_DATA;
+                  end if;
+                when S_MODE => -- mode bits done: remaining dummy cycles / data
+                  if (unsigned(ctrl(ctrl_dummy3_c downto ctrl_dummy0_c)) > 2) then
+                    engine.cnt   <= std_ulogic_vector(unsigned("00" & ctrl(ctrl_dummy3_c downto ctrl_dummy0_c)) - 2);
+                    engine.state <= S_DUMMY;
+                  else
+                    engine.cnt   <= "001000";
+                    engine.state <= S_DATA;
+                  end if;
+                when S_DUMMY => -- dummy cycles done: receive data
+                  engine.cnt   <= cond_sel_stdulogicvector_f(boolean(mode = mode_spi_c), "100000", cond_sel_stdulogicvector_f(boolean(mode = mode_dual_c), "010000", "001000"));
+                  engine.state <= S_DATA;
+                when S_DATA => -- data word complete; keep chip-select asserted for a subsequent sequential access
+                  engine.done  <= '1';
+                  engine.burst <= '1';
+                  engine.naddr <= std_ulogic_vector(unsigned(req.addr) + 1);
+                  engine.state <= S_IDLE;
+                when others => -- S_DIRECT: byte transfer done
+                  engine.state <= S_IDLE;
+              end case;
+            end if;
+          end if;
+        end if;
+      end if;
+    end if;
+  end process serial_engine;
+
+  -- lane configuration of the current phase --
+  tx_quad  <= '1' when ((engine.state = S_ADDR) and (mode = mode_qio_c)) or (engine.state = S_MODE) else '0';
+  rx_lanes <= "00" when (engine.state = S_DIRECT) else mode;
+
+
+  -- Flash Interface ------------------------------------------------------------------------
+  -- -------------------------------------------------------------------------------------------
+  xip_csn_o <= engine.csn;
+  xip_clk_o <= engine.sck;
+
+  -- IO2/IO3 (/WP, /HOLD) are driven high in single-lane phases --
+  xip_dat_o <= engine.sreg(31 downto 28) when (tx_quad = '1') else ("11" & '0' & engine.sreg(31));
+
+  -- output enables: IO0 = data to flash, IO1 = data from flash in single-lane phases --
+  output_enable: process(engine.state, tx_quad, mode)
+  begin
+    if (tx_quad = '1') then
+      xip_dat_oe_o <= "1111";
+    elsif (engine.state = S_DUMMY) or (engine.state = S_DATA) then
+      case mode is
+        when mode_spi_c  => xip_dat_oe_o <= "1101";
+        when mode_dual_c => xip_dat_oe_o <= "1100";
+        when others      => xip_dat_oe_o <= "0000";
+      end case;
+    else
+      xip_dat_oe_o <= "1101";
+    end if;
+  end process output_enable;
+
+
+end neorv32_xip_rtl;
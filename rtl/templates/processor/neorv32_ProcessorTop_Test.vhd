@@ -90,7 +90,7 @@ begin
     CPU_CNT_WIDTH                => 64,          -- total width of CPU cycle and instret counters (0..64)
     -- Physical Memory Protection (PMP) --
     PMP_NUM_REGIONS              => 0,           -- number of regions (0..64)
-    PMP_MIN_GRANULARITY          => 64*1024,     -- minimal region granularity in bytes, has to be a power of 2, min 8 bytes
+    PMP_MIN_GRANULARITY          => 64*1024,     -- minimal region granularity in bytes, has to be a power of 2, min 4 bytes
     -- Hardware Performance Monitors (HPM) --
     HPM_NUM_CNTS                 => 4,           -- number of implemented HPM counters (0..29)
     HPM_CNT_WIDTH                => 40,          -- total size of HPM counters (0..64)
@@ -48,6 +48,7 @@ entity neorv32_ProcessorTop_stdlogic is
     HW_THREAD_ID                 : natural := 0;      -- hardware thread id (32-bit)
     -- On-Chip Debugger (OCD) --
     ON_CHIP_DEBUGGER_EN          : boolean := false;  -- implement on-chip debugger
+    ON_CHIP_DEBUGGER_SBA_EN      : boolean := false;  -- implement system bus access (SBA) master and abstract memory access in debug module
     -- RISC-V CPU Extensions --
     CPU_EXTENSION_RISCV_A        : boolean := false;  -- implement atomic extension?
     CPU_EXTENSION_RISCV_C        : boolean := false;  -- implement compressed extension?
@@ -63,7 +64,7 @@ entity neorv32_ProcessorTop_stdlogic is
     CPU_CNT_WIDTH                : natural := 64;     -- total width of CPU cycle and instret counters (0..64)
     -- Physical Memory Protection (PMP) --
     PMP_NUM_REGIONS              : natural := 0;      -- number of regions (0..64)
-    PMP_MIN_GRANULARITY          : natural := 64*1024; -- minimal region granularity in bytes, has to be a power of 2, min 8 bytes
+    PMP_MIN_GRANULARITY          : natural := 64*1024; -- minimal region granularity in bytes, has to be a power of 2, min 4 bytes
     -- Hardware Performance Monitors (HPM) --
     HPM_NUM_CNTS                 : natural := 0;      -- number of implemented HPM counters (0..29)
     HPM_CNT_WIDTH                : natural := 40;     -- total size of HPM counters (0..64)
@@ -98,8 +99,14 @@ entity neorv32_ProcessorTop_stdlogic is
     IO_MTIME_EN                  : boolean := true;   -- implement machine system timer (MTIME)?
     IO_UART0_EN                  : boolean := true;   -- implement primary universal asynchronous receiver/transmitter (UART0)?
     IO_UART1_EN                  : boolean := true;   -- implement secondary universal asynchronous receiver/transmitter (UART1)?
+    UART0_RX_FIFO                : natural := 1;      -- UART0 RX fifo depth, has to be a power of two, min 1
+    UART0_TX_FIFO                : natural := 1;      -- UART0 TX fifo depth, has to be a power of two, min 1
+    UART1_RX_FIFO                : natural := 1;      -- UART1 RX fifo depth, has to be a power of two, min 1
+    UART1_TX_FIFO                : natural := 1;      -- UART1 TX fifo depth, has to be a power of two, min 1
     IO_SPI_EN                    : boolean := true;   -- implement serial peripheral interface (SPI)?
+    SPI_FIFO                     : natural := 1;      -- SPI TX/RX fifo depth, has to be a power of two, min 1
     IO_TWI_EN                    : boolean := true;   -- implement two-wire interface (TWI)?
+    TWI_FIFO                     : natural := 1;      -- TWI command/RX fifo depth, has to be a power of two, min 1
     IO_PWM_NUM_CH                : natural := 4;      -- number of PWM channels to implement (0..60); 0 = disabled
     IO_WDT_EN                    : boolean := true;   -- implement watch dog timer (WDT)?
     IO_TRNG_EN                   : boolean := false;  -- implement true random number generator (TRNG)?
@@ -270,6 +277,7 @@ begin
     HW_THREAD_ID                 => HW_THREAD_ID,       -- hardware thread id (hartid) (32-bit)
     -- On-Chip Debugger (OCD) --
     ON_CHIP_DEBUGGER_EN          => ON_CHIP_DEBUGGER_EN,          -- implement on-chip debugger
+    ON_CHIP_DEBUGGER_SBA_EN      => ON_CHIP_DEBUGGER_SBA_EN,      -- implement system bus access (SBA) master and abstract memory access in debug module
     -- RISC-V CPU Extensions --
     CPU_EXTENSION_RISCV_A        => CPU_EXTENSION_RISCV_A,        -- implement atomic extension?
     CPU_EXTENSION_RISCV_C        => CPU_EXTENSION_RISCV_C,        -- implement compressed extension?
@@ -285,7 +293,7 @@ begin
     CPU_CNT_WIDTH                => CPU_CNT_WIDTH,      -- total width of CPU cycle and instret counters (0..64)
     -- Physical Memory Protection (PMP) --
     PMP_NUM_REGIONS              => PMP_NUM_REGIONS,    -- number of regions (0..64)
-    PMP_MIN_GRANULARITY          => PMP_MIN_GRANULARITY, -- minimal region granularity in bytes, has to be a power of 2, min 8 bytes
+    PMP_MIN_GRANULARITY          => PMP_MIN_GRANULARITY, -- minimal region granularity in bytes, has to be a power of 2, min 4 bytes
     -- Hardware Performance Monitors (HPM) --
     HPM_NUM_CNTS                 => HPM_NUM_CNTS,       -- number of implemented HPM counters (0..29)
     HPM_CNT_WIDTH                => HPM_CNT_WIDTH,      -- total size of HPM counters (0..64)
@@ -320,8 +328,14 @@ begin
     IO_MTIME_EN                  => IO_MTIME_EN,        -- implement machine system timer (MTIME)?
     IO_UART0_EN                  => IO_UART0_EN,        -- implement primary universal asynchronous receiver/transmitter (UART0)?
     IO_UART1_EN                  => IO_UART1_EN,        -- implement secondary universal asynchronous receiver/transmitter (UART1)?
+    UART0_RX_FIFO                => UART0_RX_FIFO,      -- UART0 RX fifo depth, has to be a power of two, min 1
+    UART0_TX_FIFO                => UART0_TX_FIFO,      -- UART0 TX fifo depth, has to be a power of two, min 1
+    UART1_RX_FIFO                => UART1_RX_FIFO,      -- UART1 RX fifo depth, has to be a power of two, min 1
+    UART1_TX_FIFO                => UART1_TX_FIFO,      -- UART1 TX fifo depth, has to be a power of two, min 1
     IO_SPI_EN                    => IO_SPI_EN,          -- implement serial peripheral interface (SPI)?
+    SPI_FIFO                     => SPI_FIFO,           -- SPI TX/RX fifo depth, has to be a power of two, min 1
     IO_TWI_EN                    => IO_TWI_EN,          -- implement two-wire interface (TWI)?
+    TWI_FIFO                     => TWI_FIFO,           -- TWI command/RX fifo depth, has to be a power of two, min 1
     IO_PWM_NUM_CH                => IO_PWM_NUM_CH,      -- number of PWM channels to implement (0..60); 0 = disabled
     IO_WDT_EN                    => IO_WDT_EN,          -- implement watch dog timer (WDT)?
     IO_TRNG_EN                   => IO_TRNG_EN,         -- implement true random number generator (TRNG)?
@@ -47,18 +47,27 @@ use iCE40.components.all;
 
 entity neorv32_dmem is
   generic (
-    DMEM_BASE : std_ulogic_vector(31 downto 0) := x"80000000"; -- memory base address
-    DMEM_SIZE : natural := 64*1024 -- processor-internal instruction memory size in bytes
+    DMEM_BASE   : std_ulogic_vector(31 downto 0) := x"80000000"; -- memory base address
+    DMEM_SIZE   : natural := 64*1024; -- processor-internal instruction memory size in bytes
+    DMEM_TCM_EN : boolean := false    -- TCM port in use?
   );
   port (
-    clk_i  : in  std_ulogic; -- global clock line
-    rden_i : in  std_ulogic; -- read enable
-    wren_i : in  std_ulogic; -- write enable
-    ben_i  : in  std_ulogic_vector(03 downto 0); -- byte write enable
-    addr_i : in  std_ulogic_vector(31 downto 0); -- address
-    data_i : in  std_ulogic_vector(31 downto 0); -- data in
-    data_o : out std_ulogic_vector(31 downto 0); -- data out
-    ack_o  : out std_ulogic -- transfer acknowledge
+    clk_i      : in  std_ulogic; -- global clock line
+    -- processor bus --
+    rden_i     : in  std_ulogic; -- read enable
+    wren_i     : in  std_ulogic; -- write enable
+    ben_i      : in  std_ulogic_vector(03 downto 0); -- byte write enable
+    addr_i     : in  std_ulogic_vector(31 downto 0); -- address
+    data_i     : in  std_ulogic_vector(31 downto 0); -- data in
+    data_o     : out std_ulogic_vector(31 downto 0); -- data out
+    ack_o      : out std_ulogic; -- transfer acknowledge
+    -- tightly-coupled memory port (CPU load/store, fixed latency of one cycle) --
+    tcm_re_i   : in  std_ulogic := '0'; -- read enable
+    tcm_we_i   : in  std_ulogic := '0'; -- write enable
+    tcm_ben_i  : in  std_ulogic_vector(03 downto 0) := (others => '0'); -- byte write enable
+    tcm_addr_i : in  std_ulogic_vector(31 downto 0) := (others => '0'); -- address
+    tcm_data_i : in  std_ulogic_vector(31 downto 0) := (others => '0'); -- data in
+    tcm_data_o : out std_ulogic_vector(31 downto 0) -- data out
   );
 end neorv32_dmem;
 
@@ -98,6 +107,9 @@ begin
   assert not (DMEM_SIZE > 64*1024) report "DMEM has a fixed physical size of 64kB. Logical size must be less or equal." severity error;
 
 
+  assert not (DMEM_TCM_EN = true) report "ICE40 Ultra Plus SPRAM is single-ported and does not provide a TCM port - disable <MEM_INT_TCM_EN>!" severity failure;
+
+
   -- Access Control -------------------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
   acc_en <= '1' when (addr_i(hi_abb_c downto lo_abb_c) = DMEM_BASE(hi_abb_c downto lo_abb_c)) else '0';
@@ -157,5 +169,8 @@ begin
   -- output gate --
   data_o <= rdata when (rden = '1') else (others => '0');
 
+  -- no tightly-coupled memory port --
+  tcm_data_o <= (others => '0');
+
 
 end neorv32_dmem_rtl;
@@ -12,9 +12,11 @@ NEORV32_MEM_SRC := \
 NEORV32_CORE_SRC := \
   $(RTL_CORE_SRC)/neorv32_bootloader_image.vhd \
   $(RTL_CORE_SRC)/neorv32_boot_rom.vhd \
+  $(RTL_CORE_SRC)/neorv32_bus_arbiter.vhd \
   $(RTL_CORE_SRC)/neorv32_bus_keeper.vhd \
   $(RTL_CORE_SRC)/neorv32_busswitch.vhd \
   $(RTL_CORE_SRC)/neorv32_cfs.vhd \
+  $(RTL_CORE_SRC)/neorv32_clint.vhd \
   $(RTL_CORE_SRC)/neorv32_cpu.vhd \
   $(RTL_CORE_SRC)/neorv32_cpu_alu.vhd \
   $(RTL_CORE_SRC)/neorv32_cpu_bus.vhd \
@@ -26,9 +28,11 @@ NEORV32_CORE_SRC := \
   $(RTL_CORE_SRC)/neorv32_cpu_regfile.vhd \
   $(RTL_CORE_SRC)/neorv32_debug_dm.vhd \
   $(RTL_CORE_SRC)/neorv32_debug_dtm.vhd \
+  $(RTL_CORE_SRC)/neorv32_dma.vhd \
   $(RTL_CORE_SRC)/neorv32_fifo.vhd \
   $(RTL_CORE_SRC)/neorv32_gpio.vhd \
   $(RTL_CORE_SRC)/neorv32_icache.vhd \
+  $(RTL_CORE_SRC)/neorv32_memcpy.vhd \
   $(RTL_CORE_SRC)/neorv32_mtime.vhd \
   $(RTL_CORE_SRC)/neorv32_neoled.vhd \
   $(RTL_CORE_SRC)/neorv32_pwm.vhd \
@@ -36,6 +40,7 @@ NEORV32_CORE_SRC := \
   $(RTL_CORE_SRC)/neorv32_spi.vhd \
   $(RTL_CORE_SRC)/neorv32_sysinfo.vhd \
   $(RTL_CORE_SRC)/neorv32_top.vhd \
+  $(RTL_CORE_SRC)/neorv32_trace.vhd \
   $(RTL_CORE_SRC)/neorv32_trng.vhd \
   $(RTL_CORE_SRC)/neorv32_twi.vhd \
   $(RTL_CORE_SRC)/neorv32_uart.vhd \
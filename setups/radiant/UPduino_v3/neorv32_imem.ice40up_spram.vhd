@@ -49,17 +49,23 @@ entity neorv32_imem is
   generic (
     IMEM_BASE    : std_ulogic_vector(31 downto 0) := x"00000000"; -- memory base address
     IMEM_SIZE    : natural := 4*1024; -- processor-internal instruction memory size in bytes
-    IMEM_AS_IROM : boolean := false   -- implement IMEM as pre-initialized read-only memory?
+    IMEM_AS_IROM : boolean := false;  -- implement IMEM as pre-initialized read-only memory?
+    IMEM_TCM_EN  : boolean := false   -- second read port (TCM / bus crossbar) in use?
   );
   port (
-    clk_i  : in  std_ulogic; -- global clock line
-    rden_i : in  std_ulogic; -- read enable
-    wren_i : in  std_ulogic; -- write enable
-    ben_i  : in  std_ulogic_vector(03 downto 0); -- byte write enable
-    addr_i : in  std_ulogic_vector(31 downto 0); -- address
-    data_i : in  std_ulogic_vector(31 downto 0); -- data in
-    data_o : out std_ulogic_vector(31 downto 0); -- data out
-    ack_o  : out std_ulogic -- transfer acknowledge
+    clk_i      : in  std_ulogic; -- global clock line
+    -- processor bus --
+    rden_i     : in  std_ulogic; -- read enable
+    wren_i     : in  std_ulogic; -- write enable
+    ben_i      : in  std_ulogic_vector(03 downto 0); -- byte write enable
+    addr_i     : in  std_ulogic_vector(31 downto 0); -- address
+    data_i     : in  std_ulogic_vector(31 downto 0); -- data in
+    data_o     : out std_ulogic_vector(31 downto 0); -- data out
+    ack_o      : out std_ulogic; -- transfer acknowledge
+    -- tightly-coupled memory port (CPU instruction fetch, fixed latency of one cycle) --
+    tcm_re_i   : in  std_ulogic := '0'; -- read enable
+    tcm_addr_i : in  std_ulogic_vector(31 downto 0) := (others => '0'); -- address
+    tcm_data_o : out std_ulogic_vector(31 downto 0) -- data out
   );
 end neorv32_imem;
 
@@ -100,6 +106,9 @@ begin
   assert not (IMEM_SIZE > 64*1024) report "IMEM has a fixed physical size of 64kB. Logical size must be less or equal." severity error;
 
 
+  assert not (IMEM_TCM_EN = true) report "ICE40 Ultra Plus SPRAM is single-ported and does not provide a second (TCM/crossbar) port - disable <MEM_INT_TCM_EN> and <BUS_XBAR_EN>!" severity failure;
+
+
   -- Access Control -------------------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
   acc_en <= '1' when (addr_i(hi_abb_c downto lo_abb_c) = IMEM_BASE(hi_abb_c downto lo_abb_c)) else '0';
@@ -159,5 +168,8 @@ begin
   -- output gate --
   data_o <= rdata when (rden = '1') else (others => '0');
 
+  -- no tightly-coupled memory port --
+  tcm_data_o <= (others => '0');
+
 
 end neorv32_imem_rtl;
@@ -38,3 +38,30 @@ else
 fi
 
 cat neorv32.uart0.sim_mode.text.out | grep "CPU TEST COMPLETED SUCCESSFULLY!"
+
+# Run the CPU test again using a direct-mapped i-cache (default configuration of the processor top entity)
+echo "Re-running with direct-mapped i-cache (ICACHE_ASSOCIATIVITY = 1)..."
+rm -f neorv32.uart0.sim_mode.text.out
+touch neorv32.uart0.sim_mode.text.out
+chmod 777 neorv32.uart0.sim_mode.text.out
+
+if [ -n "$GHDL_DEVNULL" ]; then
+  $runcmd -gICACHE_ASSOCIATIVITY=1 >> /dev/null
+else
+  $runcmd -gICACHE_ASSOCIATIVITY=1
+fi
+
+cat neorv32.uart0.sim_mode.text.out | grep "CPU TEST COMPLETED SUCCESSFULLY!"
+
+echo "Re-running with tightly-coupled IMEM/DMEM ports (MEM_INT_TCM_EN = true)..."
+rm -f neorv32.uart0.sim_mode.text.out
+touch neorv32.uart0.sim_mode.text.out
+chmod 777 neorv32.uart0.sim_mode.text.out
+
+if [ -n "$GHDL_DEVNULL" ]; then
+  $runcmd -gMEM_INT_TCM_EN=true >> /dev/null
+else
+  $runcmd -gMEM_INT_TCM_EN=true
+fi
+
+cat neorv32.uart0.sim_mode.text.out | grep "CPU TEST COMPLETED SUCCESSFULLY!"
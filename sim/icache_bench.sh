@@ -0,0 +1,64 @@
+#!/usr/bin/env bash
+
+# Instruction cache configuration sweep: CoreMark is compiled for simulation (UART0 simulation mode) and executed
+# from the simulated external IMEM (ext. mem A) using all i-cache associativity / replacement policy combinations.
+# The next-line prefetcher is disabled so the results only reflect the cache organization itself.
+# The i-cache access and miss counts (HPM counters) are extracted from the simulation output to compute the miss rate.
+#
+# Usage: ./icache_bench.sh [ghdl runtime args, default: --stop-time=200ms]
+
+# Abort if any command returns != 0
+set -e
+
+cd $(dirname "$0")
+
+GHDL="${GHDL:-ghdl}"
+GHDL_RUN_ARGS="${@:---stop-time=200ms}"
+
+# Compile CoreMark and generate the application image (use only a single iteration to keep simulation time short)
+make -C ../sw/example/coremark clean_all
+make -C ../sw/example/coremark USER_FLAGS+="-DUART0_SIM_MODE -DITERATIONS=1" MARCH=-march=rv32imc install
+
+./ghdl.setup.sh
+$GHDL -m --work=neorv32 --workdir=build neorv32_tb_simple
+
+results=""
+
+for assoc in 1 2 4 8; do
+  for repl in 0 1; do
+    # replacement policy is irrelevant for direct-mapped caches
+    if [ $assoc -eq 1 ] && [ $repl -eq 1 ]; then
+      continue
+    fi
+
+    echo "Simulating i-cache: associativity = $assoc, replacement = $repl ..."
+    rm -f neorv32.uart0.sim_mode.text.out
+    touch neorv32.uart0.sim_mode.text.out
+    chmod 777 neorv32.uart0.sim_mode.text.out
+
+    $GHDL -r --work=neorv32 --workdir=build neorv32_tb_simple \
+      --max-stack-alloc=0 \
+      --ieee-asserts=disable \
+      --assert-level=error \
+      -gEXT_IMEM_C=true \
+      -gMEM_INT_IMEM_SIZE=32768 \
+      -gICACHE_ASSOCIATIVITY=$assoc \
+      -gICACHE_REPLACEMENT=$repl \
+      -gICACHE_PREFETCH_EN=false \
+      $GHDL_RUN_ARGS >> /dev/null
+
+    acc=$(grep "# I-cache accesses:" neorv32.uart0.sim_mode.text.out | awk '{print $NF}')
+    miss=$(grep "# I-cache misses:" neorv32.uart0.sim_mode.text.out | awk '{print $NF}')
+    if [ -z "$acc" ] || [ -z "$miss" ]; then
+      echo "No HPM results found! Try increasing the simulation time."
+      exit 1
+    fi
+    rate=$(awk -v m="$miss" -v a="$acc" 'BEGIN { if (a > 0) printf "%.3f", 100.0*m/a; else print "n/a" }')
+    results="$results$(printf '%-5s | %-11s | %12s | %10s | %8s %%' $assoc $repl $acc $miss $rate)\n"
+  done
+done
+
+echo ""
+echo "assoc | replacement | accesses     | misses     | miss rate"
+echo "------+-------------+--------------+------------+-----------"
+printf "$results"
@@ -48,17 +48,23 @@ entity neorv32_imem is
   generic (
     IMEM_BASE    : std_ulogic_vector(31 downto 0) := x"00000000"; -- memory base address
     IMEM_SIZE    : natural := 4*1024; -- processor-internal instruction memory size in bytes
-    IMEM_AS_IROM : boolean := true   -- implement IMEM as pre-initialized read-only memory?
+    IMEM_AS_IROM : boolean := true;  -- implement IMEM as pre-initialized read-only memory?
+    IMEM_TCM_EN  : boolean := false  -- second read port (TCM / bus crossbar) in use?
   );
   port (
-    clk_i  : in  std_ulogic; -- global clock line
-    rden_i : in  std_ulogic; -- read enable
-    wren_i : in  std_ulogic; -- write enable
-    ben_i  : in  std_ulogic_vector(03 downto 0); -- byte write enable
-    addr_i : in  std_ulogic_vector(31 downto 0); -- address
-    data_i : in  std_ulogic_vector(31 downto 0); -- data in
-    data_o : out std_ulogic_vector(31 downto 0); -- data out
-    ack_o  : out std_ulogic  -- transfer acknowledge
+    clk_i      : in  std_ulogic; -- global clock line
+    -- processor bus --
+    rden_i     : in  std_ulogic; -- read enable
+    wren_i     : in  std_ulogic; -- write enable
+    ben_i      : in  std_ulogic_vector(03 downto 0); -- byte write enable
+    addr_i     : in  std_ulogic_vector(31 downto 0); -- address
+    data_i     : in  std_ulogic_vector(31 downto 0); -- data in
+    data_o     : out std_ulogic_vector(31 downto 0); -- data out
+    ack_o      : out std_ulogic; -- transfer acknowledge
+    -- tightly-coupled memory port (CPU instruction fetch, fixed latency of one cycle) --
+    tcm_re_i   : in  std_ulogic := '0'; -- read enable
+    tcm_addr_i : in  std_ulogic_vector(31 downto 0) := (others => '0'); -- address
+    tcm_data_o : out std_ulogic_vector(31 downto 0) -- data out
   );
 end neorv32_imem;
 
@@ -74,6 +80,10 @@ architecture neorv32_imem_rtl of neorv32_imem is
   signal rden   : std_ulogic;
   signal addr   : std_ulogic_vector(index_size_f(IMEM_SIZE/4)-1 downto 0);
 
+  -- tightly-coupled memory port --
+  signal tcm_addr  : std_ulogic_vector(index_size_f(IMEM_SIZE/4)-1 downto 0);
+  signal tcm_rdata : std_ulogic_vector(31 downto 0);
+
 begin
 
   -- Sanity Checks --------------------------------------------------------------------------
@@ -86,6 +96,9 @@ begin
   acc_en <= '1' when (addr_i(hi_abb_c downto lo_abb_c) = IMEM_BASE(hi_abb_c downto lo_abb_c)) else '0';
   addr   <= addr_i(index_size_f(IMEM_SIZE/4)+1 downto 2); -- word aligned
 
+  -- the CPU's TCM port is already decoded by the CPU itself --
+  tcm_addr <= tcm_addr_i(index_size_f(IMEM_SIZE/4)+1 downto 2); -- word aligned
+
 
   -- Memory Access --------------------------------------------------------------------------
   -- -------------------------------------------------------------------------------------------
@@ -106,8 +119,27 @@ begin
     end if;
   end process imem_file_access;
 
+  -- tightly-coupled memory port (second read port) --
+  imem_file_tcm_access: process(clk_i)
+    variable addr_v : integer;
+  begin
+    if rising_edge(clk_i) then
+      if (tcm_re_i = '1') then
+        addr_v := to_integer(unsigned(tcm_addr));
+        if (addr_v > application_init_image'length) then
+          tcm_rdata <= (others => '0');
+        else
+          tcm_rdata <= application_init_image(addr_v);
+        end if;
+      end if;
+    end if;
+  end process imem_file_tcm_access;
+
   -- output gate --
   data_o <= rdata when (rden = '1') else (others => '0');
 
+  -- TCM port: no output gate, the CPU only samples the data when it has issued a TCM request --
+  tcm_data_o <= tcm_rdata;
+
 
 end neorv32_imem_rtl;
@@ -56,7 +56,11 @@ entity neorv32_tb_simple is
     CPU_EXTENSION_RISCV_Zicsr    : boolean := true;
     CPU_EXTENSION_RISCV_Zifencei : boolean := true;
     EXT_IMEM_C                   : boolean := false;   -- false: use and boot from proc-internal IMEM, true: use and boot from external (initialized) simulated IMEM (ext. mem A)
-    MEM_INT_IMEM_SIZE            : natural := 16*1024  -- size in bytes of processor-internal IMEM / external mem A
+    MEM_INT_IMEM_SIZE            : natural := 16*1024; -- size in bytes of processor-internal IMEM / external mem A
+    MEM_INT_TCM_EN               : boolean := false;   -- connect processor-internal IMEM/DMEM directly to the CPU (TCM ports)
+    ICACHE_ASSOCIATIVITY         : natural := 2;       -- i-cache: associativity / number of sets (1=direct_mapped), has to be a power of 2
+    ICACHE_REPLACEMENT           : natural := 0;       -- i-cache: replacement policy: 0 = (pseudo-)LRU, 1 = random
+    ICACHE_PREFETCH_EN           : boolean := true     -- i-cache: implement next-line prefetcher
   );
 end neorv32_tb_simple;
 
@@ -192,7 +196,7 @@ begin
     PMP_NUM_REGIONS              => 5,             -- number of regions (0..64)
     PMP_MIN_GRANULARITY          => 64*1024,       -- minimal region granularity in bytes, has to be a power of 2, min 8 bytes
     -- Hardware Performance Monitors (HPM) --
-    HPM_NUM_CNTS                 => 12,            -- number of implemented HPM counters (0..29)
+    HPM_NUM_CNTS                 => 16,            -- number of implemented HPM counters (0..29)
     HPM_CNT_WIDTH                => 40,            -- total size of HPM counters (0..64)
     -- Internal Instruction memory --
     MEM_INT_IMEM_EN              => int_imem_c ,   -- implement processor-internal instruction memory
@@ -200,11 +204,15 @@ begin
     -- Internal Data memory --
     MEM_INT_DMEM_EN              => int_dmem_c,    -- implement processor-internal data memory
     MEM_INT_DMEM_SIZE            => dmem_size_c,   -- size of processor-internal data memory in bytes
+    -- Tightly-coupled memory ports --
+    MEM_INT_TCM_EN               => MEM_INT_TCM_EN, -- connect internal IMEM/DMEM directly to the CPU's fetch/load-store paths
     -- Internal Cache memory --
     ICACHE_EN                    => true,          -- implement instruction cache
     ICACHE_NUM_BLOCKS            => 8,             -- i-cache: number of blocks (min 2), has to be a power of 2
     ICACHE_BLOCK_SIZE            => 64,            -- i-cache: block size in bytes (min 4), has to be a power of 2
-    ICACHE_ASSOCIATIVITY         => 2,             -- i-cache: associativity / number of sets (1=direct_mapped), has to be a power of 2
+    ICACHE_ASSOCIATIVITY         => ICACHE_ASSOCIATIVITY, -- i-cache: associativity / number of sets (1=direct_mapped), has to be a power of 2
+    ICACHE_REPLACEMENT           => ICACHE_REPLACEMENT, -- i-cache: replacement policy: 0 = (pseudo-)LRU, 1 = random
+    ICACHE_PREFETCH_EN           => ICACHE_PREFETCH_EN, -- i-cache: implement next-line prefetcher
     -- External memory interface --
     MEM_EXT_EN                   => true,          -- implement external memory bus interface?
     MEM_EXT_TIMEOUT              => 255,           -- cycles after a pending bus access auto-terminates (0 = disabled)
@@ -222,8 +230,14 @@ begin
     IO_MTIME_EN                  => true,          -- implement machine system timer (MTIME)?
     IO_UART0_EN                  => true,          -- implement primary universal asynchronous receiver/transmitter (UART0)?
     IO_UART1_EN                  => true,          -- implement secondary universal asynchronous receiver/transmitter (UART1)?
+    UART0_RX_FIFO                => 1,             -- UART0 RX fifo depth, has to be a power of two, min 1
+    UART0_TX_FIFO                => 1,             -- UART0 TX fifo depth, has to be a power of two, min 1
+    UART1_RX_FIFO                => 1,             -- UART1 RX fifo depth, has to be a power of two, min 1
+    UART1_TX_FIFO                => 1,             -- UART1 TX fifo depth, has to be a power of two, min 1
     IO_SPI_EN                    => true,          -- implement serial peripheral interface (SPI)?
+    SPI_FIFO                     => 1,             -- SPI TX/RX fifo depth, has to be a power of two, min 1
     IO_TWI_EN                    => true,          -- implement two-wire interface (TWI)?
+    TWI_FIFO                     => 1,             -- TWI command/RX fifo depth, has to be a power of two, min 1
     IO_PWM_NUM_CH                => 30,            -- number of PWM channels to implement (0..60); 0 = disabled
     IO_WDT_EN                    => true,          -- implement watch dog timer (WDT)?
     IO_TRNG_EN                   => false,         -- trng cannot be simulated
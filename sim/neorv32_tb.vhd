@@ -283,6 +283,7 @@ begin
     INT_BOOTLOADER_EN            => false,         -- boot configuration: true = boot explicit bootloader; false = boot from int/ext (I)MEM
     -- On-Chip Debugger (OCD) --
     ON_CHIP_DEBUGGER_EN          => true,          -- implement on-chip debugger
+    ON_CHIP_DEBUGGER_SBA_EN      => true,          -- implement system bus access (SBA) master and abstract memory access in debug module
     -- RISC-V CPU Extensions --
     CPU_EXTENSION_RISCV_A        => true,          -- implement atomic extension?
     CPU_EXTENSION_RISCV_C        => true,          -- implement compressed extension?
@@ -313,6 +314,8 @@ begin
     ICACHE_NUM_BLOCKS            => 8,             -- i-cache: number of blocks (min 2), has to be a power of 2
     ICACHE_BLOCK_SIZE            => 64,            -- i-cache: block size in bytes (min 4), has to be a power of 2
     ICACHE_ASSOCIATIVITY         => 2,             -- i-cache: associativity / number of sets (1=direct_mapped), has to be a power of 2
+    ICACHE_REPLACEMENT           => 0,             -- i-cache: replacement policy: 0 = (pseudo-)LRU, 1 = random
+    ICACHE_PREFETCH_EN           => true,          -- i-cache: implement next-line prefetcher
     -- External memory interface --
     MEM_EXT_EN                   => true,          -- implement external memory bus interface?
     MEM_EXT_TIMEOUT              => 255,           -- cycles after a pending bus access auto-terminates (0 = disabled)
@@ -330,8 +333,14 @@ begin
     IO_MTIME_EN                  => true,          -- implement machine system timer (MTIME)?
     IO_UART0_EN                  => true,          -- implement primary universal asynchronous receiver/transmitter (UART0)?
     IO_UART1_EN                  => true,          -- implement secondary universal asynchronous receiver/transmitter (UART1)?
+    UART0_RX_FIFO                => 1,             -- UART0 RX fifo depth, has to be a power of two, min 1
+    UART0_TX_FIFO                => 1,             -- UART0 TX fifo depth, has to be a power of two, min 1
+    UART1_RX_FIFO                => 1,             -- UART1 RX fifo depth, has to be a power of two, min 1
+    UART1_TX_FIFO                => 1,             -- UART1 TX fifo depth, has to be a power of two, min 1
     IO_SPI_EN                    => true,          -- implement serial peripheral interface (SPI)?
+    SPI_FIFO                     => 1,             -- SPI TX/RX fifo depth, has to be a power of two, min 1
     IO_TWI_EN                    => true,          -- implement two-wire interface (TWI)?
+    TWI_FIFO                     => 1,             -- TWI command/RX fifo depth, has to be a power of two, min 1
     IO_PWM_NUM_CH                => 30,            -- number of PWM channels to implement (0..60); 0 = disabled
     IO_WDT_EN                    => true,          -- implement watch dog timer (WDT)?
     IO_TRNG_EN                   => false,         -- trng cannot be simulated
@@ -112,6 +112,11 @@
 #ifndef SPI_BOOT_BASE_ADDR
   #define SPI_BOOT_BASE_ADDR 0x08000000
 #endif
+
+/** Set to 1 to use the "fast read" command (with 8 dummy cycles) for loading the executable from SPI flash */
+#ifndef SPI_FLASH_FAST_READ
+  #define SPI_FLASH_FAST_READ 0
+#endif
 /**@}*/
 
 
@@ -120,7 +125,8 @@
  **************************************************************************/
 enum EXE_STREAM_SOURCE {
   EXE_STREAM_UART  = 0, /**< Get executable via UART */
-  EXE_STREAM_FLASH = 1  /**< Get executable via SPI flash */
+  EXE_STREAM_FLASH = 1, /**< Get executable via SPI flash */
+  EXE_STREAM_BLOCK = 2  /**< Get executable via UART using the block upload protocol */
 };
 
 
@@ -131,7 +137,8 @@ enum ERROR_CODES {
   ERROR_SIGNATURE = 0, /**< 0: Wrong signature in executable */
   ERROR_SIZE      = 1, /**< 1: Insufficient instruction memory capacity */
   ERROR_CHECKSUM  = 2, /**< 2: Checksum error in executable */
-  ERROR_FLASH     = 3  /**< 3: SPI flash access error */
+  ERROR_FLASH     = 3, /**< 3: SPI flash access error */
+  ERROR_EXE       = 4  /**< 4: Corrupted (compressed) executable */
 };
 
 
@@ -141,6 +148,7 @@ enum ERROR_CODES {
 enum SPI_FLASH_CMD {
   SPI_FLASH_CMD_PAGE_PROGRAM = 0x02, /**< Program page */
   SPI_FLASH_CMD_READ         = 0x03, /**< Read data */
+  SPI_FLASH_CMD_FAST_READ    = 0x0B, /**< Read data (fast, with dummy cycles) */
   SPI_FLASH_CMD_READ_STATUS  = 0x05, /**< Get status register */
   SPI_FLASH_CMD_WRITE_ENABLE = 0x06, /**< Allow write access */
   SPI_FLASH_CMD_READ_ID      = 0x9E, /**< Read manufacturer ID */
@@ -148,6 +156,22 @@ enum SPI_FLASH_CMD {
 };
 
 
+/**********************************************************************//**
+ * Block upload protocol (UART): frame types and responses
+ **************************************************************************/
+enum BLOCK_UPLOAD_PROTOCOL {
+  BLOCK_CMD_DATA = 0x01, /**< Data block: CMD, SEQ, LEN[7:0], LEN[15:8], LEN x data byte, CRC32 (little-endian) over SEQ..data */
+  BLOCK_CMD_BAUD = 0x02, /**< Switch baud rate: CMD, 4-byte baud rate, CRC32 over baud rate (both little-endian) */
+  BLOCK_CMD_END  = 0x04, /**< End of upload: responded by ACK if executable is valid, NAK otherwise */
+  BLOCK_RSP_ACK  = 0x06, /**< Frame accepted */
+  BLOCK_RSP_NAK  = 0x15, /**< Frame rejected, resend */
+  BLOCK_CMD_SYNC = 0x16  /**< Sync request: always responded by ACK */
+};
+
+/** Block upload protocol: max. payload size of a data block in bytes (the block buffer and the stack have to fit into the bootloader's 512 bytes of RAM) */
+#define BLOCK_MAX_SIZE 64
+
+
 /**********************************************************************//**
  * NEORV32 executable
  **************************************************************************/
@@ -160,9 +184,14 @@ enum NEORV32_EXECUTABLE {
 
 
 /**********************************************************************//**
- * Valid executable identification signature.
+ * Valid executable identification signatures.
  **************************************************************************/
-#define EXE_SIGNATURE 0x4788CAFE
+/**@{*/
+/** Raw executable */
+#define EXE_SIGNATURE    0x4788CAFE
+/** LZSS-compressed executable */
+#define EXE_SIGNATURE_LZ 0x4788CAFF
+/**@}*/
 
 
 /**********************************************************************//**
@@ -201,18 +230,44 @@ volatile uint32_t exe_available = 0;
 volatile uint32_t getting_exe = 0;
 
 
+#if (UART_EN != 0)
+/**********************************************************************//**
+ * Block upload protocol state.
+ **************************************************************************/
+struct {
+  uint8_t  buf[BLOCK_MAX_SIZE]; /**< current data block */
+  uint32_t len;                 /**< size of current data block */
+  uint32_t pos;                 /**< read position in current data block */
+  uint8_t  seq;                 /**< expected sequence number of next data block */
+  uint8_t  ack;                 /**< current data block not acknowledged yet */
+} block_upload;
+#endif
+
+
 // Function prototypes
 void __attribute__((__interrupt__)) bootloader_trap_handler(void);
 void print_help(void);
 void start_app(void);
 void get_exe(int src);
 void save_exe(void);
-uint32_t get_exe_word(int src, uint32_t addr);
+uint32_t get_exe_word(int src);
+void get_exe_lz(int src, uint8_t *dst, uint32_t size);
+uint32_t get_exe_lz_byte(int src, uint32_t *buf, uint32_t *cnt);
 void system_error(uint8_t err_code);
 void print_hex_word(uint32_t num);
 
+// UART block upload protocol functions
+uint8_t block_get_byte(void);
+void block_get_frame(void);
+void block_finish(int valid);
+int block_getc_timeout(uint8_t *c);
+uint32_t block_crc32(uint32_t crc, uint8_t d);
+
 // SPI flash driver functions
-uint8_t spi_flash_read_byte(uint32_t addr);
+void spi_flash_read_start(uint32_t addr);
+void spi_flash_read_stop(void);
+uint32_t spi_flash_read_word(void);
+uint32_t spi_flash_read_burst(uint32_t *dst, uint32_t num);
 void spi_flash_write_byte(uint32_t addr, uint8_t wdata);
 void spi_flash_write_word(uint32_t addr, uint32_t wdata);
 void spi_flash_erase_sector(uint32_t addr);
@@ -381,6 +436,11 @@ int main(void) {
     else if (c == 'u') { // get executable via UART
       get_exe(EXE_STREAM_UART);
     }
+#if (UART_EN != 0)
+    else if (c == 'x') { // get executable via UART (block upload protocol)
+      get_exe(EXE_STREAM_BLOCK);
+    }
+#endif
     else if (c == 's') { // program flash from memory (IMEM)
       save_exe();
     }
@@ -413,6 +473,7 @@ void print_help(void) {
                      " h: Help\n"
                      " r: Restart\n"
                      " u: Upload\n"
+                     " x: Upload (block protocol)\n"
                      " s: Store to flash\n"
                      " l: Load from flash\n"
                      " e: Execute");
@@ -503,37 +564,70 @@ void get_exe(int src) {
   if (src == EXE_STREAM_UART) {
     PRINT_TEXT("Awaiting neorv32_exe.bin... ");
   }
+#if (UART_EN != 0)
+  else if (src == EXE_STREAM_BLOCK) {
+    PRINT_TEXT("Awaiting block upload... ");
+    block_upload.len = 0;
+    block_upload.pos = 0;
+    block_upload.seq = 0;
+    block_upload.ack = 0;
+  }
+#endif
   else {
     PRINT_TEXT("Loading... ");
 
     // flash checks
-    if ((neorv32_spi_available() == 0) ||    // check if SPI is available at all
-        (spi_flash_read_1st_id() == 0x00)) { // check if flash ready (or available at all)
+    if (neorv32_spi_available() == 0) { // check if SPI is available at all
       system_error(ERROR_FLASH);
     }
+    neorv32_spi_setup(SPI_FLASH_CLK_PRSC, 0, 0); // might not be configured yet (auto-boot)
+    if (spi_flash_read_1st_id() == 0x00) { // check if flash ready (or available at all)
+      system_error(ERROR_FLASH);
+    }
+
+    // read the whole image using a single (streaming) read command
+    spi_flash_read_start(addr);
   }
 
   // check if valid image
-  uint32_t signature = get_exe_word(src, addr + EXE_OFFSET_SIGNATURE);
-  if (signature != EXE_SIGNATURE) { // signature
+  uint32_t signature = get_exe_word(src);
+  if ((signature != EXE_SIGNATURE) && (signature != EXE_SIGNATURE_LZ)) { // signature
     system_error(ERROR_SIGNATURE);
   }
 
   // image size and checksum
-  uint32_t size  = get_exe_word(src, addr + EXE_OFFSET_SIZE); // size in bytes
-  uint32_t check = get_exe_word(src, addr + EXE_OFFSET_CHECKSUM); // complement sum checksum
+  uint32_t size  = get_exe_word(src); // size in bytes
+  uint32_t check = get_exe_word(src); // complement sum checksum
 
   // transfer program data
   uint32_t *pnt = (uint32_t*)SYSINFO_ISPACE_BASE;
   uint32_t checksum = 0;
   uint32_t d = 0, i = 0;
-  addr = addr + EXE_OFFSET_DATA;
-  while (i < (size/4)) { // in words
-    d = get_exe_word(src, addr);
-    checksum += d;
-    pnt[i++] = d;
-    addr += 4;
+  if (signature == EXE_SIGNATURE_LZ) {
+    get_exe_lz(src, (uint8_t*)pnt, size); // decompress while receiving
+    while (i < (size/4)) { // in words
+      checksum += pnt[i++];
+    }
+  }
+  else if (src != EXE_STREAM_FLASH) {
+    while (i < (size/4)) { // in words
+      d = get_exe_word(src);
+      checksum += d;
+      pnt[i++] = d;
+    }
+  }
+  else {
+    checksum = spi_flash_read_burst(pnt, size/4);
+  }
+
+  if (src == EXE_STREAM_FLASH) {
+    spi_flash_read_stop();
+  }
+#if (UART_EN != 0)
+  else if (src == EXE_STREAM_BLOCK) {
+    block_finish((checksum + check) == 0); // report result to uploader
   }
+#endif
 
   // error during transfer?
   if ((checksum + check) != 0) {
@@ -619,33 +713,116 @@ void save_exe(void) {
 
 
 /**********************************************************************//**
- * Get word from executable stream
+ * Get next word from executable stream
+ *
+ * @note The SPI flash stream has to be opened via spi_flash_read_start() before.
  *
  * @param src Source of executable stream data. See #EXE_STREAM_SOURCE.
- * @param addr Address when accessing SPI flash.
  * @return 32-bit data word from stream.
  **************************************************************************/
-uint32_t get_exe_word(int src, uint32_t addr) {
+uint32_t get_exe_word(int src) {
 
   union {
     uint32_t uint32;
     uint8_t  uint8[sizeof(uint32_t)];
   } data;
 
-  uint32_t i;
-  for (i=0; i<4; i++) {
-    if (src == EXE_STREAM_UART) {
+  if (src == EXE_STREAM_UART) {
+    uint32_t i;
+    for (i=0; i<4; i++) {
       data.uint8[i] = (uint8_t)PRINT_GETC();
     }
-    else {
-      data.uint8[i] = spi_flash_read_byte(addr + i);
+  }
+#if (UART_EN != 0)
+  else if (src == EXE_STREAM_BLOCK) {
+    uint32_t i;
+    for (i=0; i<4; i++) {
+      data.uint8[i] = block_get_byte();
     }
   }
+#endif
+  else {
+    data.uint32 = spi_flash_read_word();
+  }
 
   return data.uint32;
 }
 
 
+/**********************************************************************//**
+ * Get LZSS-compressed executable from stream and decompress it on the fly. Already
+ * decompressed data is used as dictionary, so no additional buffer is required.
+ *
+ * @note Stream format: a flag byte precedes each group of 8 items (LSB first). Flag = 1:
+ * literal byte. Flag = 0: 2-byte match {offset[7:0]}, {offset[11:8], length[3:0]}
+ * (offset = distance - 1, length = match length - 3); if the length field is 15 an
+ * extension byte follows that is added to the match length.
+ *
+ * @param src Source of executable stream data. See #EXE_STREAM_SOURCE.
+ * @param[in,out] dst Destination pointer.
+ * @param size Size of the decompressed executable in bytes.
+ **************************************************************************/
+void get_exe_lz(int src, uint8_t *dst, uint32_t size) {
+
+  uint32_t buf = 0, cnt = 0; // stream is fetched word-wise
+  uint32_t flags = 1; // only sentinel bit left: fetch new flag byte
+  uint32_t out = 0, off = 0, len = 0;
+
+  while (out < size) {
+
+    if (flags == 1) {
+      flags = get_exe_lz_byte(src, &buf, &cnt) | 0x100;
+    }
+
+    if (flags & 1) { // literal
+      dst[out++] = (uint8_t)get_exe_lz_byte(src, &buf, &cnt);
+    }
+    else { // match: copy from already decompressed data
+      off = get_exe_lz_byte(src, &buf, &cnt);
+      len = get_exe_lz_byte(src, &buf, &cnt);
+      off = (off | ((len & 0xf0) << 4)) + 1;
+      len = (len & 0x0f) + 3;
+      if (len == 18) { // length extension
+        len += get_exe_lz_byte(src, &buf, &cnt);
+      }
+      if ((off == 0) || (off > out)) { // reference before start of image: corrupted stream
+        system_error(ERROR_EXE);
+      }
+      while ((len != 0) && (out < size)) {
+        dst[out] = dst[out - off];
+        out++;
+        len--;
+      }
+    }
+
+    flags = flags >> 1;
+  }
+}
+
+
+/**********************************************************************//**
+ * Get next byte from (word-wise fetched) compressed executable stream.
+ *
+ * @param src Source of executable stream data. See #EXE_STREAM_SOURCE.
+ * @param[in,out] buf Stream word buffer.
+ * @param[in,out] cnt Number of bytes left in stream word buffer.
+ * @return Next byte from stream.
+ **************************************************************************/
+uint32_t get_exe_lz_byte(int src, uint32_t *buf, uint32_t *cnt) {
+
+  if (*cnt == 0) {
+    *buf = get_exe_word(src);
+    *cnt = 4;
+  }
+
+  uint32_t b = *buf & 0xff;
+  *buf = *buf >> 8;
+  *cnt = *cnt - 1;
+
+  return b;
+}
+
+
 /**********************************************************************//**
  * Output system error ID and stall.
  *
@@ -689,27 +866,300 @@ void print_hex_word(uint32_t num) {
 
 
 
+// -------------------------------------------------------------------------------------
+// UART block upload protocol functions
+// -------------------------------------------------------------------------------------
+#if (UART_EN != 0)
+
+/**********************************************************************//**
+ * Get next byte from block upload stream. A data block is acknowledged
+ * when it has been processed completely and the next one is requested
+ * (flow control: the uploader waits for the ACK before sending the next block).
+ *
+ * @return Next byte from stream.
+ **************************************************************************/
+uint8_t block_get_byte(void) {
+
+  while (block_upload.pos >= block_upload.len) { // current block processed
+    if (block_upload.ack) {
+      neorv32_uart0_putc(BLOCK_RSP_ACK);
+      block_upload.ack = 0;
+    }
+    block_get_frame();
+  }
+
+  return block_upload.buf[block_upload.pos++];
+}
+
+
+/**********************************************************************//**
+ * Receive frames until a new valid data block is available.
+ * Bad/incomplete blocks are rejected (NAK) so the uploader sends them again.
+ **************************************************************************/
+void block_get_frame(void) {
+
+  uint8_t c = 0, seq = 0;
+  uint32_t crc = 0, len = 0, i = 0, tmp = 0, rx_crc = 0;
+
+  while (1) {
+
+    c = (uint8_t)neorv32_uart0_getc(); // wait for start of frame
+
+    // sync request
+    if (c == BLOCK_CMD_SYNC) {
+      neorv32_uart0_putc(BLOCK_RSP_ACK);
+    }
+
+    // switch baud rate
+    else if (c == BLOCK_CMD_BAUD) {
+      crc = 0xffffffff;
+      tmp = 0;
+      for (i=0; i<4; i++) {
+        if (block_getc_timeout(&c)) {
+          break;
+        }
+        crc = block_crc32(crc, c);
+        tmp |= ((uint32_t)c) << (i*8);
+      }
+      rx_crc = 0;
+      for (i=0; (i<4) && (block_getc_timeout(&c) == 0); i++) {
+        rx_crc |= ((uint32_t)c) << (i*8);
+      }
+      if ((i == 4) && (rx_crc == ~crc) && (tmp != 0)) { // CRC OK
+        neorv32_uart0_putc(BLOCK_RSP_ACK);
+        while (neorv32_uart0_tx_busy()); // wait for ACK to be sent
+        neorv32_uart0_setup(tmp, PARITY_NONE, FLOW_CONTROL_NONE);
+      }
+      else {
+        neorv32_uart0_putc(BLOCK_RSP_NAK);
+      }
+    }
+
+    // data block
+    else if (c == BLOCK_CMD_DATA) {
+      crc = 0xffffffff;
+      for (i=0; i<3; i++) { // header: sequence number and block length
+        if (block_getc_timeout(&c)) {
+          break;
+        }
+        crc = block_crc32(crc, c);
+        if (i == 0) {
+          seq = c;
+        }
+        else if (i == 1) {
+          len = (uint32_t)c;
+        }
+        else {
+          len |= ((uint32_t)c) << 8;
+        }
+      }
+      if ((i != 3) || (len == 0) || (len > BLOCK_MAX_SIZE)) {
+        neorv32_uart0_putc(BLOCK_RSP_NAK);
+        continue;
+      }
+      rx_crc = 0;
+      for (i=0; i<(len+4); i++) { // payload and CRC
+        if (block_getc_timeout(&c)) {
+          break;
+        }
+        if (i < len) {
+          block_upload.buf[i] = c;
+          crc = block_crc32(crc, c);
+        }
+        else {
+          rx_crc |= ((uint32_t)c) << ((i-len)*8);
+        }
+      }
+      if ((i != (len+4)) || (rx_crc != ~crc)) { // timeout or CRC error
+        neorv32_uart0_putc(BLOCK_RSP_NAK);
+      }
+      else if (seq == block_upload.seq) { // new block
+        block_upload.len = len;
+        block_upload.pos = 0;
+        block_upload.seq++;
+        block_upload.ack = 1; // acknowledge when processed
+        return;
+      }
+      else if (seq == (uint8_t)(block_upload.seq - 1)) { // repeated block (ACK got lost)
+        neorv32_uart0_putc(BLOCK_RSP_ACK);
+      }
+      else {
+        neorv32_uart0_putc(BLOCK_RSP_NAK);
+      }
+    }
+
+    // premature end of upload
+    else if (c == BLOCK_CMD_END) {
+      neorv32_uart0_putc(BLOCK_RSP_NAK);
+    }
+  }
+}
+
+
+/**********************************************************************//**
+ * Finish block upload: acknowledge last data block, wait for end frame and
+ * respond with upload status. The UART is set back to default baud rate afterwards.
+ *
+ * @param valid Executable is valid (checksum OK) when not zero.
+ **************************************************************************/
+void block_finish(int valid) {
+
+  if (block_upload.ack) {
+    neorv32_uart0_putc(BLOCK_RSP_ACK);
+    block_upload.ack = 0;
+  }
+
+  while (1) {
+    uint8_t c = (uint8_t)neorv32_uart0_getc();
+    if (c == BLOCK_CMD_SYNC) {
+      neorv32_uart0_putc(BLOCK_RSP_ACK);
+    }
+    else if (c == BLOCK_CMD_END) {
+      if (valid) {
+        neorv32_uart0_putc(BLOCK_RSP_ACK);
+      }
+      else {
+        neorv32_uart0_putc(BLOCK_RSP_NAK);
+      }
+      break;
+    }
+  }
+
+  while (neorv32_uart0_tx_busy());
+  neorv32_uart0_setup(UART_BAUD, PARITY_NONE, FLOW_CONTROL_NONE);
+}
+
+
+/**********************************************************************//**
+ * Get char from UART0 with timeout (roughly 1/8s..1s depending on clock speed).
+ *
+ * @param[in,out] c Received char.
+ * @return 0 if char received, 1 if timeout.
+ **************************************************************************/
+int block_getc_timeout(uint8_t *c) {
+
+  uint32_t timeout = SYSINFO_CLK >> 4;
+
+  while (timeout--) {
+    if (neorv32_uart0_char_received()) {
+      *c = (uint8_t)neorv32_uart0_char_received_get();
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+
+/**********************************************************************//**
+ * Update CRC32 (IEEE 802.3, reflected, polynomial 0xEDB88320) with one data byte.
+ * Uses a 16-entry table (two table lookups per byte).
+ *
+ * @param crc Current CRC value (start with 0xffffffff).
+ * @param d Data byte.
+ * @return Updated CRC value.
+ **************************************************************************/
+uint32_t block_crc32(uint32_t crc, uint8_t d) {
+
+  static const uint32_t crc_table[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+  };
+
+  crc = crc ^ (uint32_t)d;
+  crc = (crc >> 4) ^ crc_table[crc & 0x0f];
+  crc = (crc >> 4) ^ crc_table[crc & 0x0f];
+
+  return crc;
+}
+
+#endif // UART_EN
+
+
 // -------------------------------------------------------------------------------------
 // SPI flash driver functions
 // -------------------------------------------------------------------------------------
 
 /**********************************************************************//**
- * Read byte from SPI flash.
+ * Start streaming read from SPI flash. Sends the read command and the start address
+ * and switches the SPI module to 32-bit transfers. The flash keeps on sending
+ * consecutive data as long as the chip select stays asserted.
  *
- * @param[in] addr Flash read address.
- * @return Read byte from SPI flash.
+ * @param[in] addr Flash read start address.
  **************************************************************************/
-uint8_t spi_flash_read_byte(uint32_t addr) {
+void spi_flash_read_start(uint32_t addr) {
 
   neorv32_spi_cs_en(SPI_FLASH_CS);
 
+#if (SPI_FLASH_FAST_READ != 0)
+  neorv32_spi_trans(SPI_FLASH_CMD_FAST_READ);
+  spi_flash_write_addr(addr);
+  neorv32_spi_trans(0); // 8 dummy cycles
+#else
   neorv32_spi_trans(SPI_FLASH_CMD_READ);
   spi_flash_write_addr(addr);
-  uint8_t rdata = (uint8_t)neorv32_spi_trans(0);
+#endif
+
+  SPI_CT |= (uint32_t)(3 << SPI_CT_SIZE0); // 32-bit transfers
+}
+
+
+/**********************************************************************//**
+ * Stop streaming read from SPI flash (deassert chip select, back to 8-bit transfers).
+ **************************************************************************/
+void spi_flash_read_stop(void) {
 
   neorv32_spi_cs_dis(SPI_FLASH_CS);
+  SPI_CT &= ~((uint32_t)(3 << SPI_CT_SIZE0));
+}
+
+
+/**********************************************************************//**
+ * Read next word from SPI flash read stream.
+ *
+ * @return Read word (little-endian: first byte from flash is the lowest byte).
+ **************************************************************************/
+uint32_t spi_flash_read_word(void) {
+
+  uint32_t d = neorv32_spi_trans(0);
+
+  // flash sends MSB first: swap byte order
+  return (d << 24) | ((d << 8) & 0x00ff0000) | ((d >> 8) & 0x0000ff00) | (d >> 24);
+}
+
+
+/**********************************************************************//**
+ * Read block of words from SPI flash read stream. The next SPI transfers are
+ * already running (up to SPI FIFO depth) while the current word is processed.
+ *
+ * @param[in,out] dst Destination pointer.
+ * @param[in] num Number of words to read.
+ * @return Sum of all read words (for checksum computation).
+ **************************************************************************/
+uint32_t spi_flash_read_burst(uint32_t *dst, uint32_t num) {
+
+  uint32_t depth = neorv32_spi_get_fifo_depth();
+  uint32_t sent = 0, i = 0, d = 0, sum = 0;
+
+  // fill TX FIFO (limited to RX FIFO capacity)
+  while ((sent < num) && (sent < depth)) {
+    SPI_DATA = 0;
+    sent++;
+  }
+
+  while (i < num) {
+    while ((SPI_CT & (1<<SPI_CT_RX_AVAIL)) == 0); // wait for next word
+    d = SPI_DATA;
+    if (sent < num) { // keep the SPI busy
+      SPI_DATA = 0;
+      sent++;
+    }
+    d = (d << 24) | ((d << 8) & 0x00ff0000) | ((d >> 8) & 0x0000ff00) | (d >> 24);
+    sum += d;
+    dst[i++] = d;
+  }
 
-  return rdata;
+  return sum;
 }
 
 
@@ -22,6 +22,10 @@ MABI  ?= -mabi=ilp32
 # User flags for additional configuration (will be added to compiler flags)
 USER_FLAGS ?=
 
+# Memory layout (linker symbols, see neorv32.ld); has to be sync with the processor's MEM_INT_* generics
+# Example: MEM_LAYOUT = __neorv32_ram_base=0x90000000 __neorv32_ram_size=16k __neorv32_xmem0_base=0x9FFFC000 __neorv32_xmem0_size=16k
+MEM_LAYOUT ?=
+
 # Relative or absolute path to the NEORV32 home folder
 NEORV32_HOME ?= ../../..
 
@@ -52,6 +56,7 @@ LD_SCRIPT = $(NEORV32_COM_PATH)/neorv32.ld
 
 # Main output files
 APP_EXE  = neorv32_exe.bin
+APP_LZ   = neorv32_exe_lz.bin
 APP_HEX  = neorv32_exe.hex
 APP_ASM  = main.asm
 APP_IMG  = neorv32_application_image.vhd
@@ -84,22 +89,27 @@ CC_X86 = g++ -Wall -O -g
 # NEORV32 executable image generator
 IMAGE_GEN = $(NEORV32_EXG_PATH)/image_gen
 
+# Bootloader block upload tool (host side)
+UPLOAD_TOOL = $(NEORV32_EXG_PATH)/uart_block_upload
+
 # Compiler & linker flags
 CC_OPTS  = $(MARCH) $(MABI) $(EFFORT) -Wall -ffunction-sections -fdata-sections -nostartfiles -mno-fdiv
 CC_OPTS += -Wl,--gc-sections -lm -lc -lgcc -lc
 # This accelerates instruction fetch after branches when C extension is enabled (irrelevant when C extension is disabled)
 CC_OPTS += -falign-functions=4 -falign-labels=4 -falign-loops=4 -falign-jumps=4
+CC_OPTS += $(addprefix -Xlinker --defsym=,$(MEM_LAYOUT))
 CC_OPTS += $(USER_FLAGS)
 
 
 # -----------------------------------------------------------------------------
 # Application output definitions
 # -----------------------------------------------------------------------------
-.PHONY: check info help elf_info clean clean_all bootloader
+.PHONY: check info help elf_info clean clean_all bootloader upload_tool
 .DEFAULT_GOAL := help
 
 # 'compile' is still here for compatibility
 exe:     $(APP_ASM) $(APP_EXE)
+exe_lz:  $(APP_ASM) $(APP_LZ)
 hex:     $(APP_ASM) $(APP_HEX)
 compile: $(APP_ASM) $(APP_EXE)
 install: $(APP_ASM) $(APP_IMG)
@@ -119,6 +129,12 @@ $(IMAGE_GEN): $(NEORV32_EXG_PATH)/image_gen.cpp
 	@echo Compiling $(IMAGE_GEN)
 	@$(CC_X86) $< -o $(IMAGE_GEN)
 
+$(UPLOAD_TOOL): $(NEORV32_EXG_PATH)/uart_block_upload.cpp
+	@echo Compiling $(UPLOAD_TOOL)
+	@$(CC_X86) $< -o $(UPLOAD_TOOL)
+
+upload_tool: $(UPLOAD_TOOL)
+
 
 # -----------------------------------------------------------------------------
 # General targets: Assemble, compile, link, dump
@@ -168,6 +184,13 @@ $(APP_EXE): main.bin $(IMAGE_GEN)
 	@echo "Executable ($(APP_EXE)) size in bytes:"
 	@wc -c < $(APP_EXE)
 
+# Generate compressed NEORV32 executable image for upload via bootloader
+$(APP_LZ): main.bin $(IMAGE_GEN)
+	@set -e
+	@$(IMAGE_GEN) -app_lz $< $@ $(shell basename $(CURDIR))
+	@echo "Compressed executable ($(APP_LZ)) size in bytes:"
+	@wc -c < $(APP_LZ)
+
 # Generate NEORV32 executable VHDL boot image
 $(APP_IMG): main.bin $(IMAGE_GEN)
 	@set -e
@@ -255,6 +278,7 @@ info:
 	@$(CC) -print-search-dirs
 	@echo "---------------- Info: Flags ----------------"
 	@echo "USER_FLAGS: $(USER_FLAGS)"
+	@echo "MEM_LAYOUT: $(MEM_LAYOUT)"
 	@echo "CC_OPTS:    $(CC_OPTS)"
 	@echo "---------------- Info: Host Native GCC Flags ----------------"
 	@echo "CC_X86:     $(CC_X86)"
@@ -278,13 +302,15 @@ help:
 	@echo " check      - check toolchain"
 	@echo " info       - show makefile/toolchain configuration"
 	@echo " exe        - compile and generate <neorv32_exe.bin> executable for upload via bootloader"
+	@echo " exe_lz     - compile and generate compressed <neorv32_exe_lz.bin> executable for upload via bootloader"
 	@echo " hex        - compile and generate <neorv32_exe.hex> executable raw file"
 	@echo " install    - compile, generate and install VHDL IMEM boot image (for application)"
 	@echo " all        - exe + hex + install"
 	@echo " elf_info   - show ELF layout info"
 	@echo " clean      - clean up project"
-	@echo " clean_all  - clean up project, core libraries and image generator"
+	@echo " clean_all  - clean up project, core libraries, image generator and upload tool"
 	@echo " bootloader - compile, generate and install VHDL BOOTROM boot image (for bootloader only!)"
+	@echo " upload_tool - compile host-side bootloader block upload tool <uart_block_upload>"
 
 
 # -----------------------------------------------------------------------------
@@ -294,4 +320,4 @@ clean:
 	@rm -f *.elf *.o *.bin *.out *.asm *.vhd *.hex
 
 clean_all: clean
-	@rm -f $(OBJ) $(IMAGE_GEN)
+	@rm -f $(OBJ) $(IMAGE_GEN) $(UPLOAD_TOOL)
@@ -0,0 +1,297 @@
+// #################################################################################################
+// # << NEORV32 - printf Formatting Benchmark >>                                                   #
+// # ********************************************************************************************* #
+// # BSD 3-Clause License                                                                          #
+// #                                                                                               #
+// # Copyright (c) 2021, Stephan Nolting. All rights reserved.                                     #
+// #                                                                                               #
+// # Redistribution and use in source and binary forms, with or without modification, are          #
+// # permitted provided that the following conditions are met:                                     #
+// #                                                                                               #
+// # 1. Redistributions of source code must retain the above copyright notice, this list of        #
+// #    conditions and the following disclaimer.                                                   #
+// #                                                                                               #
+// # 2. Redistributions in binary form must reproduce the above copyright notice, this list of     #
+// #    conditions and the following disclaimer in the documentation and/or other materials        #
+// #    provided with the distribution.                                                            #
+// #                                                                                               #
+// # 3. Neither the name of the copyright holder nor the names of its contributors may be used to  #
+// #    endorse or promote products derived from this software without specific prior written      #
+// #    permission.                                                                                #
+// #                                                                                               #
+// # THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS   #
+// # OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF               #
+// # MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE    #
+// # COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,     #
+// # EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE #
+// # GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED    #
+// # AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING     #
+// # NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED  #
+// # OF THE POSSIBILITY OF SUCH DAMAGE.                                                            #
+// # ********************************************************************************************* #
+// # The NEORV32 Processor - https://github.com/stnolting/neorv32              (c) Stephan Nolting #
+// #################################################################################################
+
+/**********************************************************************//**
+ * @file bench_printf/main.c
+ * @author Stephan Nolting
+ * @brief Cycle-count benchmark for the UART printf formatting core.
+ **************************************************************************/
+
+#include <neorv32.h>
+#include <stdarg.h>
+
+
+/**********************************************************************//**
+ * @name User configuration
+ **************************************************************************/
+/**@{*/
+/** UART BAUD rate */
+#define BAUD_RATE 19200
+/** Number of runs per test case */
+#define NUM_RUNS 16
+/**@}*/
+
+
+// prototypes
+uint32_t bench_printf(void (*f)(const char *format, ...), const char *format, uint32_t arg);
+void baseline_buf_printf(const char *format, ...);
+void baseline_itoa(uint32_t x, char *res);
+void baseline_tohex(uint32_t x, char *res);
+void wait_tx_done(void);
+
+
+/**********************************************************************//**
+ * Benchmark the formatting core of the UART printf functions.
+ *
+ * The formatting cost is measured using the buffered (non-blocking) UART0 printf, so the result is not
+ * affected by the UART transmission time. For comparison, a copy of the previous (division-based)
+ * formatter is benchmarked, too. All results are average cycles per call (including the benchmark overhead).
+ *
+ * @note This program requires the UART0 and the Zicsr extension (cycle counter).
+ *
+ * @return 0 if execution was successful
+ **************************************************************************/
+int main() {
+
+  // capture all exceptions and give debug info via UART
+  neorv32_rte_setup();
+
+  // init UART at default baud rate, no parity bits, ho hw flow control
+  neorv32_uart0_setup(BAUD_RATE, PARITY_NONE, FLOW_CONTROL_NONE);
+
+  // check available hardware extensions and compare with compiler flags
+  neorv32_rte_check_isa(0); // silent = 0 -> show message if isa mismatch
+
+  // intro
+  neorv32_uart0_printf("<<< printf formatting benchmark >>>\n\n");
+#if defined __riscv_div
+  neorv32_uart0_printf("Compiled with hardware division (M extension).\n");
+#else
+  neorv32_uart0_printf("Compiled without hardware division (no M extension).\n");
+#endif
+  neorv32_uart0_printf("Average cycles per call (%u runs each):\n\n", (uint32_t)NUM_RUNS);
+
+  // buffered UART0 mode: formatting without waiting for the UART hardware
+  if (neorv32_uart0_buf_setup()) {
+    neorv32_uart0_printf("Buffered UART0 mode setup failed!\n");
+    return 1;
+  }
+  neorv32_cpu_eint(); // enable global interrupts
+
+  // baseline (previous formatter) vs. new formatting core
+  uint32_t b_u0  = bench_printf(baseline_buf_printf,      "%u", 7);
+  uint32_t n_u0  = bench_printf(neorv32_uart0_buf_printf, "%u", 7);
+  uint32_t b_u   = bench_printf(baseline_buf_printf,      "%u", 4294967295UL);
+  uint32_t n_u   = bench_printf(neorv32_uart0_buf_printf, "%u", 4294967295UL);
+  uint32_t b_i   = bench_printf(baseline_buf_printf,      "%i", (uint32_t)-123456789);
+  uint32_t n_i   = bench_printf(neorv32_uart0_buf_printf, "%i", (uint32_t)-123456789);
+  uint32_t b_x   = bench_printf(baseline_buf_printf,      "%x", 0xcafe1234UL);
+  uint32_t n_x   = bench_printf(neorv32_uart0_buf_printf, "%x", 0xcafe1234UL);
+  uint32_t b_str = bench_printf(baseline_buf_printf,      "value: %s", (uint32_t)"neorv32");
+  uint32_t n_str = bench_printf(neorv32_uart0_buf_printf, "value: %s", (uint32_t)"neorv32");
+
+  // new conversions only (not supported by the baseline)
+  uint32_t n_xw  = bench_printf(neorv32_uart0_buf_printf, "%04X", 0xabUL);
+  uint32_t n_uw  = bench_printf(neorv32_uart0_buf_printf, "%10u", 1234UL);
+
+  neorv32_cpu_dint(); // disable global interrupts
+  neorv32_uart0_buf_disable();
+
+  neorv32_uart0_printf("                                baseline      new\n");
+  neorv32_uart0_printf("printf(\"%%u\", 7):                %8u %8u\n", b_u0, n_u0);
+  neorv32_uart0_printf("printf(\"%%u\", 4294967295):       %8u %8u\n", b_u, n_u);
+  neorv32_uart0_printf("printf(\"%%i\", -123456789):       %8u %8u\n", b_i, n_i);
+  neorv32_uart0_printf("printf(\"%%x\", 0xcafe1234):       %8u %8u\n", b_x, n_x);
+  neorv32_uart0_printf("printf(\"value: %%s\", \"neorv32\"): %8u %8u\n", b_str, n_str);
+  neorv32_uart0_printf("printf(\"%%04X\", 0xab):          %8s %8u\n", "n/a", n_xw);
+  neorv32_uart0_printf("printf(\"%%10u\", 1234):          %8s %8u\n", "n/a", n_uw);
+
+  neorv32_uart0_printf("\nBenchmark completed.\n");
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Benchmark a buffered printf function.
+ *
+ * @param[in] f Printf function to benchmark.
+ * @param[in] format Format string (with a single conversion).
+ * @param[in] arg Argument for the conversion.
+ * @return Average number of cycles per call.
+ **************************************************************************/
+uint32_t bench_printf(void (*f)(const char *format, ...), const char *format, uint32_t arg) {
+
+  uint32_t i;
+  uint64_t start, total = 0;
+
+  for (i=0; i<NUM_RUNS; i++) {
+    wait_tx_done(); // make sure the ring buffer is empty
+    start = neorv32_cpu_get_cycle();
+    f(format, arg);
+    total += neorv32_cpu_get_cycle() - start;
+  }
+  wait_tx_done();
+  neorv32_uart0_buf_print("\n");
+  wait_tx_done();
+
+  return (uint32_t)(total / NUM_RUNS);
+}
+
+
+/**********************************************************************//**
+ * Baseline: the previous library formatter (division-based decimal conversion, one output call per
+ * conversion). The formatted chars are collected locally and written to the UART0 TX ring buffer in one go.
+ *
+ * @param[in] format Pointer to format string (supports %s, %c, %i, %u, %x only).
+ **************************************************************************/
+void __attribute__((noinline)) baseline_buf_printf(const char *format, ...) {
+
+  char c, string_buf[11], *s, out[64];
+  int32_t n;
+  int len = 0;
+
+  va_list a;
+  va_start(a, format);
+
+  while ((c = *format++) && (len < (int)sizeof(out)-2)) {
+    s = 0;
+    if (c == '%') {
+      c = *format++;
+      switch (c) {
+        case 's': // string
+          s = va_arg(a, char*);
+          break;
+        case 'c': // char
+          out[len++] = (char)va_arg(a, int);
+          break;
+        case 'i': // 32-bit signed
+          n = (int32_t)va_arg(a, int32_t);
+          if (n < 0) {
+            n = -n;
+            out[len++] = '-';
+          }
+          baseline_itoa((uint32_t)n, string_buf);
+          s = string_buf;
+          break;
+        case 'u': // 32-bit unsigned
+          baseline_itoa(va_arg(a, uint32_t), string_buf);
+          s = string_buf;
+          break;
+        case 'x': // 32-bit hexadecimal
+          baseline_tohex(va_arg(a, uint32_t), string_buf);
+          s = string_buf;
+          break;
+        default: // unsupported format
+          out[len++] = '%';
+          out[len++] = c;
+          break;
+      }
+      while ((s != 0) && (*s != '\0') && (len < (int)sizeof(out)-2)) {
+        if (*s == '\n') {
+          out[len++] = '\r';
+        }
+        out[len++] = *s++;
+      }
+    }
+    else {
+      if (c == '\n') {
+        out[len++] = '\r';
+      }
+      out[len++] = c;
+    }
+  }
+  va_end(a);
+
+  neorv32_uart0_write(out, len);
+}
+
+
+/**********************************************************************//**
+ * Baseline: decimal conversion using repeated division by 10 (previous library version).
+ *
+ * @param[in] x Unsigned input number.
+ * @param[in,out] res Pointer for storing the resulting number string (11 chars).
+ **************************************************************************/
+void baseline_itoa(uint32_t x, char *res) {
+
+  static const char numbers[] = "0123456789";
+  char buffer1[11];
+  uint16_t i, j;
+
+  buffer1[10] = '\0';
+  res[10] = '\0';
+
+  // convert
+  for (i=0; i<10; i++) {
+    buffer1[i] = numbers[x%10];
+    x /= 10;
+  }
+
+  // delete 'leading' zeros
+  for (i=9; i!=0; i--) {
+    if (buffer1[i] == '0')
+      buffer1[i] = '\0';
+    else
+      break;
+  }
+
+  // reverse
+  j = 0;
+  do {
+    if (buffer1[i] != '\0')
+      res[j++] = buffer1[i];
+  } while (i--);
+
+  res[j] = '\0'; // terminate result string
+}
+
+
+/**********************************************************************//**
+ * Baseline: 8-digit hexadecimal conversion (previous library version).
+ *
+ * @param[in] x Unsigned input number.
+ * @param[in,out] res Pointer for storing the resulting number string (9 chars).
+ **************************************************************************/
+void baseline_tohex(uint32_t x, char *res) {
+
+  static const char symbols[] = "0123456789abcdef";
+
+  int i;
+  for (i=0; i<8; i++) { // nibble by nibble
+    uint32_t num_tmp = x >> (4*i);
+    res[7-i] = (char)symbols[num_tmp & 0x0f];
+  }
+
+  res[8] = '\0'; // terminate result string
+}
+
+
+/**********************************************************************//**
+ * Wait until the buffered UART0 transmission has completed.
+ **************************************************************************/
+void wait_tx_done(void) {
+
+  while (neorv32_uart0_buf_tx_free() != UART0_BUF_TX_SIZE);
+  while (neorv32_uart0_tx_busy());
+}
@@ -182,6 +182,10 @@ portable_init(core_portable *p, int *argc, char *argv[])
   neorv32_cpu_csr_write(CSR_MHPMCOUNTER12, 0); neorv32_cpu_csr_write(CSR_MHPMEVENT12, 1 << HPMCNT_EVENT_TBRANCH);
   neorv32_cpu_csr_write(CSR_MHPMCOUNTER13, 0); neorv32_cpu_csr_write(CSR_MHPMEVENT13, 1 << HPMCNT_EVENT_TRAP);
   neorv32_cpu_csr_write(CSR_MHPMCOUNTER14, 0); neorv32_cpu_csr_write(CSR_MHPMEVENT14, 1 << HPMCNT_EVENT_ILLEGAL);
+  neorv32_cpu_csr_write(CSR_MHPMCOUNTER15, 0); neorv32_cpu_csr_write(CSR_MHPMEVENT15, 1 << HPMCNT_EVENT_PF_USE);
+  neorv32_cpu_csr_write(CSR_MHPMCOUNTER16, 0); neorv32_cpu_csr_write(CSR_MHPMEVENT16, 1 << HPMCNT_EVENT_PF_NUSE);
+  neorv32_cpu_csr_write(CSR_MHPMCOUNTER17, 0); neorv32_cpu_csr_write(CSR_MHPMEVENT17, 1 << HPMCNT_EVENT_IC_ACC);
+  neorv32_cpu_csr_write(CSR_MHPMCOUNTER18, 0); neorv32_cpu_csr_write(CSR_MHPMEVENT18, 1 << HPMCNT_EVENT_IC_MISS);
 
   neorv32_uart_printf("NEORV32: Processor running at %u Hz\n", (uint32_t)SYSINFO_CLK);
   neorv32_uart_printf("NEORV32: Executing coremark (%u iterations). This may take some time...\n\n", (uint32_t)ITERATIONS);
@@ -247,6 +251,10 @@ portable_fini(core_portable *p)
   if (num_hpm_cnts_global > 9)  {neorv32_uart_printf("# Conditional branches (taken): %u\n", (uint32_t)neorv32_cpu_csr_read(CSR_MHPMCOUNTER12)); }
   if (num_hpm_cnts_global > 10) {neorv32_uart_printf("# Entered traps:                %u\n", (uint32_t)neorv32_cpu_csr_read(CSR_MHPMCOUNTER13)); }
   if (num_hpm_cnts_global > 11) {neorv32_uart_printf("# Illegal operations:           %u\n", (uint32_t)neorv32_cpu_csr_read(CSR_MHPMCOUNTER14)); }
+  if (num_hpm_cnts_global > 12) {neorv32_uart_printf("# I-cache useful prefetches:    %u\n", (uint32_t)neorv32_cpu_csr_read(CSR_MHPMCOUNTER15)); }
+  if (num_hpm_cnts_global > 13) {neorv32_uart_printf("# I-cache useless prefetches:   %u\n", (uint32_t)neorv32_cpu_csr_read(CSR_MHPMCOUNTER16)); }
+  if (num_hpm_cnts_global > 14) {neorv32_uart_printf("# I-cache accesses:             %u\n", (uint32_t)neorv32_cpu_csr_read(CSR_MHPMCOUNTER17)); }
+  if (num_hpm_cnts_global > 15) {neorv32_uart_printf("# I-cache misses:               %u\n", (uint32_t)neorv32_cpu_csr_read(CSR_MHPMCOUNTER18)); }
   neorv32_uart_printf("\n");
 
   neorv32_uart_printf("NEORV32: Executed instructions      0x%x_%x\n", (uint32_t)exe_instructions.uint32[1], (uint32_t)exe_instructions.uint32[0]);
@@ -32,7 +32,9 @@ Original Author: Shay Gal-on
 /* NEORV32-specific */
 /************************/
 #define BAUD_RATE  (19200)
+#ifndef ITERATIONS
 #define ITERATIONS (2000)
+#endif
 #define FLAGS_STR  "-> default, see makefile" // compiler optimization
 
 /************************/
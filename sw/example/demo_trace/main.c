@@ -0,0 +1,152 @@
+// #################################################################################################
+// # << NEORV32 - Instruction Trace Encoder (TRACE) Demo Program >>                                #
+// # ********************************************************************************************* #
+// # BSD 3-Clause License                                                                          #
+// #                                                                                               #
+// # Copyright (c) 2021, Stephan Nolting. All rights reserved.                                     #
+// #                                                                                               #
+// # Redistribution and use in source and binary forms, with or without modification, are          #
+// # permitted provided that the following conditions are met:                                     #
+// #                                                                                               #
+// # 1. Redistributions of source code must retain the above copyright notice, this list of        #
+// #    conditions and the following disclaimer.                                                   #
+// #                                                                                               #
+// # 2. Redistributions in binary form must reproduce the above copyright notice, this list of     #
+// #    conditions and the following disclaimer in the documentation and/or other materials        #
+// #    provided with the distribution.                                                            #
+// #                                                                                               #
+// # 3. Neither the name of the copyright holder nor the names of its contributors may be used to  #
+// #    endorse or promote products derived from this software without specific prior written      #
+// #    permission.                                                                                #
+// #                                                                                               #
+// # THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS   #
+// # OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF               #
+// # MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE    #
+// # COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,     #
+// # EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE #
+// # GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED    #
+// # AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING     #
+// # NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED  #
+// # OF THE POSSIBILITY OF SUCH DAMAGE.                                                            #
+// # ********************************************************************************************* #
+// # The NEORV32 Processor - https://github.com/stnolting/neorv32              (c) Stephan Nolting #
+
+/**********************************************************************//**
+ * @file demo_trace/main.c
+ * @author Stephan Nolting
+ * @brief Instruction trace encoder (TRACE) demo program. Records the program flow into the
+ * on-chip trace buffer and dumps the raw trace words via UART0 (to be decoded by sw/image_gen/trace_decoder).
+ **************************************************************************/
+
+#include <neorv32.h>
+
+
+/**********************************************************************//**
+ * @name User configuration
+ **************************************************************************/
+/**@{*/
+/** UART BAUD rate */
+#define BAUD_RATE 19200
+/** Max number of trace words to dump */
+#define TRACE_MAX 4096
+/**@}*/
+
+// prototypes
+void mtime_irq_handler(void);
+uint32_t fibonacci(uint32_t n);
+
+/** trace buffer copy */
+uint32_t trace_data[TRACE_MAX];
+
+/** number of timer interrupts */
+volatile uint32_t irq_cnt = 0;
+
+
+/**********************************************************************//**
+ * Main function
+ *
+ * @note This program requires the TRACE, the MTIME and the UART to be synthesized.
+ *
+ * @return 0 if execution was successful
+ **************************************************************************/
+int main() {
+
+  // initialize the neorv32 runtime environment
+  neorv32_rte_setup();
+
+  // setup UART0 at default baud rate, no parity bits, ho hw flow control
+  neorv32_uart0_setup(BAUD_RATE, PARITY_NONE, FLOW_CONTROL_NONE);
+
+  // check if TRACE unit is implemented at all
+  if (neorv32_trace_available() == 0) {
+    neorv32_uart0_printf("TRACE not synthesized!\n");
+    return 1;
+  }
+
+  // check if trace buffer is implemented
+  if (neorv32_trace_get_buffer_size() == 0) {
+    neorv32_uart0_printf("No trace buffer implemented (TRACE_BUFFER_DEPTH = 0)!\n");
+    return 1;
+  }
+
+  // intro
+  neorv32_uart0_printf("Instruction trace encoder (TRACE) demo program\n");
+  neorv32_uart0_printf("Trace buffer size: %u words\n\n", (uint32_t)neorv32_trace_get_buffer_size());
+
+  // install timer interrupt handler
+  neorv32_rte_exception_install(RTE_TRAP_MTI, mtime_irq_handler);
+  neorv32_mtime_set_timecmp(neorv32_mtime_get_time() + 500);
+  neorv32_cpu_irq_enable(CSR_MIE_MTIE);
+  neorv32_cpu_eint();
+
+  // trace to buffer, stop when full, SYNC every 2^(4+3) packets
+  neorv32_trace_setup(0, 1, 4);
+  neorv32_trace_enable();
+
+  // some code to be traced
+  uint32_t res = fibonacci(20);
+
+  neorv32_trace_disable();
+  neorv32_cpu_dint();
+
+  neorv32_uart0_printf("fibonacci(20) = %u, %u timer interrupts\n", res, irq_cnt);
+  if (neorv32_trace_get_overflow()) {
+    neorv32_uart0_printf("WARNING! Trace data has been dropped.\n");
+  }
+
+  // dump trace buffer
+  uint32_t num = neorv32_trace_read_buffer(trace_data, TRACE_MAX);
+  neorv32_uart0_printf("\n--- trace data (%u words) ---\n", num);
+  uint32_t i;
+  for (i=0; i<num; i++) {
+    neorv32_uart0_printf("%x\n", trace_data[i]);
+  }
+  neorv32_uart0_printf("--- end of trace data ---\n");
+
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Recursive Fibonacci number computation (generates branches and uninferable jumps).
+ *
+ * @param[in] n Index.
+ * @return Fibonacci number n.
+ **************************************************************************/
+uint32_t fibonacci(uint32_t n) {
+
+  if (n < 2) {
+    return n;
+  }
+  return fibonacci(n-1) + fibonacci(n-2);
+}
+
+
+/**********************************************************************//**
+ * MTIME interrupt handler.
+ **************************************************************************/
+void mtime_irq_handler(void) {
+
+  irq_cnt++;
+  neorv32_mtime_set_timecmp(neorv32_mtime_get_time() + 500);
+}
@@ -38,7 +38,109 @@
 #include <string.h>
 
 
-const uint32_t signature = 0x4788CAFE;
+const uint32_t signature    = 0x4788CAFE;
+const uint32_t signature_lz = 0x4788CAFF; // LZSS-compressed executable
+
+
+// LZSS compression parameters (have to match the bootloader's decompressor)
+#define LZ_WINDOW    4096 // max. match offset
+#define LZ_MIN_MATCH 3    // min. match length
+#define LZ_MAX_MATCH (LZ_MIN_MATCH + 15 + 255) // max. match length (using extension byte)
+#define LZ_HASH_SIZE 4096
+
+
+/**********************************************************************//**
+ * LZSS compression.
+ *
+ * Stream format: a flag byte precedes each group of 8 items (LSB first). Flag = 1: literal byte.
+ * Flag = 0: 2-byte match {offset[7:0]}, {offset[11:8], length[3:0]} with offset = distance - 1
+ * and length = match length - 3; if the length field is 15 an extension byte follows that is
+ * added to the match length.
+ *
+ * @param[in] src Input data.
+ * @param[in] len Input data size in bytes.
+ * @param[in,out] dst Output buffer (has to provide at least len + len/8 + 1 bytes).
+ * @return Compressed size in bytes.
+ **************************************************************************/
+unsigned int lz_compress(const unsigned char *src, unsigned int len, unsigned char *dst) {
+
+  static int head[LZ_HASH_SIZE];
+  int *prev = (int*)malloc(sizeof(int) * (len + 1));
+  unsigned int in = 0, out = 0, flag_pos = 0, items = 8, i;
+
+  for (i=0; i<LZ_HASH_SIZE; i++) {
+    head[i] = -1;
+  }
+
+  while (in < len) {
+
+    // new flag byte every 8 items
+    if (items == 8) {
+      flag_pos = out;
+      dst[out++] = 0;
+      items = 0;
+    }
+
+    // search longest match in window (hash chain)
+    unsigned int best_len = 0, best_off = 0;
+    unsigned int h = 0;
+    if ((in + LZ_MIN_MATCH) <= len) {
+      h = ((src[in] << 8) ^ (src[in+1] << 4) ^ src[in+2]) & (LZ_HASH_SIZE-1);
+      int cand = head[h];
+      while ((cand >= 0) && ((in - (unsigned int)cand) <= LZ_WINDOW)) {
+        unsigned int m = 0;
+        while (((in + m) < len) && (m < LZ_MAX_MATCH) && (src[cand + m] == src[in + m])) {
+          m++;
+        }
+        if (m > best_len) {
+          best_len = m;
+          best_off = in - (unsigned int)cand;
+          if (m == LZ_MAX_MATCH) {
+            break;
+          }
+        }
+        cand = prev[cand];
+      }
+    }
+
+    // emit literal or match
+    unsigned int step;
+    if (best_len >= LZ_MIN_MATCH) {
+      unsigned int l = best_len - LZ_MIN_MATCH;
+      unsigned int o = best_off - 1;
+      dst[out++] = (unsigned char)(o & 0xff);
+      if (l >= 15) {
+        dst[out++] = (unsigned char)(((o >> 4) & 0xf0) | 0x0f);
+        dst[out++] = (unsigned char)(l - 15);
+      }
+      else {
+        dst[out++] = (unsigned char)(((o >> 4) & 0xf0) | l);
+      }
+      step = best_len;
+    }
+    else {
+      dst[flag_pos] |= (unsigned char)(1 << items);
+      dst[out++] = src[in];
+      step = 1;
+    }
+    items++;
+
+    // update hash chains for all consumed positions
+    for (i=0; i<step; i++) {
+      if ((in + LZ_MIN_MATCH) <= len) {
+        h = ((src[in] << 8) ^ (src[in+1] << 4) ^ src[in+2]) & (LZ_HASH_SIZE-1);
+        prev[in] = head[h];
+        head[h] = (int)in;
+      }
+      in++;
+    }
+  }
+
+  free(prev);
+  return out;
+}
+
+
 
 int main(int argc, char *argv[]) {
 
@@ -48,6 +150,7 @@ int main(int argc, char *argv[]) {
 	         "Three arguments are required.\n"
 	         "1st: Option\n"
 	         " -app_bin : Generate application executable binary (binary file, little-endian, with header) \n"
+	         " -app_lz  : Generate LZSS-compressed application executable binary (binary file, little-endian, with header) \n"
 	         " -app_hex : Generate application raw executable (hex file, no header)\n"
 	         " -app_img : Generate application raw executable memory image (vhdl file, no header)\n"
 	         " -bld_img : Generate bootloader raw executable memory image (vdhl file, no header)\n"
@@ -73,6 +176,8 @@ int main(int argc, char *argv[]) {
     option = 3;
   else if (strcmp(argv[1], "-app_hex") == 0)
     option = 4;
+  else if (strcmp(argv[1], "-app_lz") == 0)
+    option = 5;
   else {
   	printf("Invalid option!");
   	return 1;
@@ -344,6 +449,64 @@ int main(int argc, char *argv[]) {
   }
 
 
+// ------------------------------------------------------------
+// Generate COMPRESSED BINARY executable (with header!!!) for bootloader upload
+// ------------------------------------------------------------
+  if (option == 5) {
+
+    // read raw image, zero-padded to a multiple of 4 bytes
+    size = (uint32_t)((input_size + 3) & ~3u);
+    unsigned char *raw = (unsigned char*)calloc(size + 1, 1);
+    unsigned char *lz  = (unsigned char*)calloc(size + size/8 + 8, 1);
+    if ((raw == NULL) || (lz == NULL)) {
+      printf("Out of memory!");
+      return 4;
+    }
+    if (fread(raw, sizeof(unsigned char), input_size, input) != input_size) {
+      printf("Unexpected input file end!\n");
+    }
+
+    // checksum of the uncompressed image (sum complement)
+    checksum = 0;
+    for (i=0; i<size; i+=4) {
+      tmp  = (uint32_t)(raw[i+0] << 0);
+      tmp |= (uint32_t)(raw[i+1] << 8);
+      tmp |= (uint32_t)(raw[i+2] << 16);
+      tmp |= (uint32_t)(raw[i+3] << 24);
+      checksum += tmp;
+    }
+    checksum = (~checksum) + 1;
+
+    // compress, zero-pad compressed stream to a multiple of 4 bytes
+    unsigned int lz_size = lz_compress(raw, size, lz);
+    while (lz_size & 3) {
+      lz[lz_size++] = 0;
+    }
+
+    // header: signature
+    fputc((unsigned char)((signature_lz >>  0) & 0xFF), output);
+    fputc((unsigned char)((signature_lz >>  8) & 0xFF), output);
+    fputc((unsigned char)((signature_lz >> 16) & 0xFF), output);
+    fputc((unsigned char)((signature_lz >> 24) & 0xFF), output);
+    // header: size (uncompressed)
+    fputc((unsigned char)((size >>  0) & 0xFF), output);
+    fputc((unsigned char)((size >>  8) & 0xFF), output);
+    fputc((unsigned char)((size >> 16) & 0xFF), output);
+    fputc((unsigned char)((size >> 24) & 0xFF), output);
+    // header: checksum (sum complement of uncompressed image)
+    fputc((unsigned char)((checksum >>  0) & 0xFF), output);
+    fputc((unsigned char)((checksum >>  8) & 0xFF), output);
+    fputc((unsigned char)((checksum >> 16) & 0xFF), output);
+    fputc((unsigned char)((checksum >> 24) & 0xFF), output);
+    // compressed data
+    fwrite(lz, sizeof(unsigned char), lz_size, output);
+
+    printf("Compressed %u bytes to %u bytes\n", (unsigned int)size, lz_size);
+    free(raw);
+    free(lz);
+  }
+
+
   fclose(input);
   fclose(output);
 
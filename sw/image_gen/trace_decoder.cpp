@@ -0,0 +1,591 @@
+// #################################################################################################
+// # << NEORV32 - Instruction Trace Decoder >>                                                     #
+// # ********************************************************************************************* #
+// # Reconstructs the program flow from the raw trace words generated by the processor's           #
+// # instruction trace encoder (TRACE) and the according ELF file.                                 #
+// #                                                                                               #
+// # Build: g++ -O2 -Wall trace_decoder.cpp -o trace_decoder                                       #
+// # ********************************************************************************************* #
+// # BSD 3-Clause License                                                                          #
+// #                                                                                               #
+// # Copyright (c) 2021, Stephan Nolting. All rights reserved.                                     #
+// #                                                                                               #
+// # Redistribution and use in source and binary forms, with or without modification, are          #
+// # permitted provided that the following conditions are met:                                     #
+// #                                                                                               #
+// # 1. Redistributions of source code must retain the above copyright notice, this list of        #
+// #    conditions and the following disclaimer.                                                   #
+// #                                                                                               #
+// # 2. Redistributions in binary form must reproduce the above copyright notice, this list of     #
+// #    conditions and the following disclaimer in the documentation and/or other materials        #
+// #    provided with the distribution.                                                            #
+// #                                                                                               #
+// # 3. Neither the name of the copyright holder nor the names of its contributors may be used to  #
+// #    endorse or promote products derived from this software without specific prior written      #
+// #    permission.                                                                                #
+// #                                                                                               #
+// # THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS   #
+// # OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF               #
+// # MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE    #
+// # COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,     #
+// # EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE #
+// # GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED    #
+// # AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING     #
+// # NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED  #
+// # OF THE POSSIBILITY OF SUCH DAMAGE.                                                            #
+// # ********************************************************************************************* #
+// # The NEORV32 Processor - https://github.com/stnolting/neorv32              (c) Stephan Nolting #
+// #################################################################################################
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+
+// trace packet types (see rtl/core/neorv32_trace.vhd)
+enum packet_type_t {
+  PKT_BMAP = 0, // branch map only
+  PKT_SYNC = 1, // synchronization: pc, time
+  PKT_JUMP = 2, // uninferable jump: target
+  PKT_TRAP = 3, // trap entry: epc, target, time
+  PKT_TRET = 4  // trap return: target, time
+};
+
+// number of payload words for each packet type
+const int payload_words[8] = {0, 2, 1, 3, 2, 0, 0, 0};
+
+// maximum number of instructions to walk without any trace information
+const unsigned long walk_limit = 1000000;
+
+
+/**********************************************************************//**
+ * Executable memory and symbols from ELF file
+ **************************************************************************/
+struct section_t {
+  uint32_t addr;
+  std::vector<uint8_t> data;
+};
+
+std::vector<section_t> sections;
+std::map<uint32_t, std::string> symbols; // function symbols: address -> name
+
+
+/**********************************************************************//**
+ * Decoder state
+ **************************************************************************/
+struct trap_frame_t {
+  uint32_t cause;
+  uint32_t time;
+};
+
+struct stats_t {
+  unsigned long count;
+  uint64_t sum;
+  uint32_t min;
+  uint32_t max;
+  uint32_t max_time;
+};
+
+bool        pc_valid = false;
+uint32_t    pc = 0;
+std::deque<bool> bmap; // pending conditional branch outcomes, oldest first
+std::vector<trap_frame_t> trap_stack;
+std::map<uint32_t, stats_t> trap_stats; // per trap cause
+bool        opt_time = false;
+unsigned long num_instr = 0;
+unsigned long num_errors = 0;
+
+
+static uint32_t rd32(const uint8_t *p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t rd16(const uint8_t *p) {
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+
+/**********************************************************************//**
+ * Load executable sections and function symbols from ELF32 (little-endian) file.
+ **************************************************************************/
+bool load_elf(const char *fname) {
+
+  FILE *f = fopen(fname, "rb");
+  if (f == NULL) {
+    return false;
+  }
+  fseek(f, 0L, SEEK_END);
+  long size = ftell(f);
+  rewind(f);
+  std::vector<uint8_t> elf((size_t)size);
+  if (fread(elf.data(), 1, (size_t)size, f) != (size_t)size) {
+    fclose(f);
+    return false;
+  }
+  fclose(f);
+
+  if ((size < 52) || (memcmp(elf.data(), "\x7f" "ELF", 4) != 0) || (elf[4] != 1) || (elf[5] != 1)) {
+    fprintf(stderr, "Not a little-endian ELF32 file!\n");
+    return false;
+  }
+
+  uint32_t shoff     = rd32(&elf[32]);
+  uint16_t shentsize = rd16(&elf[46]);
+  uint16_t shnum     = rd16(&elf[48]);
+
+  for (unsigned i=0; i<shnum; i++) {
+    const uint8_t *sh = &elf[shoff + i*shentsize];
+    uint32_t type   = rd32(sh + 4);
+    uint32_t flags  = rd32(sh + 8);
+    uint32_t addr   = rd32(sh + 12);
+    uint32_t offset = rd32(sh + 16);
+    uint32_t ssize  = rd32(sh + 20);
+    uint32_t link   = rd32(sh + 24);
+    uint32_t esize  = rd32(sh + 36);
+
+    if ((type == 1) && (flags & 0x4)) { // SHT_PROGBITS + SHF_EXECINSTR
+      section_t s;
+      s.addr = addr;
+      s.data.assign(elf.begin() + offset, elf.begin() + offset + ssize);
+      sections.push_back(s);
+    }
+    else if ((type == 2) && (esize == 16)) { // SHT_SYMTAB
+      const uint8_t *strsh = &elf[shoff + link*shentsize];
+      const char *strtab = (const char*)&elf[rd32(strsh + 16)];
+      for (uint32_t j=0; j<ssize/16; j++) {
+        const uint8_t *sym = &elf[offset + j*16];
+        uint32_t value = rd32(sym + 4);
+        uint8_t  info  = sym[12];
+        if (((info & 0xf) == 2) || (((info & 0xf) == 0) && (strtab[rd32(sym)] != '$') && (strtab[rd32(sym)] != '.') && (strtab[rd32(sym)] != 0))) { // STT_FUNC or labels
+          if (symbols.find(value) == symbols.end() || ((info & 0xf) == 2)) {
+            symbols[value] = std::string(&strtab[rd32(sym)]);
+          }
+        }
+      }
+    }
+  }
+
+  return (sections.size() > 0);
+}
+
+
+/**********************************************************************//**
+ * Fetch instruction word from executable.
+ **************************************************************************/
+bool fetch(uint32_t addr, uint32_t &instr) {
+
+  for (auto &s : sections) {
+    if ((addr >= s.addr) && ((addr + 2) <= (s.addr + s.data.size()))) {
+      uint32_t offs = addr - s.addr;
+      instr = rd16(&s.data[offs]);
+      if ((instr & 3) == 3) {
+        if ((addr + 4) > (s.addr + s.data.size())) {
+          return false;
+        }
+        instr |= (uint32_t)rd16(&s.data[offs+2]) << 16;
+      }
+      return true;
+    }
+  }
+  return false;
+}
+
+
+/**********************************************************************//**
+ * Get symbol name + offset of address.
+ **************************************************************************/
+std::string symbolize(uint32_t addr) {
+
+  char tmp[64];
+  auto it = symbols.upper_bound(addr);
+  if (it == symbols.begin()) {
+    return std::string("?");
+  }
+  --it;
+  if (addr == it->first) {
+    return it->second;
+  }
+  sprintf(tmp, "+0x%x", addr - it->first);
+  return it->second + tmp;
+}
+
+
+/**********************************************************************//**
+ * Instruction classification
+ **************************************************************************/
+enum instr_class_t {
+  INSTR_LINEAR, // no control flow change
+  INSTR_DIRECT, // direct jump (target inferable)
+  INSTR_BRANCH, // conditional branch
+  INSTR_JUMP,   // uninferable jump (jalr)
+  INSTR_MRET    // trap return
+};
+
+static int32_t sext(uint32_t x, int bits) {
+  return (int32_t)(x << (32-bits)) >> (32-bits);
+}
+
+instr_class_t classify(uint32_t instr, uint32_t addr, uint32_t &size, uint32_t &target) {
+
+  if ((instr & 3) == 3) { // 32-bit instruction
+    size = 4;
+    uint32_t opcode = instr & 0x7f;
+    if (opcode == 0x6f) { // jal
+      uint32_t imm = ((instr >> 31) << 20) | (((instr >> 12) & 0xff) << 12) | (((instr >> 20) & 1) << 11) | (((instr >> 21) & 0x3ff) << 1);
+      target = addr + sext(imm, 21);
+      return INSTR_DIRECT;
+    }
+    if (opcode == 0x67) { // jalr
+      return INSTR_JUMP;
+    }
+    if (opcode == 0x63) { // branch
+      uint32_t imm = ((instr >> 31) << 12) | (((instr >> 7) & 1) << 11) | (((instr >> 25) & 0x3f) << 5) | (((instr >> 8) & 0xf) << 1);
+      target = addr + sext(imm, 13);
+      return INSTR_BRANCH;
+    }
+    if (instr == 0x30200073) { // mret
+      return INSTR_MRET;
+    }
+    return INSTR_LINEAR;
+  }
+
+  // 16-bit compressed instruction
+  size = 2;
+  uint32_t quadrant = instr & 3;
+  uint32_t funct3   = (instr >> 13) & 7;
+  if ((quadrant == 1) && ((funct3 == 1) || (funct3 == 5))) { // c.jal, c.j
+    uint32_t imm = (((instr >> 12) & 1) << 11) | (((instr >> 11) & 1) << 4) | (((instr >> 9) & 3) << 8) |
+                   (((instr >> 8) & 1) << 10) | (((instr >> 7) & 1) << 6) | (((instr >> 6) & 1) << 7) |
+                   (((instr >> 3) & 7) << 1) | (((instr >> 2) & 1) << 5);
+    target = addr + sext(imm, 12);
+    return INSTR_DIRECT;
+  }
+  if ((quadrant == 1) && ((funct3 == 6) || (funct3 == 7))) { // c.beqz, c.bnez
+    uint32_t imm = (((instr >> 12) & 1) << 8) | (((instr >> 10) & 3) << 3) | (((instr >> 5) & 3) << 6) |
+                   (((instr >> 3) & 3) << 1) | (((instr >> 2) & 1) << 5);
+    target = addr + sext(imm, 9);
+    return INSTR_BRANCH;
+  }
+  if ((quadrant == 2) && (funct3 == 4) && (((instr >> 2) & 0x1f) == 0) && (((instr >> 7) & 0x1f) != 0)) { // c.jr, c.jalr
+    return INSTR_JUMP;
+  }
+  return INSTR_LINEAR;
+}
+
+
+/**********************************************************************//**
+ * Print executed instruction.
+ **************************************************************************/
+void print_instr(uint32_t addr, uint32_t instr, uint32_t size) {
+
+  num_instr++;
+  if (opt_time == false) {
+    if (size == 4) {
+      printf("%08x:  %08x  <%s>\n", addr, instr, symbolize(addr).c_str());
+    }
+    else {
+      printf("%08x:  %04x      <%s>\n", addr, instr, symbolize(addr).c_str());
+    }
+  }
+}
+
+
+/**********************************************************************//**
+ * Report decoding error and invalidate decoder state.
+ **************************************************************************/
+void decode_error(const char *msg) {
+
+  num_errors++;
+  printf("!! decoding error at 0x%08x: %s - waiting for next SYNC packet\n", pc, msg);
+  pc_valid = false;
+  bmap.clear();
+}
+
+
+/**********************************************************************//**
+ * Execute one instruction. Conditional branches consume one bit of the branch map.
+ *
+ * @return false if the instruction cannot be resolved with the available trace information.
+ **************************************************************************/
+bool step(void) {
+
+  uint32_t instr, size, target = 0;
+
+  if (fetch(pc, instr) == false) {
+    decode_error("address not in executable");
+    return false;
+  }
+  instr_class_t type = classify(instr, pc, size, target);
+
+  if ((type == INSTR_JUMP) || (type == INSTR_MRET)) {
+    return false; // target provided by next packet
+  }
+  if ((type == INSTR_BRANCH) && (bmap.empty())) {
+    return false; // branch outcome provided by next packet
+  }
+
+  print_instr(pc, instr, size);
+  if (type == INSTR_DIRECT) {
+    pc = target;
+  }
+  else if (type == INSTR_BRANCH) {
+    bool taken = bmap.front();
+    bmap.pop_front();
+    pc = taken ? target : (pc + size);
+  }
+  else {
+    pc = pc + size;
+  }
+  return true;
+}
+
+
+/**********************************************************************//**
+ * Consume all pending branch map bits.
+ **************************************************************************/
+bool walk_branches(void) {
+
+  unsigned long cnt = 0;
+  while (bmap.empty() == false) {
+    if ((step() == false) || (++cnt > walk_limit)) {
+      if (pc_valid) {
+        decode_error("unresolved branch map");
+      }
+      return false;
+    }
+  }
+  return true;
+}
+
+
+/**********************************************************************//**
+ * Execute instructions until the instruction at PC is an uninferable jump or trap return.
+ **************************************************************************/
+bool walk_to_discontinuity(instr_class_t expected) {
+
+  unsigned long cnt = 0;
+  while (1) {
+    uint32_t instr, size, target;
+    if (fetch(pc, instr) == false) {
+      decode_error("address not in executable");
+      return false;
+    }
+    instr_class_t type = classify(instr, pc, size, target);
+    if (type == expected) {
+      print_instr(pc, instr, size);
+      return true;
+    }
+    if ((step() == false) || (++cnt > walk_limit)) {
+      if (pc_valid) {
+        decode_error("expected discontinuity not found");
+      }
+      return false;
+    }
+  }
+}
+
+
+/**********************************************************************//**
+ * Execute instructions until PC reaches the trap's exception PC.
+ **************************************************************************/
+bool walk_to_epc(uint32_t epc) {
+
+  unsigned long cnt = 0;
+  while (pc != epc) {
+    if ((step() == false) || (++cnt > walk_limit)) {
+      if (pc_valid) {
+        decode_error("trap address not reached");
+      }
+      return false;
+    }
+  }
+  return true;
+}
+
+
+/**********************************************************************//**
+ * Process a complete trace packet.
+ **************************************************************************/
+void process_packet(uint32_t header, const uint32_t *payload) {
+
+  uint32_t type  = (header >> 1) & 7;
+  uint32_t bcnt  = (header >> 4) & 0x1f;
+  uint32_t cause = (header >> 9) & 0x7f;
+
+  // append branch outcomes of this packet (oldest first)
+  if (pc_valid) {
+    for (uint32_t i=0; i<bcnt; i++) {
+      bmap.push_back((header >> (16+i)) & 1);
+    }
+  }
+
+  switch (type) {
+
+    case PKT_SYNC:
+      if (pc_valid) {
+        walk_branches();
+      }
+      pc = payload[0];
+      pc_valid = true;
+      bmap.clear();
+      trap_stack.clear();
+      printf("-- SYNC @ %u: pc=0x%08x <%s>%s\n", payload[1] >> 1, pc, symbolize(pc).c_str(), (cause & 1) ? " (trace data lost before)" : "");
+      break;
+
+    case PKT_BMAP:
+      if (pc_valid) {
+        walk_branches();
+      }
+      break;
+
+    case PKT_JUMP:
+      if (pc_valid && walk_branches() && walk_to_discontinuity(INSTR_JUMP)) {
+        pc = payload[0];
+      }
+      break;
+
+    case PKT_TRAP: {
+      uint32_t epc = payload[0];
+      uint32_t now = payload[2] >> 1;
+      bool irq = (cause & 0x40) != 0;
+      if (pc_valid && walk_branches() && walk_to_epc(epc)) {
+        if (irq == false) { // exception: faulting instruction has been executed
+          uint32_t instr, size, target;
+          if (fetch(pc, instr)) {
+            classify(instr, pc, size, target);
+            print_instr(pc, instr, size);
+          }
+        }
+        pc = payload[1];
+      }
+      printf("-- TRAP @ %u: cause=%s%u epc=0x%08x <%s> -> 0x%08x <%s>\n", now, irq ? "irq." : "exc.",
+             cause & 0x1f, epc, symbolize(epc).c_str(), payload[1], symbolize(payload[1]).c_str());
+      trap_frame_t frame = {cause, now};
+      trap_stack.push_back(frame);
+      break;
+    }
+
+    case PKT_TRET: {
+      uint32_t now = payload[1] >> 1;
+      if (pc_valid && walk_branches() && walk_to_discontinuity(INSTR_MRET)) {
+        pc = payload[0];
+      }
+      if (trap_stack.empty() == false) {
+        trap_frame_t frame = trap_stack.back();
+        trap_stack.pop_back();
+        uint32_t duration = (now - frame.time) & 0x7fffffff;
+        printf("-- TRET @ %u: -> 0x%08x <%s>, handler duration = %u cycles\n", now, payload[0], symbolize(payload[0]).c_str(), duration);
+        stats_t &s = trap_stats[frame.cause];
+        if ((s.count == 0) || (duration < s.min)) {
+          s.min = duration;
+        }
+        if ((s.count == 0) || (duration > s.max)) {
+          s.max = duration;
+          s.max_time = frame.time;
+        }
+        s.count++;
+        s.sum += duration;
+      }
+      else {
+        printf("-- TRET @ %u: -> 0x%08x <%s>\n", now, payload[0], symbolize(payload[0]).c_str());
+      }
+      break;
+    }
+
+    default:
+      num_errors++;
+      printf("!! unknown packet type %u\n", type);
+      pc_valid = false;
+      bmap.clear();
+      break;
+  }
+}
+
+
+int main(int argc, char *argv[]) {
+
+  int argi = 1;
+  if ((argc > 1) && (strcmp(argv[1], "-t") == 0)) {
+    opt_time = true;
+    argi++;
+  }
+
+  if ((argc - argi) != 2) {
+    printf("<<< NEORV32 instruction trace decoder >>>\n"
+           "Two arguments are required.\n"
+           "Usage: trace_decoder [-t] <elf file> <trace file>\n"
+           " -t          : only show trap entry/return events and print handler duration statistics\n"
+           " <elf file>  : executable that was traced (ELF32)\n"
+           " <trace file>: raw trace words, one hexadecimal 32-bit word per line\n");
+    return 0;
+  }
+
+  if (load_elf(argv[argi]) == false) {
+    printf("ELF file error!\n");
+    return 2;
+  }
+
+  FILE *input = fopen(argv[argi+1], "r");
+  if (input == NULL) {
+    printf("Trace file error!\n");
+    return 3;
+  }
+
+  // parse trace words
+  char line[256];
+  uint32_t header = 0;
+  uint32_t payload[3];
+  int pending = -1; // number of missing payload words; -1 = waiting for header
+  int num = 0;
+  while (fgets(line, sizeof(line), input) != NULL) {
+    char *end;
+    uint32_t word = (uint32_t)strtoul(line, &end, 16);
+    if (end == line) { // not a trace word
+      continue;
+    }
+
+    if (word & 1) { // header word
+      if (pending > 0) {
+        num_errors++;
+        printf("!! incomplete packet\n");
+        pc_valid = false;
+        bmap.clear();
+      }
+      header  = word;
+      num     = 0;
+      pending = payload_words[(header >> 1) & 7];
+    }
+    else if (pending > 0) { // payload word
+      payload[num++] = word;
+      pending--;
+    }
+    else { // orphaned payload word (e.g. beginning of wrapped-around trace buffer)
+      continue;
+    }
+
+    if (pending == 0) {
+      process_packet(header, payload);
+      pending = -1;
+    }
+  }
+  fclose(input);
+
+  // statistics
+  printf("\n-- %lu instructions decoded, %lu errors\n", num_instr, num_errors);
+  if (trap_stats.empty() == false) {
+    printf("-- trap handler statistics (cycles):\n");
+    printf("   cause    count        min        avg        max   (max @ time)\n");
+    for (auto &it : trap_stats) {
+      const stats_t &s = it.second;
+      printf("   %s%-4u %8lu %10u %10u %10u   (@ %u)\n", (it.first & 0x40) ? "irq." : "exc.", it.first & 0x1f,
+             s.count, s.min, (uint32_t)(s.sum / s.count), s.max, s.max_time);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,327 @@
+// #################################################################################################
+// # << NEORV32 - Bootloader block upload tool (UART) >>                                           #
+// # ********************************************************************************************* #
+// # BSD 3-Clause License                                                                          #
+// #                                                                                               #
+// # Copyright (c) 2021, Stephan Nolting. All rights reserved.                                     #
+// #                                                                                               #
+// # Redistribution and use in source and binary forms, with or without modification, are          #
+// # permitted provided that the following conditions are met:                                     #
+// #                                                                                               #
+// # 1. Redistributions of source code must retain the above copyright notice, this list of        #
+// #    conditions and the following disclaimer.                                                   #
+// #                                                                                               #
+// # 2. Redistributions in binary form must reproduce the above copyright notice, this list of     #
+// #    conditions and the following disclaimer in the documentation and/or other materials        #
+// #    provided with the distribution.                                                            #
+// #                                                                                               #
+// # 3. Neither the name of the copyright holder nor the names of its contributors may be used to  #
+// #    endorse or promote products derived from this software without specific prior written      #
+// #    permission.                                                                                #
+// #                                                                                               #
+// # THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS   #
+// # OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF               #
+// # MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE    #
+// # COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,     #
+// # EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE #
+// # GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED    #
+// # AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING     #
+// # NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED  #
+// # OF THE POSSIBILITY OF SUCH DAMAGE.                                                            #
+// # ********************************************************************************************* #
+// # The NEORV32 Processor - https://github.com/stnolting/neorv32              (c) Stephan Nolting #
+// #################################################################################################
+
+
+// Host-side uploader for the bootloader's block upload protocol ("x" command):
+// data is sent in blocks of up to 64 bytes, each protected by a CRC32; bad blocks
+// are rejected by the bootloader and sent again. Optionally, the UART baud rate is
+// switched to a higher rate for the actual upload.
+// Compile: g++ uart_block_upload.cpp -o uart_block_upload (Linux/POSIX only) or "make upload_tool" in any application folder
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+
+// protocol (has to match the bootloader)
+#define BLOCK_CMD_DATA 0x01
+#define BLOCK_CMD_BAUD 0x02
+#define BLOCK_CMD_END  0x04
+#define BLOCK_RSP_ACK  0x06
+#define BLOCK_RSP_NAK  0x15
+#define BLOCK_CMD_SYNC 0x16
+#define BLOCK_MAX_SIZE 64 // has to match the bootloader
+
+#define MAX_RETRIES 10
+
+
+/**********************************************************************//**
+ * Update CRC32 (IEEE 802.3, reflected, polynomial 0xEDB88320) with one data byte.
+ **************************************************************************/
+uint32_t crc32_update(uint32_t crc, uint8_t d) {
+
+  int i;
+  crc ^= (uint32_t)d;
+  for (i=0; i<8; i++) {
+    crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+  }
+  return crc;
+}
+
+
+/**********************************************************************//**
+ * Convert numeric baud rate to termios speed.
+ **************************************************************************/
+speed_t baud_to_speed(unsigned long baud) {
+
+  switch (baud) {
+    case 9600:    return B9600;
+    case 19200:   return B19200;
+    case 38400:   return B38400;
+    case 57600:   return B57600;
+    case 115200:  return B115200;
+    case 230400:  return B230400;
+#ifdef B460800
+    case 460800:  return B460800;
+    case 500000:  return B500000;
+    case 576000:  return B576000;
+    case 921600:  return B921600;
+    case 1000000: return B1000000;
+    case 1152000: return B1152000;
+    case 1500000: return B1500000;
+    case 2000000: return B2000000;
+    case 2500000: return B2500000;
+    case 3000000: return B3000000;
+    case 3500000: return B3500000;
+    case 4000000: return B4000000;
+#endif
+    default:      return B0;
+  }
+}
+
+
+/**********************************************************************//**
+ * Configure serial port (raw mode, 8N1, no flow control).
+ **************************************************************************/
+int port_config(int fd, unsigned long baud) {
+
+  struct termios tty;
+  speed_t speed = baud_to_speed(baud);
+
+  if (speed == B0) {
+    printf("Unsupported baud rate %lu!\n", baud);
+    return -1;
+  }
+  if (tcgetattr(fd, &tty) != 0) {
+    return -1;
+  }
+  cfmakeraw(&tty);
+  tty.c_cflag &= ~(CSTOPB | CRTSCTS | PARENB);
+  tty.c_cflag |= CLOCAL | CREAD;
+  tty.c_cc[VMIN]  = 0;
+  tty.c_cc[VTIME] = 0;
+  cfsetispeed(&tty, speed);
+  cfsetospeed(&tty, speed);
+  if (tcsetattr(fd, TCSANOW, &tty) != 0) {
+    return -1;
+  }
+  tcflush(fd, TCIOFLUSH);
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Wait for ACK/NAK response (other chars - e.g. console text - are ignored).
+ *
+ * @return 1 = ACK, 0 = NAK, -1 = timeout.
+ **************************************************************************/
+int get_response(int fd, int timeout_ms) {
+
+  struct pollfd pfd;
+  unsigned char c;
+
+  pfd.fd = fd;
+  pfd.events = POLLIN;
+
+  while (poll(&pfd, 1, timeout_ms) > 0) {
+    if (read(fd, &c, 1) != 1) {
+      continue;
+    }
+    if (c == BLOCK_RSP_ACK) {
+      return 1;
+    }
+    if (c == BLOCK_RSP_NAK) {
+      return 0;
+    }
+  }
+  return -1;
+}
+
+
+/**********************************************************************//**
+ * Send frame and wait for ACK (resend on NAK/timeout).
+ *
+ * @return 0 if acknowledged, -1 on error.
+ **************************************************************************/
+int send_frame(int fd, const unsigned char *frame, int len, int timeout_ms) {
+
+  int retry;
+  for (retry=0; retry<MAX_RETRIES; retry++) {
+    tcflush(fd, TCIFLUSH); // discard stale responses
+    if (write(fd, frame, len) != len) {
+      return -1;
+    }
+    tcdrain(fd);
+    if (get_response(fd, timeout_ms) == 1) {
+      return 0;
+    }
+  }
+  return -1;
+}
+
+
+/**********************************************************************//**
+ * Synchronize with bootloader.
+ *
+ * @return 0 if bootloader responded, -1 on error.
+ **************************************************************************/
+int sync_bootloader(int fd) {
+
+  unsigned char c = BLOCK_CMD_SYNC;
+  return send_frame(fd, &c, 1, 200);
+}
+
+
+int main(int argc, char *argv[]) {
+
+  if ((argc != 3) && (argc != 4) && (argc != 5)) {
+    printf("<<< NEORV32 bootloader block upload tool >>>\n"
+           "Upload executable via serial port (UART) to the NEORV32 bootloader using\n"
+           "the block upload protocol (CRC32-protected blocks with retransmission).\n"
+           "Make sure the bootloader is in console mode (auto-boot aborted).\n"
+           "Usage:   uart_block_upload <port> <NEORV32 executable> [baud] [upload baud]\n"
+           "Example: uart_block_upload /dev/ttyUSB0 neorv32_exe.bin 19200 921600\n");
+    return 0;
+  }
+
+  unsigned long baud    = (argc > 3) ? strtoul(argv[3], NULL, 0) : 19200;
+  unsigned long up_baud = (argc > 4) ? strtoul(argv[4], NULL, 0) : baud;
+  unsigned char frame[BLOCK_MAX_SIZE + 8];
+  uint32_t crc = 0;
+  int i = 0;
+
+  // read executable
+  FILE *input = fopen(argv[2], "rb");
+  if (input == NULL) {
+    printf("Input file error!\n");
+    return 2;
+  }
+  fseek(input, 0L, SEEK_END);
+  long size = ftell(input);
+  rewind(input);
+  unsigned char *exe = (unsigned char*)malloc(size > 0 ? size : 1);
+  if ((size <= 0) || (fread(exe, 1, size, input) != (size_t)size)) {
+    printf("Input file error!\n");
+    return 2;
+  }
+  fclose(input);
+
+  // open serial port
+  int fd = open(argv[1], O_RDWR | O_NOCTTY);
+  if ((fd < 0) || (port_config(fd, baud) != 0)) {
+    printf("Serial port error!\n");
+    return 3;
+  }
+  if (baud_to_speed(up_baud) == B0) {
+    printf("Unsupported baud rate %lu!\n", up_baud);
+    return 3;
+  }
+
+  // start block upload and sync
+  frame[0] = 'x';
+  if (write(fd, frame, 1) != 1) {
+    printf("Serial port error!\n");
+    return 3;
+  }
+  usleep(100000);
+  if (sync_bootloader(fd) != 0) {
+    printf("No response from bootloader. Reset processor and abort auto-boot before starting the upload.\n");
+    return 4;
+  }
+
+  // switch baud rate
+  if (up_baud != baud) {
+    frame[0] = BLOCK_CMD_BAUD;
+    crc = 0xffffffff;
+    for (i=0; i<4; i++) {
+      frame[1+i] = (unsigned char)(up_baud >> (i*8));
+      crc = crc32_update(crc, frame[1+i]);
+    }
+    crc = ~crc;
+    for (i=0; i<4; i++) {
+      frame[5+i] = (unsigned char)(crc >> (i*8));
+    }
+    if (send_frame(fd, frame, 9, 500) != 0) {
+      printf("Baud rate switch rejected!\n");
+      return 5;
+    }
+    usleep(20000);
+    if ((port_config(fd, up_baud) != 0) || (sync_bootloader(fd) != 0)) {
+      printf("No response from bootloader after baud rate switch (%lu)!\n", up_baud);
+      return 5;
+    }
+  }
+
+  // send data blocks
+  long pos = 0;
+  unsigned char seq = 0;
+  printf("Uploading %ld bytes @ %lu baud... ", size, up_baud);
+  fflush(stdout);
+  while (pos < size) {
+    int len = ((size - pos) > BLOCK_MAX_SIZE) ? BLOCK_MAX_SIZE : (int)(size - pos);
+    frame[0] = BLOCK_CMD_DATA;
+    frame[1] = seq;
+    frame[2] = (unsigned char)(len & 0xff);
+    frame[3] = (unsigned char)(len >> 8);
+    memcpy(&frame[4], &exe[pos], len);
+    crc = 0xffffffff;
+    for (i=1; i<(4+len); i++) {
+      crc = crc32_update(crc, frame[i]);
+    }
+    crc = ~crc;
+    for (i=0; i<4; i++) {
+      frame[4+len+i] = (unsigned char)(crc >> (i*8));
+    }
+    if (send_frame(fd, frame, len+8, 3000) != 0) {
+      printf("\nUpload error (block %ld)!\n", pos / BLOCK_MAX_SIZE);
+      return 6;
+    }
+    pos += len;
+    seq++;
+  }
+
+  // end of upload; bootloader responds with ACK if the executable is valid
+  frame[0] = BLOCK_CMD_END;
+  tcflush(fd, TCIFLUSH);
+  if ((write(fd, frame, 1) != 1) || (tcdrain(fd) != 0)) {
+    printf("\nSerial port error!\n");
+    return 3;
+  }
+  int rsp = get_response(fd, 3000);
+  port_config(fd, baud); // bootloader is back at default baud rate
+  close(fd);
+  free(exe);
+
+  if (rsp != 1) {
+    printf("\nChecksum error!\n");
+    return 7;
+  }
+  printf("OK\n");
+  return 0;
+}
@@ -190,6 +190,16 @@ enum NEORV32_CSR_enum {
   CSR_PMPADDR62      = 0x3ee, /**< 0x3ee - pmpaddr62 (r/w): Physical memory protection address register 62 */
   CSR_PMPADDR63      = 0x3ef, /**< 0x3ef - pmpaddr63 (r/w): Physical memory protection address register 63 */
 
+  CSR_TSELECT        = 0x7a0, /**< 0x7a0 - tselect (r/w): Trigger module - trigger select */
+  CSR_TDATA1         = 0x7a1, /**< 0x7a1 - tdata1  (r/w): Trigger module - trigger configuration (mcontrol) */
+  CSR_TDATA2         = 0x7a2, /**< 0x7a2 - tdata2  (r/w): Trigger module - trigger compare address */
+  CSR_TDATA3         = 0x7a3, /**< 0x7a3 - tdata3  (r/w): Trigger module - trigger match counter (custom) */
+  CSR_TINFO          = 0x7a4, /**< 0x7a4 - tinfo   (r/-): Trigger module - supported trigger types */
+  CSR_TCONTROL       = 0x7a5, /**< 0x7a5 - tcontrol (r/w): Trigger module - M-mode trigger enable */
+
+  CSR_MICACHECTL     = 0x7c0, /**< 0x7c0 - micachectl (custom CSR) (r/w): I-cache locking control and status */
+  CSR_MICACHEPRE     = 0x7c1, /**< 0x7c1 - micachepre (custom CSR) (r/w): I-cache block preload address */
+
   CSR_MCYCLE         = 0xb00, /**< 0xb00 - mcycle   (r/w): Machine cycle counter low word */
   CSR_MINSTRET       = 0xb02, /**< 0xb02 - minstret (r/w): Machine instructions-retired counter low word */
 
@@ -424,7 +434,89 @@ enum NEORV32_CSR_MZEXT_enum {
   CSR_MZEXT_ZXNOCNT   =  7, /**< CPU mzext CSR (7): Custom extension - NO CPU counters: "cycle" & "instret" CSRs are NOT available at all when set (r/-) */
   CSR_MZEXT_PMP       =  8, /**< CPU mzext CSR (8): PMP (physical memory protection) extension available when set (r/-) */
   CSR_MZEXT_HPM       =  9, /**< CPU mzext CSR (9): HPM (hardware performance monitors) extension available when set (r/-) */
-  CSR_MZEXT_DEBUGMODE = 10  /**< CPU mzext CSR (10): RISC-V CPU debug mode available when set (r/-) */
+  CSR_MZEXT_DEBUGMODE = 10, /**< CPU mzext CSR (10): RISC-V CPU debug mode available when set (r/-) */
+  CSR_MZEXT_SDTRIG    = 11  /**< CPU mzext CSR (11): RISC-V hardware trigger module (Sdtrig) available when set (r/-) */
+};
+
+
+/**********************************************************************//**
+ * CPU <b>pmpcfg</b> PMP configuration attributes (per entry)
+ **************************************************************************/
+enum NEORV32_PMPCFG_ATTRIBUTES_enum {
+  PMPCFG_R     = 0, /**< PMP entry (0): Read permission (r/w) */
+  PMPCFG_W     = 1, /**< PMP entry (1): Write permission (r/w) */
+  PMPCFG_X     = 2, /**< PMP entry (2): Execute permission (r/w) */
+  PMPCFG_A_LSB = 3, /**< PMP entry (3): Mode LSB (r/w) */
+  PMPCFG_A_MSB = 4, /**< PMP entry (4): Mode MSB (r/w) */
+  PMPCFG_L     = 7  /**< PMP entry (7): Locked entry (r/w) */
+};
+
+
+/**********************************************************************//**
+ * PMP modes (pmpcfg A bits)
+ **************************************************************************/
+enum NEORV32_PMP_MODES_enum {
+  PMP_OFF   = 0, /**< '00': entry disabled */
+  PMP_TOR   = 1, /**< '01': top of range */
+  PMP_NA4   = 2, /**< '10': naturally aligned four-byte region */
+  PMP_NAPOT = 3  /**< '11': naturally aligned power-of-two region */
+};
+
+
+/**********************************************************************//**
+ * CPU <b>tdata1</b> trigger configuration bits (address/data match trigger, mcontrol)
+ **************************************************************************/
+enum NEORV32_TDATA1_enum {
+  TDATA1_LOAD       =  0, /**< CPU tdata1 CSR (0): Fire on load address match (r/w) */
+  TDATA1_STORE      =  1, /**< CPU tdata1 CSR (1): Fire on store address match (r/w) */
+  TDATA1_EXECUTE    =  2, /**< CPU tdata1 CSR (2): Fire on instruction address match (r/w) */
+  TDATA1_U          =  3, /**< CPU tdata1 CSR (3): Trigger enabled in user mode (r/w) */
+  TDATA1_M          =  6, /**< CPU tdata1 CSR (6): Trigger enabled in machine mode (r/w) */
+  TDATA1_MATCH_LSB  =  7, /**< CPU tdata1 CSR (7): Match type LSB (r/w) */
+  TDATA1_MATCH_MSB  = 10, /**< CPU tdata1 CSR (10): Match type MSB (r/w) */
+  TDATA1_ACTION_LSB = 12, /**< CPU tdata1 CSR (12): Trigger action LSB (r/w) */
+  TDATA1_ACTION_MSB = 15, /**< CPU tdata1 CSR (15): Trigger action MSB (r/w) */
+  TDATA1_HIT        = 20, /**< CPU tdata1 CSR (20): Trigger has fired (r/w) */
+  TDATA1_DMODE      = 27  /**< CPU tdata1 CSR (27): Trigger owned by debug mode (r/w) */
+};
+
+
+/**********************************************************************//**
+ * CPU <b>micachectl</b> custom CSR (r/w): I-cache locking control and status
+ **************************************************************************/
+enum NEORV32_CSR_MICACHECTL_enum {
+  CSR_MICACHECTL_LOCK   =  0, /**< CPU micachectl CSR  (0) (r/w): Lock blocks loaded via micachepre */
+  CSR_MICACHECTL_UNLOCK =  1, /**< CPU micachectl CSR  (1) (-/w): Unlock all blocks (single-shot, always reads zero) */
+  CSR_MICACHECTL_FAIL   = 30, /**< CPU micachectl CSR (30) (r/-): Last preload failed (no unlocked way available or bus error) */
+  CSR_MICACHECTL_BUSY   = 31  /**< CPU micachectl CSR (31) (r/-): Preload in progress */
+};
+
+
+/**********************************************************************//**
+ * CPU <b>tcontrol</b> trigger control bits
+ **************************************************************************/
+enum NEORV32_TCONTROL_enum {
+  TCONTROL_MTE  = 3, /**< CPU tcontrol CSR (3): M-mode breakpoint exception triggers enabled (r/w) */
+  TCONTROL_MPTE = 7  /**< CPU tcontrol CSR (7): Previous MTE state, saved on trap entry, restored by mret (r/w) */
+};
+
+
+/**********************************************************************//**
+ * Trigger match types (tdata1 match bits)
+ **************************************************************************/
+enum NEORV32_TRIGGER_MATCH_enum {
+  TRIGGER_MATCH_EQUAL = 0, /**< '0000': address equals tdata2 */
+  TRIGGER_MATCH_NAPOT = 1  /**< '0001': address within naturally aligned power-of-two region encoded in tdata2 */
+};
+
+
+/**********************************************************************//**
+ * Trigger actions (tdata1 action bits)
+ **************************************************************************/
+enum NEORV32_TRIGGER_ACTION_enum {
+  TRIGGER_ACTION_BREAK = 0x0, /**< '0000': raise breakpoint exception */
+  TRIGGER_ACTION_DEBUG = 0x1, /**< '0001': enter debug mode (debug mode triggers only) */
+  TRIGGER_ACTION_COUNT = 0xf  /**< '1111': count matches in tdata3 only, no trap (custom) */
 };
 
 
@@ -448,7 +540,12 @@ enum NEORV32_HPMCNT_EVENT_enum {
   HPMCNT_EVENT_TBRANCH = 12, /**< CPU mhpmevent CSR (12): Conditional taken branch */
 
   HPMCNT_EVENT_TRAP    = 13, /**< CPU mhpmevent CSR (13): Entered trap */
-  HPMCNT_EVENT_ILLEGAL = 14  /**< CPU mhpmevent CSR (14): Illegal instruction exception */
+  HPMCNT_EVENT_ILLEGAL = 14, /**< CPU mhpmevent CSR (14): Illegal instruction exception */
+
+  HPMCNT_EVENT_PF_USE  = 15, /**< CPU mhpmevent CSR (15): I-cache useful prefetch (prefetched block was used) */
+  HPMCNT_EVENT_PF_NUSE = 16, /**< CPU mhpmevent CSR (16): I-cache useless prefetch (prefetched block was discarded) */
+  HPMCNT_EVENT_IC_ACC  = 17, /**< CPU mhpmevent CSR (17): I-cache access */
+  HPMCNT_EVENT_IC_MISS = 18  /**< CPU mhpmevent CSR (18): I-cache miss */
 };
 
 
@@ -539,9 +636,11 @@ enum NEORV32_CLOCK_PRSC_enum {
  **************************************************************************/
 /**@{*/
 /** instruction memory base address (r/w/x) */
-// -> configured via ispace_base_c constant in neorv32_package.vhd and available to SW via SYSCONFIG entry
+// -> configured via ispace_base_c constant in neorv32_package.vhd (or top's MEM_INT_IMEM_BASE generic) and available to SW via SYSCONFIG entry
 /** data memory base address (r/w/x) */
-// -> configured via dspace_base_c constant in neorv32_package.vhd and available to SW via SYSCONFIG entry
+// -> configured via dspace_base_c constant in neorv32_package.vhd (or top's MEM_INT_DMEM_BASE generic) and available to SW via SYSCONFIG entry
+/** additional internal memory banks (r/w/x) */
+// -> configured via top's MEM_INT_XMEM_BASE/MEM_INT_XMEM_SIZE generics; number of banks available to SW via SYSCONFIG entry
 /** bootloader memory base address (r/-/x) */
 #define BOOTLOADER_BASE_ADDRESS (0xFFFF0000UL)
 /** peripheral/IO devices memory base address (r/w/x) */
@@ -778,6 +877,190 @@ enum NEORV32_SLINK_STATUS_enum {
 /**@}*/
 
 
+/**********************************************************************//**
+ * @name IO Device: Instruction Trace Encoder (TRACE)
+ **************************************************************************/
+/**@{*/
+/** TRACE base address */
+#define TRACE_BASE (0xFFFFFF00UL) // /**< TRACE base address */
+/** TRACE address space size in bytes */
+#define TRACE_SIZE (4*4) // /**< TRACE address space size in bytes */
+
+/** TRACE control register (r/w) */
+#define TRACE_CT   (*(IO_REG32 (TRACE_BASE + 0)))
+/** TRACE buffer write pointer (r/-) */
+#define TRACE_WPTR (*(IO_ROM32 (TRACE_BASE + 4)))
+/** TRACE buffer read pointer (r/w) */
+#define TRACE_RPTR (*(IO_REG32 (TRACE_BASE + 8)))
+/** TRACE buffer data at read pointer, auto-increments read pointer (r/-) */
+#define TRACE_DATA (*(IO_ROM32 (TRACE_BASE + 12)))
+
+/** TRACE control register bits */
+enum NEORV32_TRACE_CT_enum {
+  TRACE_CT_EN     =  0, /**< TRACE control register(0) (r/w): Trace encoder enable */
+  TRACE_CT_STREAM =  1, /**< TRACE control register(1) (r/w): Trace sink: 0 = trace buffer, 1 = stream port */
+  TRACE_CT_STOP   =  2, /**< TRACE control register(2) (r/w): Buffer mode: 0 = ring buffer, 1 = stop when full */
+  TRACE_CT_SYNC0  =  3, /**< TRACE control register(3) (r/w): Periodic SYNC packet every 2^(n+3) packets (0 = off), bit 0 */
+  TRACE_CT_SYNC1  =  4, /**< TRACE control register(4) (r/w): Periodic SYNC packet every 2^(n+3) packets (0 = off), bit 1 */
+  TRACE_CT_SYNC2  =  5, /**< TRACE control register(5) (r/w): Periodic SYNC packet every 2^(n+3) packets (0 = off), bit 2 */
+  TRACE_CT_SYNC3  =  6, /**< TRACE control register(6) (r/w): Periodic SYNC packet every 2^(n+3) packets (0 = off), bit 3 */
+
+  TRACE_CT_BUF_S0 = 24, /**< TRACE control register(24) (r/-): log2(trace buffer size) bit 0 */
+  TRACE_CT_BUF_S1 = 25, /**< TRACE control register(25) (r/-): log2(trace buffer size) bit 1 */
+  TRACE_CT_BUF_S2 = 26, /**< TRACE control register(26) (r/-): log2(trace buffer size) bit 2 */
+  TRACE_CT_BUF_S3 = 27, /**< TRACE control register(27) (r/-): log2(trace buffer size) bit 3 */
+  TRACE_CT_BUF_EN = 28, /**< TRACE control register(28) (r/-): Trace buffer implemented */
+  TRACE_CT_WRAP   = 29, /**< TRACE control register(29) (r/-): Ring buffer has wrapped around */
+  TRACE_CT_OVFL   = 30, /**< TRACE control register(30) (r/-): Trace data has been dropped */
+  TRACE_CT_FULL   = 31  /**< TRACE control register(31) (r/-): Trace buffer is full (stop mode) */
+};
+/**@}*/
+
+
+/**********************************************************************//**
+ * @name IO Device: Block Memory Copy/Fill Engine (MEMCPY)
+ **************************************************************************/
+/**@{*/
+/** MEMCPY base address */
+#define MEMCPY_BASE (0xFFFFFF10UL) // /**< MEMCPY base address */
+/** MEMCPY address space size in bytes */
+#define MEMCPY_SIZE (4*4) // /**< MEMCPY address space size in bytes */
+
+/** MEMCPY control register (r/w) */
+#define MEMCPY_CT  (*(IO_REG32 (MEMCPY_BASE + 0)))
+/** MEMCPY source address / fill pattern (r/w) */
+#define MEMCPY_SRC (*(IO_REG32 (MEMCPY_BASE + 4)))
+/** MEMCPY destination address (r/w) */
+#define MEMCPY_DST (*(IO_REG32 (MEMCPY_BASE + 8)))
+/** MEMCPY number of (remaining) words, writing a non-zero value starts the operation (r/w) */
+#define MEMCPY_NUM (*(IO_REG32 (MEMCPY_BASE + 12)))
+
+/** MEMCPY control register bits */
+enum NEORV32_MEMCPY_CT_enum {
+  MEMCPY_CT_EN   =  0, /**< MEMCPY control register(0)  (r/w): Engine enable, clearing aborts current operation */
+  MEMCPY_CT_FILL =  1, /**< MEMCPY control register(1)  (r/w): Operation: 0 = copy SRC to DST, 1 = fill DST with SRC pattern */
+  MEMCPY_CT_ERR  = 30, /**< MEMCPY control register(30) (r/-): Last operation was aborted due to a bus error */
+  MEMCPY_CT_BUSY = 31  /**< MEMCPY control register(31) (r/-): Operation in progress */
+};
+/**@}*/
+
+
+/**********************************************************************//**
+ * @name Execute In Place Flash Controller (XIP)
+ **************************************************************************/
+/**@{*/
+/** XIP control register base address */
+#define XIP_CT_BASE (0xFFFFFC00UL) // /**< XIP control register base address */
+/** XIP control register address space size in bytes */
+#define XIP_CT_SIZE (2*4) // /**< XIP control register address space size in bytes */
+
+/** XIP control register (r/w) */
+#define XIP_CT   (*(IO_REG32 (XIP_CT_BASE + 0)))
+/** XIP direct SPI data register (r/w), writing starts a byte transfer (only if XIP is disabled) */
+#define XIP_DATA (*(IO_REG32 (XIP_CT_BASE + 4)))
+
+#ifndef XIP_MEM_BASE
+/** XIP flash window base address (has to match the processor's XIP_BASE generic) */
+#define XIP_MEM_BASE (0x20000000UL)
+#endif
+
+/** XIP control register bits */
+enum NEORV32_XIP_CT_enum {
+  XIP_CT_EN      =  0, /**< XIP control register(0)  (r/w): XIP enable (memory-mapped flash access), direct SPI mode when cleared */
+  XIP_CT_PRSC0   =  1, /**< XIP control register(1)  (r/w): Clock prescaler select bit 0 */
+  XIP_CT_PRSC1   =  2, /**< XIP control register(2)  (r/w): Clock prescaler select bit 1 */
+  XIP_CT_PRSC2   =  3, /**< XIP control register(3)  (r/w): Clock prescaler select bit 2 */
+  XIP_CT_MODE0   =  4, /**< XIP control register(4)  (r/w): Read mode bit 0 */
+  XIP_CT_MODE1   =  5, /**< XIP control register(5)  (r/w): Read mode bit 1 */
+  XIP_CT_DUMMY0  =  6, /**< XIP control register(6)  (r/w): Number of dummy clock cycles bit 0 */
+  XIP_CT_DUMMY1  =  7, /**< XIP control register(7)  (r/w): Number of dummy clock cycles bit 1 */
+  XIP_CT_DUMMY2  =  8, /**< XIP control register(8)  (r/w): Number of dummy clock cycles bit 2 */
+  XIP_CT_DUMMY3  =  9, /**< XIP control register(9)  (r/w): Number of dummy clock cycles bit 3 */
+  XIP_CT_CMD_LSB = 10, /**< XIP control register(10) (r/w): Flash read command, LSB */
+  XIP_CT_CMD_MSB = 17, /**< XIP control register(17) (r/w): Flash read command, MSB */
+  XIP_CT_BURST   = 18, /**< XIP control register(18) (r/w): Allow burst continuation of sequential accesses */
+  XIP_CT_DCS     = 19, /**< XIP control register(19) (r/w): Direct SPI mode: assert chip-select */
+
+  XIP_CT_BUSY    = 31  /**< XIP control register(31) (r/-): Serial engine busy */
+};
+
+/** XIP read modes */
+enum NEORV32_XIP_MODE_enum {
+  XIP_MODE_SPI  = 0, /**< Single SPI (1-1-1), e.g. fast read 0x0B */
+  XIP_MODE_DUAL = 1, /**< Dual output (1-1-2), e.g. 0x3B */
+  XIP_MODE_QOUT = 2, /**< Quad output (1-1-4), e.g. 0x6B */
+  XIP_MODE_QIO  = 3  /**< Quad I/O (1-4-4), e.g. 0xEB */
+};
+/**@}*/
+
+
+/**********************************************************************//**
+ * @name IO Device: Direct Memory Access Controller (DMA)
+ **************************************************************************/
+/**@{*/
+/** DMA base address */
+#define DMA_BASE (0xFFFFFF20UL) // /**< DMA base address */
+/** DMA address space size in bytes */
+#define DMA_SIZE (8*4) // /**< DMA address space size in bytes */
+
+/** DMA control register (r/w) */
+#define DMA_CT   (*(IO_REG32 (DMA_BASE + 0)))
+/** DMA status register (r/c) */
+#define DMA_STAT (*(IO_REG32 (DMA_BASE + 4)))
+/** DMA source address of selected channel (r/w) */
+#define DMA_SRC  (*(IO_REG32 (DMA_BASE + 8)))
+/** DMA destination address of selected channel (r/w) */
+#define DMA_DST  (*(IO_REG32 (DMA_BASE + 12)))
+/** DMA transfer configuration of selected channel (r/w) */
+#define DMA_CFG  (*(IO_REG32 (DMA_BASE + 16)))
+
+/** DMA control register bits */
+enum NEORV32_DMA_CT_enum {
+  DMA_CT_EN      =  0, /**< DMA control register(0)  (r/w): DMA enable, clearing aborts all channels */
+  DMA_CT_SEL0    =  2, /**< DMA control register(2)  (r/w): Channel select for DMA_SRC/DMA_DST/DMA_CFG, bit 0 */
+  DMA_CT_SEL1    =  3, /**< DMA control register(3)  (r/w): Channel select for DMA_SRC/DMA_DST/DMA_CFG, bit 1 */
+  DMA_CT_IRQ0    =  8, /**< DMA control register(8)  (r/w): Channel 0 transfer done interrupt enable */
+  DMA_CT_IRQ1    =  9, /**< DMA control register(9)  (r/w): Channel 1 transfer done interrupt enable */
+  DMA_CT_IRQ2    = 10, /**< DMA control register(10) (r/w): Channel 2 transfer done interrupt enable */
+  DMA_CT_IRQ3    = 11, /**< DMA control register(11) (r/w): Channel 3 transfer done interrupt enable */
+  DMA_CT_NUM_CH0 = 28, /**< DMA control register(28) (r/-): Number of implemented channels minus 1, bit 0 */
+  DMA_CT_NUM_CH1 = 29  /**< DMA control register(29) (r/-): Number of implemented channels minus 1, bit 1 */
+};
+
+/** DMA status register bits */
+enum NEORV32_DMA_STAT_enum {
+  DMA_STAT_DONE0 =  0, /**< DMA status register(0)  (r/c): Channel 0 transfer done, write 0 to clear */
+  DMA_STAT_DONE1 =  1, /**< DMA status register(1)  (r/c): Channel 1 transfer done, write 0 to clear */
+  DMA_STAT_DONE2 =  2, /**< DMA status register(2)  (r/c): Channel 2 transfer done, write 0 to clear */
+  DMA_STAT_DONE3 =  3, /**< DMA status register(3)  (r/c): Channel 3 transfer done, write 0 to clear */
+  DMA_STAT_ERR0  =  8, /**< DMA status register(8)  (r/c): Channel 0 bus error, write 0 to clear */
+  DMA_STAT_ERR1  =  9, /**< DMA status register(9)  (r/c): Channel 1 bus error, write 0 to clear */
+  DMA_STAT_ERR2  = 10, /**< DMA status register(10) (r/c): Channel 2 bus error, write 0 to clear */
+  DMA_STAT_ERR3  = 11, /**< DMA status register(11) (r/c): Channel 3 bus error, write 0 to clear */
+  DMA_STAT_BUSY0 = 16, /**< DMA status register(16) (r/-): Channel 0 transfer in progress */
+  DMA_STAT_BUSY1 = 17, /**< DMA status register(17) (r/-): Channel 1 transfer in progress */
+  DMA_STAT_BUSY2 = 18, /**< DMA status register(18) (r/-): Channel 2 transfer in progress */
+  DMA_STAT_BUSY3 = 19  /**< DMA status register(19) (r/-): Channel 3 transfer in progress */
+};
+
+/** DMA channel configuration register bits */
+enum NEORV32_DMA_CFG_enum {
+  DMA_CFG_NUM_LSB   =  0, /**< DMA configuration register(0)  (r/w): Number of (remaining) transfer units, LSB */
+  DMA_CFG_NUM_MSB   = 15, /**< DMA configuration register(15) (r/w): Number of (remaining) transfer units, MSB */
+  DMA_CFG_SIZE_LSB  = 16, /**< DMA configuration register(16) (r/w): Transfer unit size (0 = byte, 1 = half-word, 2 = word), LSB */
+  DMA_CFG_SIZE_MSB  = 17, /**< DMA configuration register(17) (r/w): Transfer unit size, MSB */
+  DMA_CFG_SRC_INC   = 18, /**< DMA configuration register(18) (r/w): Auto-increment source address */
+  DMA_CFG_DST_INC   = 19, /**< DMA configuration register(19) (r/w): Auto-increment destination address */
+  DMA_CFG_BURST_LSB = 20, /**< DMA configuration register(20) (r/w): log2(burst length), LSB */
+  DMA_CFG_BURST_MSB = 22, /**< DMA configuration register(22) (r/w): log2(burst length), MSB */
+  DMA_CFG_TRIG_LSB  = 24, /**< DMA configuration register(24) (r/w): Trigger (0 = software, n = fast IRQ channel n-1), LSB */
+  DMA_CFG_TRIG_MSB  = 27, /**< DMA configuration register(27) (r/w): Trigger, MSB */
+  DMA_CFG_PEND      = 30, /**< DMA configuration register(30) (r/w): Trigger event pending */
+  DMA_CFG_START     = 31  /**< DMA configuration register(31) (r/w): Start (write 1) / abort (write 0) transfer; read: channel busy */
+};
+/**@}*/
+
+
 /**********************************************************************//**
  * @name IO Device: External Interrupt Controller (XIRQ)
  **************************************************************************/
@@ -823,6 +1106,24 @@ enum NEORV32_SLINK_STATUS_enum {
 /**@}*/
 
 
+/**********************************************************************//**
+ * @name IO Device: Core-Local Interruptor (CLINT)
+ **************************************************************************/
+/**@{*/
+/** CLINT base address */
+#define CLINT_BASE (0xFFFFFF40UL) // /**< CLINT base address */
+/** CLINT address space size in bytes */
+#define CLINT_SIZE (16*4) // /**< CLINT address space size in bytes */
+
+/** CLINT machine software interrupt pending register of hart x (x = 0..3) (r/w) */
+#define CLINT_MSIP(x)        (*(IO_REG32 (CLINT_BASE + 0x00 + 4*(x))))
+/** CLINT machine timer compare register of hart x (x = 0..3), low word (r/w) */
+#define CLINT_MTIMECMP_LO(x) (*(IO_REG32 (CLINT_BASE + 0x20 + 8*(x))))
+/** CLINT machine timer compare register of hart x (x = 0..3), high word (r/w) */
+#define CLINT_MTIMECMP_HI(x) (*(IO_REG32 (CLINT_BASE + 0x24 + 8*(x))))
+/**@}*/
+
+
 /**********************************************************************//**
  * @name IO Device: Primary/Secondary Universal Asynchronous Receiver and Transmitter (UART0 / UART1)
  **************************************************************************/
@@ -863,6 +1164,13 @@ enum NEORV32_UART_CT_enum {
   UART_CT_BAUD10   = 10, /**< UART control register(10) (r/w): BAUD rate config value (12-bit, bit 9) */
   UART_CT_BAUD11   = 11, /**< UART control register(11) (r/w): BAUD rate config value msb (12-bit, bit 0) */
   UART_CT_SIM_MODE = 12, /**< UART control register(12) (r/w): Simulation output override enable, for use in simulation only */
+  UART_CT_RX_NEMP  = 13, /**< UART control register(13) (r/-): RX FIFO not empty */
+  UART_CT_RX_HALF  = 14, /**< UART control register(14) (r/-): RX FIFO at least half-full */
+  UART_CT_RX_FULL  = 15, /**< UART control register(15) (r/-): RX FIFO full */
+  UART_CT_TX_EMPTY = 16, /**< UART control register(16) (r/-): TX FIFO empty */
+  UART_CT_TX_NHALF = 17, /**< UART control register(17) (r/-): TX FIFO not at least half-full */
+  UART_CT_TX_FULL  = 18, /**< UART control register(18) (r/-): TX FIFO full */
+  UART_CT_HS_EN    = 19, /**< UART control register(19) (r/w): High-speed mode enable (fractional baud generator, oversampling, RX majority vote) */
 
   UART_CT_RTS_EN   = 20, /**< UART control register(20) (r/w): Enable hardware flow control: Assert RTS output if UART.RX is ready to receive */
   UART_CT_CTS_EN   = 21, /**< UART control register(21) (r/w): Enable hardware flow control: UART.TX starts sending only if CTS input is asserted */
@@ -873,8 +1181,9 @@ enum NEORV32_UART_CT_enum {
   UART_CT_PRSC2    = 26, /**< UART control register(26) (r/w): BAUD rate clock prescaler select bit 2 */
   UART_CT_CTS      = 27, /**< UART control register(27) (r/-): current state of CTS input */
   UART_CT_EN       = 28, /**< UART control register(28) (r/w): UART global enable */
-
-  UART_CT_TX_BUSY  = 31  /**< UART control register(31) (r/-): Transmitter is busy when set */
+  UART_CT_RX_IRQ   = 29, /**< UART control register(29) (r/w): RX IRQ mode: 0 = RX FIFO not empty, 1 = RX FIFO at least half-full */
+  UART_CT_TX_IRQ   = 30, /**< UART control register(30) (r/w): TX IRQ mode: 0 = TX FIFO empty and transmitter idle, 1 = TX FIFO not at least half-full */
+  UART_CT_TX_BUSY  = 31  /**< UART control register(31) (r/-): Transmitter is busy or TX FIFO is not empty when set */
 };
 
 /** UART0/UART1 parity configuration */
@@ -936,8 +1245,20 @@ enum NEORV32_SPI_CT_enum {
   SPI_CT_PRSC2  = 12, /**< UART control register(12) (r/w): Clock prescaler select bit 2 */
   SPI_CT_SIZE0  = 13, /**< UART control register(13) (r/w): Transfer data size lsb (00: 8-bit, 01: 16-bit, 10: 24-bit, 11: 32-bit) */
   SPI_CT_SIZE1  = 14, /**< UART control register(14) (r/w): Transfer data size msb (00: 8-bit, 01: 16-bit, 10: 24-bit, 11: 32-bit) */
+  SPI_CT_IRQ0   = 15, /**< SPI control register(15) (r/w): IRQ mode lsb (00: each transfer done, 01: TX FIFO empty and idle) */
+  SPI_CT_IRQ1   = 16, /**< SPI control register(16) (r/w): IRQ mode msb (10: TX FIFO less than half-full, 11: RX FIFO at least half-full) */
+
+  SPI_CT_RX_AVAIL = 17, /**< SPI control register(17) (r/-): RX FIFO not empty */
+  SPI_CT_RX_HALF  = 18, /**< SPI control register(18) (r/-): RX FIFO at least half-full */
+  SPI_CT_RX_FULL  = 19, /**< SPI control register(19) (r/-): RX FIFO full */
+  SPI_CT_TX_EMPTY = 20, /**< SPI control register(20) (r/-): TX FIFO empty */
+  SPI_CT_TX_NHALF = 21, /**< SPI control register(21) (r/-): TX FIFO not at least half-full */
+  SPI_CT_TX_FULL  = 22, /**< SPI control register(22) (r/-): TX FIFO full */
+
+  SPI_CT_FIFO_LSB = 23, /**< SPI control register(23) (r/-): log2(FIFO size), lsb */
+  SPI_CT_FIFO_MSB = 26, /**< SPI control register(26) (r/-): log2(FIFO size), msb */
 
-  SPI_CT_BUSY   = 31  /**< UART control register(31) (r/-): SPI busy flag */
+  SPI_CT_BUSY   = 31  /**< UART control register(31) (r/-): SPI busy flag (transceiver busy or TX FIFO not empty) */
 };
 /**@}*/
 
@@ -958,23 +1279,40 @@ enum NEORV32_SPI_CT_enum {
 
 /** TWI control register bits */
 enum NEORV32_TWI_CT_enum {
-  TWI_CT_EN     =  0, /**< TWI control register(0) (r/w): TWI enable */
-  TWI_CT_START  =  1, /**< TWI control register(1) (-/w): Generate START condition, auto-clears */
-  TWI_CT_STOP   =  2, /**< TWI control register(2) (-/w): Generate STOP condition, auto-clears */
-  TWI_CT_PRSC0  =  3, /**< TWI control register(3) (r/w): Clock prescaler select bit 0 */
-  TWI_CT_PRSC1  =  4, /**< TWI control register(4) (r/w): Clock prescaler select bit 1 */
-  TWI_CT_PRSC2  =  5, /**< TWI control register(5) (r/w): Clock prescaler select bit 2 */
-  TWI_CT_MACK   =  6, /**< TWI control register(6) (r/w): Generate controller ACK for each transmission */
-  TWI_CT_CKSTEN =  7, /**< TWI control register(7) (r/w): Enable clock stretching (by peripheral) */
-
-  TWI_CT_ACK    = 30, /**< TWI control register(30) (r/-): ACK received when set */
-  TWI_CT_BUSY   = 31  /**< TWI control register(31) (r/-): Transfer in progress, busy flag */
+  TWI_CT_EN        =  0, /**< TWI control register(0) (r/w): TWI enable */
+  TWI_CT_START     =  1, /**< TWI control register(1) (-/w): Generate START condition, auto-clears */
+  TWI_CT_STOP      =  2, /**< TWI control register(2) (-/w): Generate STOP condition, auto-clears */
+  TWI_CT_PRSC0     =  3, /**< TWI control register(3) (r/w): Clock prescaler select bit 0 */
+  TWI_CT_PRSC1     =  4, /**< TWI control register(4) (r/w): Clock prescaler select bit 1 */
+  TWI_CT_PRSC2     =  5, /**< TWI control register(5) (r/w): Clock prescaler select bit 2 */
+  TWI_CT_MACK      =  6, /**< TWI control register(6) (r/w): Generate controller ACK for each transmission */
+  TWI_CT_CKSTEN    =  7, /**< TWI control register(7) (r/w): Enable clock stretching (by peripheral) */
+  TWI_CT_CDIV0     =  8, /**< TWI control register(8) (r/w): Clock divider bit 0 */
+  TWI_CT_CDIV1     =  9, /**< TWI control register(9) (r/w): Clock divider bit 1 */
+  TWI_CT_CDIV2     = 10, /**< TWI control register(10) (r/w): Clock divider bit 2 */
+  TWI_CT_CDIV3     = 11, /**< TWI control register(11) (r/w): Clock divider bit 3 */
+  TWI_CT_IRQ_SEQ   = 12, /**< TWI control register(12) (r/w): Interrupt when command sequence done (1) or on each transfer (0) */
+
+  TWI_CT_RX_AVAIL  = 20, /**< TWI control register(20) (r/-): RX FIFO not empty */
+  TWI_CT_RX_FULL   = 21, /**< TWI control register(21) (r/-): RX FIFO full */
+  TWI_CT_CMD_EMPTY = 22, /**< TWI control register(22) (r/-): Command FIFO empty */
+  TWI_CT_CMD_FULL  = 23, /**< TWI control register(23) (r/-): Command FIFO full */
+  TWI_CT_FIFO_LSB  = 24, /**< TWI control register(24) (r/-): log2(FIFO size), LSB */
+  TWI_CT_FIFO_MSB  = 27, /**< TWI control register(27) (r/-): log2(FIFO size), MSB */
+
+  TWI_CT_NACK      = 29, /**< TWI control register(29) (r/-): Byte not acknowledged (sticky, cleared by writing TWI_CT) */
+  TWI_CT_ACK       = 30, /**< TWI control register(30) (r/-): ACK received when set */
+  TWI_CT_BUSY      = 31  /**< TWI control register(31) (r/-): Transfer in progress or command FIFO not empty, busy flag */
 };
 
 /** WTD receive/transmit data register bits */
 enum NEORV32_TWI_DATA_enum {
-  TWI_DATA_LSB = 0, /**< TWI data register(0) (r/w): Receive/transmit data (8-bit) LSB */
-  TWI_DATA_MSB = 7  /**< TWI data register(7) (r/w): Receive/transmit data (8-bit) MSB */
+  TWI_DATA_LSB  =  0, /**< TWI data register(0) (r/w): Receive/transmit data (8-bit) LSB */
+  TWI_DATA_MSB  =  7, /**< TWI data register(7) (r/w): Receive/transmit data (8-bit) MSB */
+  TWI_DATA_MACK =  8, /**< TWI data register(8) (-/w): Generate controller ACK for this byte */
+  TWI_DATA_RX   =  9, /**< TWI data register(9) (-/w): Write received byte to RX FIFO */
+  TWI_DATA_CMD0 = 10, /**< TWI data register(10) (-/w): Command bit 0 (00 = data, 01 = START, 10 = STOP) */
+  TWI_DATA_CMD1 = 11  /**< TWI data register(11) (-/w): Command bit 1 */
 };
 /**@}*/
 
@@ -1125,9 +1463,9 @@ enum NEORV32_NEOLED_CT_enum {
 #define SYSINFO_FEATURES    (*(IO_ROM32 (SYSINFO_BASE + 8)))
 /** SYSINFO(3): Cache configuration */
 #define SYSINFO_CACHE       (*(IO_ROM32 (SYSINFO_BASE + 12)))
-/** SYSINFO(4): Instruction memory address space base */
+/** SYSINFO(4): Instruction memory address space base (= IMEM base address if internal IMEM is implemented) */
 #define SYSINFO_ISPACE_BASE (*(IO_ROM32 (SYSINFO_BASE + 16)))
-/** SYSINFO(5): Data memory address space base */
+/** SYSINFO(5): Data memory address space base (= DMEM base address if internal DMEM is implemented) */
 #define SYSINFO_DSPACE_BASE (*(IO_ROM32 (SYSINFO_BASE + 20)))
 /** SYSINFO(6): Internal instruction memory (IMEM) size in bytes */
 #define SYSINFO_IMEM_SIZE   (*(IO_ROM32 (SYSINFO_BASE + 24)))
@@ -1145,6 +1483,14 @@ enum NEORV32_NEOLED_CT_enum {
   SYSINFO_FEATURES_MEM_INT_DMEM     =  3, /**< SYSINFO_FEATURES  (3) (r/-): Processor-internal data memory implemented when 1 (via MEM_INT_DMEM_EN generic) */
   SYSINFO_FEATURES_MEM_EXT_ENDIAN   =  4, /**< SYSINFO_FEATURES  (4) (r/-): External bus interface uses BIG-endian byte-order when 1 (via MEM_EXT_BIG_ENDIAN generic) */
   SYSINFO_FEATURES_ICACHE           =  5, /**< SYSINFO_FEATURES  (5) (r/-): Processor-internal instruction cache implemented when 1 (via ICACHE_EN generic) */
+  SYSINFO_FEATURES_NUM_HARTS_0      =  6, /**< SYSINFO_FEATURES  (6) (r/-): Number of implemented harts minus one, bit 0 (via CPU_NUM_HARTS generic) */
+  SYSINFO_FEATURES_NUM_HARTS_1      =  7, /**< SYSINFO_FEATURES  (7) (r/-): Number of implemented harts minus one, bit 1 (via CPU_NUM_HARTS generic) */
+  SYSINFO_FEATURES_MEM_INT_TCM      =  8, /**< SYSINFO_FEATURES  (8) (r/-): Processor-internal IMEM/DMEM connected via tightly-coupled memory ports when 1 (via MEM_INT_TCM_EN generic) */
+  SYSINFO_FEATURES_BUS_XBAR         =  9, /**< SYSINFO_FEATURES  (9) (r/-): Bus switch crossbar path for instruction fetches implemented when 1 (via BUS_XBAR_EN generic) */
+  SYSINFO_FEATURES_MEMCPY           = 10, /**< SYSINFO_FEATURES (10) (r/-): Block memory copy/fill engine implemented when 1 (via IO_MEMCPY_EN generic) */
+  SYSINFO_FEATURES_MEM_INT_XMEM_0   = 11, /**< SYSINFO_FEATURES (11) (r/-): Number of additional internal memory banks, bit 0 (via MEM_INT_XMEM_SIZE generic) */
+  SYSINFO_FEATURES_MEM_INT_XMEM_1   = 12, /**< SYSINFO_FEATURES (12) (r/-): Number of additional internal memory banks, bit 1 (via MEM_INT_XMEM_SIZE generic) */
+  SYSINFO_FEATURES_MEM_INT_XMEM_2   = 13, /**< SYSINFO_FEATURES (13) (r/-): Number of additional internal memory banks, bit 2 (via MEM_INT_XMEM_SIZE generic) */
 
   SYSINFO_FEATURES_OCD              = 14, /**< SYSINFO_FEATURES (14) (r/-): On-chip debugger implemented when 1 (via ON_CHIP_DEBUGGER_EN generic) */
   SYSINFO_FEATURES_HW_RESET         = 15, /**< SYSINFO_FEATURES (15) (r/-): Dedicated hardware reset of core registers implemented when 1 (via package's dedicated_reset_c constant) */
@@ -1161,7 +1507,10 @@ enum NEORV32_NEOLED_CT_enum {
   SYSINFO_FEATURES_IO_SLINK         = 25, /**< SYSINFO_FEATURES (25) (r/-): Stream link interface implemented when 1 (via SLINK_NUM_RX & SLINK_NUM_TX generics) */
   SYSINFO_FEATURES_IO_UART1         = 26, /**< SYSINFO_FEATURES (26) (r/-): Secondary universal asynchronous receiver/transmitter 1 implemented when 1 (via IO_UART1_EN generic) */
   SYSINFO_FEATURES_IO_NEOLED        = 27, /**< SYSINFO_FEATURES (27) (r/-): NeoPixel-compatible smart LED interface implemented when 1 (via IO_NEOLED_EN generic) */
-  SYSINFO_FEATURES_IO_XIRQ          = 28  /**< SYSINFO_FEATURES (28) (r/-): External interrupt controller implemented when 1 (via XIRQ_NUM_IO generic) */
+  SYSINFO_FEATURES_IO_XIRQ          = 28, /**< SYSINFO_FEATURES (28) (r/-): External interrupt controller implemented when 1 (via XIRQ_NUM_IO generic) */
+  SYSINFO_FEATURES_IO_TRACE         = 29, /**< SYSINFO_FEATURES (29) (r/-): Instruction trace encoder implemented when 1 (via TRACE_EN generic) */
+  SYSINFO_FEATURES_IO_CLINT         = 30, /**< SYSINFO_FEATURES (30) (r/-): Core-local interruptor implemented when 1 (via CPU_NUM_HARTS generic > 1) */
+  SYSINFO_FEATURES_IO_DMA           = 31  /**< SYSINFO_FEATURES (31) (r/-): Direct memory access controller implemented when 1 (via IO_DMA_NUM_CH generic > 0) */
 };
 
 /**********************************************************************//**
@@ -1183,10 +1532,10 @@ enum NEORV32_NEOLED_CT_enum {
   SYSINFO_CACHE_IC_ASSOCIATIVITY_2 = 10, /**< SYSINFO_CACHE (10) (r/-): i-cache: log2(associativity), bit 2 (via ICACHE_ASSOCIATIVITY generic) */
   SYSINFO_CACHE_IC_ASSOCIATIVITY_3 = 11, /**< SYSINFO_CACHE (11) (r/-): i-cache: log2(associativity), bit 3 (via ICACHE_ASSOCIATIVITY generic) */
 
-  SYSINFO_CACHE_IC_REPLACEMENT_0   = 12, /**< SYSINFO_CACHE (12) (r/-): i-cache: replacement policy (0001 = LRU if associativity > 0) bit 0 */
-  SYSINFO_CACHE_IC_REPLACEMENT_1   = 13, /**< SYSINFO_CACHE (13) (r/-): i-cache: replacement policy (0001 = LRU if associativity > 0) bit 1 */
-  SYSINFO_CACHE_IC_REPLACEMENT_2   = 14, /**< SYSINFO_CACHE (14) (r/-): i-cache: replacement policy (0001 = LRU if associativity > 0) bit 2 */
-  SYSINFO_CACHE_IC_REPLACEMENT_3   = 15, /**< SYSINFO_CACHE (15) (r/-): i-cache: replacement policy (0001 = LRU if associativity > 0) bit 3 */
+  SYSINFO_CACHE_IC_REPLACEMENT_0   = 12, /**< SYSINFO_CACHE (12) (r/-): i-cache: replacement policy (0001 = (pseudo-)LRU, 0010 = random; if associativity > 1) bit 0 */
+  SYSINFO_CACHE_IC_REPLACEMENT_1   = 13, /**< SYSINFO_CACHE (13) (r/-): i-cache: replacement policy (0001 = (pseudo-)LRU, 0010 = random; if associativity > 1) bit 1 */
+  SYSINFO_CACHE_IC_REPLACEMENT_2   = 14, /**< SYSINFO_CACHE (14) (r/-): i-cache: replacement policy (0001 = (pseudo-)LRU, 0010 = random; if associativity > 1) bit 2 */
+  SYSINFO_CACHE_IC_REPLACEMENT_3   = 15, /**< SYSINFO_CACHE (15) (r/-): i-cache: replacement policy (0001 = (pseudo-)LRU, 0010 = random; if associativity > 1) bit 3 */
 };
 
 
@@ -1204,16 +1553,20 @@ enum NEORV32_NEOLED_CT_enum {
 
 // io/peripheral devices
 #include "neorv32_cfs.h"
+#include "neorv32_dma.h"
 #include "neorv32_gpio.h"
+#include "neorv32_memcpy.h"
 #include "neorv32_mtime.h"
 #include "neorv32_neoled.h"
 #include "neorv32_pwm.h"
 #include "neorv32_slink.h"
 #include "neorv32_spi.h"
+#include "neorv32_trace.h"
 #include "neorv32_trng.h"
 #include "neorv32_twi.h"
 #include "neorv32_uart.h"
 #include "neorv32_wdt.h"
+#include "neorv32_xip.h"
 #include "neorv32_xirq.h"
 
 
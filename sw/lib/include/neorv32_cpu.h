@@ -57,6 +57,11 @@ uint32_t neorv32_cpu_pmp_get_granularity(void);
 int neorv32_cpu_pmp_configure_region(uint32_t index, uint32_t base, uint32_t size, uint8_t config);
 uint32_t neorv32_cpu_hpm_get_counters(void);
 uint32_t neorv32_cpu_hpm_get_size(void);
+uint32_t neorv32_cpu_trigger_get_num(void);
+int neorv32_cpu_trigger_configure(uint32_t index, uint32_t addr, uint32_t size, uint32_t config, uint8_t action);
+uint32_t neorv32_cpu_trigger_get_count(uint32_t index);
+int neorv32_cpu_icache_pin(uint32_t base, uint32_t size);
+void neorv32_cpu_icache_unpin_all(void);
 int neorv32_cpu_check_zext(uint8_t flag_id);
 
 
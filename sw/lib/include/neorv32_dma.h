@@ -0,0 +1,68 @@
+// #################################################################################################
+// # << NEORV32: neorv32_dma.h - Direct Memory Access Controller HW Driver >>                      #
+// # ********************************************************************************************* #
+// # BSD 3-Clause License                                                                          #
+// #                                                                                               #
+// # Copyright (c) 2021, Stephan Nolting. All rights reserved.                                     #
+// #                                                                                               #
+// # Redistribution and use in source and binary forms, with or without modification, are          #
+// # permitted provided that the following conditions are met:                                     #
+// #                                                                                               #
+// # 1. Redistributions of source code must retain the above copyright notice, this list of        #
+// #    conditions and the following disclaimer.                                                   #
+// #                                                                                               #
+// # 2. Redistributions in binary form must reproduce the above copyright notice, this list of     #
+// #    conditions and the following disclaimer in the documentation and/or other materials        #
+// #    provided with the distribution.                                                            #
+// #                                                                                               #
+// # 3. Neither the name of the copyright holder nor the names of its contributors may be used to  #
+// #    endorse or promote products derived from this software without specific prior written      #
+// #    permission.                                                                                #
+// #                                                                                               #
+// # THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS   #
+// # OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF               #
+// # MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE    #
+// # COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,     #
+// # EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE #
+// # GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED    #
+// # AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING     #
+// # NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED  #
+// # OF THE POSSIBILITY OF SUCH DAMAGE.                                                            #
+// # ********************************************************************************************* #
+// # The NEORV32 Processor - https://github.com/stnolting/neorv32              (c) Stephan Nolting #
+
+
+/**********************************************************************//**
+ * @file neorv32_dma.h
+ * @author Stephan Nolting
+ * @brief Direct Memory Access Controller HW driver header file.
+ *
+ * @note These functions should only be used if the DMA unit was synthesized (IO_DMA_NUM_CH > 0).
+ **************************************************************************/
+
+#ifndef neorv32_dma_h
+#define neorv32_dma_h
+
+/**********************************************************************//**
+ * DMA transfer unit size
+ **************************************************************************/
+enum NEORV32_DMA_SIZE_enum {
+  DMA_SIZE_BYTE = 0, /**< 8-bit transfer units */
+  DMA_SIZE_HALF = 1, /**< 16-bit transfer units */
+  DMA_SIZE_WORD = 2  /**< 32-bit transfer units */
+};
+
+// prototypes
+int      neorv32_dma_available(void);
+int      neorv32_dma_get_num_channels(void);
+void     neorv32_dma_enable(void);
+void     neorv32_dma_disable(void);
+void     neorv32_dma_irq_enable(int channel, int enable);
+uint32_t neorv32_dma_config(int size, int src_inc, int dst_inc, int burst, int trigger);
+int      neorv32_dma_transfer(int channel, uint32_t src, uint32_t dst, uint32_t num, uint32_t config);
+void     neorv32_dma_abort(int channel);
+int      neorv32_dma_busy(int channel);
+int      neorv32_dma_done(int channel);
+int      neorv32_dma_wait(int channel);
+
+#endif // neorv32_dma_h
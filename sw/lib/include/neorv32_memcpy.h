@@ -0,0 +1,55 @@
+// #################################################################################################
+// # << NEORV32: neorv32_memcpy.h - Block Memory Copy/Fill Engine HW Driver >>                     #
+// # ********************************************************************************************* #
+// # BSD 3-Clause License                                                                          #
+// #                                                                                               #
+// # Copyright (c) 2021, Stephan Nolting. All rights reserved.                                     #
+// #                                                                                               #
+// # Redistribution and use in source and binary forms, with or without modification, are          #
+// # permitted provided that the following conditions are met:                                     #
+// #                                                                                               #
+// # 1. Redistributions of source code must retain the above copyright notice, this list of        #
+// #    conditions and the following disclaimer.                                                   #
+// #                                                                                               #
+// # 2. Redistributions in binary form must reproduce the above copyright notice, this list of     #
+// #    conditions and the following disclaimer in the documentation and/or other materials        #
+// #    provided with the distribution.                                                            #
+// #                                                                                               #
+// # 3. Neither the name of the copyright holder nor the names of its contributors may be used to  #
+// #    endorse or promote products derived from this software without specific prior written      #
+// #    permission.                                                                                #
+// #                                                                                               #
+// # THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS   #
+// # OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF               #
+// # MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE    #
+// # COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,     #
+// # EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE #
+// # GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED    #
+// # AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING     #
+// # NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED  #
+// # OF THE POSSIBILITY OF SUCH DAMAGE.                                                            #
+// # ********************************************************************************************* #
+// # The NEORV32 Processor - https://github.com/stnolting/neorv32              (c) Stephan Nolting #
+
+
+/**********************************************************************//**
+ * @file neorv32_memcpy.h
+ * @author Stephan Nolting
+ * @brief Block Memory Copy/Fill Engine HW driver header file.
+ *
+ * @note The functions fall back to plain CPU copy/fill loops if the MEMCPY unit was not synthesized (IO_MEMCPY_EN = false).
+ **************************************************************************/
+
+#ifndef neorv32_memcpy_h
+#define neorv32_memcpy_h
+
+#include <stddef.h>
+
+// prototypes
+int   neorv32_memcpy_available(void);
+int   neorv32_memcpy_words(uint32_t *dst, const uint32_t *src, uint32_t num);
+int   neorv32_memset_words(uint32_t *dst, uint32_t pattern, uint32_t num);
+void *neorv32_memcpy(void *dst, const void *src, size_t num);
+void *neorv32_memset(void *dst, int c, size_t num);
+
+#endif // neorv32_memcpy_h
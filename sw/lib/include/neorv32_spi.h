@@ -52,6 +52,9 @@ void neorv32_spi_enable(void);
 void neorv32_spi_cs_en(uint8_t cs);
 void neorv32_spi_cs_dis(uint8_t cs);
 uint32_t neorv32_spi_trans(uint32_t tx_data);
+int neorv32_spi_transfer(const void *tx, void *rx, int len);
 int neorv32_spi_busy(void);
+uint32_t neorv32_spi_get_fifo_depth(void);
+void neorv32_spi_irq_config(uint8_t mode);
 
 #endif // neorv32_spi_h
@@ -56,5 +56,9 @@ int neorv32_twi_trans(uint8_t d);
 uint8_t neorv32_twi_get_data(void);
 void neorv32_twi_generate_stop(void);
 void neorv32_twi_generate_start(void);
+int neorv32_twi_setup_clock(uint32_t freq);
+uint32_t neorv32_twi_get_fifo_depth(void);
+void neorv32_twi_irq_config(uint8_t mode);
+int neorv32_twi_xfer(uint8_t addr, const uint8_t *wbuf, int wlen, uint8_t *rbuf, int rlen);
 
 #endif // neorv32_twi_h
@@ -49,6 +49,51 @@
 // Libs required by functions
 #include <stdarg.h>
 
+
+/**********************************************************************//**
+ * @name UART fast interrupt channels
+ **************************************************************************/
+ /**@{*/
+/** UART0 RX MIE FIRQ bit */
+#define UART0_RX_FIRQ_ENABLE CSR_MIE_FIRQ2E   // MIE FIRQ bit
+/** UART0 RX RTE IRQ ID */
+#define UART0_RX_RTE_ID      RTE_TRAP_FIRQ_2  // RTE IRQ ID
+/** UART0 TX MIE FIRQ bit */
+#define UART0_TX_FIRQ_ENABLE CSR_MIE_FIRQ3E   // MIE FIRQ bit
+/** UART0 TX RTE IRQ ID */
+#define UART0_TX_RTE_ID      RTE_TRAP_FIRQ_3  // RTE IRQ ID
+/** UART1 RX MIE FIRQ bit */
+#define UART1_RX_FIRQ_ENABLE CSR_MIE_FIRQ4E   // MIE FIRQ bit
+/** UART1 RX RTE IRQ ID */
+#define UART1_RX_RTE_ID      RTE_TRAP_FIRQ_4  // RTE IRQ ID
+/** UART1 TX MIE FIRQ bit */
+#define UART1_TX_FIRQ_ENABLE CSR_MIE_FIRQ5E   // MIE FIRQ bit
+/** UART1 TX RTE IRQ ID */
+#define UART1_TX_RTE_ID      RTE_TRAP_FIRQ_5  // RTE IRQ ID
+/**@}*/
+
+
+/**********************************************************************//**
+ * @name UART0 buffered mode: ring buffer sizes in bytes (have to be a power of two), can be overridden via <USER_FLAGS+=-DUART0_BUF_TX_SIZE=...>
+ **************************************************************************/
+ /**@{*/
+#ifndef UART0_BUF_TX_SIZE
+/** UART0 TX ring buffer size in bytes */
+#define UART0_BUF_TX_SIZE 256
+#endif
+#ifndef UART0_BUF_RX_SIZE
+/** UART0 RX ring buffer size in bytes */
+#define UART0_BUF_RX_SIZE 64
+#endif
+/**@}*/
+
+#if (UART0_BUF_TX_SIZE == 0) || ((UART0_BUF_TX_SIZE & (UART0_BUF_TX_SIZE-1)) != 0)
+#error "UART0_BUF_TX_SIZE has to be a power of two!"
+#endif
+#if (UART0_BUF_RX_SIZE == 0) || ((UART0_BUF_RX_SIZE & (UART0_BUF_RX_SIZE-1)) != 0)
+#error "UART0_BUF_RX_SIZE has to be a power of two!"
+#endif
+
 // compatibility wrappers (mapping to primary UART -> UART0)
 int  neorv32_uart_available(void);
 void neorv32_uart_setup(uint32_t baudrate, uint8_t parity, uint8_t flow_con);
@@ -79,6 +124,18 @@ void neorv32_uart0_print(const char *s);
 void neorv32_uart0_printf(const char *format, ...);
 int  neorv32_uart0_scan(char *buffer, int max_size, int echo);
 
+// prototypes for UART0 (primary UART) - buffered, interrupt-driven mode
+int  neorv32_uart0_buf_setup(void);
+void neorv32_uart0_buf_disable(void);
+int  neorv32_uart0_write(const char *buf, int len);
+int  neorv32_uart0_read(char *buf, int len);
+void neorv32_uart0_buf_print(const char *s);
+void neorv32_uart0_buf_printf(const char *format, ...);
+int  neorv32_uart0_buf_rx_available(void);
+int  neorv32_uart0_buf_tx_free(void);
+uint32_t neorv32_uart0_buf_get_tx_dropped(void);
+uint32_t neorv32_uart0_buf_get_rx_dropped(void);
+
 // prototypes for UART1 (secondary UART)
 int  neorv32_uart1_available(void);
 void neorv32_uart1_setup(uint32_t baudrate, uint8_t parity, uint8_t flow_con);
@@ -77,6 +77,8 @@
 static int __neorv32_cpu_irq_id_check(uint8_t irq_sel);
 static uint32_t __neorv32_cpu_pmp_cfg_read(uint32_t index);
 static void __neorv32_cpu_pmp_cfg_write(uint32_t index, uint32_t data);
+static uint32_t __neorv32_cpu_pmp_addr_read(uint32_t index);
+static void __neorv32_cpu_pmp_addr_write(uint32_t index, uint32_t data);
 
 
 /**********************************************************************//**
@@ -385,46 +387,96 @@ uint32_t neorv32_cpu_pmp_get_granularity(void) {
 
   uint32_t i;
 
-  // find least-significat set bit
-  for (i=31; i!=0; i--) {
-    if (((tmp_a >> i) & 1) == 0) {
+  // find least-significant set bit: bits G-1:0 read as zero (granularity = 2^(G+2) bytes)
+  for (i=0; i<30; i++) {
+    if ((tmp_a >> i) & 1) {
       break;
     }
   }
 
-  return (uint32_t)(1 << (i+1+2));
+  return (uint32_t)(1 << (i+2));
 }
 
 
 /**********************************************************************//**
  * Physical memory protection (PMP): Configure region.
  *
- * @note Using NAPOT mode - page base address has to be naturally aligned.
+ * @note The region's mode is taken from the A bits of the config byte (see #NEORV32_PMP_MODES_enum):
+ * NAPOT: base has to be naturally aligned to size and size has to be a power of 2 (min 8 bytes or according to HW's PMP.granularity configuration).
+ * NA4: size has to be 4 bytes.
+ * TOR: region covers [base, base+size); base and size have to be 4-byte aligned, the region must not wrap
+ * around the end of the address space (but may end at 0x1_0000_0000). The lower bound is
+ * taken from the previous entry (index-1), which is programmed with base if it is not in use (mode OFF).
+ * For index 0 base has to be 0.
  *
  * @warning This function requires the PMP CPU extension.
  * @warning Only use available PMP regions. Check before using neorv32_cpu_pmp_get_regions(void).
  *
  * @param[in] index Region number (index, 0..PMP_NUM_REGIONS-1).
- * @param[in] base Region base address (has to be naturally aligned!).
- * @param[in] size Region size, has to be a power of 2 (min 8 bytes or according to HW's PMP.granularity configuration).
+ * @param[in] base Region base address.
+ * @param[in] size Region size in bytes.
  * @param[in] config Region configuration (attributes) byte (for PMPCFGx).
  * @return Returns 0 on success, 1 on failure.
  **************************************************************************/
 int neorv32_cpu_pmp_configure_region(uint32_t index, uint32_t base, uint32_t size, uint8_t config) {
 
-  if (size < 8) {
-    return 1; // minimal region size is 8 bytes
+  uint32_t mode = (((uint32_t)config) >> PMPCFG_A_LSB) & 3;
+  uint32_t tmp;
+
+  if ((base & 3) || (size & 3) || (size == 0)) {
+    return 1; // word-aligned regions only
   }
 
-  if ((size & (size - 1)) != 0) {
-    return 1; // region size is not a power of two
+  switch (mode) {
+
+    case PMP_NAPOT:
+      if ((size < 8) || ((size & (size - 1)) != 0) || (base & (size - 1))) {
+        return 1; // size is not a power of two (min 8 bytes) or base is not naturally aligned
+      }
+      tmp = (base >> 2) | ((size - 1) >> 3);
+      break;
+
+    case PMP_NA4:
+      if (size != 4) {
+        return 1; // NA4 only covers a single word
+      }
+      tmp = base >> 2;
+      break;
+
+    case PMP_TOR:
+      // compute the upper bound in words: a region may end at 0x1_0000_0000 (pmpaddr = 0x40000000)
+      if (((base >> 2) + (size >> 2)) > 0x40000000UL) {
+        return 1; // region wraps around the end of the address space
+      }
+      if (index == 0) {
+        if (base != 0) {
+          return 1; // lower bound of entry 0 is fixed to zero
+        }
+      }
+      else {
+        // previous entry provides the lower bound; only touch it if it is not in use
+        tmp = __neorv32_cpu_pmp_cfg_read((index-1) >> 2) >> (((index-1)%4)*8);
+        if ((tmp & (3 << PMPCFG_A_LSB)) != 0) {
+          if (__neorv32_cpu_pmp_addr_read(index-1) != (base >> 2)) {
+            return 1; // previous entry is in use and does not end at base
+          }
+        }
+        else {
+          __neorv32_cpu_pmp_addr_write(index-1, base >> 2);
+        }
+      }
+      tmp = (base >> 2) + (size >> 2);
+      break;
+
+    default: // OFF
+      tmp = base >> 2;
+      break;
   }
 
   // pmpcfg register index
-  uint32_t pmpcfg_index = index >> 4; // 4 entries per pmpcfg csr
+  uint32_t pmpcfg_index = index >> 2; // 4 entries per pmpcfg csr
 
   // setup configuration
-  uint32_t tmp;
   uint32_t config_int  = ((uint32_t)config) << ((index%4)*8);
   uint32_t config_mask = ((uint32_t)0xFF)   << ((index%4)*8);
   config_mask = ~config_mask;
@@ -432,81 +484,8 @@ int neorv32_cpu_pmp_configure_region(uint32_t index, uint32_t base, uint32_t siz
   // clear old configuration
   __neorv32_cpu_pmp_cfg_write(pmpcfg_index, __neorv32_cpu_pmp_cfg_read(pmpcfg_index) & config_mask);
 
-
-  // set base address and region size
-  uint32_t addr_mask = ~((size - 1) >> 2);
-  uint32_t size_mask = (size - 1) >> 3;
-
-  tmp = base & addr_mask;
-  tmp = tmp | size_mask;
-
-  switch(index & 63) {
-    case 0:  neorv32_cpu_csr_write(CSR_PMPADDR0,  tmp); break;
-    case 1:  neorv32_cpu_csr_write(CSR_PMPADDR1,  tmp); break;
-    case 2:  neorv32_cpu_csr_write(CSR_PMPADDR2,  tmp); break;
-    case 3:  neorv32_cpu_csr_write(CSR_PMPADDR3,  tmp); break;
-    case 4:  neorv32_cpu_csr_write(CSR_PMPADDR4,  tmp); break;
-    case 5:  neorv32_cpu_csr_write(CSR_PMPADDR5,  tmp); break;
-    case 6:  neorv32_cpu_csr_write(CSR_PMPADDR6,  tmp); break;
-    case 7:  neorv32_cpu_csr_write(CSR_PMPADDR7,  tmp); break;
-    case 8:  neorv32_cpu_csr_write(CSR_PMPADDR8,  tmp); break;
-    case 9:  neorv32_cpu_csr_write(CSR_PMPADDR9,  tmp); break;
-    case 10: neorv32_cpu_csr_write(CSR_PMPADDR10, tmp); break;
-    case 11: neorv32_cpu_csr_write(CSR_PMPADDR11, tmp); break;
-    case 12: neorv32_cpu_csr_write(CSR_PMPADDR12, tmp); break;
-    case 13: neorv32_cpu_csr_write(CSR_PMPADDR13, tmp); break;
-    case 14: neorv32_cpu_csr_write(CSR_PMPADDR14, tmp); break;
-    case 15: neorv32_cpu_csr_write(CSR_PMPADDR15, tmp); break;
-    case 16: neorv32_cpu_csr_write(CSR_PMPADDR16, tmp); break;
-    case 17: neorv32_cpu_csr_write(CSR_PMPADDR17, tmp); break;
-    case 18: neorv32_cpu_csr_write(CSR_PMPADDR18, tmp); break;
-    case 19: neorv32_cpu_csr_write(CSR_PMPADDR19, tmp); break;
-    case 20: neorv32_cpu_csr_write(CSR_PMPADDR20, tmp); break;
-    case 21: neorv32_cpu_csr_write(CSR_PMPADDR21, tmp); break;
-    case 22: neorv32_cpu_csr_write(CSR_PMPADDR22, tmp); break;
-    case 23: neorv32_cpu_csr_write(CSR_PMPADDR23, tmp); break;
-    case 24: neorv32_cpu_csr_write(CSR_PMPADDR24, tmp); break;
-    case 25: neorv32_cpu_csr_write(CSR_PMPADDR25, tmp); break;
-    case 26: neorv32_cpu_csr_write(CSR_PMPADDR26, tmp); break;
-    case 27: neorv32_cpu_csr_write(CSR_PMPADDR27, tmp); break;
-    case 28: neorv32_cpu_csr_write(CSR_PMPADDR28, tmp); break;
-    case 29: neorv32_cpu_csr_write(CSR_PMPADDR29, tmp); break;
-    case 30: neorv32_cpu_csr_write(CSR_PMPADDR30, tmp); break;
-    case 31: neorv32_cpu_csr_write(CSR_PMPADDR31, tmp); break;
-    case 32: neorv32_cpu_csr_write(CSR_PMPADDR32, tmp); break;
-    case 33: neorv32_cpu_csr_write(CSR_PMPADDR33, tmp); break;
-    case 34: neorv32_cpu_csr_write(CSR_PMPADDR34, tmp); break;
-    case 35: neorv32_cpu_csr_write(CSR_PMPADDR35, tmp); break;
-    case 36: neorv32_cpu_csr_write(CSR_PMPADDR36, tmp); break;
-    case 37: neorv32_cpu_csr_write(CSR_PMPADDR37, tmp); break;
-    case 38: neorv32_cpu_csr_write(CSR_PMPADDR38, tmp); break;
-    case 39: neorv32_cpu_csr_write(CSR_PMPADDR39, tmp); break;
-    case 40: neorv32_cpu_csr_write(CSR_PMPADDR40, tmp); break;
-    case 41: neorv32_cpu_csr_write(CSR_PMPADDR41, tmp); break;
-    case 42: neorv32_cpu_csr_write(CSR_PMPADDR42, tmp); break;
-    case 43: neorv32_cpu_csr_write(CSR_PMPADDR43, tmp); break;
-    case 44: neorv32_cpu_csr_write(CSR_PMPADDR44, tmp); break;
-    case 45: neorv32_cpu_csr_write(CSR_PMPADDR45, tmp); break;
-    case 46: neorv32_cpu_csr_write(CSR_PMPADDR46, tmp); break;
-    case 47: neorv32_cpu_csr_write(CSR_PMPADDR47, tmp); break;
-    case 48: neorv32_cpu_csr_write(CSR_PMPADDR48, tmp); break;
-    case 49: neorv32_cpu_csr_write(CSR_PMPADDR49, tmp); break;
-    case 50: neorv32_cpu_csr_write(CSR_PMPADDR50, tmp); break;
-    case 51: neorv32_cpu_csr_write(CSR_PMPADDR51, tmp); break;
-    case 52: neorv32_cpu_csr_write(CSR_PMPADDR52, tmp); break;
-    case 53: neorv32_cpu_csr_write(CSR_PMPADDR53, tmp); break;
-    case 54: neorv32_cpu_csr_write(CSR_PMPADDR54, tmp); break;
-    case 55: neorv32_cpu_csr_write(CSR_PMPADDR55, tmp); break;
-    case 56: neorv32_cpu_csr_write(CSR_PMPADDR56, tmp); break;
-    case 57: neorv32_cpu_csr_write(CSR_PMPADDR57, tmp); break;
-    case 58: neorv32_cpu_csr_write(CSR_PMPADDR58, tmp); break;
-    case 59: neorv32_cpu_csr_write(CSR_PMPADDR59, tmp); break;
-    case 60: neorv32_cpu_csr_write(CSR_PMPADDR60, tmp); break;
-    case 61: neorv32_cpu_csr_write(CSR_PMPADDR61, tmp); break;
-    case 62: neorv32_cpu_csr_write(CSR_PMPADDR62, tmp); break;
-    case 63: neorv32_cpu_csr_write(CSR_PMPADDR63, tmp); break;
-    default: break;
-  }
+  // set region address
+  __neorv32_cpu_pmp_addr_write(index, tmp);
 
   // wait for HW to compute PMP-internal stuff (address masks)
   for (tmp=0; tmp<16; tmp++) {
@@ -711,6 +690,152 @@ uint32_t neorv32_cpu_hpm_get_size(void) {
 }
 
 
+/**********************************************************************//**
+ * Hardware trigger module: Get number of implemented triggers.
+ *
+ * @warning This function overrides the tselect CSR.
+ *
+ * @return Number of implemented triggers (0 if not implemented at all).
+ **************************************************************************/
+uint32_t neorv32_cpu_trigger_get_num(void) {
+
+  // trigger module implemented at all?
+  if ((neorv32_cpu_csr_read(CSR_MZEXT) & (1<<CSR_MZEXT_SDTRIG)) == 0) {
+    return 0;
+  }
+
+  // tselect is WARL: writing an index of an unimplemented trigger has no effect
+  uint32_t num_triggers = 0;
+  while (num_triggers < 16) {
+    neorv32_cpu_csr_write(CSR_TSELECT, num_triggers);
+    if (neorv32_cpu_csr_read(CSR_TSELECT) != num_triggers) {
+      break;
+    }
+    num_triggers++;
+  }
+
+  return num_triggers;
+}
+
+
+/**********************************************************************//**
+ * Hardware trigger module: Configure address match trigger.
+ *
+ * @note For NAPOT matching the size has to be a power of two (min 2 bytes) and the address has to be naturally aligned to it.
+ * @note The trigger's match counter (tdata3) is reset.
+ * @note For #TRIGGER_ACTION_BREAK triggers enabled in machine mode tcontrol.MTE is set. MTE is cleared on trap
+ * entry, so the trigger does not fire inside the trap handler; mret restores it from tcontrol.MPTE. To resume at
+ * the trigger address the handler has to disable the trigger (or clear tcontrol.MPTE) before returning.
+ *
+ * @param[in] index Trigger index (0..num_triggers-1).
+ * @param[in] addr Compare (base) address.
+ * @param[in] size Size of the matching region in bytes; use 1 for an exact address match.
+ * @param[in] config Trigger configuration (tdata1 bits M, U, EXECUTE, STORE, LOAD; see #NEORV32_TDATA1_enum).
+ * @param[in] action Trigger action (see #NEORV32_TRIGGER_ACTION_enum).
+ * @return 0 if success, -1 if invalid index or size.
+ **************************************************************************/
+int neorv32_cpu_trigger_configure(uint32_t index, uint32_t addr, uint32_t size, uint32_t config, uint8_t action) {
+
+  if (index >= neorv32_cpu_trigger_get_num()) {
+    return -1; // trigger not implemented
+  }
+
+  neorv32_cpu_csr_write(CSR_TSELECT, index);
+  neorv32_cpu_csr_write(CSR_TDATA1, 0); // disable trigger while reconfiguring
+
+  uint32_t match = TRIGGER_MATCH_EQUAL;
+  if (size > 1) {
+    if ((size & (size - 1)) != 0) {
+      return -1; // size is not a power of two
+    }
+    addr = (addr & (~(size - 1))) | ((size >> 1) - 1); // NAPOT encoding
+    match = TRIGGER_MATCH_NAPOT;
+  }
+
+  neorv32_cpu_csr_write(CSR_TDATA2, addr);
+  neorv32_cpu_csr_write(CSR_TDATA3, 0);
+
+  config &= (1<<TDATA1_M) | (1<<TDATA1_U) | (1<<TDATA1_EXECUTE) | (1<<TDATA1_STORE) | (1<<TDATA1_LOAD);
+  config |= match << TDATA1_MATCH_LSB;
+  config |= ((uint32_t)(action & 0x0f)) << TDATA1_ACTION_LSB;
+  neorv32_cpu_csr_write(CSR_TDATA1, config);
+
+  // M-mode breakpoint exception triggers are only armed while tcontrol.MTE is set
+  if ((action == TRIGGER_ACTION_BREAK) && (config & (1<<TDATA1_M))) {
+    neorv32_cpu_csr_write(CSR_TCONTROL, neorv32_cpu_csr_read(CSR_TCONTROL) | (1<<TCONTROL_MTE));
+  }
+
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Hardware trigger module: Get number of matches of a trigger.
+ *
+ * @note This allows to use a trigger with #TRIGGER_ACTION_COUNT action as non-intrusive address/data access profiler.
+ *
+ * @param[in] index Trigger index (0..num_triggers-1).
+ * @return Current value of the trigger's match counter (tdata3).
+ **************************************************************************/
+uint32_t neorv32_cpu_trigger_get_count(uint32_t index) {
+
+  neorv32_cpu_csr_write(CSR_TSELECT, index);
+  return neorv32_cpu_csr_read(CSR_TDATA3);
+}
+
+
+/**********************************************************************//**
+ * Instruction cache: Preload and lock ("pin") an address range.
+ *
+ * @note Locked blocks are never replaced and are not invalidated by fence.i. Hence, pinned code
+ * (like a time-critical interrupt handler) always executes with cache-hit latency.
+ *
+ * @warning At least one way per cache line should remain unlocked. Otherwise, all accesses
+ * mapping to a fully-locked line are served directly from main memory (uncached).
+ *
+ * @param[in] base Base address of the range.
+ * @param[in] size Size of the range in bytes.
+ * @return 0 if success, -1 if i-cache not implemented, -2 if a block could not be pinned (no unlocked way available or bus error).
+ **************************************************************************/
+int neorv32_cpu_icache_pin(uint32_t base, uint32_t size) {
+
+  // i-cache implemented?
+  if ((SYSINFO_FEATURES & (1 << SYSINFO_FEATURES_ICACHE)) == 0) {
+    return -1;
+  }
+
+  uint32_t block_size = 1 << ((SYSINFO_CACHE >> SYSINFO_CACHE_IC_BLOCK_SIZE_0) & 0x0F);
+  uint32_t addr = base & (~(block_size - 1)); // block-aligned
+  uint32_t end = base + size;
+  int rc = 0;
+
+  neorv32_cpu_csr_write(CSR_MICACHECTL, 1 << CSR_MICACHECTL_LOCK); // lock preloaded blocks
+
+  while (addr < end) {
+    neorv32_cpu_csr_write(CSR_MICACHEPRE, addr); // trigger block preload
+    while (neorv32_cpu_csr_read(CSR_MICACHECTL) & (1 << CSR_MICACHECTL_BUSY)); // wait for preload to complete
+    if (neorv32_cpu_csr_read(CSR_MICACHECTL) & (1 << CSR_MICACHECTL_FAIL)) {
+      rc = -2;
+    }
+    addr += block_size;
+  }
+
+  neorv32_cpu_csr_write(CSR_MICACHECTL, 0); // do not lock further preloads
+  return rc;
+}
+
+
+/**********************************************************************//**
+ * Instruction cache: Unlock all pinned blocks.
+ *
+ * @note The blocks remain valid until they are replaced or invalidated (fence.i).
+ **************************************************************************/
+void neorv32_cpu_icache_unpin_all(void) {
+
+  neorv32_cpu_csr_write(CSR_MICACHECTL, 1 << CSR_MICACHECTL_UNLOCK);
+}
+
+
 /**********************************************************************//**
  * Check if certain Z* extension is available
  *
@@ -733,3 +858,165 @@ int neorv32_cpu_check_zext(uint8_t flag_id) {
   }
 }
 
+
+/**********************************************************************//**
+ * Internal helper function: Read PMP address register 0..63
+ *
+ * @warning This function requires the PMP CPU extension.
+ *
+ * @param[in] index PMP ADDR register ID (0..63).
+ * @return PMP ADDR read data.
+ **************************************************************************/
+static uint32_t __neorv32_cpu_pmp_addr_read(uint32_t index) {
+
+  uint32_t tmp = 0;
+  switch(index & 63) {
+    case 0:  tmp = neorv32_cpu_csr_read(CSR_PMPADDR0);  break;
+    case 1:  tmp = neorv32_cpu_csr_read(CSR_PMPADDR1);  break;
+    case 2:  tmp = neorv32_cpu_csr_read(CSR_PMPADDR2);  break;
+    case 3:  tmp = neorv32_cpu_csr_read(CSR_PMPADDR3);  break;
+    case 4:  tmp = neorv32_cpu_csr_read(CSR_PMPADDR4);  break;
+    case 5:  tmp = neorv32_cpu_csr_read(CSR_PMPADDR5);  break;
+    case 6:  tmp = neorv32_cpu_csr_read(CSR_PMPADDR6);  break;
+    case 7:  tmp = neorv32_cpu_csr_read(CSR_PMPADDR7);  break;
+    case 8:  tmp = neorv32_cpu_csr_read(CSR_PMPADDR8);  break;
+    case 9:  tmp = neorv32_cpu_csr_read(CSR_PMPADDR9);  break;
+    case 10: tmp = neorv32_cpu_csr_read(CSR_PMPADDR10); break;
+    case 11: tmp = neorv32_cpu_csr_read(CSR_PMPADDR11); break;
+    case 12: tmp = neorv32_cpu_csr_read(CSR_PMPADDR12); break;
+    case 13: tmp = neorv32_cpu_csr_read(CSR_PMPADDR13); break;
+    case 14: tmp = neorv32_cpu_csr_read(CSR_PMPADDR14); break;
+    case 15: tmp = neorv32_cpu_csr_read(CSR_PMPADDR15); break;
+    case 16: tmp = neorv32_cpu_csr_read(CSR_PMPADDR16); break;
+    case 17: tmp = neorv32_cpu_csr_read(CSR_PMPADDR17); break;
+    case 18: tmp = neorv32_cpu_csr_read(CSR_PMPADDR18); break;
+    case 19: tmp = neorv32_cpu_csr_read(CSR_PMPADDR19); break;
+    case 20: tmp = neorv32_cpu_csr_read(CSR_PMPADDR20); break;
+    case 21: tmp = neorv32_cpu_csr_read(CSR_PMPADDR21); break;
+    case 22: tmp = neorv32_cpu_csr_read(CSR_PMPADDR22); break;
+    case 23: tmp = neorv32_cpu_csr_read(CSR_PMPADDR23); break;
+    case 24: tmp = neorv32_cpu_csr_read(CSR_PMPADDR24); break;
+    case 25: tmp = neorv32_cpu_csr_read(CSR_PMPADDR25); break;
+    case 26: tmp = neorv32_cpu_csr_read(CSR_PMPADDR26); break;
+    case 27: tmp = neorv32_cpu_csr_read(CSR_PMPADDR27); break;
+    case 28: tmp = neorv32_cpu_csr_read(CSR_PMPADDR28); break;
+    case 29: tmp = neorv32_cpu_csr_read(CSR_PMPADDR29); break;
+    case 30: tmp = neorv32_cpu_csr_read(CSR_PMPADDR30); break;
+    case 31: tmp = neorv32_cpu_csr_read(CSR_PMPADDR31); break;
+    case 32: tmp = neorv32_cpu_csr_read(CSR_PMPADDR32); break;
+    case 33: tmp = neorv32_cpu_csr_read(CSR_PMPADDR33); break;
+    case 34: tmp = neorv32_cpu_csr_read(CSR_PMPADDR34); break;
+    case 35: tmp = neorv32_cpu_csr_read(CSR_PMPADDR35); break;
+    case 36: tmp = neorv32_cpu_csr_read(CSR_PMPADDR36); break;
+    case 37: tmp = neorv32_cpu_csr_read(CSR_PMPADDR37); break;
+    case 38: tmp = neorv32_cpu_csr_read(CSR_PMPADDR38); break;
+    case 39: tmp = neorv32_cpu_csr_read(CSR_PMPADDR39); break;
+    case 40: tmp = neorv32_cpu_csr_read(CSR_PMPADDR40); break;
+    case 41: tmp = neorv32_cpu_csr_read(CSR_PMPADDR41); break;
+    case 42: tmp = neorv32_cpu_csr_read(CSR_PMPADDR42); break;
+    case 43: tmp = neorv32_cpu_csr_read(CSR_PMPADDR43); break;
+    case 44: tmp = neorv32_cpu_csr_read(CSR_PMPADDR44); break;
+    case 45: tmp = neorv32_cpu_csr_read(CSR_PMPADDR45); break;
+    case 46: tmp = neorv32_cpu_csr_read(CSR_PMPADDR46); break;
+    case 47: tmp = neorv32_cpu_csr_read(CSR_PMPADDR47); break;
+    case 48: tmp = neorv32_cpu_csr_read(CSR_PMPADDR48); break;
+    case 49: tmp = neorv32_cpu_csr_read(CSR_PMPADDR49); break;
+    case 50: tmp = neorv32_cpu_csr_read(CSR_PMPADDR50); break;
+    case 51: tmp = neorv32_cpu_csr_read(CSR_PMPADDR51); break;
+    case 52: tmp = neorv32_cpu_csr_read(CSR_PMPADDR52); break;
+    case 53: tmp = neorv32_cpu_csr_read(CSR_PMPADDR53); break;
+    case 54: tmp = neorv32_cpu_csr_read(CSR_PMPADDR54); break;
+    case 55: tmp = neorv32_cpu_csr_read(CSR_PMPADDR55); break;
+    case 56: tmp = neorv32_cpu_csr_read(CSR_PMPADDR56); break;
+    case 57: tmp = neorv32_cpu_csr_read(CSR_PMPADDR57); break;
+    case 58: tmp = neorv32_cpu_csr_read(CSR_PMPADDR58); break;
+    case 59: tmp = neorv32_cpu_csr_read(CSR_PMPADDR59); break;
+    case 60: tmp = neorv32_cpu_csr_read(CSR_PMPADDR60); break;
+    case 61: tmp = neorv32_cpu_csr_read(CSR_PMPADDR61); break;
+    case 62: tmp = neorv32_cpu_csr_read(CSR_PMPADDR62); break;
+    case 63: tmp = neorv32_cpu_csr_read(CSR_PMPADDR63); break;
+    default: break;
+  }
+
+  return tmp;
+}
+
+
+/**********************************************************************//**
+ * Internal helper function: Write PMP address register 0..63
+ *
+ * @warning This function requires the PMP CPU extension.
+ *
+ * @param[in] index PMP ADDR register ID (0..63).
+ * @param[in] data PMP ADDR write data.
+ **************************************************************************/
+static void __neorv32_cpu_pmp_addr_write(uint32_t index, uint32_t data) {
+
+  switch(index & 63) {
+    case 0:  neorv32_cpu_csr_write(CSR_PMPADDR0,  data); break;
+    case 1:  neorv32_cpu_csr_write(CSR_PMPADDR1,  data); break;
+    case 2:  neorv32_cpu_csr_write(CSR_PMPADDR2,  data); break;
+    case 3:  neorv32_cpu_csr_write(CSR_PMPADDR3,  data); break;
+    case 4:  neorv32_cpu_csr_write(CSR_PMPADDR4,  data); break;
+    case 5:  neorv32_cpu_csr_write(CSR_PMPADDR5,  data); break;
+    case 6:  neorv32_cpu_csr_write(CSR_PMPADDR6,  data); break;
+    case 7:  neorv32_cpu_csr_write(CSR_PMPADDR7,  data); break;
+    case 8:  neorv32_cpu_csr_write(CSR_PMPADDR8,  data); break;
+    case 9:  neorv32_cpu_csr_write(CSR_PMPADDR9,  data); break;
+    case 10: neorv32_cpu_csr_write(CSR_PMPADDR10, data); break;
+    case 11: neorv32_cpu_csr_write(CSR_PMPADDR11, data); break;
+    case 12: neorv32_cpu_csr_write(CSR_PMPADDR12, data); break;
+    case 13: neorv32_cpu_csr_write(CSR_PMPADDR13, data); break;
+    case 14: neorv32_cpu_csr_write(CSR_PMPADDR14, data); break;
+    case 15: neorv32_cpu_csr_write(CSR_PMPADDR15, data); break;
+    case 16: neorv32_cpu_csr_write(CSR_PMPADDR16, data); break;
+    case 17: neorv32_cpu_csr_write(CSR_PMPADDR17, data); break;
+    case 18: neorv32_cpu_csr_write(CSR_PMPADDR18, data); break;
+    case 19: neorv32_cpu_csr_write(CSR_PMPADDR19, data); break;
+    case 20: neorv32_cpu_csr_write(CSR_PMPADDR20, data); break;
+    case 21: neorv32_cpu_csr_write(CSR_PMPADDR21, data); break;
+    case 22: neorv32_cpu_csr_write(CSR_PMPADDR22, data); break;
+    case 23: neorv32_cpu_csr_write(CSR_PMPADDR23, data); break;
+    case 24: neorv32_cpu_csr_write(CSR_PMPADDR24, data); break;
+    case 25: neorv32_cpu_csr_write(CSR_PMPADDR25, data); break;
+    case 26: neorv32_cpu_csr_write(CSR_PMPADDR26, data); break;
+    case 27: neorv32_cpu_csr_write(CSR_PMPADDR27, data); break;
+    case 28: neorv32_cpu_csr_write(CSR_PMPADDR28, data); break;
+    case 29: neorv32_cpu_csr_write(CSR_PMPADDR29, data); break;
+    case 30: neorv32_cpu_csr_write(CSR_PMPADDR30, data); break;
+    case 31: neorv32_cpu_csr_write(CSR_PMPADDR31, data); break;
+    case 32: neorv32_cpu_csr_write(CSR_PMPADDR32, data); break;
+    case 33: neorv32_cpu_csr_write(CSR_PMPADDR33, data); break;
+    case 34: neorv32_cpu_csr_write(CSR_PMPADDR34, data); break;
+    case 35: neorv32_cpu_csr_write(CSR_PMPADDR35, data); break;
+    case 36: neorv32_cpu_csr_write(CSR_PMPADDR36, data); break;
+    case 37: neorv32_cpu_csr_write(CSR_PMPADDR37, data); break;
+    case 38: neorv32_cpu_csr_write(CSR_PMPADDR38, data); break;
+    case 39: neorv32_cpu_csr_write(CSR_PMPADDR39, data); break;
+    case 40: neorv32_cpu_csr_write(CSR_PMPADDR40, data); break;
+    case 41: neorv32_cpu_csr_write(CSR_PMPADDR41, data); break;
+    case 42: neorv32_cpu_csr_write(CSR_PMPADDR42, data); break;
+    case 43: neorv32_cpu_csr_write(CSR_PMPADDR43, data); break;
+    case 44: neorv32_cpu_csr_write(CSR_PMPADDR44, data); break;
+    case 45: neorv32_cpu_csr_write(CSR_PMPADDR45, data); break;
+    case 46: neorv32_cpu_csr_write(CSR_PMPADDR46, data); break;
+    case 47: neorv32_cpu_csr_write(CSR_PMPADDR47, data); break;
+    case 48: neorv32_cpu_csr_write(CSR_PMPADDR48, data); break;
+    case 49: neorv32_cpu_csr_write(CSR_PMPADDR49, data); break;
+    case 50: neorv32_cpu_csr_write(CSR_PMPADDR50, data); break;
+    case 51: neorv32_cpu_csr_write(CSR_PMPADDR51, data); break;
+    case 52: neorv32_cpu_csr_write(CSR_PMPADDR52, data); break;
+    case 53: neorv32_cpu_csr_write(CSR_PMPADDR53, data); break;
+    case 54: neorv32_cpu_csr_write(CSR_PMPADDR54, data); break;
+    case 55: neorv32_cpu_csr_write(CSR_PMPADDR55, data); break;
+    case 56: neorv32_cpu_csr_write(CSR_PMPADDR56, data); break;
+    case 57: neorv32_cpu_csr_write(CSR_PMPADDR57, data); break;
+    case 58: neorv32_cpu_csr_write(CSR_PMPADDR58, data); break;
+    case 59: neorv32_cpu_csr_write(CSR_PMPADDR59, data); break;
+    case 60: neorv32_cpu_csr_write(CSR_PMPADDR60, data); break;
+    case 61: neorv32_cpu_csr_write(CSR_PMPADDR61, data); break;
+    case 62: neorv32_cpu_csr_write(CSR_PMPADDR62, data); break;
+    case 63: neorv32_cpu_csr_write(CSR_PMPADDR63, data); break;
+    default: break;
+  }
+}
@@ -0,0 +1,238 @@
+// #################################################################################################
+// # << NEORV32: neorv32_dma.c - Direct Memory Access Controller HW Driver >>                      #
+// # ********************************************************************************************* #
+// # BSD 3-Clause License                                                                          #
+// #                                                                                               #
+// # Copyright (c) 2021, Stephan Nolting. All rights reserved.                                     #
+// #                                                                                               #
+// # Redistribution and use in source and binary forms, with or without modification, are          #
+// # permitted provided that the following conditions are met:                                     #
+// #                                                                                               #
+// # 1. Redistributions of source code must retain the above copyright notice, this list of        #
+// #    conditions and the following disclaimer.                                                   #
+// #                                                                                               #
+// # 2. Redistributions in binary form must reproduce the above copyright notice, this list of     #
+// #    conditions and the following disclaimer in the documentation and/or other materials        #
+// #    provided with the distribution.                                                            #
+// #                                                                                               #
+// # 3. Neither the name of the copyright holder nor the names of its contributors may be used to  #
+// #    endorse or promote products derived from this software without specific prior written      #
+// #    permission.                                                                                #
+// #                                                                                               #
+// # THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS   #
+// # OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF               #
+// # MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE    #
+// # COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,     #
+// # EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE #
+// # GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED    #
+// # AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING     #
+// # NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED  #
+// # OF THE POSSIBILITY OF SUCH DAMAGE.                                                            #
+// # ********************************************************************************************* #
+// # The NEORV32 Processor - https://github.com/stnolting/neorv32              (c) Stephan Nolting #
+
+
+/**********************************************************************//**
+ * @file neorv32_dma.c
+ * @author Stephan Nolting
+ * @brief Direct Memory Access Controller HW driver source file.
+ *
+ * @note These functions should only be used if the DMA unit was synthesized (IO_DMA_NUM_CH > 0).
+ **************************************************************************/
+
+#include "neorv32.h"
+#include "neorv32_dma.h"
+
+
+/**********************************************************************//**
+ * Check if DMA controller was synthesized.
+ *
+ * @return 0 if DMA was not synthesized, 1 if DMA is available.
+ **************************************************************************/
+int neorv32_dma_available(void) {
+
+  if (SYSINFO_FEATURES & (1 << SYSINFO_FEATURES_IO_DMA)) {
+    return 1;
+  }
+  else {
+    return 0;
+  }
+}
+
+
+/**********************************************************************//**
+ * Get number of implemented DMA channels.
+ *
+ * @return Number of DMA channels (1..4).
+ **************************************************************************/
+int neorv32_dma_get_num_channels(void) {
+
+  return (int)((DMA_CT >> DMA_CT_NUM_CH0) & 3) + 1;
+}
+
+
+/**********************************************************************//**
+ * Enable DMA controller.
+ **************************************************************************/
+void neorv32_dma_enable(void) {
+
+  DMA_CT |= (uint32_t)(1 << DMA_CT_EN);
+}
+
+
+/**********************************************************************//**
+ * Disable DMA controller. This will abort all active transfers.
+ **************************************************************************/
+void neorv32_dma_disable(void) {
+
+  DMA_CT &= ~((uint32_t)(1 << DMA_CT_EN));
+}
+
+
+/**********************************************************************//**
+ * Enable/disable transfer done interrupt (fast IRQ channel 12) of a DMA channel.
+ *
+ * @param[in] channel DMA channel (0..3).
+ * @param[in] enable Enable interrupt when 1, disable when 0.
+ **************************************************************************/
+void neorv32_dma_irq_enable(int channel, int enable) {
+
+  uint32_t mask = (uint32_t)(1 << (DMA_CT_IRQ0 + (channel & 3)));
+
+  if (enable) {
+    DMA_CT |= mask;
+  }
+  else {
+    DMA_CT &= ~mask;
+  }
+}
+
+
+/**********************************************************************//**
+ * Compose DMA channel transfer configuration.
+ *
+ * @param[in] size Transfer unit size (#NEORV32_DMA_SIZE_enum).
+ * @param[in] src_inc Auto-increment source address after each transfer unit when 1 (memory source), keep constant when 0 (peripheral source).
+ * @param[in] dst_inc Auto-increment destination address after each transfer unit when 1 (memory destination), keep constant when 0 (peripheral destination).
+ * @param[in] burst Number of transfer units per bus arbitration / trigger event: 2^burst (0..7).
+ * @param[in] trigger Transfer trigger: 0 = software (start immediately), n = event of fast IRQ channel n-1 (1..12).
+ * @return Configuration word for #neorv32_dma_transfer.
+ **************************************************************************/
+uint32_t neorv32_dma_config(int size, int src_inc, int dst_inc, int burst, int trigger) {
+
+  uint32_t cfg = 0;
+  cfg |= ((uint32_t)(size    & 0x03)) << DMA_CFG_SIZE_LSB;
+  cfg |= ((uint32_t)(src_inc & 0x01)) << DMA_CFG_SRC_INC;
+  cfg |= ((uint32_t)(dst_inc & 0x01)) << DMA_CFG_DST_INC;
+  cfg |= ((uint32_t)(burst   & 0x07)) << DMA_CFG_BURST_LSB;
+  cfg |= ((uint32_t)(trigger & 0x0f)) << DMA_CFG_TRIG_LSB;
+
+  return cfg;
+}
+
+
+/**********************************************************************//**
+ * Start a DMA transfer. The DMA controller has to be enabled.
+ *
+ * @note Source and destination addresses have to be naturally aligned to the transfer unit size.
+ *
+ * @param[in] channel DMA channel (0..3).
+ * @param[in] src Source address.
+ * @param[in] dst Destination address.
+ * @param[in] num Number of transfer units (1..65535).
+ * @param[in] config Transfer configuration (see #neorv32_dma_config).
+ * @return 0 if transfer was started, -1 if channel is not implemented or busy or if num is out of range.
+ **************************************************************************/
+int neorv32_dma_transfer(int channel, uint32_t src, uint32_t dst, uint32_t num, uint32_t config) {
+
+  if ((channel < 0) || (channel >= neorv32_dma_get_num_channels()) || (num == 0) || (num > 0xffff)) {
+    return -1;
+  }
+
+  DMA_CT = (DMA_CT & ~((uint32_t)(3 << DMA_CT_SEL0))) | ((uint32_t)channel << DMA_CT_SEL0); // select channel
+
+  if (DMA_CFG & (1 << DMA_CFG_START)) { // channel still busy
+    return -1;
+  }
+
+  DMA_SRC = src;
+  DMA_DST = dst;
+  DMA_CFG = (config & ~((uint32_t)(0xffff << DMA_CFG_NUM_LSB))) | (num << DMA_CFG_NUM_LSB) | (1 << DMA_CFG_START);
+
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Abort transfer of DMA channel.
+ *
+ * @param[in] channel DMA channel (0..3).
+ **************************************************************************/
+void neorv32_dma_abort(int channel) {
+
+  DMA_CT = (DMA_CT & ~((uint32_t)(3 << DMA_CT_SEL0))) | ((uint32_t)(channel & 3) << DMA_CT_SEL0); // select channel
+  DMA_CFG = 0; // START = 0: abort
+}
+
+
+/**********************************************************************//**
+ * Check if DMA channel is busy.
+ *
+ * @param[in] channel DMA channel (0..3).
+ * @return 1 if transfer is in progress, 0 if idle.
+ **************************************************************************/
+int neorv32_dma_busy(int channel) {
+
+  if (DMA_STAT & (1 << (DMA_STAT_BUSY0 + (channel & 3)))) {
+    return 1;
+  }
+  else {
+    return 0;
+  }
+}
+
+
+/**********************************************************************//**
+ * Check and clear "transfer done" flag of DMA channel.
+ *
+ * @param[in] channel DMA channel (0..3).
+ * @return 0 if transfer is not completed yet, 1 if transfer completed, -1 if transfer was aborted due to a bus error.
+ **************************************************************************/
+int neorv32_dma_done(int channel) {
+
+  uint32_t stat = DMA_STAT;
+  uint32_t done_mask = (uint32_t)(1 << (DMA_STAT_DONE0 + (channel & 3)));
+  uint32_t err_mask  = (uint32_t)(1 << (DMA_STAT_ERR0  + (channel & 3)));
+
+  if ((stat & done_mask) == 0) {
+    return 0;
+  }
+
+  DMA_STAT = ~(done_mask | err_mask); // write zero to clear flags of this channel only
+
+  if (stat & err_mask) {
+    return -1;
+  }
+  else {
+    return 1;
+  }
+}
+
+
+/**********************************************************************//**
+ * Wait for DMA channel to complete its transfer (blocking).
+ *
+ * @param[in] channel DMA channel (0..3).
+ * @return 0 if transfer completed successfully, -1 if transfer was aborted due to a bus error.
+ **************************************************************************/
+int neorv32_dma_wait(int channel) {
+
+  while (neorv32_dma_busy(channel));
+
+  if (neorv32_dma_done(channel) < 0) {
+    return -1;
+  }
+  else {
+    return 0;
+  }
+}
@@ -0,0 +1,204 @@
+// #################################################################################################
+// # << NEORV32: neorv32_memcpy.c - Block Memory Copy/Fill Engine HW Driver >>                     #
+// # ********************************************************************************************* #
+// # BSD 3-Clause License                                                                          #
+// #                                                                                               #
+// # Copyright (c) 2021, Stephan Nolting. All rights reserved.                                     #
+// #                                                                                               #
+// # Redistribution and use in source and binary forms, with or without modification, are          #
+// # permitted provided that the following conditions are met:                                     #
+// #                                                                                               #
+// # 1. Redistributions of source code must retain the above copyright notice, this list of        #
+// #    conditions and the following disclaimer.                                                   #
+// #                                                                                               #
+// # 2. Redistributions in binary form must reproduce the above copyright notice, this list of     #
+// #    conditions and the following disclaimer in the documentation and/or other materials        #
+// #    provided with the distribution.                                                            #
+// #                                                                                               #
+// # 3. Neither the name of the copyright holder nor the names of its contributors may be used to  #
+// #    endorse or promote products derived from this software without specific prior written      #
+// #    permission.                                                                                #
+// #                                                                                               #
+// # THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS   #
+// # OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF               #
+// # MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE    #
+// # COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,     #
+// # EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE #
+// # GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED    #
+// # AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING     #
+// # NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED  #
+// # OF THE POSSIBILITY OF SUCH DAMAGE.                                                            #
+// # ********************************************************************************************* #
+// # The NEORV32 Processor - https://github.com/stnolting/neorv32              (c) Stephan Nolting #
+
+
+/**********************************************************************//**
+ * @file neorv32_memcpy.c
+ * @author Stephan Nolting
+ * @brief Block Memory Copy/Fill Engine HW driver source file.
+ *
+ * @note The functions fall back to plain CPU copy/fill loops if the MEMCPY unit was not synthesized (IO_MEMCPY_EN = false).
+ **************************************************************************/
+
+#include "neorv32.h"
+#include "neorv32_memcpy.h"
+
+/**********************************************************************//**
+ * Minimal block size in bytes for using the hardware engine. Smaller
+ * blocks are faster done by the CPU than setting up the engine.
+ **************************************************************************/
+#define MEMCPY_MIN_BYTES 32
+
+
+/**********************************************************************//**
+ * Check if block memory copy/fill engine was synthesized.
+ *
+ * @return 0 if MEMCPY was not synthesized, 1 if MEMCPY is available.
+ **************************************************************************/
+int neorv32_memcpy_available(void) {
+
+  if (SYSINFO_FEATURES & (1 << SYSINFO_FEATURES_MEMCPY)) {
+    return 1;
+  }
+  else {
+    return 0;
+  }
+}
+
+
+/**********************************************************************//**
+ * Copy a block of words using the MEMCPY engine (blocking).
+ *
+ * @warning The engine has to be available (see #neorv32_memcpy_available).
+ *
+ * @param[in,out] dst Word-aligned destination address.
+ * @param[in] src Word-aligned source address.
+ * @param[in] num Number of words to copy.
+ * @return 0 if successful, -1 if the operation was aborted due to a bus error.
+ **************************************************************************/
+int neorv32_memcpy_words(uint32_t *dst, const uint32_t *src, uint32_t num) {
+
+  while (MEMCPY_CT & (1 << MEMCPY_CT_BUSY)); // wait for previous operation to complete
+
+  MEMCPY_CT  = (uint32_t)(1 << MEMCPY_CT_EN); // copy mode
+  MEMCPY_SRC = (uint32_t)src;
+  MEMCPY_DST = (uint32_t)dst;
+  MEMCPY_NUM = num; // start
+
+  uint32_t ct;
+  do {
+    ct = MEMCPY_CT;
+  } while (ct & (1 << MEMCPY_CT_BUSY));
+
+  if (ct & (1 << MEMCPY_CT_ERR)) {
+    return -1;
+  }
+  else {
+    return 0;
+  }
+}
+
+
+/**********************************************************************//**
+ * Fill a block of words with a constant pattern using the MEMCPY engine (blocking).
+ *
+ * @warning The engine has to be available (see #neorv32_memcpy_available).
+ *
+ * @param[in,out] dst Word-aligned destination address.
+ * @param[in] pattern Fill pattern.
+ * @param[in] num Number of words to fill.
+ * @return 0 if successful, -1 if the operation was aborted due to a bus error.
+ **************************************************************************/
+int neorv32_memset_words(uint32_t *dst, uint32_t pattern, uint32_t num) {
+
+  while (MEMCPY_CT & (1 << MEMCPY_CT_BUSY)); // wait for previous operation to complete
+
+  MEMCPY_CT  = (uint32_t)((1 << MEMCPY_CT_EN) | (1 << MEMCPY_CT_FILL)); // fill mode
+  MEMCPY_SRC = pattern;
+  MEMCPY_DST = (uint32_t)dst;
+  MEMCPY_NUM = num; // start
+
+  uint32_t ct;
+  do {
+    ct = MEMCPY_CT;
+  } while (ct & (1 << MEMCPY_CT_BUSY));
+
+  if (ct & (1 << MEMCPY_CT_ERR)) {
+    return -1;
+  }
+  else {
+    return 0;
+  }
+}
+
+
+/**********************************************************************//**
+ * Copy memory block (drop-in replacement for memcpy). The word-aligned bulk of
+ * the block is moved by the MEMCPY engine if available.
+ *
+ * @param[in,out] dst Destination address.
+ * @param[in] src Source address.
+ * @param[in] num Number of bytes to copy.
+ * @return Destination address.
+ **************************************************************************/
+void *neorv32_memcpy(void *dst, const void *src, size_t num) {
+
+  uint8_t *d = (uint8_t*)dst;
+  const uint8_t *s = (const uint8_t*)src;
+
+  // use engine if both blocks have the same word alignment
+  if ((num >= MEMCPY_MIN_BYTES) && ((((uint32_t)d ^ (uint32_t)s) & 3) == 0) && (neorv32_memcpy_available())) {
+
+    while ((uint32_t)d & 3) { // unaligned head
+      *d++ = *s++;
+      num--;
+    }
+
+    uint32_t words = (uint32_t)(num >> 2);
+    neorv32_memcpy_words((uint32_t*)d, (const uint32_t*)s, words);
+    d   += words << 2;
+    s   += words << 2;
+    num &= 3;
+  }
+
+  while (num--) { // remaining bytes
+    *d++ = *s++;
+  }
+
+  return dst;
+}
+
+
+/**********************************************************************//**
+ * Fill memory block (drop-in replacement for memset). The word-aligned bulk of
+ * the block is filled by the MEMCPY engine if available.
+ *
+ * @param[in,out] dst Destination address.
+ * @param[in] c Fill value (only the lowest 8 bit are used).
+ * @param[in] num Number of bytes to fill.
+ * @return Destination address.
+ **************************************************************************/
+void *neorv32_memset(void *dst, int c, size_t num) {
+
+  uint8_t *d = (uint8_t*)dst;
+  uint8_t byte = (uint8_t)c;
+
+  if ((num >= MEMCPY_MIN_BYTES) && (neorv32_memcpy_available())) {
+
+    while ((uint32_t)d & 3) { // unaligned head
+      *d++ = byte;
+      num--;
+    }
+
+    uint32_t words = (uint32_t)(num >> 2);
+    neorv32_memset_words((uint32_t*)d, (uint32_t)byte * 0x01010101UL, words);
+    d   += words << 2;
+    num &= 3;
+  }
+
+  while (num--) { // remaining bytes
+    *d++ = byte;
+  }
+
+  return dst;
+}
@@ -389,6 +389,21 @@ void neorv32_rte_print_hw_config(void) {
   if (SYSINFO_FEATURES & (1 << SYSINFO_FEATURES_MEM_INT_DMEM)) { neorv32_uart0_printf("yes, %u bytes\n", SYSINFO_DMEM_SIZE); }
   else {  neorv32_uart0_printf("no\n"); }
 
+  // additional memory banks
+  neorv32_uart0_printf("Internal XMEM banks:  %u\n", (SYSINFO_FEATURES >> SYSINFO_FEATURES_MEM_INT_XMEM_0) & 0x07);
+
+  // tightly-coupled memory ports
+  neorv32_uart0_printf("IMEM/DMEM TCM ports:  ");
+  __neorv32_rte_print_true_false(SYSINFO_FEATURES & (1 << SYSINFO_FEATURES_MEM_INT_TCM));
+
+  // bus switch crossbar
+  neorv32_uart0_printf("Bus switch crossbar:  ");
+  __neorv32_rte_print_true_false(SYSINFO_FEATURES & (1 << SYSINFO_FEATURES_BUS_XBAR));
+
+  // block memory copy/fill engine
+  neorv32_uart0_printf("Memcpy/memset engine: ");
+  __neorv32_rte_print_true_false(SYSINFO_FEATURES & (1 << SYSINFO_FEATURES_MEMCPY));
+
   // i-cache
   neorv32_uart0_printf("Internal i-cache:     ");
   __neorv32_rte_print_true_false(SYSINFO_FEATURES & (1 << SYSINFO_FEATURES_ICACHE));
@@ -419,7 +434,15 @@ void neorv32_rte_print_hw_config(void) {
       neorv32_uart0_printf(" (direct-mapped)\n");
     }
     else if (((SYSINFO_CACHE >> SYSINFO_CACHE_IC_REPLACEMENT_0) & 0x0F) == 1) {
-      neorv32_uart0_printf(" (LRU replacement policy)\n");
+      if (ic_associativity == 2) {
+        neorv32_uart0_printf(" (LRU replacement policy)\n");
+      }
+      else {
+        neorv32_uart0_printf(" (pseudo-LRU replacement policy)\n");
+      }
+    }
+    else if (((SYSINFO_CACHE >> SYSINFO_CACHE_IC_REPLACEMENT_0) & 0x0F) == 2) {
+      neorv32_uart0_printf(" (random replacement policy)\n");
     }
     else {
       neorv32_uart0_printf("\n");
@@ -453,6 +476,7 @@ void neorv32_rte_print_hw_config(void) {
   neorv32_uart0_printf("SLINK  - "); __neorv32_rte_print_true_false(tmp & (1 << SYSINFO_FEATURES_IO_SLINK));
   neorv32_uart0_printf("NEOLED - "); __neorv32_rte_print_true_false(tmp & (1 << SYSINFO_FEATURES_IO_NEOLED));
   neorv32_uart0_printf("XIRQ   - "); __neorv32_rte_print_true_false(tmp & (1 << SYSINFO_FEATURES_IO_XIRQ));
+  neorv32_uart0_printf("DMA    - "); __neorv32_rte_print_true_false(tmp & (1 << SYSINFO_FEATURES_IO_DMA));
 }
 
 
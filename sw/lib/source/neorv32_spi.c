@@ -148,10 +148,96 @@ void neorv32_spi_cs_dis(uint8_t cs) {
  **************************************************************************/
 uint32_t neorv32_spi_trans(uint32_t tx_data) {
 
+  uint32_t rx_data;
+
   SPI_DATA = tx_data; // trigger transfer
   while((SPI_CT & (1<<SPI_CT_BUSY)) != 0); // wait for current transfer to finish
 
-  return SPI_DATA;
+  // the RX FIFO might still hold older (unread) data - return the most recent word
+  do {
+    rx_data = SPI_DATA;
+  } while ((SPI_CT & (1<<SPI_CT_RX_AVAIL)) != 0);
+
+  return rx_data;
+}
+
+
+/**********************************************************************//**
+ * Bulk SPI transfer: send and receive a block of data words using the TX/RX FIFOs.
+ *
+ * The TX FIFO is kept filled while the RX FIFO is drained, so consecutive words are transferred
+ * back-to-back. The chip select lines are not altered; activate/deactivate them before/after
+ * the transfer via neorv32_spi_cs_en() / neorv32_spi_cs_dis().
+ *
+ * @warning The SPI always sends MSB first.
+ *
+ * @note This function is blocking. The element type of the buffers depends on the configured
+ * data size: uint8_t for 8-bit, uint16_t for 16-bit and uint32_t for 24-bit and 32-bit transfers.
+ *
+ * @param[in] tx Transmit data buffer; if NULL all-zero words are sent.
+ * @param[in,out] rx Receive data buffer; if NULL received data is discarded.
+ * @param[in] len Number of data words to transfer.
+ * @return Number of transferred words, -1 if the SPI is not enabled.
+ **************************************************************************/
+int neorv32_spi_transfer(const void *tx, void *rx, int len) {
+
+  uint32_t ct = SPI_CT;
+  if ((ct & (1<<SPI_CT_EN)) == 0) {
+    return -1;
+  }
+
+  uint32_t size  = (ct >> SPI_CT_SIZE0) & 0x03;
+  int      depth = (int)neorv32_spi_get_fifo_depth();
+  int      tx_cnt = 0, rx_cnt = 0;
+  uint32_t data;
+
+  // discard stale data from previous transfers
+  while((SPI_CT & (1<<SPI_CT_BUSY)) != 0);
+  while ((SPI_CT & (1<<SPI_CT_RX_AVAIL)) != 0) {
+    data = SPI_DATA;
+  }
+
+  while (rx_cnt < len) {
+
+    ct = SPI_CT;
+
+    // refill TX FIFO; never have more words in flight than the RX FIFO can hold
+    if ((tx_cnt < len) && ((tx_cnt - rx_cnt) < depth) && ((ct & (1<<SPI_CT_TX_FULL)) == 0)) {
+      data = 0;
+      if (tx != NULL) {
+        if (size == 0) {
+          data = (uint32_t)((const uint8_t*)tx)[tx_cnt];
+        }
+        else if (size == 1) {
+          data = (uint32_t)((const uint16_t*)tx)[tx_cnt];
+        }
+        else {
+          data = ((const uint32_t*)tx)[tx_cnt];
+        }
+      }
+      SPI_DATA = data;
+      tx_cnt++;
+    }
+
+    // drain RX FIFO
+    if ((ct & (1<<SPI_CT_RX_AVAIL)) != 0) {
+      data = SPI_DATA;
+      if (rx != NULL) {
+        if (size == 0) {
+          ((uint8_t*)rx)[rx_cnt] = (uint8_t)data;
+        }
+        else if (size == 1) {
+          ((uint16_t*)rx)[rx_cnt] = (uint16_t)data;
+        }
+        else {
+          ((uint32_t*)rx)[rx_cnt] = data;
+        }
+      }
+      rx_cnt++;
+    }
+  }
+
+  return rx_cnt;
 }
 
 
@@ -169,3 +255,30 @@ int neorv32_spi_busy(void) {
   }
   return 0;
 }
+
+
+/**********************************************************************//**
+ * Get SPI TX/RX FIFO depth.
+ *
+ * @return FIFO depth (number of entries); 1 if no FIFO is implemented.
+ **************************************************************************/
+uint32_t neorv32_spi_get_fifo_depth(void) {
+
+  uint32_t tmp = (SPI_CT >> SPI_CT_FIFO_LSB) & 0x0f;
+  return (uint32_t)(1 << tmp);
+}
+
+
+/**********************************************************************//**
+ * Configure SPI interrupt condition.
+ *
+ * @param[in] mode Interrupt mode: 0 = each completed transfer, 1 = TX FIFO empty and transceiver idle,
+ * 2 = TX FIFO less than half-full, 3 = RX FIFO at least half-full.
+ **************************************************************************/
+void neorv32_spi_irq_config(uint8_t mode) {
+
+  uint32_t ct = SPI_CT;
+  ct &= ~((uint32_t)(3 << SPI_CT_IRQ0));
+  ct |= ((uint32_t)(mode & 0x03)) << SPI_CT_IRQ0;
+  SPI_CT = ct;
+}
@@ -0,0 +1,189 @@
+// #################################################################################################
+// # << NEORV32: neorv32_trace.c - Instruction Trace Encoder HW Driver >>                          #
+// # ********************************************************************************************* #
+// # BSD 3-Clause License                                                                          #
+// #                                                                                               #
+// # Copyright (c) 2021, Stephan Nolting. All rights reserved.                                     #
+// #                                                                                               #
+// # Redistribution and use in source and binary forms, with or without modification, are          #
+// # permitted provided that the following conditions are met:                                     #
+// #                                                                                               #
+// # 1. Redistributions of source code must retain the above copyright notice, this list of        #
+// #    conditions and the following disclaimer.                                                   #
+// #                                                                                               #
+// # 2. Redistributions in binary form must reproduce the above copyright notice, this list of     #
+// #    conditions and the following disclaimer in the documentation and/or other materials        #
+// #    provided with the distribution.                                                            #
+// #                                                                                               #
+// # 3. Neither the name of the copyright holder nor the names of its contributors may be used to  #
+// #    endorse or promote products derived from this software without specific prior written      #
+// #    permission.                                                                                #
+// #                                                                                               #
+// # THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS   #
+// # OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF               #
+// # MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE    #
+// # COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,     #
+// # EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE #
+// # GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED    #
+// # AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING     #
+// # NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED  #
+// # OF THE POSSIBILITY OF SUCH DAMAGE.                                                            #
+// # ********************************************************************************************* #
+// # The NEORV32 Processor - https://github.com/stnolting/neorv32              (c) Stephan Nolting #
+
+
+/**********************************************************************//**
+ * @file neorv32_trace.c
+ * @author Stephan Nolting
+ * @brief Instruction Trace Encoder HW driver source file.
+ *
+ * @note These functions should only be used if the TRACE unit was synthesized (TRACE_EN = true).
+ **************************************************************************/
+
+#include "neorv32.h"
+#include "neorv32_trace.h"
+
+
+/**********************************************************************//**
+ * Check if instruction trace encoder was synthesized.
+ *
+ * @return 0 if TRACE was not synthesized, 1 if TRACE is available.
+ **************************************************************************/
+int neorv32_trace_available(void) {
+
+  if (SYSINFO_FEATURES & (1 << SYSINFO_FEATURES_IO_TRACE)) {
+    return 1;
+  }
+  else {
+    return 0;
+  }
+}
+
+
+/**********************************************************************//**
+ * Configure instruction trace encoder. The encoder is disabled by this function.
+ *
+ * @param[in] stream Trace sink: 0 = on-chip trace buffer, 1 = trace stream port.
+ * @param[in] stop Buffer mode: 0 = ring buffer (keep latest trace data), 1 = stop recording when buffer is full.
+ * @param[in] sync Insert SYNC packet every 2^(sync+3) packets (0..15); 0 = no periodic SYNC packets.
+ **************************************************************************/
+void neorv32_trace_setup(int stream, int stop, uint8_t sync) {
+
+  TRACE_CT = 0; // disable and reset
+
+  uint32_t ct = 0;
+  ct |= ((uint32_t)(stream & 1)) << TRACE_CT_STREAM;
+  ct |= ((uint32_t)(stop   & 1)) << TRACE_CT_STOP;
+  ct |= ((uint32_t)(sync & 0x0f)) << TRACE_CT_SYNC0;
+
+  TRACE_CT = ct;
+}
+
+
+/**********************************************************************//**
+ * Start tracing.
+ *
+ * @note This will clear the trace buffer and will start with a new SYNC packet.
+ **************************************************************************/
+void neorv32_trace_enable(void) {
+
+  TRACE_CT |= (uint32_t)(1 << TRACE_CT_EN);
+}
+
+
+/**********************************************************************//**
+ * Stop tracing. The content of the trace buffer is preserved.
+ **************************************************************************/
+void neorv32_trace_disable(void) {
+
+  TRACE_CT &= ~((uint32_t)(1 << TRACE_CT_EN));
+}
+
+
+/**********************************************************************//**
+ * Get size of on-chip trace buffer.
+ *
+ * @return Trace buffer size in 32-bit words (1..32768); 0 if no trace buffer is implemented.
+ **************************************************************************/
+int neorv32_trace_get_buffer_size(void) {
+
+  uint32_t ct = TRACE_CT;
+
+  if (ct & (1 << TRACE_CT_BUF_EN)) {
+    return (int)(1 << ((ct >> TRACE_CT_BUF_S0) & 0x0f));
+  }
+  else {
+    return 0;
+  }
+}
+
+
+/**********************************************************************//**
+ * Check if trace data has been dropped since tracing was enabled.
+ *
+ * @return 1 if trace packets were lost, 0 otherwise.
+ **************************************************************************/
+int neorv32_trace_get_overflow(void) {
+
+  if (TRACE_CT & (1 << TRACE_CT_OVFL)) {
+    return 1;
+  }
+  else {
+    return 0;
+  }
+}
+
+
+/**********************************************************************//**
+ * Get number of valid words in the trace buffer.
+ *
+ * @return Number of valid trace buffer entries.
+ **************************************************************************/
+uint32_t neorv32_trace_get_buffer_level(void) {
+
+  uint32_t size = (uint32_t)neorv32_trace_get_buffer_size();
+
+  if (TRACE_CT & (1 << TRACE_CT_WRAP)) { // ring buffer has wrapped around: buffer is completely filled
+    return size;
+  }
+  else if (TRACE_CT & (1 << TRACE_CT_FULL)) {
+    return size;
+  }
+  else {
+    return TRACE_WPTR;
+  }
+}
+
+
+/**********************************************************************//**
+ * Copy trace buffer content (oldest word first) to memory.
+ *
+ * @note Tracing should be disabled before reading the buffer.
+ *
+ * @param[in,out] buffer Pointer to destination array.
+ * @param[in] num Maximum number of words to copy.
+ * @return Number of words actually copied.
+ **************************************************************************/
+uint32_t neorv32_trace_read_buffer(uint32_t *buffer, uint32_t num) {
+
+  uint32_t level = neorv32_trace_get_buffer_level();
+  uint32_t i;
+
+  if (num > level) {
+    num = level;
+  }
+
+  // oldest entry is at the write pointer if the ring buffer has wrapped around
+  if (TRACE_CT & (1 << TRACE_CT_WRAP)) {
+    TRACE_RPTR = TRACE_WPTR;
+  }
+  else {
+    TRACE_RPTR = 0;
+  }
+
+  for (i=0; i<num; i++) {
+    buffer[i] = TRACE_DATA; // read pointer is incremented automatically
+  }
+
+  return num;
+}
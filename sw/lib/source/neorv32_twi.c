@@ -213,3 +213,215 @@ void neorv32_twi_generate_start(void) {
   TWI_CT |= (1 << TWI_CT_START); // generate START condition
   while(TWI_CT & (1 << TWI_CT_BUSY)); // wait until idle again
 }
+
+
+/**********************************************************************//**
+ * Configure TWI clock prescaler and clock divider for a target SCL frequency.
+ * The resulting frequency is f_main / (4 * prescaler * (1 + cdiv)); the highest
+ * frequency that does not exceed the target is selected.
+ *
+ * @note This function uses the SYSINFO_CLK value (from the SYSINFO HW module) to do the computations.
+ *
+ * @param[in] freq Target SCL frequency in Hz (e.g. 100000, 400000 or 1000000).
+ * @return 0 if success, 1 if the frequency cannot be reached.
+ **************************************************************************/
+int neorv32_twi_setup_clock(uint32_t freq) {
+
+  const uint16_t prsc_lut[8] = {2, 4, 8, 64, 128, 1024, 2048, 4096};
+
+  if (freq == 0) {
+    return 1;
+  }
+
+  uint32_t p, div, cdiv;
+  for (p=0; p<8; p++) {
+    div = 4 * (uint32_t)prsc_lut[p];
+    cdiv = (SYSINFO_CLK + (div * freq) - 1) / (div * freq); // round up: do not exceed target frequency
+    if (cdiv == 0) {
+      cdiv = 1;
+    }
+    if (cdiv <= 16) {
+      uint32_t ct = TWI_CT;
+      ct &= ~((uint32_t)((7 << TWI_CT_PRSC0) | (15 << TWI_CT_CDIV0)));
+      ct |= (p << TWI_CT_PRSC0) | ((cdiv - 1) << TWI_CT_CDIV0);
+      TWI_CT = ct;
+      return 0;
+    }
+  }
+
+  return 1; // target frequency too low
+}
+
+
+/**********************************************************************//**
+ * Get TWI command/RX FIFO depth.
+ *
+ * @return FIFO depth (number of entries), determined by the TWI_FIFO generic.
+ **************************************************************************/
+uint32_t neorv32_twi_get_fifo_depth(void) {
+
+  uint32_t tmp = (TWI_CT >> TWI_CT_FIFO_LSB) & 0x0f;
+  return (uint32_t)(1 << tmp);
+}
+
+
+/**********************************************************************//**
+ * Configure TWI interrupt condition.
+ *
+ * @param[in] mode Interrupt mode: 0 = each completed data transfer, 1 = command FIFO empty and TWI idle.
+ **************************************************************************/
+void neorv32_twi_irq_config(uint8_t mode) {
+
+  uint32_t ct = TWI_CT;
+  ct &= ~((uint32_t)(1 << TWI_CT_IRQ_SEQ));
+  ct |= ((uint32_t)(mode & 0x01)) << TWI_CT_IRQ_SEQ;
+  TWI_CT = ct;
+}
+
+
+/**********************************************************************//**
+ * Get command word for a write/read transaction (helper function for neorv32_twi_xfer()).
+ *
+ * @param[in] i Index of the command within the transaction.
+ * @param[in] addr 7-bit device address.
+ * @param[in] wbuf Write data buffer.
+ * @param[in] wlen Number of bytes to write; a write phase is executed if wlen > 0 or rlen = 0.
+ * @param[in] rlen Number of bytes to read.
+ * @return Command word for TWI_DATA.
+ **************************************************************************/
+static uint32_t neorv32_twi_xfer_cmd(int i, uint8_t addr, const uint8_t *wbuf, int wlen, int rlen) {
+
+  const uint32_t cmd_start = 1 << TWI_DATA_CMD0;
+  const uint32_t cmd_stop  = 1 << TWI_DATA_CMD1;
+
+  // write phase: START, address + W, data
+  if ((wlen > 0) || (rlen == 0)) {
+    if (i == 0) {
+      return cmd_start;
+    }
+    if (i == 1) {
+      return ((uint32_t)addr << 1) | 0;
+    }
+    if (i < (wlen + 2)) {
+      return (uint32_t)wbuf[i-2];
+    }
+    i -= wlen + 2;
+  }
+
+  // read phase: (repeated) START, address + R, data
+  if (rlen > 0) {
+    if (i == 0) {
+      return cmd_start;
+    }
+    if (i == 1) {
+      return ((uint32_t)addr << 1) | 1;
+    }
+    if (i < (rlen + 2)) {
+      uint32_t cmd = 0xff | (1 << TWI_DATA_RX); // release SDA, sample data
+      if (i < (rlen + 1)) {
+        cmd |= 1 << TWI_DATA_MACK; // ACK all but the last byte
+      }
+      return cmd;
+    }
+  }
+
+  return cmd_stop;
+}
+
+
+/**********************************************************************//**
+ * Execute a complete TWI transaction: START, address + W, write data, repeated START,
+ * address + R, read data, STOP. The write phase is skipped if wlen is zero, the read phase
+ * is skipped if rlen is zero (if both are zero only the address is sent to probe the device).
+ * The command FIFO is kept filled while the RX FIFO is drained, so the bus is not idle between
+ * bytes.
+ *
+ * @note This function is blocking. The controller ACK (TWI_CT_MACK) is disabled during the transaction.
+ *
+ * @param[in] addr 7-bit device address.
+ * @param[in] wbuf Write data buffer (may be NULL if wlen is zero).
+ * @param[in] wlen Number of bytes to write.
+ * @param[in,out] rbuf Read data buffer (may be NULL if rlen is zero).
+ * @param[in] rlen Number of bytes to read.
+ * @return 0: success, 1: a byte was not acknowledged (NACK), -1: TWI not enabled.
+ **************************************************************************/
+int neorv32_twi_xfer(uint8_t addr, const uint8_t *wbuf, int wlen, uint8_t *rbuf, int rlen) {
+
+  uint32_t ct_cfg = TWI_CT, ct;
+  if ((ct_cfg & (1<<TWI_CT_EN)) == 0) {
+    return -1;
+  }
+
+  if (wlen < 0) {
+    wlen = 0;
+  }
+  if (rlen < 0) {
+    rlen = 0;
+  }
+
+  int depth = (int)neorv32_twi_get_fifo_depth();
+  int num = 1; // STOP
+  int cmd_cnt = 0, rd_cnt = 0, rx_cnt = 0;
+  int nack = 0;
+  uint32_t cmd, data;
+
+  if ((wlen > 0) || (rlen == 0)) {
+    num += wlen + 2;
+  }
+  if (rlen > 0) {
+    num += rlen + 2;
+  }
+
+  // discard stale data from previous transfers
+  while((TWI_CT & (1<<TWI_CT_BUSY)) != 0);
+  while ((TWI_CT & (1<<TWI_CT_RX_AVAIL)) != 0) {
+    data = TWI_DATA;
+  }
+
+  // disable controller ACK (ACKs are generated per byte); this also clears the sticky NACK flag
+  TWI_CT = ct_cfg & ~((uint32_t)(1 << TWI_CT_MACK));
+
+  while ((cmd_cnt < num) || (rx_cnt < rlen)) {
+
+    ct = TWI_CT;
+
+    // peripheral did not respond: the hardware discards the remaining commands and sends STOP
+    if (ct & (1<<TWI_CT_NACK)) {
+      nack = 1;
+      break;
+    }
+
+    // refill command FIFO; never have more read bytes in flight than the RX FIFO can hold
+    if ((cmd_cnt < num) && ((ct & (1<<TWI_CT_CMD_FULL)) == 0)) {
+      cmd = neorv32_twi_xfer_cmd(cmd_cnt, addr, wbuf, wlen, rlen);
+      if ((cmd & (1 << TWI_DATA_RX)) == 0) {
+        TWI_DATA = cmd;
+        cmd_cnt++;
+      }
+      else if ((rd_cnt - rx_cnt) < depth) {
+        TWI_DATA = cmd;
+        cmd_cnt++;
+        rd_cnt++;
+      }
+    }
+
+    // drain RX FIFO
+    if ((ct & (1<<TWI_CT_RX_AVAIL)) != 0) {
+      data = TWI_DATA;
+      if (rx_cnt < rlen) {
+        rbuf[rx_cnt++] = (uint8_t)data;
+      }
+    }
+  }
+
+  while((TWI_CT & (1<<TWI_CT_BUSY)) != 0); // wait until all commands are executed (or discarded)
+
+  if (TWI_CT & (1<<TWI_CT_NACK)) {
+    nack = 1;
+  }
+
+  // restore configuration (also clears the sticky NACK flag)
+  TWI_CT = ct_cfg;
+
+  return nack;
+}
@@ -49,9 +49,25 @@
 #include <stdarg.h>
 
 /// \cond
+// Private formatting context for 'printf' functions
+typedef struct {
+  void (*out)(const char *s, int len); // output function
+  char buf[32]; // output buffer
+  int  n; // output buffer fill level
+} __neorv32_uart_fmt_t;
+
 // Private functions
-static void __neorv32_uart_itoa(uint32_t x, char *res) __attribute__((unused)); // GCC: do not ouput a warning when this variable is unused
-static void __neorv32_uart_tohex(uint32_t x, char *res) __attribute__((unused)); // GCC: do not ouput a warning when this variable is unused
+static void __neorv32_uart_vprintf(void (*out)(const char *s, int len), const char *format, va_list a);
+static int  __neorv32_uart_utoa(uint32_t x, char *res);
+static int  __neorv32_uart_utohex(uint32_t x, char *res, int digits, const char *symbols);
+static uint32_t __neorv32_uart_baud_config(uint32_t baudrate);
+static uint32_t __neorv32_uart_udiv(uint32_t n, uint32_t d);
+static void __neorv32_uart0_out(const char *s, int len);
+static void __neorv32_uart1_out(const char *s, int len);
+
+// Private variables
+static char __neorv32_uart0_char_received = 0; // last char consumed by neorv32_uart0_char_received()
+static char __neorv32_uart1_char_received = 0; // last char consumed by neorv32_uart1_char_received()
 /// \endcond
 
 
@@ -78,7 +94,8 @@ int neorv32_uart_available(void) { return neorv32_uart0_available(); }
  * @note The 'UART0_SIM_MODE' compiler flag will configure UART0 for simulation mode: all UART0 TX data will be redirected to simulation output. Use this for simulations only!
  * @note To enable simulation mode add <USER_FLAGS+=-DUART0_SIM_MODE> when compiling.
  *
- * @warning The baud rate is computed using INTEGER operations (truncation errors might occur).
+ * @note The baud rate configuration is computed automatically: the high-speed mode (fractional baud generator with 16x or
+ * 8x oversampling) is used if possible, otherwise the standard mode (clock prescaler and 12-bit baud divider) is used.
  *
  * @param[in] baudrate Targeted BAUD rate (e.g. 9600).
  * @param[in] parity Parity configuration (00=off, 10=even, 11=odd), see #NEORV32_UART_PARITY_enum.
@@ -194,10 +211,21 @@ void neorv32_uart_print(const char *s) { neorv32_uart0_print(s); }
  * <TR><TD>%c</TD><TD>Single char</TD></TR>
  * <TR><TD>%i</TD><TD>32-bit signed number, printed as decimal</TD></TR>
  * <TR><TD>%u</TD><TD>32-bit unsigned number, printed as decimal</TD></TR>
- * <TR><TD>%x</TD><TD>32-bit number, printed as 8-char hexadecimal</TD></TR>
+ * <TR><TD>%x</TD><TD>32-bit number, printed as 8-char hexadecimal (lower case); as many chars as required if a width is specified</TD></TR>
+ * <TR><TD>%X</TD><TD>32-bit number, printed as 8-char hexadecimal (upper case); as many chars as required if a width is specified</TD></TR>
+ * <TR><TD>%p</TD><TD>Pointer, printed as 0x-prefixed 8-char hexadecimal</TD></TR>
+ * <TR><TD>%%</TD><TD>Single '%'</TD></TR>
  * </TABLE>
+ * Optional flags and field width: %[-][0][width], e.g. "%-8s", "%5u", "%08i", "%02x".
+ * Numbers are converted without any division operations.
  **************************************************************************/
-void neorv32_uart_printf(const char *format, ...) { neorv32_uart0_printf(format); }
+void neorv32_uart_printf(const char *format, ...) {
+
+  va_list a;
+  va_start(a, format);
+  __neorv32_uart_vprintf(__neorv32_uart0_out, format, a);
+  va_end(a);
+}
 
 
 /**********************************************************************//**
@@ -241,7 +269,8 @@ int neorv32_uart0_available(void) {
  * @note The 'UART0_SIM_MODE' compiler flag will configure UART0 for simulation mode: all UART0 TX data will be redirected to simulation output. Use this for simulations only!
  * @note To enable simulation mode add <USER_FLAGS+=-DUART0_SIM_MODE> when compiling.
  *
- * @warning The baud rate is computed using INTEGER operations (truncation errors might occur).
+ * @note The baud rate configuration is computed automatically: the high-speed mode (fractional baud generator with 16x or
+ * 8x oversampling) is used if possible, otherwise the standard mode (clock prescaler and 12-bit baud divider) is used.
  *
  * @param[in] baudrate Targeted BAUD rate (e.g. 9600).
  * @param[in] parity Parity configuration (00=off, 10=even, 11=odd), see #NEORV32_UART_PARITY_enum.
@@ -251,37 +280,7 @@ void neorv32_uart0_setup(uint32_t baudrate, uint8_t parity, uint8_t flow_con) {
 
   UART0_CT = 0; // reset
 
-  uint32_t clock = SYSINFO_CLK;
-  uint16_t i = 0; // BAUD rate divisor
-  uint8_t p = 0; // initial prsc = CLK/2
-
-  // raw clock prescaler
-#ifdef __riscv_div
-  // use div instructions
-  i = (uint16_t)(clock / (2*baudrate));
-#else
-  // division via repeated subtraction
-  while (clock >= 2*baudrate) {
-    clock -= 2*baudrate;
-    i++;
-  }
-#endif
-
-  // find baud prescaler (12-bit wide))
-  while (i >= 0x0fff) {
-    if ((p == 2) || (p == 4))
-      i >>= 3;
-    else
-      i >>= 1;
-    p++;
-  }
-
-  uint32_t clk_prsc = (uint32_t)p;
-  clk_prsc = clk_prsc << UART_CT_PRSC0;
-
-  uint32_t baud_prsc = (uint32_t)i;
-  baud_prsc = baud_prsc - 1;
-  baud_prsc = baud_prsc << UART_CT_BAUD00;
+  uint32_t baud_config = __neorv32_uart_baud_config(baudrate);
 
   uint32_t uart_en = 1;
   uart_en = uart_en << UART_CT_EN;
@@ -304,7 +303,7 @@ void neorv32_uart0_setup(uint32_t baudrate, uint8_t parity, uint8_t flow_con) {
   uint32_t sim_mode = 0;
 #endif
 
-  UART0_CT = clk_prsc | baud_prsc | uart_en | parity_config | sim_mode | flow_control;
+  UART0_CT = baud_config | uart_en | parity_config | sim_mode | flow_control;
 }
 
 
@@ -335,8 +334,8 @@ void neorv32_uart0_enable(void) {
  **************************************************************************/
 void neorv32_uart0_putc(char c) {
 
-  // wait for previous transfer to finish
-  while ((UART0_CT & (1<<UART_CT_TX_BUSY)) != 0);
+  // wait for a free entry in the TX FIFO
+  while ((UART0_CT & (1<<UART_CT_TX_FULL)) != 0);
   UART0_DATA = ((uint32_t)c) << UART_DATA_LSB;
 }
 
@@ -426,7 +425,9 @@ int neorv32_uart0_getc_safe(char *data) {
  **************************************************************************/
 int neorv32_uart0_char_received(void) {
 
-  if ((UART0_DATA & (1<<UART_DATA_AVAIL)) != 0) {
+  uint32_t d = UART0_DATA; // this removes the char from the RX FIFO
+  if ((d & (1<<UART_DATA_AVAIL)) != 0) {
+    __neorv32_uart0_char_received = (char)d; // buffer for neorv32_uart0_char_received_get()
     return 1;
   }
   else {
@@ -445,7 +446,7 @@ int neorv32_uart0_char_received(void) {
  **************************************************************************/
 char neorv32_uart0_char_received_get(void) {
 
-  return (char)UART0_DATA;
+  return __neorv32_uart0_char_received;
 }
 
 
@@ -480,58 +481,36 @@ void neorv32_uart0_print(const char *s) {
  * <TR><TD>%c</TD><TD>Single char</TD></TR>
  * <TR><TD>%i</TD><TD>32-bit signed number, printed as decimal</TD></TR>
  * <TR><TD>%u</TD><TD>32-bit unsigned number, printed as decimal</TD></TR>
- * <TR><TD>%x</TD><TD>32-bit number, printed as 8-char hexadecimal</TD></TR>
+ * <TR><TD>%x</TD><TD>32-bit number, printed as 8-char hexadecimal (lower case); as many chars as required if a width is specified</TD></TR>
+ * <TR><TD>%X</TD><TD>32-bit number, printed as 8-char hexadecimal (upper case); as many chars as required if a width is specified</TD></TR>
+ * <TR><TD>%p</TD><TD>Pointer, printed as 0x-prefixed 8-char hexadecimal</TD></TR>
+ * <TR><TD>%%</TD><TD>Single '%'</TD></TR>
  * </TABLE>
+ * Optional flags and field width: %[-][0][width], e.g. "%-8s", "%5u", "%08i", "%02x".
+ * Numbers are converted without any division operations.
  **************************************************************************/
 void neorv32_uart0_printf(const char *format, ...) {
 
-  char c, string_buf[11];
-  int32_t n;
-
   va_list a;
   va_start(a, format);
+  __neorv32_uart_vprintf(__neorv32_uart0_out, format, a);
+  va_end(a);
+}
 
-  while ((c = *format++)) {
-    if (c == '%') {
-      c = *format++;
-      switch (c) {
-        case 's': // string
-          neorv32_uart0_print(va_arg(a, char*));
-          break;
-        case 'c': // char
-          neorv32_uart0_putc((char)va_arg(a, int));
-          break;
-        case 'i': // 32-bit signed
-          n = (int32_t)va_arg(a, int32_t);
-          if (n < 0) {
-            n = -n;
-            neorv32_uart0_putc('-');
-          }
-          __neorv32_uart_itoa((uint32_t)n, string_buf);
-          neorv32_uart0_print(string_buf);
-          break;
-        case 'u': // 32-bit unsigned
-          __neorv32_uart_itoa(va_arg(a, uint32_t), string_buf);
-          neorv32_uart0_print(string_buf);
-          break;
-        case 'x': // 32-bit hexadecimal
-          __neorv32_uart_tohex(va_arg(a, uint32_t), string_buf);
-          neorv32_uart0_print(string_buf);
-          break;
-        default: // unsupported format
-          neorv32_uart0_putc('%');
-          neorv32_uart0_putc(c);
-          break;
-      }
-    }
-    else {
-      if (c == '\n') {
-        neorv32_uart0_putc('\r');
-      }
-      neorv32_uart0_putc(c);
-    }
+
+/**********************************************************************//**
+ * Private function: Output function for neorv32_uart0_printf().
+ *
+ * @note This function is blocking.
+ *
+ * @param[in] s Pointer to data.
+ * @param[in] len Number of bytes.
+ **************************************************************************/
+static void __neorv32_uart0_out(const char *s, int len) {
+
+  while (len--) {
+    neorv32_uart0_putc(*s++);
   }
-  va_end(a);
 }
 
 
@@ -578,6 +557,328 @@ int neorv32_uart0_scan(char *buffer, int max_size, int echo) {
 
 
 
+// #################################################################################################
+// Primary UART (UART0) - buffered, interrupt-driven mode
+// #################################################################################################
+
+/// \cond
+// Private ring buffers for buffered UART0 mode
+static char __neorv32_uart0_buf_tx_data[UART0_BUF_TX_SIZE];
+static char __neorv32_uart0_buf_rx_data[UART0_BUF_RX_SIZE];
+static volatile uint32_t __neorv32_uart0_buf_tx_head = 0; // write index (application)
+static volatile uint32_t __neorv32_uart0_buf_tx_tail = 0; // read index (TX interrupt handler)
+static volatile uint32_t __neorv32_uart0_buf_rx_head = 0; // write index (RX interrupt handler)
+static volatile uint32_t __neorv32_uart0_buf_rx_tail = 0; // read index (application)
+static volatile uint32_t __neorv32_uart0_buf_tx_dropped = 0; // TX bytes dropped (TX ring buffer full)
+static volatile uint32_t __neorv32_uart0_buf_rx_dropped = 0; // RX bytes dropped (RX ring buffer full or hardware overrun)
+static volatile uint32_t __neorv32_uart0_buf_enabled = 0; // buffered mode active
+
+static void __neorv32_uart0_buf_rx_irq(void);
+static void __neorv32_uart0_buf_tx_irq(void);
+static void __neorv32_uart0_buf_tx_kick(void);
+static void __neorv32_uart0_buf_putc(char c);
+static void __neorv32_uart0_buf_out(const char *s, int len);
+/// \endcond
+
+
+/**********************************************************************//**
+ * Enable buffered (interrupt-driven) mode for UART0.
+ *
+ * The UART0 RX and TX interrupt handlers are installed via the RTE. Received data is moved from the
+ * UART0 RX FIFO into a RAM ring buffer (UART0_BUF_RX_SIZE bytes) and data to be send is taken from a
+ * RAM ring buffer (UART0_BUF_TX_SIZE bytes) and moved into the UART0 TX FIFO.
+ *
+ * @note UART0 has to be configured via neorv32_uart0_setup() before and the RTE has to be initialized
+ * via neorv32_rte_setup(). Global machine interrupts have to be enabled by the application.
+ * @note All buffers and dropped-byte counters are reset.
+ *
+ * @return 0 if success, 1 if error.
+ **************************************************************************/
+int neorv32_uart0_buf_setup(void) {
+
+  neorv32_cpu_irq_disable(UART0_RX_FIRQ_ENABLE);
+  neorv32_cpu_irq_disable(UART0_TX_FIRQ_ENABLE);
+
+  __neorv32_uart0_buf_tx_head = 0;
+  __neorv32_uart0_buf_tx_tail = 0;
+  __neorv32_uart0_buf_rx_head = 0;
+  __neorv32_uart0_buf_rx_tail = 0;
+  __neorv32_uart0_buf_tx_dropped = 0;
+  __neorv32_uart0_buf_rx_dropped = 0;
+
+  // install interrupt handlers
+  int status = 0;
+  status += neorv32_rte_exception_install(UART0_RX_RTE_ID, __neorv32_uart0_buf_rx_irq);
+  status += neorv32_rte_exception_install(UART0_TX_RTE_ID, __neorv32_uart0_buf_tx_irq);
+  if (status) {
+    return 1;
+  }
+
+  // RX IRQ: RX FIFO not empty; TX IRQ: TX FIFO less than half-full
+  uint32_t ctrl = UART0_CT;
+  ctrl &= ~(1 << UART_CT_RX_IRQ);
+  ctrl |=  (1 << UART_CT_TX_IRQ);
+  UART0_CT = ctrl;
+
+  __neorv32_uart0_buf_rx_irq(); // fetch data that might have been received before
+
+  __neorv32_uart0_buf_enabled = 1;
+  neorv32_cpu_irq_enable(UART0_RX_FIRQ_ENABLE);
+  neorv32_cpu_irq_enable(UART0_TX_FIRQ_ENABLE);
+  return 0;
+}
+
+
+/**********************************************************************//**
+ * Disable buffered (interrupt-driven) mode for UART0.
+ *
+ * @note This only disables the UART0 fast interrupt channels. Data still pending in the TX ring buffer is discarded;
+ * buffered write functions do not re-enable the TX interrupt until neorv32_uart0_buf_setup() is called again.
+ **************************************************************************/
+void neorv32_uart0_buf_disable(void) {
+
+  __neorv32_uart0_buf_enabled = 0;
+  neorv32_cpu_irq_disable(UART0_RX_FIRQ_ENABLE);
+  neorv32_cpu_irq_disable(UART0_TX_FIRQ_ENABLE);
+
+  neorv32_rte_exception_uninstall(UART0_RX_RTE_ID);
+  neorv32_rte_exception_uninstall(UART0_TX_RTE_ID);
+}
+
+
+/**********************************************************************//**
+ * Send data via UART0 (buffered mode).
+ *
+ * @note This function is non-blocking. Data that does not fit into the TX ring buffer is dropped
+ * and counted (see neorv32_uart0_buf_get_tx_dropped()).
+ *
+ * @param[in] buf Pointer to data to be send.
+ * @param[in] len Number of bytes to be send.
+ * @return Number of bytes actually queued for transmission.
+ **************************************************************************/
+int neorv32_uart0_write(const char *buf, int len) {
+
+  int i;
+  uint32_t head = __neorv32_uart0_buf_tx_head;
+
+  for (i=0; i<len; i++) {
+    if ((head - __neorv32_uart0_buf_tx_tail) >= UART0_BUF_TX_SIZE) { // ring buffer full?
+      break;
+    }
+    __neorv32_uart0_buf_tx_data[head & (UART0_BUF_TX_SIZE-1)] = buf[i];
+    head++;
+  }
+  __neorv32_uart0_buf_tx_head = head;
+  __neorv32_uart0_buf_tx_dropped += (uint32_t)(len - i);
+
+  __neorv32_uart0_buf_tx_kick();
+  return i;
+}
+
+
+/**********************************************************************//**
+ * Get received data from UART0 (buffered mode).
+ *
+ * @note This function is non-blocking.
+ *
+ * @param[in,out] buf Pointer to buffer for storing received data.
+ * @param[in] len Maximum number of bytes to read.
+ * @return Number of bytes actually read.
+ **************************************************************************/
+int neorv32_uart0_read(char *buf, int len) {
+
+  int i;
+  uint32_t tail = __neorv32_uart0_buf_rx_tail;
+
+  for (i=0; i<len; i++) {
+    if (tail == __neorv32_uart0_buf_rx_head) { // ring buffer empty?
+      break;
+    }
+    buf[i] = __neorv32_uart0_buf_rx_data[tail & (UART0_BUF_RX_SIZE-1)];
+    tail++;
+  }
+  __neorv32_uart0_buf_rx_tail = tail;
+
+  return i;
+}
+
+
+/**********************************************************************//**
+ * Print string (zero-terminated) via UART0 (buffered mode). Print full line break "\r\n" for every '\n'.
+ *
+ * @note This function is non-blocking.
+ *
+ * @param[in] s Pointer to string.
+ **************************************************************************/
+void neorv32_uart0_buf_print(const char *s) {
+
+  char c = 0;
+  while ((c = *s++)) {
+    if (c == '\n') {
+      __neorv32_uart0_buf_putc('\r');
+    }
+    __neorv32_uart0_buf_putc(c);
+  }
+  __neorv32_uart0_buf_tx_kick();
+}
+
+
+/**********************************************************************//**
+ * Custom version of 'printf' function using UART0 (buffered mode).
+ *
+ * @note This function is non-blocking. The formatted string is written into the TX ring buffer;
+ * chars that do not fit are dropped and counted (see neorv32_uart0_buf_get_tx_dropped()).
+ *
+ * @param[in] format Pointer to format string. See neorv32_uart0_printf() for supported formats.
+ **************************************************************************/
+void neorv32_uart0_buf_printf(const char *format, ...) {
+
+  va_list a;
+  va_start(a, format);
+  __neorv32_uart_vprintf(__neorv32_uart0_buf_out, format, a);
+  va_end(a);
+}
+
+
+/**********************************************************************//**
+ * Private function: Output function for neorv32_uart0_buf_printf().
+ *
+ * @note This function is non-blocking.
+ *
+ * @param[in] s Pointer to data.
+ * @param[in] len Number of bytes.
+ **************************************************************************/
+static void __neorv32_uart0_buf_out(const char *s, int len) {
+
+  neorv32_uart0_write(s, len);
+}
+
+
+/**********************************************************************//**
+ * Get number of bytes waiting in the UART0 RX ring buffer (buffered mode).
+ *
+ * @return Number of bytes available for neorv32_uart0_read().
+ **************************************************************************/
+int neorv32_uart0_buf_rx_available(void) {
+
+  return (int)(__neorv32_uart0_buf_rx_head - __neorv32_uart0_buf_rx_tail);
+}
+
+
+/**********************************************************************//**
+ * Get number of free bytes in the UART0 TX ring buffer (buffered mode).
+ *
+ * @return Number of bytes that can be written via neorv32_uart0_write() without dropping data.
+ **************************************************************************/
+int neorv32_uart0_buf_tx_free(void) {
+
+  return (int)(UART0_BUF_TX_SIZE - (__neorv32_uart0_buf_tx_head - __neorv32_uart0_buf_tx_tail));
+}
+
+
+/**********************************************************************//**
+ * Get number of dropped TX bytes (buffered mode).
+ *
+ * @return Number of bytes that were dropped since the TX ring buffer was full.
+ **************************************************************************/
+uint32_t neorv32_uart0_buf_get_tx_dropped(void) {
+
+  return __neorv32_uart0_buf_tx_dropped;
+}
+
+
+/**********************************************************************//**
+ * Get number of dropped RX bytes (buffered mode).
+ *
+ * @return Number of bytes that were dropped since the RX ring buffer was full (or the hardware RX FIFO overflowed).
+ **************************************************************************/
+uint32_t neorv32_uart0_buf_get_rx_dropped(void) {
+
+  return __neorv32_uart0_buf_rx_dropped;
+}
+
+
+/**********************************************************************//**
+ * Private function: Put single char into the UART0 TX ring buffer. Does not start the transmission.
+ *
+ * @param[in] c Char to be send.
+ **************************************************************************/
+static void __neorv32_uart0_buf_putc(char c) {
+
+  uint32_t head = __neorv32_uart0_buf_tx_head;
+
+  if ((head - __neorv32_uart0_buf_tx_tail) >= UART0_BUF_TX_SIZE) { // ring buffer full?
+    __neorv32_uart0_buf_tx_dropped++;
+  }
+  else {
+    __neorv32_uart0_buf_tx_data[head & (UART0_BUF_TX_SIZE-1)] = c;
+    __neorv32_uart0_buf_tx_head = head + 1;
+  }
+}
+
+
+/**********************************************************************//**
+ * Private function: Move data from the UART0 TX ring buffer into the UART0 TX FIFO.
+ * The TX interrupt is only triggered by a TX FIFO level change, so this has to be
+ * called by the application after new data has been queued.
+ **************************************************************************/
+static void __neorv32_uart0_buf_tx_kick(void) {
+
+  if (__neorv32_uart0_buf_enabled == 0) { // buffered mode not (or no longer) active
+    return;
+  }
+
+  neorv32_cpu_irq_disable(UART0_TX_FIRQ_ENABLE); // make sure the TX handler is not interfering
+  __neorv32_uart0_buf_tx_irq();
+  neorv32_cpu_irq_enable(UART0_TX_FIRQ_ENABLE);
+}
+
+
+/**********************************************************************//**
+ * Private function: UART0 RX interrupt handler (buffered mode). Move all data from the UART0 RX FIFO
+ * into the RX ring buffer.
+ **************************************************************************/
+static void __neorv32_uart0_buf_rx_irq(void) {
+
+  uint32_t d, head = __neorv32_uart0_buf_rx_head;
+
+  while (1) {
+    d = UART0_DATA; // get data from RX FIFO
+    if ((d & (1<<UART_DATA_AVAIL)) == 0) { // RX FIFO empty
+      break;
+    }
+    if (d & (1<<UART_DATA_OVERR)) { // hardware RX FIFO overflow
+      __neorv32_uart0_buf_rx_dropped++;
+    }
+    if ((head - __neorv32_uart0_buf_rx_tail) >= UART0_BUF_RX_SIZE) { // ring buffer full?
+      __neorv32_uart0_buf_rx_dropped++;
+    }
+    else {
+      __neorv32_uart0_buf_rx_data[head & (UART0_BUF_RX_SIZE-1)] = (char)d;
+      head++;
+    }
+  }
+  __neorv32_uart0_buf_rx_head = head;
+}
+
+
+/**********************************************************************//**
+ * Private function: UART0 TX interrupt handler (buffered mode). Move data from the TX ring buffer
+ * into the UART0 TX FIFO until the TX FIFO is full or the ring buffer is empty.
+ **************************************************************************/
+static void __neorv32_uart0_buf_tx_irq(void) {
+
+  uint32_t tail = __neorv32_uart0_buf_tx_tail;
+
+  while ((tail != __neorv32_uart0_buf_tx_head) && ((UART0_CT & (1<<UART_CT_TX_FULL)) == 0)) {
+    UART0_DATA = ((uint32_t)__neorv32_uart0_buf_tx_data[tail & (UART0_BUF_TX_SIZE-1)]) << UART_DATA_LSB;
+    tail++;
+  }
+  __neorv32_uart0_buf_tx_tail = tail;
+}
+
+
+
 // #################################################################################################
 // Secondary UART (UART1)
 // #################################################################################################
@@ -604,7 +905,8 @@ int neorv32_uart1_available(void) {
  * @note The 'UART1_SIM_MODE' compiler flag will configure UART1 for simulation mode: all UART1 TX data will be redirected to simulation output. Use this for simulations only!
  * @note To enable simulation mode add <USER_FLAGS+=-DUART1_SIM_MODE> when compiling.
  *
- * @warning The baud rate is computed using INTEGER operations (truncation errors might occur).
+ * @note The baud rate configuration is computed automatically: the high-speed mode (fractional baud generator with 16x or
+ * 8x oversampling) is used if possible, otherwise the standard mode (clock prescaler and 12-bit baud divider) is used.
  *
  * @param[in] baudrate Targeted BAUD rate (e.g. 9600).
  * @param[in] parity Parity configuration (00=off, 10=even, 11=odd), see #NEORV32_UART_PARITY_enum.
@@ -614,37 +916,7 @@ void neorv32_uart1_setup(uint32_t baudrate, uint8_t parity, uint8_t flow_con) {
 
   UART1_CT = 0; // reset
 
-  uint32_t clock = SYSINFO_CLK;
-  uint16_t i = 0; // BAUD rate divisor
-  uint8_t p = 0; // initial prsc = CLK/2
-
-  // raw clock prescaler
-#ifdef __riscv_div
-  // use div instructions
-  i = (uint16_t)(clock / (2*baudrate));
-#else
-  // division via repeated subtraction
-  while (clock >= 2*baudrate) {
-    clock -= 2*baudrate;
-    i++;
-  }
-#endif
-
-  // find baud prescaler (12-bit wide))
-  while (i >= 0x0fff) {
-    if ((p == 2) || (p == 4))
-      i >>= 3;
-    else
-      i >>= 1;
-    p++;
-  }
-
-  uint32_t clk_prsc = (uint32_t)p;
-  clk_prsc = clk_prsc << UART_CT_PRSC0;
-
-  uint32_t baud_prsc = (uint32_t)i;
-  baud_prsc = baud_prsc - 1;
-  baud_prsc = baud_prsc << UART_CT_BAUD00;
+  uint32_t baud_config = __neorv32_uart_baud_config(baudrate);
 
   uint32_t uart_en = 1;
   uart_en = uart_en << UART_CT_EN;
@@ -664,7 +936,7 @@ void neorv32_uart1_setup(uint32_t baudrate, uint8_t parity, uint8_t flow_con) {
   uint32_t sim_mode = 0;
 #endif
 
-  UART1_CT = clk_prsc | baud_prsc | uart_en | parity_config | sim_mode | flow_control;
+  UART1_CT = baud_config | uart_en | parity_config | sim_mode | flow_control;
 }
 
 
@@ -695,8 +967,8 @@ void neorv32_uart1_enable(void) {
  **************************************************************************/
 void neorv32_uart1_putc(char c) {
 
-  // wait for previous transfer to finish
-  while ((UART1_CT & (1<<UART_CT_TX_BUSY)) != 0);
+  // wait for a free entry in the TX FIFO
+  while ((UART1_CT & (1<<UART_CT_TX_FULL)) != 0);
   UART1_DATA = ((uint32_t)c) << UART_DATA_LSB;
 }
 
@@ -786,7 +1058,9 @@ int neorv32_uart1_getc_safe(char *data) {
  **************************************************************************/
 int neorv32_uart1_char_received(void) {
 
-  if ((UART1_DATA & (1<<UART_DATA_AVAIL)) != 0) {
+  uint32_t d = UART1_DATA; // this removes the char from the RX FIFO
+  if ((d & (1<<UART_DATA_AVAIL)) != 0) {
+    __neorv32_uart1_char_received = (char)d; // buffer for neorv32_uart1_char_received_get()
     return 1;
   }
   else {
@@ -805,7 +1079,7 @@ int neorv32_uart1_char_received(void) {
  **************************************************************************/
 char neorv32_uart1_char_received_get(void) {
 
-  return (char)UART1_DATA;
+  return __neorv32_uart1_char_received;
 }
 
 
@@ -840,58 +1114,36 @@ void neorv32_uart1_print(const char *s) {
  * <TR><TD>%c</TD><TD>Single char</TD></TR>
  * <TR><TD>%i</TD><TD>32-bit signed number, printed as decimal</TD></TR>
  * <TR><TD>%u</TD><TD>32-bit unsigned number, printed as decimal</TD></TR>
- * <TR><TD>%x</TD><TD>32-bit number, printed as 8-char hexadecimal</TD></TR>
+ * <TR><TD>%x</TD><TD>32-bit number, printed as 8-char hexadecimal (lower case); as many chars as required if a width is specified</TD></TR>
+ * <TR><TD>%X</TD><TD>32-bit number, printed as 8-char hexadecimal (upper case); as many chars as required if a width is specified</TD></TR>
+ * <TR><TD>%p</TD><TD>Pointer, printed as 0x-prefixed 8-char hexadecimal</TD></TR>
+ * <TR><TD>%%</TD><TD>Single '%'</TD></TR>
  * </TABLE>
+ * Optional flags and field width: %[-][0][width], e.g. "%-8s", "%5u", "%08i", "%02x".
+ * Numbers are converted without any division operations.
  **************************************************************************/
 void neorv32_uart1_printf(const char *format, ...) {
 
-  char c, string_buf[11];
-  int32_t n;
-
   va_list a;
   va_start(a, format);
+  __neorv32_uart_vprintf(__neorv32_uart1_out, format, a);
+  va_end(a);
+}
 
-  while ((c = *format++)) {
-    if (c == '%') {
-      c = *format++;
-      switch (c) {
-        case 's': // string
-          neorv32_uart1_print(va_arg(a, char*));
-          break;
-        case 'c': // char
-          neorv32_uart1_putc((char)va_arg(a, int));
-          break;
-        case 'i': // 32-bit signed
-          n = (int32_t)va_arg(a, int32_t);
-          if (n < 0) {
-            n = -n;
-            neorv32_uart1_putc('-');
-          }
-          __neorv32_uart_itoa((uint32_t)n, string_buf);
-          neorv32_uart1_print(string_buf);
-          break;
-        case 'u': // 32-bit unsigned
-          __neorv32_uart_itoa(va_arg(a, uint32_t), string_buf);
-          neorv32_uart1_print(string_buf);
-          break;
-        case 'x': // 32-bit hexadecimal
-          __neorv32_uart_tohex(va_arg(a, uint32_t), string_buf);
-          neorv32_uart1_print(string_buf);
-          break;
-        default: // unsupported format
-          neorv32_uart1_putc('%');
-          neorv32_uart1_putc(c);
-          break;
-      }
-    }
-    else {
-      if (c == '\n') {
-        neorv32_uart1_putc('\r');
-      }
-      neorv32_uart1_putc(c);
-    }
+
+/**********************************************************************//**
+ * Private function: Output function for neorv32_uart1_printf().
+ *
+ * @note This function is blocking.
+ *
+ * @param[in] s Pointer to data.
+ * @param[in] len Number of bytes.
+ **************************************************************************/
+static void __neorv32_uart1_out(const char *s, int len) {
+
+  while (len--) {
+    neorv32_uart1_putc(*s++);
   }
-  va_end(a);
 }
 
 
@@ -943,60 +1195,307 @@ int neorv32_uart1_scan(char *buffer, int max_size, int echo) {
 // #################################################################################################
 
 /**********************************************************************//**
- * Private function for 'neorv32_printf' to convert into decimal.
+ * Private function: Append char to formatting output buffer; flush buffer if full.
  *
- * @param[in] x Unsigned input number.
- * @param[in,out] res Pointer for storing the reuslting number string (11 chars).
+ * @param[in,out] f Pointer to formatting context.
+ * @param[in] c Char to append.
  **************************************************************************/
-static void __neorv32_uart_itoa(uint32_t x, char *res) {
+static inline void __neorv32_uart_fmt_putc(__neorv32_uart_fmt_t *f, char c) {
 
-  static const char numbers[] = "0123456789";
-  char buffer1[11];
-  uint16_t i, j;
+  f->buf[f->n++] = c;
+  if (f->n == (int)sizeof(f->buf)) {
+    f->out(f->buf, f->n);
+    f->n = 0;
+  }
+}
 
-  buffer1[10] = '\0';
-  res[10] = '\0';
 
-  // convert
-  for (i=0; i<10; i++) {
-    buffer1[i] = numbers[x%10];
-    x /= 10;
-  }
+/**********************************************************************//**
+ * Private function: Append char multiple times to formatting output buffer.
+ *
+ * @param[in,out] f Pointer to formatting context.
+ * @param[in] c Char to append.
+ * @param[in] num Number of times to append c (nothing is appended if num <= 0).
+ **************************************************************************/
+static void __neorv32_uart_fmt_fill(__neorv32_uart_fmt_t *f, char c, int num) {
 
-  // delete 'leading' zeros
-  for (i=9; i!=0; i--) {
-    if (buffer1[i] == '0')
-      buffer1[i] = '\0';
-    else
-      break;
+  while (num-- > 0) {
+    __neorv32_uart_fmt_putc(f, c);
   }
+}
 
-  // reverse
-  j = 0;
-  do {
-    if (buffer1[i] != '\0')
-      res[j++] = buffer1[i];
-  } while (i--);
 
-  res[j] = '\0'; // terminate result string
+/**********************************************************************//**
+ * Private formatting core for all 'printf' functions. The complete output is formatted in one pass
+ * into a small local buffer, which is handed over to the output function whenever it is full.
+ *
+ * Format specifiers: %[-][0][width]<conversion>
+ * <TABLE>
+ * <TR><TD>-</TD><TD>Left-align within width (pad with spaces)</TD></TR>
+ * <TR><TD>0</TD><TD>Pad with zeros instead of spaces (right-aligned numbers only)</TD></TR>
+ * <TR><TD>width</TD><TD>Minimum field width (decimal)</TD></TR>
+ * </TABLE>
+ *
+ * @param[in] out Output function (gets pointer to data and number of bytes).
+ * @param[in] format Pointer to format string.
+ * @param[in] a Argument list.
+ **************************************************************************/
+static void __neorv32_uart_vprintf(void (*out)(const char *s, int len), const char *format, va_list a) {
+
+  static const char hex_lower[] = "0123456789abcdef";
+  static const char hex_upper[] = "0123456789ABCDEF";
+
+  __neorv32_uart_fmt_t f;
+  char c, pad, sign, num[11];
+  const char *s, *prefix;
+  int len, width, left, expand;
+  int32_t n;
+
+  f.out = out;
+  f.n = 0;
+
+  while ((c = *format++)) {
+
+    if (c != '%') { // plain char
+      if (c == '\n') {
+        __neorv32_uart_fmt_putc(&f, '\r');
+      }
+      __neorv32_uart_fmt_putc(&f, c);
+      continue;
+    }
+
+    // flags and field width
+    left = 0;
+    pad = ' ';
+    width = 0;
+    if (*format == '-') {
+      left = 1;
+      format++;
+    }
+    if (*format == '0') {
+      pad = '0';
+      format++;
+    }
+    while ((*format >= '0') && (*format <= '9')) {
+      width = (width << 3) + (width << 1) + (*format++ - '0'); // width*10 without multiplication
+    }
+
+    // conversion
+    s = num;
+    len = 0;
+    sign = 0;
+    prefix = "";
+    expand = 0;
+    c = *format++;
+    switch (c) {
+      case 's': // string
+        s = va_arg(a, char*);
+        while (s[len] != '\0') {
+          len++;
+        }
+        expand = 1;
+        break;
+      case 'c': // char
+        num[0] = (char)va_arg(a, int);
+        len = 1;
+        break;
+      case 'i': // 32-bit signed
+        n = (int32_t)va_arg(a, int32_t);
+        if (n < 0) {
+          sign = '-';
+          len = __neorv32_uart_utoa(0 - (uint32_t)n, num);
+        }
+        else {
+          len = __neorv32_uart_utoa((uint32_t)n, num);
+        }
+        break;
+      case 'u': // 32-bit unsigned
+        len = __neorv32_uart_utoa(va_arg(a, uint32_t), num);
+        break;
+      case 'x': // 32-bit hexadecimal (8 digits if no width is specified)
+      case 'X':
+        len = __neorv32_uart_utohex(va_arg(a, uint32_t), num, (width == 0) ? 8 : 0, (c == 'x') ? hex_lower : hex_upper);
+        break;
+      case 'p': // pointer
+        prefix = "0x";
+        len = __neorv32_uart_utohex((uint32_t)va_arg(a, void*), num, 8, hex_lower);
+        break;
+      case '%': // escaped '%'
+        num[0] = '%';
+        len = 1;
+        break;
+      case '\0': // incomplete specifier at end of format string
+        format--;
+        __neorv32_uart_fmt_putc(&f, '%');
+        continue;
+      default: // unsupported format
+        __neorv32_uart_fmt_putc(&f, '%');
+        __neorv32_uart_fmt_putc(&f, c);
+        continue;
+    }
+
+    // padding
+    width -= len + (sign != 0) + ((prefix[0] != '\0') ? 2 : 0);
+    if ((left == 0) && (pad == ' ')) {
+      __neorv32_uart_fmt_fill(&f, ' ', width);
+    }
+    if (sign) {
+      __neorv32_uart_fmt_putc(&f, sign);
+    }
+    while (*prefix) {
+      __neorv32_uart_fmt_putc(&f, *prefix++);
+    }
+    if ((left == 0) && (pad == '0')) {
+      __neorv32_uart_fmt_fill(&f, '0', width);
+    }
+    while (len--) {
+      if ((expand) && (*s == '\n')) {
+        __neorv32_uart_fmt_putc(&f, '\r');
+      }
+      __neorv32_uart_fmt_putc(&f, *s++);
+    }
+    if (left) {
+      __neorv32_uart_fmt_fill(&f, ' ', width);
+    }
+  }
+
+  if (f.n) { // flush remaining data
+    f.out(f.buf, f.n);
+  }
 }
 
 
 /**********************************************************************//**
- * Private function for 'neorv32_printf' to convert into hexadecimal.
+ * Private function for 'printf' to convert into decimal. Division-free: each digit is determined
+ * by subtracting the according power of ten (max. 9 subtractions per digit), which is much faster than
+ * a (software) division on cores without M extension.
  *
  * @param[in] x Unsigned input number.
- * @param[in,out] res Pointer for storing the resulting number string (9 chars).
+ * @param[in,out] res Pointer for storing the resulting number string (not terminated, max 10 chars).
+ * @return Number of chars.
  **************************************************************************/
-static void __neorv32_uart_tohex(uint32_t x, char *res) {
+static int __neorv32_uart_utoa(uint32_t x, char *res) {
+
+  static const uint32_t pow10[9] = {1000000000, 100000000, 10000000, 1000000, 100000, 10000, 1000, 100, 10};
+
+  int i, len = 0;
+  char d;
+
+  for (i=0; i<9; i++) {
+    d = '0';
+    while (x >= pow10[i]) {
+      x -= pow10[i];
+      d++;
+    }
+    if ((d != '0') || (len != 0)) { // skip leading zeros
+      res[len++] = d;
+    }
+  }
+  res[len++] = '0' + (char)x; // last digit is the remainder
+
+  return len;
+}
 
-  static const char symbols[] = "0123456789abcdef";
+
+/**********************************************************************//**
+ * Private function for 'printf' to convert into hexadecimal.
+ *
+ * @param[in] x Unsigned input number.
+ * @param[in,out] res Pointer for storing the resulting number string (not terminated, max 8 chars).
+ * @param[in] digits Number of digits (1..8); 0 = as many as required.
+ * @param[in] symbols Pointer to hex symbol table (lower or upper case).
+ * @return Number of chars.
+ **************************************************************************/
+static int __neorv32_uart_utohex(uint32_t x, char *res, int digits, const char *symbols) {
 
   int i;
-  for (i=0; i<8; i++) { // nibble by nibble
-    uint32_t num_tmp = x >> (4*i);
-    res[7-i] = (char)symbols[num_tmp & 0x0f];
+
+  if (digits == 0) { // minimum number of digits
+    digits = 1;
+    while ((digits < 8) && ((x >> (4*digits)) != 0)) {
+      digits++;
+    }
   }
 
-  res[8] = '\0'; // terminate result string
+  for (i=digits-1; i>=0; i--) { // nibble by nibble
+    res[i] = symbols[x & 0x0f];
+    x >>= 4;
+  }
+
+  return digits;
+}
+
+
+/**********************************************************************//**
+ * Private function: Compute the UART baud rate configuration for a given baud rate.
+ *
+ * The high-speed mode (fractional baud generator) is used if the required oversampling divider fits
+ * its range (1.0 .. 255.9375): 16x oversampling is preferred, 8x oversampling is used for very high
+ * baud rates. Otherwise (low baud rates) the standard mode with clock prescaler is used.
+ *
+ * @param[in] baudrate Targeted BAUD rate (e.g. 9600).
+ * @return UART control register bits (UART_CT_BAUDxx, UART_CT_PRSCx and UART_CT_HS_EN).
+ **************************************************************************/
+static uint32_t __neorv32_uart_baud_config(uint32_t baudrate) {
+
+  uint32_t clock = SYSINFO_CLK;
+  uint32_t div;
+
+  // high-speed mode, 16x oversampling: divider (4 fractional bits) = (clock / (16 * baudrate)) * 16
+  div = __neorv32_uart_udiv(clock + (baudrate >> 1), baudrate); // rounded
+  if ((div >= 0x010) && (div <= 0xfff)) {
+    return (1 << UART_CT_HS_EN) | (div << UART_CT_BAUD00);
+  }
+
+  // high-speed mode, 8x oversampling: divider (4 fractional bits) = (clock / (8 * baudrate)) * 16
+  if (div < 0x010) {
+    div = __neorv32_uart_udiv((clock << 1) + (baudrate >> 1), baudrate); // rounded
+    if (div < 0x010) { // baud rate too high: use highest possible baud rate (clock / 8)
+      div = 0x010;
+    }
+    return (1 << UART_CT_HS_EN) | (1 << UART_CT_PRSC0) | (div << UART_CT_BAUD00);
+  }
+
+  // standard mode: raw clock prescaler
+  uint32_t i = __neorv32_uart_udiv(clock, 2*baudrate); // BAUD rate divisor
+  uint32_t p = 0; // initial prsc = CLK/2
+
+  // find baud prescaler (12-bit wide))
+  while (i >= 0x0fff) {
+    if ((p == 2) || (p == 4))
+      i >>= 3;
+    else
+      i >>= 1;
+    p++;
+  }
+
+  return (p << UART_CT_PRSC0) | ((i - 1) << UART_CT_BAUD00);
+}
+
+
+/**********************************************************************//**
+ * Private function: Unsigned 32-bit division (shift-and-subtract if there is no hardware divider).
+ *
+ * @param[in] n Dividend.
+ * @param[in] d Divisor (must not be zero).
+ * @return Quotient.
+ **************************************************************************/
+static uint32_t __neorv32_uart_udiv(uint32_t n, uint32_t d) {
+
+#ifdef __riscv_div
+  // use div instructions
+  return n / d;
+#else
+  uint32_t q = 0, r = 0;
+  int i;
+
+  for (i=31; i>=0; i--) {
+    r = (r << 1) | ((n >> i) & 1);
+    if (r >= d) {
+      r -= d;
+      q |= (uint32_t)1 << i;
+    }
+  }
+  return q;
+#endif
 }
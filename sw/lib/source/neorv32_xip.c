@@ -0,0 +1,158 @@
+// #################################################################################################
+// # << NEORV32: neorv32_xip.c - Execute In Place Flash Controller HW Driver >>                    #
+// # ********************************************************************************************* #
+// # BSD 3-Clause License                                                                          #
+// #                                                                                               #
+// # Copyright (c) 2021, Stephan Nolting. All rights reserved.                                     #
+// #                                                                                               #
+// # Redistribution and use in source and binary forms, with or without modification, are          #
+// # permitted provided that the following conditions are met:                                     #
+// #                                                                                               #
+// # 1. Redistributions of source code must retain the above copyright notice, this list of        #
+// #    conditions and the following disclaimer.                                                   #
+// #                                                                                               #
+// # 2. Redistributions in binary form must reproduce the above copyright notice, this list of     #
+// #    conditions and the following disclaimer in the documentation and/or other materials        #
+// #    provided with the distribution.                                                            #
+// #                                                                                               #
+// # 3. Neither the name of the copyright holder nor the names of its contributors may be used to  #
+// #    endorse or promote products derived from this software without specific prior written      #
+// #    permission.                                                                                #
+// #                                                                                               #
+// # THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS   #
+// # OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF               #
+// # MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE    #
+// # COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,     #
+// # EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE #
+// # GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED    #
+// # AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING     #
+// # NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED  #
+// # OF THE POSSIBILITY OF SUCH DAMAGE.                                                            #
+// # ********************************************************************************************* #
+// # The NEORV32 Processor - https://github.com/stnolting/neorv32              (c) Stephan Nolting #
+
+
+/**********************************************************************//**
+ * @file neorv32_xip.c
+ * @author Stephan Nolting
+ * @brief Execute In Place Flash Controller HW driver source file.
+ *
+ * @note These functions should only be used if the XIP unit was synthesized (XIP_EN = true).
+ **************************************************************************/
+
+#include "neorv32.h"
+#include "neorv32_xip.h"
+
+
+/**********************************************************************//**
+ * Configure XIP controller. XIP (memory-mapped) access is disabled afterwards,
+ * so the controller is in direct SPI mode.
+ *
+ * @note Quad read modes require the flash's "quad enable" (QE) configuration bit to be set
+ * (vendor-specific, use the direct SPI mode to program it).
+ *
+ * @param[in] prsc Clock prescaler select (0..7). See #NEORV32_CLOCK_PRSC_enum.
+ * @param[in] mode Read mode (0..3). See #NEORV32_XIP_MODE_enum.
+ * @param[in] cmd Flash read command (e.g. 0x0B, 0x3B, 0x6B, 0xEB).
+ * @param[in] dummy Number of dummy clock cycles after the address (0..15). In quad I/O mode the first two dummy clocks are used for the mode bits.
+ **************************************************************************/
+void neorv32_xip_setup(uint8_t prsc, uint8_t mode, uint8_t cmd, uint8_t dummy) {
+
+  XIP_CT = 0; // reset, abort a running burst
+
+  uint32_t ct_prsc = (uint32_t)(prsc & 0x07);
+  ct_prsc = ct_prsc << XIP_CT_PRSC0;
+
+  uint32_t ct_mode = (uint32_t)(mode & 0x03);
+  ct_mode = ct_mode << XIP_CT_MODE0;
+
+  uint32_t ct_dummy = (uint32_t)(dummy & 0x0f);
+  ct_dummy = ct_dummy << XIP_CT_DUMMY0;
+
+  uint32_t ct_cmd = (uint32_t)cmd;
+  ct_cmd = ct_cmd << XIP_CT_CMD_LSB;
+
+  XIP_CT = ct_prsc | ct_mode | ct_dummy | ct_cmd;
+}
+
+
+/**********************************************************************//**
+ * Enable memory-mapped flash access (XIP_MEM_BASE).
+ *
+ * @param[in] burst Allow burst continuation of sequential accesses if not zero.
+ **************************************************************************/
+void neorv32_xip_start(uint8_t burst) {
+
+  while (neorv32_xip_busy()); // wait for direct transfer to finish
+
+  uint32_t ct = XIP_CT;
+  ct &= ~((uint32_t)((1 << XIP_CT_BURST) | (1 << XIP_CT_DCS))); // chip-select is controlled by the XIP engine now
+  if (burst) {
+    ct |= 1 << XIP_CT_BURST;
+  }
+  ct |= 1 << XIP_CT_EN;
+  XIP_CT = ct;
+}
+
+
+/**********************************************************************//**
+ * Disable memory-mapped flash access, switch to direct SPI mode.
+ *
+ * @warning Do not call this function from code that is executed from the XIP flash window!
+ **************************************************************************/
+void neorv32_xip_stop(void) {
+
+  XIP_CT &= ~((uint32_t)(1 << XIP_CT_EN)); // terminates a pending burst
+  while (neorv32_xip_busy());
+}
+
+
+/**********************************************************************//**
+ * Check if XIP serial engine is busy.
+ *
+ * @return 0 if idle, 1 if busy.
+ **************************************************************************/
+int neorv32_xip_busy(void) {
+
+  if ((XIP_CT & (1<<XIP_CT_BUSY)) != 0) {
+    return 1;
+  }
+  else {
+    return 0;
+  }
+}
+
+
+/**********************************************************************//**
+ * Direct SPI mode: Assert flash chip-select (active-low).
+ **************************************************************************/
+void neorv32_xip_cs_en(void) {
+
+  XIP_CT |= (uint32_t)(1 << XIP_CT_DCS);
+}
+
+
+/**********************************************************************//**
+ * Direct SPI mode: Deassert flash chip-select.
+ **************************************************************************/
+void neorv32_xip_cs_dis(void) {
+
+  XIP_CT &= ~((uint32_t)(1 << XIP_CT_DCS));
+}
+
+
+/**********************************************************************//**
+ * Direct SPI mode: Transfer a single byte (blocking, standard SPI mode 0).
+ *
+ * @note XIP has to be disabled (see neorv32_xip_stop(void)).
+ *
+ * @param[in] tx_data Byte to be send.
+ * @return Received byte.
+ **************************************************************************/
+uint8_t neorv32_xip_spi_trans(uint8_t tx_data) {
+
+  XIP_DATA = (uint32_t)tx_data; // trigger transfer
+  while (neorv32_xip_busy()); // wait for current transfer to finish
+
+  return (uint8_t)XIP_DATA;
+}